@@ -0,0 +1,62 @@
+#include "DisjointSets.h"
+
+#include <numeric>
+
+DisjointSets::DisjointSets(uint64_t numElements)
+    : _parents(numElements)
+{
+    std::iota(_parents.begin(), _parents.end(), 0);
+}
+
+uint64_t DisjointSets::find(uint64_t element)
+{
+    //path halving
+    while (_parents[element] != element) {
+        _parents[element] = _parents[_parents[element]];
+        element = _parents[element];
+    }
+    return element;
+}
+
+void DisjointSets::unite(uint64_t element1, uint64_t element2)
+{
+    auto root1 = find(element1);
+    auto root2 = find(element2);
+
+    //the smaller element becomes the root so that roots are the smallest elements of their sets
+    if (root1 < root2) {
+        _parents[root2] = root1;
+    } else if (root2 < root1) {
+        _parents[root1] = root2;
+    }
+}
+
+auto DisjointSets::getSets() -> Sets
+{
+    auto numElements = _parents.size();
+
+    //counting sort by set index
+    std::vector<uint64_t> setIndices(numElements);
+    std::vector<uint64_t> setSizes;
+    for (uint64_t element = 0; element < numElements; ++element) {
+        auto root = find(element);
+        if (root == element) {
+            setIndices[element] = setSizes.size();
+            setSizes.emplace_back(0);
+        } else {
+            setIndices[element] = setIndices[root];
+        }
+        ++setSizes[setIndices[element]];
+    }
+
+    Sets result;
+    result.offsets.resize(setSizes.size() + 1, 0);
+    std::partial_sum(setSizes.begin(), setSizes.end(), result.offsets.begin() + 1);
+
+    result.elements.resize(numElements);
+    auto insertPositions = result.offsets;
+    for (uint64_t element = 0; element < numElements; ++element) {
+        result.elements[insertPositions[setIndices[element]]++] = element;
+    }
+    return result;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * Union-find over the elements 0, ..., n-1 stored in flat arrays.
+ * Used to group connected cells into clusters in almost linear time.
+ */
+class DisjointSets
+{
+public:
+    DisjointSets(uint64_t numElements);
+
+    uint64_t find(uint64_t element);
+    void unite(uint64_t element1, uint64_t element2);
+
+    //elements of each set are stored consecutively in ascending order, sets are ordered by their smallest element
+    struct Sets
+    {
+        std::vector<uint64_t> offsets;  //numSets + 1 entries
+        std::vector<uint64_t> elements;
+    };
+    Sets getSets();
+
+private:
+    std::vector<uint64_t> _parents;
+};
@@ -7,18 +7,24 @@
 
 _FileLogger::_FileLogger()
 {
-    LoggingService::getInstance().registerCallBack(this);
-
     std::remove(Const::LogFilename.c_str());
     _outfile.open(Const::LogFilename, std::ios_base::app);
+
+    LoggingService::getInstance().registerCallBack(this);
 }
 
 _FileLogger::~_FileLogger()
 {
+    LoggingService::getInstance().flush();
     LoggingService::getInstance().unregisterCallBack(this);
 }
 
 void _FileLogger::newLogMessage(Priority priority, std::string const& message)
 {
-    _outfile << message << std::endl;
+    _outfile << message << '\n';
+}
+
+void _FileLogger::flush()
+{
+    _outfile.flush();
 }
@@ -0,0 +1,250 @@
+#include "JsonReader.h"
+
+#include <stdexcept>
+
+namespace
+{
+    void appendUtf8(std::string& result, uint32_t codePoint)
+    {
+        if (codePoint < 0x80) {
+            result += static_cast<char>(codePoint);
+        } else if (codePoint < 0x800) {
+            result += static_cast<char>(0xc0 | (codePoint >> 6));
+            result += static_cast<char>(0x80 | (codePoint & 0x3f));
+        } else if (codePoint < 0x10000) {
+            result += static_cast<char>(0xe0 | (codePoint >> 12));
+            result += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f));
+            result += static_cast<char>(0x80 | (codePoint & 0x3f));
+        } else {
+            result += static_cast<char>(0xf0 | (codePoint >> 18));
+            result += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3f));
+            result += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f));
+            result += static_cast<char>(0x80 | (codePoint & 0x3f));
+        }
+    }
+}
+
+JsonReader::JsonReader(std::string_view const& input)
+    : _input(input)
+{}
+
+bool JsonReader::isObject()
+{
+    return peek() == '{';
+}
+
+bool JsonReader::isArray()
+{
+    return peek() == '[';
+}
+
+void JsonReader::beginObject()
+{
+    expect('{');
+    _firstEntryStack.emplace_back(true);
+}
+
+bool JsonReader::nextMember(std::string& key)
+{
+    if (!nextEntry('}')) {
+        return false;
+    }
+    key.clear();
+    readString(key);
+    expect(':');
+    return true;
+}
+
+void JsonReader::beginArray()
+{
+    expect('[');
+    _firstEntryStack.emplace_back(true);
+}
+
+bool JsonReader::nextElement()
+{
+    return nextEntry(']');
+}
+
+std::string JsonReader::readScalar()
+{
+    std::string result;
+    if (peek() == '"') {
+        readString(result);
+    } else {
+        readLiteral(result);
+    }
+    return result;
+}
+
+void JsonReader::skipValue()
+{
+    std::string key;
+    if (isObject()) {
+        beginObject();
+        while (nextMember(key)) {
+            skipValue();
+        }
+    } else if (isArray()) {
+        beginArray();
+        while (nextElement()) {
+            skipValue();
+        }
+    } else {
+        readScalar();
+    }
+}
+
+void JsonReader::skipWhitespace()
+{
+    while (_pos < _input.size() && (_input[_pos] == ' ' || _input[_pos] == '\t' || _input[_pos] == '\n' || _input[_pos] == '\r')) {
+        ++_pos;
+    }
+}
+
+char JsonReader::peek()
+{
+    skipWhitespace();
+    if (_pos == _input.size()) {
+        throwError();
+    }
+    return _input[_pos];
+}
+
+void JsonReader::expect(char c)
+{
+    if (peek() != c) {
+        throwError();
+    }
+    ++_pos;
+}
+
+bool JsonReader::nextEntry(char endChar)
+{
+    if (_firstEntryStack.empty()) {
+        throwError();
+    }
+    if (peek() == endChar) {
+        ++_pos;
+        _firstEntryStack.pop_back();
+        return false;
+    }
+    if (!_firstEntryStack.back()) {
+        expect(',');
+    }
+    _firstEntryStack.back() = false;
+    return true;
+}
+
+void JsonReader::readString(std::string& result)
+{
+    expect('"');
+    while (true) {
+        if (_pos == _input.size()) {
+            throwError();
+        }
+        auto c = _input[_pos++];
+        if (c == '"') {
+            return;
+        }
+        if (c != '\\') {
+            result += c;
+            continue;
+        }
+        if (_pos == _input.size()) {
+            throwError();
+        }
+        switch (_input[_pos++]) {
+        case '"':
+            result += '"';
+            break;
+        case '\\':
+            result += '\\';
+            break;
+        case '/':
+            result += '/';
+            break;
+        case 'b':
+            result += '\b';
+            break;
+        case 'f':
+            result += '\f';
+            break;
+        case 'n':
+            result += '\n';
+            break;
+        case 'r':
+            result += '\r';
+            break;
+        case 't':
+            result += '\t';
+            break;
+        case 'u': {
+            auto readCodeUnit = [this] {
+                if (_input.size() - _pos < 4) {
+                    throwError();
+                }
+                uint32_t codeUnit = 0;
+                for (int i = 0; i < 4; ++i) {
+                    auto c = _input[_pos];
+                    uint32_t digit = 0;
+                    if (c >= '0' && c <= '9') {
+                        digit = c - '0';
+                    } else if (c >= 'a' && c <= 'f') {
+                        digit = c - 'a' + 10;
+                    } else if (c >= 'A' && c <= 'F') {
+                        digit = c - 'A' + 10;
+                    } else {
+                        throwError();
+                    }
+                    codeUnit = (codeUnit << 4) | digit;
+                    ++_pos;
+                }
+                return codeUnit;
+            };
+            auto codePoint = readCodeUnit();
+
+            //surrogates are only valid as a pair of a high and a low surrogate
+            if (codePoint >= 0xdc00 && codePoint < 0xe000) {
+                throwError();
+            }
+            if (codePoint >= 0xd800 && codePoint < 0xdc00) {
+                if (_input.substr(_pos, 2) != "\\u") {
+                    throwError();
+                }
+                _pos += 2;
+                auto lowSurrogate = readCodeUnit();
+                if (lowSurrogate < 0xdc00 || lowSurrogate >= 0xe000) {
+                    throwError();
+                }
+                codePoint = 0x10000 + ((codePoint - 0xd800) << 10) + (lowSurrogate - 0xdc00);
+            }
+            appendUtf8(result, codePoint);
+        } break;
+        default:
+            throwError();
+        }
+    }
+}
+
+void JsonReader::readLiteral(std::string& result)
+{
+    skipWhitespace();
+    auto startPos = _pos;
+    while (_pos < _input.size()) {
+        auto c = _input[_pos];
+        if (c == ',' || c == '}' || c == ']' || c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+            break;
+        }
+        ++_pos;
+    }
+    if (_pos == startPos) {
+        throwError();
+    }
+    result.assign(_input.substr(startPos, _pos - startPos));
+}
+
+void JsonReader::throwError() const
+{
+    throw std::runtime_error("Invalid JSON at position " + std::to_string(_pos) + ".");
+}
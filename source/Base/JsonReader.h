@@ -0,0 +1,50 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Pull parser for JSON documents which reads the values in document order without building a tree.
+ * Scalars are returned as strings like in boost::property_tree (e.g. "42", "true", "null").
+ * Syntax errors throw std::runtime_error.
+ *
+ * Example for [{"a": 1}, ...]:
+ *   reader.beginArray();
+ *   while (reader.nextElement()) {
+ *       reader.beginObject();
+ *       while (reader.nextMember(key)) {
+ *           if (key == "a") { value = reader.readScalar(); } else { reader.skipValue(); }
+ *       }
+ *   }
+ */
+class JsonReader
+{
+public:
+    JsonReader(std::string_view const& input);
+
+    bool isObject();
+    bool isArray();
+
+    void beginObject();
+    bool nextMember(std::string& key);  //returns false at the end of the object
+
+    void beginArray();
+    bool nextElement();  //returns false at the end of the array
+
+    std::string readScalar();
+    void skipValue();
+
+private:
+    void skipWhitespace();
+    char peek();
+    void expect(char c);
+    bool nextEntry(char endChar);
+    void readString(std::string& result);
+    void readLiteral(std::string& result);
+    void throwError() const;
+
+    std::string_view _input;
+    size_t _pos = 0;
+    std::vector<bool> _firstEntryStack;  //for each open object/array: whether the next entry is the first one
+};
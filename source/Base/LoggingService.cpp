@@ -1,10 +1,43 @@
 #include "LoggingService.h"
 
-#include <iostream>
 #include <iomanip>
 #include <ctime>
 #include <sstream>
 #include <algorithm>
+#include <cstdlib>
+#include <exception>
+
+namespace
+{
+    std::string getPerformanceEventName(PerformanceEvent event)
+    {
+        switch (event) {
+        case PerformanceEvent::ResizeArrays:
+            return "resize arrays";
+        case PerformanceEvent::GarbageCollection:
+            return "garbage collection";
+        case PerformanceEvent::SaveSimulation:
+            return "save simulation";
+        case PerformanceEvent::LoadSimulation:
+            return "load simulation";
+        case PerformanceEvent::UploadSimulation:
+            return "upload simulation";
+        }
+        return "";
+    }
+
+    std::terminate_handler previousTerminateHandler = nullptr;
+
+    //pending records would be lost otherwise
+    void flushAndTerminate()
+    {
+        LoggingService::getInstance().flush();
+        if (previousTerminateHandler) {
+            previousTerminateHandler();
+        }
+        std::abort();
+    }
+}
 
 LoggingService& LoggingService::getInstance()
 {
@@ -12,30 +45,128 @@ LoggingService& LoggingService::getInstance()
     return instance;
 }
 
-void LoggingService::log(Priority priority, std::string const& message)
+LoggingService::LoggingService()
 {
-    std::lock_guard<std::mutex> lock(_mutex);
+    _writerThread = std::thread([this] { processRecords(); });
+    previousTerminateHandler = std::set_terminate(flushAndTerminate);
+}
 
-    auto t = std::time(nullptr);
-    auto tm = *std::localtime(&t);
+LoggingService::~LoggingService()
+{
+    _shutdown = true;
+    _wakeUpCounter.fetch_add(1);
+    _wakeUpCounter.notify_one();
+    _writerThread.join();
+}
 
-    std::stringstream stream;
-    stream << std::put_time(&tm, "%Y-%m-%d %H-%M-%S") << ": " << message;
+void LoggingService::log(Priority priority, std::string message)
+{
+    LogRecord record;
+    record.time = std::chrono::system_clock::now();
+    record.priority = priority;
+    record.message = std::move(message);
+    push(std::move(record));
+}
 
-    auto enrichedMessage = stream.str();
-    for (auto const& callback : _callbacks) {
-        callback->newLogMessage(priority, enrichedMessage);
+void LoggingService::logPerformanceEvent(PerformanceEvent event, std::chrono::steady_clock::duration duration)
+{
+    LogRecord record;
+    record.time = std::chrono::system_clock::now();
+    record.isPerformanceEvent = true;
+    record.performanceEvent.event = event;
+    record.performanceEvent.durationMs = std::chrono::duration<double, std::milli>(duration).count();
+    push(std::move(record));
+}
+
+void LoggingService::flush()
+{
+    if (std::this_thread::get_id() == _writerThread.get_id()) {
+        return;
+    }
+    auto numPushedRecords = _numPushedRecords.load();
+    auto numDeliveredRecords = _numDeliveredRecords.load();
+    while (numDeliveredRecords < numPushedRecords) {
+        _numDeliveredRecords.wait(numDeliveredRecords);
+        numDeliveredRecords = _numDeliveredRecords.load();
     }
 }
 
 void LoggingService::registerCallBack(LoggingCallBack* callback)
 {
+    std::lock_guard lock(_callbacksMutex);
     _callbacks.emplace_back(callback);
 }
 
 void LoggingService::unregisterCallBack(LoggingCallBack* callback)
 {
+    std::lock_guard lock(_callbacksMutex);
     auto end = std::remove_if(_callbacks.begin(), _callbacks.end(), [&](auto const& callback_) { return callback_ == callback; });
 
     _callbacks.erase(end, _callbacks.end());
 }
+
+void LoggingService::push(LogRecord&& record)
+{
+    //the writer thread frees up slots quickly, so waiting for it only happens on bursts of messages
+    while (!_records.tryPush(std::move(record))) {
+        std::this_thread::yield();
+    }
+    _numPushedRecords.fetch_add(1);
+    _wakeUpCounter.fetch_add(1);
+    _wakeUpCounter.notify_one();
+}
+
+void LoggingService::processRecords()
+{
+    uint64_t numDeliveredRecords = 0;
+    LogRecord record;
+    while (true) {
+        auto wakeUpCounter = _wakeUpCounter.load();
+        auto numPushedRecords = _numPushedRecords.load();
+        if (numDeliveredRecords < numPushedRecords) {
+            std::lock_guard lock(_callbacksMutex);
+            while (numDeliveredRecords < numPushedRecords) {
+
+                //a producer may have reserved a slot without having filled it yet
+                if (!_records.tryPop(record)) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                deliver(record);
+                ++numDeliveredRecords;
+            }
+            for (auto const& callback : _callbacks) {
+                callback->flush();
+            }
+            _numDeliveredRecords.store(numDeliveredRecords);
+            _numDeliveredRecords.notify_all();
+        } else if (_shutdown) {
+            return;
+        } else {
+            _wakeUpCounter.wait(wakeUpCounter);
+        }
+    }
+}
+
+void LoggingService::deliver(LogRecord const& record)
+{
+    auto t = std::chrono::system_clock::to_time_t(record.time);
+    auto tm = *std::localtime(&t);
+
+    std::stringstream stream;
+    stream << std::put_time(&tm, "%Y-%m-%d %H-%M-%S") << ": ";
+    if (record.isPerformanceEvent) {
+        stream << getPerformanceEventName(record.performanceEvent.event) << " took " << std::fixed << std::setprecision(1)
+               << record.performanceEvent.durationMs << " ms";
+    } else {
+        stream << record.message;
+    }
+
+    auto enrichedMessage = stream.str();
+    for (auto const& callback : _callbacks) {
+        if (record.isPerformanceEvent) {
+            callback->newPerformanceEvent(record.performanceEvent);
+        }
+        callback->newLogMessage(record.priority, enrichedMessage);
+    }
+}
@@ -1,8 +1,14 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
-#include <mutex>
+
+#include "MpscRingBuffer.h"
 
 enum class Priority
 {
@@ -10,28 +16,86 @@ enum class Priority
     Important,
 };
 
+enum class PerformanceEvent
+{
+    ResizeArrays,
+    GarbageCollection,
+    SaveSimulation,
+    LoadSimulation,
+    UploadSimulation,
+};
+
+struct PerformanceEventRecord
+{
+    PerformanceEvent event = PerformanceEvent::ResizeArrays;
+    double durationMs = 0;
+};
+
+//callbacks are invoked from the writer thread of the LoggingService
 class LoggingCallBack
 {
 public:
     virtual void newLogMessage(Priority priority, std::string const& message) = 0;
+    virtual void newPerformanceEvent(PerformanceEventRecord const& record) {}
+
+    //called after all currently pending messages have been delivered
+    virtual void flush() {}
 };
 
+//log calls only enqueue a record into a lock-free ring buffer
+//timestamps are formatted and the callbacks are invoked on a background writer thread
+//pending records are delivered on std::terminate, error paths that may end the process should call flush() explicitly
 class LoggingService
 {
 public:
     static LoggingService& getInstance();
 
-    void log(Priority priority, std::string const& message);
+    LoggingService(LoggingService const&) = delete;
+    ~LoggingService();
+
+    void log(Priority priority, std::string message);
+    void logPerformanceEvent(PerformanceEvent event, std::chrono::steady_clock::duration duration);
+
+    //blocks until all records logged so far have been delivered to the callbacks (returns immediately if called from a callback)
+    void flush();
 
     void registerCallBack(LoggingCallBack* callback);
     void unregisterCallBack(LoggingCallBack* callback);
 
 private:
+    LoggingService();
+
+    struct LogRecord
+    {
+        std::chrono::system_clock::time_point time;
+        Priority priority = Priority::Unimportant;
+        std::string message;
+        bool isPerformanceEvent = false;
+        PerformanceEventRecord performanceEvent;
+    };
+    void push(LogRecord&& record);
+    void processRecords();
+    void deliver(LogRecord const& record);
+
+    static auto constexpr RingBufferCapacity = 4096;
+    MpscRingBuffer<LogRecord, RingBufferCapacity> _records;
+    std::atomic<uint64_t> _numPushedRecords = 0;
+    std::atomic<uint64_t> _numDeliveredRecords = 0;
+    std::atomic<uint64_t> _wakeUpCounter = 0;  //is increased to wake up the writer thread
+    std::atomic<bool> _shutdown = false;
+
     std::vector<LoggingCallBack*> _callbacks;
-    std::mutex _mutex;
+    std::mutex _callbacksMutex;
+
+    std::thread _writerThread;
 };
 
-inline void log(Priority priority, std::string const& message)
+inline void log(Priority priority, std::string message)
+{
+    LoggingService::getInstance().log(priority, std::move(message));
+}
+
+inline void logPerformanceEvent(PerformanceEvent event, std::chrono::steady_clock::duration duration)
 {
-    LoggingService::getInstance().log(priority, message);
-}
\ No newline at end of file
+    LoggingService::getInstance().logPerformanceEvent(event, duration);
+}
@@ -0,0 +1,99 @@
+#include "MemoryMappedFile.h"
+
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+MemoryMappedFile::MemoryMappedFile(std::string const& filename)
+{
+    _fileHandle = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (_fileHandle == INVALID_HANDLE_VALUE) {
+        _fileHandle = nullptr;
+        throw std::runtime_error("Could not open " + filename + ".");
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(_fileHandle, &size)) {
+        CloseHandle(_fileHandle);
+        throw std::runtime_error("Could not determine size of " + filename + ".");
+    }
+    _size = static_cast<uint64_t>(size.QuadPart);
+    if (_size == 0) {
+        return;
+    }
+
+    _mappingHandle = CreateFileMappingA(_fileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (_mappingHandle != nullptr) {
+        _data = static_cast<char const*>(MapViewOfFile(_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+    }
+    if (_data == nullptr) {
+        if (_mappingHandle != nullptr) {
+            CloseHandle(_mappingHandle);
+        }
+        CloseHandle(_fileHandle);
+        throw std::runtime_error("Could not map " + filename + ".");
+    }
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    if (_data != nullptr) {
+        UnmapViewOfFile(_data);
+    }
+    if (_mappingHandle != nullptr) {
+        CloseHandle(_mappingHandle);
+    }
+    if (_fileHandle != nullptr) {
+        CloseHandle(_fileHandle);
+    }
+}
+#else
+MemoryMappedFile::MemoryMappedFile(std::string const& filename)
+{
+    auto fileDescriptor = open(filename.c_str(), O_RDONLY);
+    if (fileDescriptor == -1) {
+        throw std::runtime_error("Could not open " + filename + ".");
+    }
+    struct stat fileStatus;
+    if (fstat(fileDescriptor, &fileStatus) == -1) {
+        close(fileDescriptor);
+        throw std::runtime_error("Could not determine size of " + filename + ".");
+    }
+    _size = static_cast<uint64_t>(fileStatus.st_size);
+    if (_size == 0) {
+        close(fileDescriptor);
+        return;
+    }
+
+    auto data = mmap(nullptr, _size, PROT_READ, MAP_SHARED, fileDescriptor, 0);
+    close(fileDescriptor);
+    if (data == MAP_FAILED) {
+        throw std::runtime_error("Could not map " + filename + ".");
+    }
+    _data = static_cast<char const*>(data);
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    if (_data != nullptr) {
+        munmap(const_cast<char*>(_data), _size);
+    }
+}
+#endif
+
+char const* MemoryMappedFile::getData() const
+{
+    return _data;
+}
+
+uint64_t MemoryMappedFile::getSize() const
+{
+    return _size;
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+/**
+ * Read-only mapping of a whole file into memory. Throws std::runtime_error if the file cannot be mapped.
+ */
+class MemoryMappedFile
+{
+public:
+    MemoryMappedFile(std::string const& filename);
+    ~MemoryMappedFile();
+
+    MemoryMappedFile(MemoryMappedFile const&) = delete;
+    MemoryMappedFile& operator=(MemoryMappedFile const&) = delete;
+
+    char const* getData() const;
+    uint64_t getSize() const;
+
+private:
+    char const* _data = nullptr;
+    uint64_t _size = 0;
+
+#ifdef _WIN32
+    void* _fileHandle = nullptr;
+    void* _mappingHandle = nullptr;
+#endif
+};
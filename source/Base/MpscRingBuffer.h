@@ -0,0 +1,69 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+//bounded lock-free queue for multiple producers and a single consumer (based on D. Vyukov's bounded MPMC queue)
+//each slot carries a sequence number which tells producers and the consumer whether the slot is free or filled
+template <typename T, size_t Capacity>
+class MpscRingBuffer
+{
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "capacity must be a power of two");
+
+public:
+    MpscRingBuffer()
+        : _slots(std::make_unique<Slot[]>(Capacity))
+    {
+        for (size_t i = 0; i < Capacity; ++i) {
+            _slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    //can be called from any thread, returns false if the buffer is full
+    bool tryPush(T&& value)
+    {
+        auto pos = _pushPos.load(std::memory_order_relaxed);
+        while (true) {
+            auto& slot = _slots[pos & (Capacity - 1)];
+            auto sequence = slot.sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (_pushPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    slot.value = std::move(value);
+                    slot.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _pushPos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    //must only be called from the consumer thread, returns false if the buffer is empty
+    bool tryPop(T& value)
+    {
+        auto& slot = _slots[_popPos & (Capacity - 1)];
+        auto sequence = slot.sequence.load(std::memory_order_acquire);
+        if (static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(_popPos + 1) < 0) {
+            return false;
+        }
+        value = std::move(slot.value);
+        slot.sequence.store(_popPos + Capacity, std::memory_order_release);
+        ++_popPos;
+        return true;
+    }
+
+private:
+    struct Slot
+    {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    std::unique_ptr<Slot[]> _slots;
+    alignas(64) std::atomic<size_t> _pushPos = 0;
+    alignas(64) size_t _popPos = 0;
+};
@@ -0,0 +1,56 @@
+#include "ParallelExecution.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+void ParallelExecution::execute(size_t numTasks, std::function<void(size_t)> const& func)
+{
+    auto numThreads = std::min(static_cast<size_t>(std::max(1u, std::thread::hardware_concurrency())), numTasks);
+    if (numThreads <= 1) {
+        for (size_t i = 0; i < numTasks; ++i) {
+            func(i);
+        }
+        return;
+    }
+
+    std::atomic<size_t> nextTask = 0;
+    std::exception_ptr exception;
+    std::mutex exceptionMutex;
+    auto worker = [&] {
+        for (auto task = nextTask++; task < numTasks; task = nextTask++) {
+            try {
+                func(task);
+            } catch (...) {
+                std::lock_guard lock(exceptionMutex);
+                if (!exception) {
+                    exception = std::current_exception();
+                }
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads);
+    for (size_t i = 0; i < numThreads; ++i) {
+        threads.emplace_back(worker);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+}
+
+void ParallelExecution::executeForRanges(size_t numElements, size_t rangeSize, std::function<void(size_t, size_t)> const& func)
+{
+    auto numRanges = (numElements + rangeSize - 1) / rangeSize;
+    execute(numRanges, [&](size_t rangeIndex) {
+        auto begin = rangeIndex * rangeSize;
+        func(begin, std::min(begin + rangeSize, numElements));
+    });
+}
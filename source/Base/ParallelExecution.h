@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+class ParallelExecution
+{
+public:
+    //executes func(0), ..., func(numTasks - 1) on all available cores and rethrows the first exception
+    static void execute(size_t numTasks, std::function<void(size_t)> const& func);
+
+    //splits [0, numElements) into ranges of at most rangeSize elements and executes func(begin, end) for each range in parallel
+    static void executeForRanges(size_t numElements, size_t rangeSize, std::function<void(size_t, size_t)> const& func);
+};
@@ -10,7 +10,9 @@ namespace Const
     std::string const LogFilename = "log.txt";
     std::string const AutosaveFileWithoutPath = "autosave.sim";
     std::string const AutosaveFile = BasePath + AutosaveFileWithoutPath;
+    std::string const AutosaveBaseFilePrefix = BasePath + "autosave.base.";  //followed by the generation of the base snapshot
     std::string const SettingsFilename = BasePath + "settings.json";
+    std::string const DownloadCacheDirectory = BasePath + "download cache";
 
     std::string const SimulationFragmentShader = BasePath + "shader.fs";
     std::string const SimulationVertexShader = BasePath + "shader.vs";
@@ -0,0 +1,215 @@
+#include "BatchService.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <future>
+#include <iostream>
+#include <optional>
+#include <vector>
+
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+#include "Base/Definitions.h"
+#include "Base/StringHelper.h"
+#include "EngineInterface/AuxiliaryDataParserService.h"
+#include "EngineInterface/SerializerService.h"
+#include "EngineImpl/SimulationControllerImpl.h"
+
+namespace
+{
+    struct BatchJob
+    {
+        std::string inputFilename;
+        std::string outputFilename;
+        int timesteps = 0;
+        boost::property_tree::ptree parameterOverrides;
+    };
+
+    struct JobSummary
+    {
+        bool success = false;
+        int64_t loadMs = 0;
+        int64_t setupMs = 0;
+        int64_t simulationMs = 0;
+        int64_t saveMs = 0;
+        float tps = 0;
+    };
+
+    struct LoadedInput
+    {
+        std::optional<DeserializedColumnarSimulation> simData;
+        int64_t loadMs = 0;
+    };
+
+    int64_t getMillisecondsSince(std::chrono::steady_clock::time_point const& timepoint)
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - timepoint).count();
+    }
+
+    std::vector<BatchJob> readJobs(boost::property_tree::ptree const& manifest)
+    {
+        std::vector<BatchJob> result;
+        for (auto const& [key, jobTree] : manifest.get_child("jobs")) {
+            BatchJob job;
+            job.inputFilename = jobTree.get<std::string>("input");
+            job.outputFilename = jobTree.get<std::string>("output");
+            job.timesteps = jobTree.get<int>("timesteps");
+            if (auto overrides = jobTree.get_child_optional("parameters")) {
+                job.parameterOverrides = *overrides;
+            }
+            result.emplace_back(job);
+        }
+        return result;
+    }
+
+    //copies the leaves of overrides into tree, the keys of nested nodes are joined by '.'
+    void mergeOverrides(boost::property_tree::ptree& tree, boost::property_tree::ptree const& overrides, std::string const& path = "")
+    {
+        for (auto const& [key, child] : overrides) {
+            auto childPath = path.empty() ? key : path + "." + key;
+            if (child.empty()) {
+                tree.put(childPath, child.data());
+            } else {
+                mergeOverrides(tree, child, childPath);
+            }
+        }
+    }
+
+    SimulationParameters applyOverrides(SimulationParameters const& parameters, boost::property_tree::ptree const& overrides)
+    {
+        auto tree = AuxiliaryDataParserService::encodeSimulationParameters(parameters);
+        mergeOverrides(tree, overrides);
+        return AuxiliaryDataParserService::decodeSimulationParameters(tree);
+    }
+
+    LoadedInput loadInput(std::string const& filename)
+    {
+        auto startTimepoint = std::chrono::steady_clock::now();
+        LoadedInput result;
+        DeserializedColumnarSimulation simData;
+        if (SerializerService::deserializeSimulationFromFiles(simData, filename)) {
+            result.simData = std::move(simData);
+        }
+        result.loadMs = getMillisecondsSince(startTimepoint);
+        return result;
+    }
+
+    JobSummary runJob(SimulationController const& simController, BatchJob const& job, LoadedInput& input)
+    {
+        JobSummary result;
+        result.loadMs = input.loadMs;
+        if (!input.simData) {
+            std::cout << "Could not read from input files." << std::endl;
+            return result;
+        }
+        auto isSimulationCreated = false;
+        try {
+            auto& simData = *input.simData;
+            simData.auxiliaryData.simulationParameters = applyOverrides(simData.auxiliaryData.simulationParameters, job.parameterOverrides);
+
+            auto startTimepoint = std::chrono::steady_clock::now();
+            simController->newSimulation(
+                simData.auxiliaryData.timestep, simData.auxiliaryData.generalSettings, simData.auxiliaryData.simulationParameters);
+            isSimulationCreated = true;
+            simController->setColumnarSimulationData(simData.mainData);
+            simController->setStatisticsHistory(simData.statistics);
+            result.setupMs = getMillisecondsSince(startTimepoint);
+
+            startTimepoint = std::chrono::steady_clock::now();
+            simController->calcTimesteps(job.timesteps);
+            result.simulationMs = getMillisecondsSince(startTimepoint);
+            result.tps = result.simulationMs != 0 ? 1000.0f * toFloat(job.timesteps) / toFloat(result.simulationMs) : 0.0f;
+
+            startTimepoint = std::chrono::steady_clock::now();
+            simData.auxiliaryData.timestep = static_cast<uint32_t>(simController->getCurrentTimestep());
+            simData.mainData = simController->getColumnarSimulationData();
+            simData.auxiliaryData.simulationParameters = simController->getSimulationParameters();
+            simData.statistics = simController->getStatisticsHistory().getCopiedData();
+            isSimulationCreated = false;
+            simController->closeSimulation();
+
+            result.success = SerializerService::serializeSimulationToFiles(job.outputFilename, simData);
+            if (!result.success) {
+                std::cout << "Could not write to output files." << std::endl;
+            }
+            result.saveMs = getMillisecondsSince(startTimepoint);
+        } catch (std::exception const& e) {
+            std::cout << "Job failed: " << e.what() << std::endl;
+            result.success = false;
+
+            //the subsequent jobs need a closed simulation
+            if (isSimulationCreated) {
+                try {
+                    simController->closeSimulation();
+                } catch (std::exception const& e) {
+                    std::cout << "Could not close simulation: " << e.what() << std::endl;
+                }
+            }
+        }
+        return result;
+    }
+
+    void writeSummary(std::string const& filename, std::vector<BatchJob> const& jobs, std::vector<JobSummary> const& summaries)
+    {
+        std::ofstream stream(filename);
+        stream << "job, input, output, success, time steps, load ms, setup ms, simulation ms, save ms, TPS" << std::endl;
+        for (size_t i = 0; i < summaries.size(); ++i) {
+            auto const& job = jobs.at(i);
+            auto const& summary = summaries.at(i);
+            stream << i << ", " << job.inputFilename << ", " << job.outputFilename << ", " << (summary.success ? "true" : "false") << ", "
+                   << job.timesteps << ", " << summary.loadMs << ", " << summary.setupMs << ", " << summary.simulationMs << ", " << summary.saveMs << ", " << summary.tps
+                   << std::endl;
+        }
+        if (!stream) {
+            std::cout << "Could not write summary file." << std::endl;
+        }
+    }
+}
+
+bool BatchService::runJobs(std::string const& manifestFilename)
+{
+    std::vector<BatchJob> jobs;
+    std::optional<std::string> summaryFilename;
+    try {
+        boost::property_tree::ptree manifest;
+        boost::property_tree::read_json(manifestFilename, manifest);
+        jobs = readJobs(manifest);
+        if (auto filename = manifest.get_optional<std::string>("summary")) {
+            summaryFilename = *filename;
+        }
+    } catch (std::exception const& e) {
+        std::cout << "Could not read manifest: " << e.what() << std::endl;
+        return false;
+    }
+
+    //the CUDA context is reused by the subsequent jobs
+    auto simController = std::make_shared<_SimulationControllerImpl>();
+    simController->setDeviceResetOnClose(false);
+    std::cout << "Device: " << simController->getGpuName() << std::endl;
+
+    std::vector<JobSummary> summaries;
+    std::future<LoadedInput> nextInput;
+    if (!jobs.empty()) {
+        nextInput = std::async(std::launch::async, loadInput, jobs.front().inputFilename);
+    }
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        auto const& job = jobs.at(i);
+        std::cout << "Job " << i + 1 << "/" << jobs.size() << ": " << job.inputFilename << std::endl;
+
+        auto input = nextInput.get();
+        if (i + 1 < jobs.size()) {
+            nextInput = std::async(std::launch::async, loadInput, jobs.at(i + 1).inputFilename);
+        }
+        auto summary = runJob(simController, job, input);
+        std::cout << "Job finished: " << StringHelper::format(job.timesteps) << " time steps, " << StringHelper::format(summary.simulationMs)
+                  << " ms, " << StringHelper::format(summary.tps, 1) << " TPS" << std::endl;
+        summaries.emplace_back(summary);
+    }
+
+    if (summaryFilename) {
+        writeSummary(*summaryFilename, jobs, summaries);
+    }
+    return std::all_of(summaries.begin(), summaries.end(), [](auto const& summary) { return summary.success; });
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+
+/**
+ * Runs the simulation jobs of a JSON manifest with one simulation controller:
+ * {
+ *   "summary": "summary.csv",                       (optional)
+ *   "jobs": [
+ *     {
+ *       "input": "input.sim",
+ *       "output": "output.sim",
+ *       "timesteps": 10000,
+ *       "parameters": {"simulation parameters.friction": 0.001}   (optional)
+ *     }
+ *   ]
+ * }
+ * Parameter overrides use the same keys as the *.settings.json files, either dotted or nested.
+ * The input of the next job is read in the background while the current job is running.
+ * The CUDA device is not reset between the jobs and the setup of each job is measured separately from the simulation time.
+ */
+class BatchService
+{
+public:
+    //returns false if the manifest could not be read or a job failed, a failed job does not stop the subsequent jobs
+    static bool runJobs(std::string const& manifestFilename);
+};
@@ -0,0 +1,160 @@
+#include "FrameExporter.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+#include <zlib.h>
+
+#include "Base/Definitions.h"
+
+namespace
+{
+    void convertToRgb8(std::vector<uint64_t> const& image, std::vector<uint8_t>& rgb)
+    {
+        rgb.resize(image.size() * 3);
+        for (size_t i = 0; i < image.size(); ++i) {
+            auto const& pixel = image[i];
+            rgb[i * 3] = static_cast<uint8_t>(std::min(pixel & 0xffff, uint64_t(255)));
+            rgb[i * 3 + 1] = static_cast<uint8_t>(std::min((pixel >> 16) & 0xffff, uint64_t(255)));
+            rgb[i * 3 + 2] = static_cast<uint8_t>(std::min((pixel >> 32) & 0xffff, uint64_t(255)));
+        }
+    }
+
+    void appendUInt32(std::vector<uint8_t>& data, uint32_t value)
+    {
+        data.emplace_back(static_cast<uint8_t>(value >> 24));
+        data.emplace_back(static_cast<uint8_t>(value >> 16));
+        data.emplace_back(static_cast<uint8_t>(value >> 8));
+        data.emplace_back(static_cast<uint8_t>(value));
+    }
+
+    void appendChunk(std::vector<uint8_t>& png, char const* type, uint8_t const* data, uint32_t size)
+    {
+        appendUInt32(png, size);
+        auto typeStart = png.size();
+        png.insert(png.end(), type, type + 4);
+        png.insert(png.end(), data, data + size);
+        appendUInt32(png, crc32(0, png.data() + typeStart, size + 4));
+    }
+
+    //8 bit RGB without interlacing and without row filters
+    bool encodePng(std::vector<uint8_t> const& rgb, IntVector2D const& imageSize, std::vector<uint8_t>& png)
+    {
+        auto rowSize = toInt(imageSize.x) * 3;
+        std::vector<uint8_t> rows((rowSize + 1) * imageSize.y);
+        for (int y = 0; y < imageSize.y; ++y) {
+            rows[(rowSize + 1) * y] = 0;
+            std::copy_n(rgb.begin() + rowSize * y, rowSize, rows.begin() + (rowSize + 1) * y + 1);
+        }
+        auto compressedSize = compressBound(static_cast<uLong>(rows.size()));
+        std::vector<uint8_t> compressed(compressedSize);
+        if (compress2(compressed.data(), &compressedSize, rows.data(), static_cast<uLong>(rows.size()), Z_BEST_SPEED) != Z_OK) {
+            return false;
+        }
+
+        png.clear();
+        uint8_t const signature[] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+        png.insert(png.end(), std::begin(signature), std::end(signature));
+
+        std::vector<uint8_t> header;
+        appendUInt32(header, imageSize.x);
+        appendUInt32(header, imageSize.y);
+        header.insert(header.end(), {8, 2, 0, 0, 0});  //bit depth, color type RGB, compression, filter, interlace
+        appendChunk(png, "IHDR", header.data(), static_cast<uint32_t>(header.size()));
+        appendChunk(png, "IDAT", compressed.data(), static_cast<uint32_t>(compressedSize));
+        appendChunk(png, "IEND", nullptr, 0);
+        return true;
+    }
+}
+
+FrameExporter::FrameExporter(FrameFormat format, std::string const& target, IntVector2D const& imageSize)
+    : _format(format)
+    , _target(target)
+    , _imageSize(imageSize)
+{
+    if (_format == FrameFormat::Png) {
+        std::filesystem::create_directories(_target);
+    } else {
+        _rawStream.open(_target, std::ios::binary);
+        if (!_rawStream) {
+            throw std::runtime_error("Could not open " + _target + ".");
+        }
+    }
+    _thread = std::thread(&FrameExporter::encoderThread, this);
+}
+
+FrameExporter::~FrameExporter()
+{
+    finish();
+}
+
+void FrameExporter::addFrame(std::vector<uint64_t>&& image)
+{
+    std::unique_lock lock(_mutex);
+    _conditionVariable.wait(lock, [this] { return _queue.size() < MaxQueuedFrames; });
+    _queue.emplace_back(std::move(image));
+    _conditionVariable.notify_all();
+}
+
+bool FrameExporter::finish()
+{
+    {
+        std::unique_lock lock(_mutex);
+        _finished = true;
+        _conditionVariable.notify_all();
+    }
+    if (_thread.joinable()) {
+        _thread.join();
+    }
+    if (_rawStream.is_open()) {
+        //buffered frames are written on closing
+        _rawStream.close();
+        _success &= !_rawStream.fail();
+    }
+    return _success;
+}
+
+void FrameExporter::encoderThread()
+{
+    while (true) {
+        std::vector<uint64_t> image;
+        {
+            std::unique_lock lock(_mutex);
+            _conditionVariable.wait(lock, [this] { return !_queue.empty() || _finished; });
+            if (_queue.empty()) {
+                return;
+            }
+            image = std::move(_queue.front());
+        }
+
+        //the frame stays in the queue while it is written in order to limit the number of frames in memory
+        auto success = writeFrame(image);
+        {
+            std::unique_lock lock(_mutex);
+            _queue.pop_front();
+            _success &= success;
+            _conditionVariable.notify_all();
+        }
+    }
+}
+
+bool FrameExporter::writeFrame(std::vector<uint64_t> const& image)
+{
+    convertToRgb8(image, _rgb);
+    if (_format == FrameFormat::Raw) {
+        _rawStream.write(reinterpret_cast<char const*>(_rgb.data()), _rgb.size());
+        return static_cast<bool>(_rawStream);
+    }
+
+    if (!encodePng(_rgb, _imageSize, _png)) {
+        return false;
+    }
+    std::stringstream filename;
+    filename << "frame_" << std::setw(6) << std::setfill('0') << _frameNumber++ << ".png";
+    std::ofstream stream(std::filesystem::path(_target) / filename.str(), std::ios::binary);
+    stream.write(reinterpret_cast<char const*>(_png.data()), _png.size());
+    return static_cast<bool>(stream);
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Base/Vector2D.h"
+
+enum class FrameFormat
+{
+    Png,
+    Raw
+};
+
+/**
+ * Encodes rendered frames (64 bit pixels in bbbbggggrrrr format) on a background thread
+ * such that the simulation can continue while the previous frame is being written.
+ * Png: each frame is written to <target>/frame_<number>.png
+ * Raw: the frames are appended as RGB24 to the file or named pipe <target> (e.g. for ffmpeg -f rawvideo -pix_fmt rgb24)
+ * At most MaxQueuedFrames are held in memory, addFrame blocks if the encoder falls behind.
+ */
+class FrameExporter
+{
+public:
+    FrameExporter(FrameFormat format, std::string const& target, IntVector2D const& imageSize);
+    ~FrameExporter();
+
+    FrameExporter(FrameExporter const&) = delete;
+    void operator=(FrameExporter const&) = delete;
+
+    void addFrame(std::vector<uint64_t>&& image);
+
+    //waits until all queued frames are written, returns false if a frame could not be written
+    bool finish();
+
+private:
+    static auto constexpr MaxQueuedFrames = 2;
+
+    void encoderThread();
+    bool writeFrame(std::vector<uint64_t> const& image);
+
+    FrameFormat _format;
+    std::string _target;
+    IntVector2D _imageSize;
+
+    std::ofstream _rawStream;
+    std::vector<uint8_t> _rgb;
+    std::vector<uint8_t> _png;
+    int _frameNumber = 0;
+
+    std::mutex _mutex;
+    std::condition_variable _conditionVariable;
+    std::deque<std::vector<uint64_t>> _queue;
+    bool _finished = false;
+    bool _success = true;
+    std::thread _thread;
+};
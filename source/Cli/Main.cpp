@@ -1,5 +1,9 @@
 #include <algorithm>
+#include <csignal>
+#include <filesystem>
 #include <iostream>
+#include <optional>
+#include <vector>
 
 #include "CLI/CLI.hpp"
 
@@ -8,12 +12,75 @@
 #include "Base/Resources.h"
 #include "Base/StringHelper.h"
 #include "Base/FileLogger.h"
+#include "EngineInterface/ColumnarSerializerService.h"
 #include "EngineInterface/SerializerService.h"
+#include "EngineInterface/TiledSimulationFile.h"
+#include "EngineInterface/TimestepProfileService.h"
 #include "EngineImpl/SimulationControllerImpl.h"
 
+#include "BatchService.h"
+#include "FrameExporter.h"
+#include "SettingsWatcher.h"
+
+namespace
+{
+    auto constexpr SettingsCheckInterval = uint64_t(100);
+
+    //the time steps are calculated in portions of SettingsCheckInterval if the settings file is watched
+    void calcTimesteps(SimulationController const& simController, uint64_t timesteps, std::optional<SettingsWatcher>& settingsWatcher)
+    {
+        if (!settingsWatcher) {
+            simController->calcTimesteps(timesteps);
+            return;
+        }
+        for (uint64_t t = 0; t < timesteps;) {
+            auto steps = std::min(SettingsCheckInterval, timesteps - t);
+            simController->calcTimesteps(steps);
+            t += steps;
+            settingsWatcher->update();
+        }
+    }
+
+    struct FrameSettings
+    {
+        int interval = 0;
+        IntVector2D imageSize;
+        RealVector2D center;
+        double zoom = 0;
+    };
+
+    //renders a frame every interval time steps (including the first and last time step) while the previous frame is being encoded
+    void calcTimestepsAndExportFrames(
+        SimulationController const& simController,
+        uint64_t timesteps,
+        FrameSettings const& settings,
+        FrameExporter& exporter,
+        std::optional<SettingsWatcher>& settingsWatcher)
+    {
+        RealVector2D halfSize{toFloat(settings.imageSize.x) / 2 / toFloat(settings.zoom), toFloat(settings.imageSize.y) / 2 / toFloat(settings.zoom)};
+        auto exportFrame = [&] {
+            std::vector<uint64_t> image;
+            simController->drawVectorGraphicsToHost(settings.center - halfSize, settings.center + halfSize, settings.imageSize, settings.zoom, image);
+            exporter.addFrame(std::move(image));
+        };
+
+        exportFrame();
+        for (uint64_t t = 0; t < timesteps;) {
+            auto steps = std::min(static_cast<uint64_t>(settings.interval), timesteps - t);
+            calcTimesteps(simController, steps, settingsWatcher);
+            t += steps;
+            exportFrame();
+        }
+    }
+}
+
 int main(int argc, char** argv)
 {
     try {
+#ifndef _WIN32
+        //writing to a closed pipe (e.g. --raw-frames after the reader has exited) should fail instead of terminating the process
+        std::signal(SIGPIPE, SIG_IGN);
+#endif
         FileLogger fileLogger = std::make_shared<_FileLogger>();
 
         CLI::App app{"Command-line interface for ALIEN v" + Const::ProgramVersion};
@@ -22,7 +89,22 @@ int main(int argc, char** argv)
         std::string inputFilename;
         std::string outputFilename;
         std::string statisticsFilename;
+        std::string manifestFilename;
+        std::string tiledOutputFilename;
+        std::vector<float> region;
         int timesteps = 0;
+        bool deltaCheckpoint = false;
+        bool compact = false;
+        bool watchSettings = false;
+        std::string profileFilename;
+        std::string frameDirectory;
+        std::string rawFramesFilename;
+        int frameInterval = 100;
+        int imageWidth = 1920;
+        int imageHeight = 1080;
+        std::optional<double> zoom;
+        std::optional<float> centerX;
+        std::optional<float> centerY;
         app.add_option(
             "-i", inputFilename, "Specifies the name of the input file for the simulation to run. The corresponding *.settings.json should also be available.");
         app.add_option(
@@ -30,58 +112,223 @@ int main(int argc, char** argv)
             outputFilename,
             "Specifies the name of the output file for the simulation. The *.settings.json and *.statistics.csv file will also be saved.");
         app.add_option("-t", timesteps, "The number of time steps to be calculated.");
+        app.add_flag(
+            "-d",
+            deltaCheckpoint,
+            "Saves the output simulation as delta checkpoint which only contains the changes relative to the input simulation. The input file must "
+            "therefore be kept.");
+        app.add_flag(
+            "--compact",
+            compact,
+            "Folds the input simulation (a delta checkpoint together with its base) into a full simulation file specified by -o without running the "
+            "simulation.");
+        app.add_flag(
+            "--watch-settings",
+            watchSettings,
+            "Applies modifications of the *.settings.json file belonging to the input file while the simulation is running. Only the "
+            "modified parameters are taken over.");
+        app.add_option(
+            "--tiled-output",
+            tiledOutputFilename,
+            "Additionally writes the cells and particles of the output simulation into a spatially indexed file from which regions can be read "
+            "with --region without decoding the whole simulation.");
+        app.add_option(
+            "--region",
+            region,
+            "Reads the cells and particles inside the rectangle <x1> <y1> <x2> <y2> from the spatially indexed input file (see --tiled-output) and "
+            "writes them to the file specified by -o without running the simulation. Rectangles crossing the world edge are continued on the "
+            "opposite side.")->expected(4);
+        app.add_option(
+            "-b",
+            manifestFilename,
+            "Specifies the name of a JSON manifest with simulation jobs (input and output files, time steps and simulation parameter overrides) which "
+            "are run one after the other in the same process. The other options are ignored in this case.");
+        app.add_option(
+            "--profile",
+            profileFilename,
+            "Specifies a file into which the durations of the time step stages (physics, cell functions, garbage collection, ...) and the entity "
+            "counts of the last 1000 time steps are written. The format is JSON for *.json files and CSV otherwise.");
+        app.add_option(
+            "--frames",
+            frameDirectory,
+            "Specifies a directory into which the simulation is rendered as PNG frames (frame_000000.png, ...) while it is running. No OpenGL is "
+            "required.");
+        app.add_option(
+            "--raw-frames",
+            rawFramesFilename,
+            "Specifies a file or named pipe into which the simulation is rendered as raw RGB24 frames while it is running (e.g. for ffmpeg -f rawvideo "
+            "-pix_fmt rgb24 -s <width>x<height> -i <pipe>).");
+        app.add_option("--frame-interval", frameInterval, "The number of time steps between two frames (default 100).");
+        app.add_option("--image-width", imageWidth, "The width of the frames in pixels (default 1920).");
+        app.add_option("--image-height", imageHeight, "The height of the frames in pixels (default 1080).");
+        app.add_option("--zoom", zoom, "The zoom factor, i.e. pixels per space unit (default: the whole world is visible).");
+        app.add_option("--center-x", centerX, "The x coordinate of the viewport center (default: world center).");
+        app.add_option("--center-y", centerY, "The y coordinate of the viewport center (default: world center).");
         CLI11_PARSE(app, argc, argv);
 
+        //run batch
+        if (!manifestFilename.empty()) {
+            std::cout << "Running batch" << std::endl;
+            if (!BatchService::runJobs(manifestFilename)) {
+                std::cout << "Not all jobs could be completed." << std::endl;
+                return 1;
+            }
+            std::cout << "Finished" << std::endl;
+            return 0;
+        }
+
         //read input
         std::cout << "Reading input" << std::endl;
         if (inputFilename.empty()) {
             std::cout << "No input file given." << std::endl;
             return 1;
         }
-        DeserializedSimulation simData;
+        if (compact) {
+            std::cout << "Compacting simulation" << std::endl;
+            if (outputFilename.empty()) {
+                std::cout << "No output file given." << std::endl;
+                return 1;
+            }
+            if (!SerializerService::compactSimulationFiles(outputFilename, inputFilename)) {
+                std::cout << "Could not compact input files." << std::endl;
+                return 1;
+            }
+            std::cout << "Finished" << std::endl;
+            return 0;
+        }
+        if (!region.empty()) {
+            std::cout << "Reading region" << std::endl;
+            if (outputFilename.empty()) {
+                std::cout << "No output file given." << std::endl;
+                return 1;
+            }
+            if (!TiledSimulationFile::isTiledFile(inputFilename)) {
+                std::cout << "The input file is not spatially indexed." << std::endl;
+                return 1;
+            }
+            ClusteredDataDescription regionData;
+            try {
+                regionData = TiledSimulationFile(inputFilename).getRegion({region.at(0), region.at(1)}, {region.at(2), region.at(3)});
+            } catch (std::exception const& e) {
+                std::cout << "Could not read region from input file: " << e.what() << std::endl;
+                return 1;
+            }
+            if (!SerializerService::serializeContentToFile(outputFilename, regionData)) {
+                std::cout << "Could not write to output file." << std::endl;
+                return 1;
+            }
+            std::cout << StringHelper::format(regionData.clusters.size()) << " clusters and " << StringHelper::format(regionData.particles.size())
+                      << " particles written" << std::endl;
+            std::cout << "Finished" << std::endl;
+            return 0;
+        }
+        DeserializedColumnarSimulation simData;
         if (!SerializerService::deserializeSimulationFromFiles(simData, inputFilename)) {
             std::cout << "Could not read from input files." << std::endl;
             return 1;
         }
+        std::optional<ClusteredDataDescription> inputData;
+        if (deltaCheckpoint) {
+            inputData = ColumnarSerializerService::convertColumnarDataToDescription(simData.mainData);
+        }
 
         //run simulation
         auto startTimepoint = std::chrono::steady_clock::now();
 
         auto simController = std::make_shared<_SimulationControllerImpl>();
         simController->newSimulation(simData.auxiliaryData.timestep, simData.auxiliaryData.generalSettings, simData.auxiliaryData.simulationParameters);
-        simController->setClusteredSimulationData(simData.mainData);
+        simController->setColumnarSimulationData(simData.mainData);
         simController->setStatisticsHistory(simData.statistics);
         std::cout << "Device: " << simController->getGpuName() << std::endl;
+        if (!profileFilename.empty()) {
+            simController->setProfilingEnabled(true);
+        }
         std::cout << "Start simulation" << std::endl;
 
-        simController->calcTimesteps(timesteps);
+        std::optional<SettingsWatcher> settingsWatcher;
+        if (watchSettings) {
+            auto settingsFilename = std::filesystem::path(inputFilename).replace_extension(".settings.json").string();
+            settingsWatcher.emplace(settingsFilename, simController);
+            std::cout << "Watching " << settingsFilename << std::endl;
+        }
+
+        auto framesWritten = true;
+        if (!frameDirectory.empty() || !rawFramesFilename.empty()) {
+            if (frameInterval <= 0 || imageWidth <= 0 || imageHeight <= 0) {
+                std::cout << "Invalid frame settings." << std::endl;
+                return 1;
+            }
+            auto worldSize = simController->getWorldSize();
+            FrameSettings frameSettings;
+            frameSettings.interval = frameInterval;
+            frameSettings.imageSize = {imageWidth, imageHeight};
+            frameSettings.center = {centerX.value_or(toFloat(worldSize.x) / 2), centerY.value_or(toFloat(worldSize.y) / 2)};
+            frameSettings.zoom = zoom.value_or(std::min(toDouble(imageWidth) / worldSize.x, toDouble(imageHeight) / worldSize.y));
+
+            auto format = !frameDirectory.empty() ? FrameFormat::Png : FrameFormat::Raw;
+            FrameExporter exporter(format, !frameDirectory.empty() ? frameDirectory : rawFramesFilename, frameSettings.imageSize);
+            calcTimestepsAndExportFrames(simController, timesteps, frameSettings, exporter, settingsWatcher);
+            if (!exporter.finish()) {
+                std::cout << "Could not write all frames." << std::endl;
+                framesWritten = false;
+            }
+        } else {
+            calcTimesteps(simController, timesteps, settingsWatcher);
+        }
 
         auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTimepoint).count();
         auto tps = ms != 0 ? 1000.0f * toFloat(timesteps) / toFloat(ms) : 0.0f; 
         std::cout << "Simulation finished: " << StringHelper::format(timesteps) << " time steps, " << StringHelper::format(ms) << " ms, "
                   << StringHelper::format(tps, 1) << " TPS" << std::endl;
-        
+        if (!profileFilename.empty()) {
+            if (!TimestepProfileService::serializeToFile(profileFilename, simController->getTimestepProfiles())) {
+                std::cout << "Could not write profiling data." << std::endl;
+            }
+        }
+
 
         //write output simulation file
         std::cout << "Writing output" << std::endl;
         simData.auxiliaryData.timestep = static_cast<uint32_t>(simController->getCurrentTimestep());
-        simData.mainData = simController->getClusteredSimulationData();
+        simData.mainData = simController->getColumnarSimulationData();
         simData.auxiliaryData.simulationParameters = simController->getSimulationParameters();
         simData.statistics = simController->getStatisticsHistory().getCopiedData();
         if (outputFilename.empty()) {
             std::cout << "No output file given." << std::endl;
             return 1;
         }
-        if (!SerializerService::serializeSimulationToFiles(outputFilename, simData)) {
+        auto success = false;
+        if (inputData) {
+            DeserializedSimulation outputData{
+                ColumnarSerializerService::convertColumnarDataToDescription(simData.mainData), simData.auxiliaryData, simData.statistics};
+            success = SerializerService::serializeSimulationDeltaToFiles(outputFilename, inputFilename, *inputData, outputData);
+        } else {
+            success = SerializerService::serializeSimulationToFiles(outputFilename, simData);
+        }
+        if (!success) {
             std::cout << "Could not write to output files." << std::endl;
             return 1;
         }
+        if (!tiledOutputFilename.empty()) {
+            try {
+                TiledSimulationFile::write(
+                    tiledOutputFilename, ColumnarSerializerService::convertColumnarDataToDescription(simData.mainData), simController->getWorldSize());
+            } catch (std::exception const& e) {
+                std::cout << "Could not write spatially indexed output file: " << e.what() << std::endl;
+                return 1;
+            }
+        }
 
+        if (!framesWritten) {
+            return 1;
+        }
         std::cout << "Finished" << std::endl;
     } catch (std::exception const& e) {
         std::cerr << "An uncaught exception occurred: " << e.what() << std::endl;
+        return 1;
     } catch (...) {
         std::cerr << "An unknown exception occurred." << std::endl;
+        return 1;
     }
     return 0;
 }
@@ -0,0 +1,74 @@
+#include "SettingsWatcher.h"
+
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include "EngineInterface/SerializerService.h"
+#include "EngineInterface/SimulationController.h"
+#include "EngineInterface/SimulationParametersDiffService.h"
+
+namespace
+{
+    std::optional<std::filesystem::file_time_type> getLastWriteTime(std::string const& filename)
+    {
+        std::error_code error;
+        auto result = std::filesystem::last_write_time(filename, error);
+        if (error) {
+            return std::nullopt;
+        }
+        return result;
+    }
+}
+
+SettingsWatcher::SettingsWatcher(std::string const& filename, SimulationController const& simController)
+    : _filename(filename)
+    , _simController(simController)
+{
+    _lastWriteTime = getLastWriteTime(_filename);
+    if (!SerializerService::deserializeSimulationParametersFromFile(_fileParameters, _filename)) {
+        _fileParameters = _simController->getSimulationParameters();
+    }
+}
+
+bool SettingsWatcher::update()
+{
+    auto writeTime = getLastWriteTime(_filename);
+    if (!writeTime || writeTime == _lastWriteTime) {
+        _pendingWriteTime.reset();
+        return false;
+    }
+    if (writeTime != _pendingWriteTime) {
+        _pendingWriteTime = writeTime;
+        return false;
+    }
+    _lastWriteTime = writeTime;
+    _pendingWriteTime.reset();
+
+    SimulationParameters fileParameters;
+    if (!SerializerService::deserializeSimulationParametersFromFile(fileParameters, _filename)) {
+        std::cout << "Could not read " << _filename << "." << std::endl;
+        return false;
+    }
+    auto changedFields = SimulationParametersDiffService::calcChangedFields(_fileParameters, fileParameters);
+    if (changedFields.empty()) {
+        return false;
+    }
+
+    //exact ranges of the changed fields such that runtime changes of other parameters are preserved
+    std::vector<ParameterByteRange> changedRanges;
+    SimulationParametersDiffService::calcChangedByteRanges(changedRanges, _fileParameters, fileParameters, 0);
+    auto parameters = _simController->getSimulationParameters();
+    for (auto const& range : changedRanges) {
+        std::memcpy(reinterpret_cast<char*>(&parameters) + range.offset, reinterpret_cast<char const*>(&fileParameters) + range.offset, range.size);
+    }
+    _simController->setSimulationParameters(parameters);
+    _fileParameters = fileParameters;
+
+    std::cout << "Settings reloaded:";
+    for (auto const& field : changedFields) {
+        std::cout << " " << field << (&field != &changedFields.back() ? "," : "");
+    }
+    std::cout << std::endl;
+    return true;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <filesystem>
+#include <optional>
+#include <string>
+
+#include "EngineInterface/Definitions.h"
+#include "EngineInterface/SimulationParameters.h"
+
+/**
+ * Applies modifications of a *.settings.json file to a running simulation.
+ * Only the parameters which differ from the previously read file content are taken over, others keep their current values
+ * (e.g. the positions of moving spots). A modification is applied once the modification time of the file has not changed
+ * between two calls of update() in order to skip partially written files.
+ */
+class SettingsWatcher
+{
+public:
+    SettingsWatcher(std::string const& filename, SimulationController const& simController);
+
+    //returns true if parameters have been changed
+    bool update();
+
+private:
+    std::string _filename;
+    SimulationController _simController;
+
+    std::optional<std::filesystem::file_time_type> _lastWriteTime;
+    std::optional<std::filesystem::file_time_type> _pendingWriteTime;
+    SimulationParameters _fileParameters;
+};
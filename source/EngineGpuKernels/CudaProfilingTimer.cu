@@ -0,0 +1,43 @@
+#include "CudaProfilingTimer.cuh"
+
+#include "Macros.cuh"
+
+_CudaProfilingTimer::~_CudaProfilingTimer()
+{
+    for (auto const& measurement : _measurements) {
+        cudaEventDestroy(measurement.startEvent);
+        cudaEventDestroy(measurement.stopEvent);
+    }
+}
+
+void _CudaProfilingTimer::startStage(ProfilingStage stage)
+{
+    if (_numUsedMeasurements == static_cast<int>(_measurements.size())) {
+        Measurement measurement;
+        CHECK_FOR_CUDA_ERROR(cudaEventCreate(&measurement.startEvent));
+        CHECK_FOR_CUDA_ERROR(cudaEventCreate(&measurement.stopEvent));
+        _measurements.emplace_back(measurement);
+    }
+    auto& measurement = _measurements.at(_numUsedMeasurements);
+    measurement.stage = stage;
+    CHECK_FOR_CUDA_ERROR(cudaEventRecord(measurement.startEvent));
+    _openMeasurementIndices.at(stage) = _numUsedMeasurements;
+    ++_numUsedMeasurements;
+}
+
+void _CudaProfilingTimer::stopStage(ProfilingStage stage)
+{
+    CHECK_FOR_CUDA_ERROR(cudaEventRecord(_measurements.at(_openMeasurementIndices.at(stage)).stopEvent));
+}
+
+void _CudaProfilingTimer::collectDurations(StageDurations& durations)
+{
+    for (int i = 0; i < _numUsedMeasurements; ++i) {
+        auto const& measurement = _measurements.at(i);
+        CHECK_FOR_CUDA_ERROR(cudaEventSynchronize(measurement.stopEvent));
+        float milliseconds = 0;
+        CHECK_FOR_CUDA_ERROR(cudaEventElapsedTime(&milliseconds, measurement.startEvent, measurement.stopEvent));
+        durations.at(measurement.stage) += milliseconds;
+    }
+    _numUsedMeasurements = 0;
+}
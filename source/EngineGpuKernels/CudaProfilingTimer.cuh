@@ -0,0 +1,29 @@
+#pragma once
+
+#include <vector>
+
+#include <cuda_runtime.h>
+
+#include "EngineInterface/TimestepProfiler.h"
+
+//measures the stages on the device timeline with CUDA events, the events are reused in subsequent time steps
+class _CudaProfilingTimer : public _ProfilingTimer
+{
+public:
+    ~_CudaProfilingTimer() override;
+
+    void startStage(ProfilingStage stage) override;
+    void stopStage(ProfilingStage stage) override;
+    void collectDurations(StageDurations& durations) override;  //waits for the last recorded event
+
+private:
+    struct Measurement
+    {
+        ProfilingStage stage = ProfilingStage_Physics;
+        cudaEvent_t startEvent = nullptr;
+        cudaEvent_t stopEvent = nullptr;
+    };
+    std::vector<Measurement> _measurements;
+    int _numUsedMeasurements = 0;
+    std::array<int, ProfilingStage_Count> _openMeasurementIndices = {};
+};
@@ -7,9 +7,9 @@
 
 namespace
 {
-    __device__ float getHeight(BaseMap const& map, float2 const& pos, SimulationParametersSpot const& spot)
+    __device__ float getHeight(BaseMap const& map, float2 const& pos, float2 const& spotPos, SimulationParametersSpot const& spot)
     {
-        auto dist = map.getDistance(pos, float2{spot.posX, spot.posY});
+        auto dist = map.getDistance(pos, spotPos);
         if (Orientation_Clockwise == spot.flowData.radialFlow.orientation) {
             return sqrtf(dist) * spot.flowData.radialFlow.strength;
         } else {
@@ -17,20 +17,20 @@ namespace
         }
     }
 
-    __device__ __inline__ float2 calcAcceleration(BaseMap const& map, float2 const& pos, int const& spotIndex)
+    __device__ __inline__ float2 calcAcceleration(BaseMap const& map, float2 const& pos, float2 const& spotPos, int const& spotIndex)
     {
         auto const& spot = cudaSimulationParameters.spots[spotIndex];
         switch (spot.flowType) {
         case FlowType_Radial: {
-            auto baseValue = getHeight(map, pos, spot);
-            auto downValue = getHeight(map, pos + float2{0, 1}, spot);
-            auto rightValue = getHeight(map, pos + float2{1, 0}, spot);
+            auto baseValue = getHeight(map, pos, spotPos, spot);
+            auto downValue = getHeight(map, pos + float2{0, 1}, spotPos, spot);
+            auto rightValue = getHeight(map, pos + float2{1, 0}, spotPos, spot);
             float2 result{rightValue - baseValue, downValue - baseValue};
             result = Math::rotateClockwise(result, 90.0f + spot.flowData.radialFlow.driftAngle);
             return result;
         }
         case FlowType_Central: {
-            auto centerDirection = map.getCorrectedDirection(float2{spot.posX, spot.posY} - pos);
+            auto centerDirection = map.getCorrectedDirection(spotPos - pos);
             return centerDirection * spot.flowData.centralFlow.strength / (Math::lengthSquared(centerDirection) + 50.0f);
         }
         case FlowType_Linear: {
@@ -49,6 +49,7 @@ __global__ void cudaApplyFlowFieldSettings(SimulationData data)
 {
     auto& cells = data.objects.cellPointers;
     auto partition = calcAllThreadsPartition(cells.getNumEntries());
+    auto const& positions = *data.spotAndSourcePositions;
 
     float2 accelerations[MAX_SPOTS];
     for (int index = partition.startIndex; index <= partition.endIndex; ++index) {
@@ -60,11 +61,11 @@ __global__ void cudaApplyFlowFieldSettings(SimulationData data)
         for (int i = 0; i < cudaSimulationParameters.numSpots; ++i) {
 
             if (cudaSimulationParameters.spots[i].flowType != FlowType_None) {
-                accelerations[numFlowFields] = calcAcceleration(data.cellMap, cell->pos, i);
+                accelerations[numFlowFields] = calcAcceleration(data.cellMap, cell->pos, positions.spots[i], i);
                 ++numFlowFields;
             }
         }
-        auto resultingAcceleration = SpotCalculator::calcResultingFlowField(data.cellMap, cell->pos, float2{0, 0}, accelerations);
+        auto resultingAcceleration = SpotCalculator::calcResultingFlowField(data.cellMap, positions, cell->pos, float2{0, 0}, accelerations);
         cell->shared1 += resultingAcceleration;
     }
 }
@@ -44,6 +44,7 @@ void checkAndThrowError(T result, char const *const func, const char *const file
                << "\"";
         auto text = stream.str();
         log(Priority::Important, text);
+        LoggingService::getInstance().flush();
 
         if (cudaError::cudaErrorMemoryAllocation == result) {
             throw CudaMemoryAllocationException(text);
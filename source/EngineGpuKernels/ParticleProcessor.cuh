@@ -150,8 +150,7 @@ __inline__ __device__ void ParticleProcessor::radiate(SimulationData& data, floa
 {
     if (cudaSimulationParameters.numParticleSources > 0) {
         auto sourceIndex = data.numberGen1.random(cudaSimulationParameters.numParticleSources - 1);
-        pos.x = cudaSimulationParameters.particleSources[sourceIndex].posX;
-        pos.y = cudaSimulationParameters.particleSources[sourceIndex].posY;
+        pos = data.spotAndSourcePositions->particleSources[sourceIndex];
 
         auto const& source = cudaSimulationParameters.particleSources[sourceIndex];
         if (source.shapeType == RadiationSourceShapeType_Circular) {
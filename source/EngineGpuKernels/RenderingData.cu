@@ -1,17 +1,72 @@
 ﻿#include "RenderingData.cuh"
 
+#include <algorithm>
+
+#include "RenderingTiles.cuh"
+
 void RenderingData::init() {}
 
 void RenderingData::resizeImageIfNecessary(int2 const& newSize)
 {
     if (newSize.x * newSize.y > numPixels) {
         CudaMemoryManager::getInstance().freeMemory(imageData);
+        CudaMemoryManager::getInstance().freeMemory(densityData);
         CudaMemoryManager::getInstance().acquireMemory<uint64_t>(newSize.x * newSize.y, imageData);
+        CudaMemoryManager::getInstance().acquireMemory<float>(newSize.x * newSize.y * 3, densityData);
         numPixels = newSize.x * newSize.y;
     }
 }
 
+void RenderingData::resizeWorkListsIfNecessary(int2 const& imageSize, uint64_t maxEntities)
+{
+    auto newNumTiles = RenderingTiles::calcNumTiles(imageSize);
+    auto requiredNumTiles = std::max(1, newNumTiles.x * newNumTiles.y);
+    if (requiredNumTiles > numTiles) {
+        CudaMemoryManager::getInstance().freeMemory(tileCounts);
+        CudaMemoryManager::getInstance().freeMemory(tileOffsets);
+        numTiles = requiredNumTiles;
+        CudaMemoryManager::getInstance().acquireMemory<int>(numTiles, tileCounts);
+        CudaMemoryManager::getInstance().acquireMemory<int>(numTiles + 1, tileOffsets);
+    }
+    if (maxEntities > workListSize) {
+        CudaMemoryManager::getInstance().freeMemory(workList);
+        CudaMemoryManager::getInstance().acquireMemory<int>(maxEntities, workList);
+        workListSize = maxEntities;
+    }
+}
+
+void RenderingData::resizeGridIfNecessary(int2 const& worldSize, uint64_t maxEntities)
+{
+    auto gridSize = RenderingTiles::calcGridSize(worldSize);
+    auto requiredNumGridCells = std::max(1, gridSize.x * gridSize.y);
+    if (requiredNumGridCells > numGridCells) {
+        CudaMemoryManager::getInstance().freeMemory(gridCounts);
+        CudaMemoryManager::getInstance().freeMemory(cellGridOffsets);
+        CudaMemoryManager::getInstance().freeMemory(particleGridOffsets);
+        numGridCells = requiredNumGridCells;
+        CudaMemoryManager::getInstance().acquireMemory<int>(numGridCells, gridCounts);
+        CudaMemoryManager::getInstance().acquireMemory<int>(numGridCells + 1, cellGridOffsets);
+        CudaMemoryManager::getInstance().acquireMemory<int>(numGridCells + 1, particleGridOffsets);
+    }
+    if (maxEntities > sortedIndicesSize) {
+        CudaMemoryManager::getInstance().freeMemory(sortedCellIndices);
+        CudaMemoryManager::getInstance().freeMemory(sortedParticleIndices);
+        CudaMemoryManager::getInstance().acquireMemory<int>(maxEntities, sortedCellIndices);
+        CudaMemoryManager::getInstance().acquireMemory<int>(maxEntities, sortedParticleIndices);
+        sortedIndicesSize = maxEntities;
+    }
+}
+
 void RenderingData::free()
 {
     CudaMemoryManager::getInstance().freeMemory(imageData);
+    CudaMemoryManager::getInstance().freeMemory(densityData);
+    CudaMemoryManager::getInstance().freeMemory(tileCounts);
+    CudaMemoryManager::getInstance().freeMemory(tileOffsets);
+    CudaMemoryManager::getInstance().freeMemory(workList);
+    CudaMemoryManager::getInstance().freeMemory(gridCounts);
+    CudaMemoryManager::getInstance().freeMemory(cellGridOffsets);
+    CudaMemoryManager::getInstance().freeMemory(particleGridOffsets);
+    CudaMemoryManager::getInstance().freeMemory(sortedCellIndices);
+    CudaMemoryManager::getInstance().freeMemory(sortedParticleIndices);
 }
@@ -9,8 +9,27 @@ struct RenderingData
 {
     int numPixels = 0;
     uint64_t* imageData = nullptr;  //pixel in bbbbggggrrrr format (3 x 16 bit + 16 bit unused)
+    float* densityData = nullptr;  //accumulated rgb values per pixel for the level-of-detail rendering
+
+    //work lists of the visible entities binned by screen tiles (see RenderingTiles.cuh), shared by cells and particles
+    int numTiles = 0;
+    int* tileCounts = nullptr;
+    int* tileOffsets = nullptr;  //numTiles + 1 entries
+    uint64_t workListSize = 0;
+    int* workList = nullptr;
+
+    //spatial grid over the world: indices of the cell and particle pointers sorted by grid cells, is rebuilt after each time step
+    int numGridCells = 0;
+    int* gridCounts = nullptr;
+    int* cellGridOffsets = nullptr;  //numGridCells + 1 entries
+    int* particleGridOffsets = nullptr;  //numGridCells + 1 entries
+    uint64_t sortedIndicesSize = 0;
+    int* sortedCellIndices = nullptr;
+    int* sortedParticleIndices = nullptr;
 
     void init();
     void resizeImageIfNecessary(int2 const& newSize);
+    void resizeWorkListsIfNecessary(int2 const& imageSize, uint64_t maxEntities);
+    void resizeGridIfNecessary(int2 const& worldSize, uint64_t maxEntities);
     void free();
 };
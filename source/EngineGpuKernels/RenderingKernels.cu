@@ -7,6 +7,7 @@
 
 namespace
 {
+    auto constexpr ZoomLevelForDensityRendering = 1.0f;  //below this zoom level cells and particles are accumulated per pixel
     auto constexpr ZoomLevelForConnections = 1.0f;
     auto constexpr ZoomLevelForShadedCells = 10.0f;
     auto constexpr ZoomLevelForArrows = 15.0f;
@@ -22,6 +23,17 @@ namespace
         alienAtomicAdd64(&imageData[index], rawColorToAdd);
     }
 
+    __device__ __inline__ void addToDensity(RenderingData const& renderingData, int2 const& imageSize, float2 const& imagePos, float3 const& color)
+    {
+        int2 intPos{toInt(imagePos.x), toInt(imagePos.y)};
+        if (intPos.x >= 0 && intPos.x < imageSize.x && intPos.y >= 0 && intPos.y < imageSize.y) {
+            auto index = (intPos.x + intPos.y * imageSize.x) * 3;
+            atomicAdd(&renderingData.densityData[index], color.x);
+            atomicAdd(&renderingData.densityData[index + 1], color.y);
+            atomicAdd(&renderingData.densityData[index + 2], color.z);
+        }
+    }
+
     __device__ __inline__ float3 colorToFloat3(unsigned int value)
     {
         return float3{toFloat(value & 0xff) / 255, toFloat((value >> 8) & 0xff) / 255, toFloat((value >> 16) & 0xff) / 255};
@@ -29,7 +41,100 @@ namespace
 
     __device__ __inline__ float2 mapUniversePosToVectorImagePos(float2 const& rectUpperLeft, float2 const& pos, float zoom)
     {
-        return float2{(pos.x - rectUpperLeft.x) * zoom, (pos.y - rectUpperLeft.y) * zoom};
+        return RenderingTiles::mapWorldPosToImagePos(rectUpperLeft, pos, zoom);
+    }
+
+    //returns -1 for cells outside the visible rect
+    __device__ __inline__ int
+    calcTileIndex(BaseMap const& map, Cell* cell, float2 const& rectUpperLeft, float2 const& rectLowerRight, int2 const& imageSize, float zoom, int2 const& numTiles)
+    {
+        auto cellPos = cell->pos;
+        map.correctPosition(cellPos);
+        if (!isContainedInRect(rectUpperLeft, rectLowerRight, cellPos)) {
+            return -1;
+        }
+        return RenderingTiles::calcTileIndex(mapUniversePosToVectorImagePos(rectUpperLeft, cellPos, zoom), numTiles);
+    }
+
+    //returns -1 for particles outside the image
+    __device__ __inline__ int calcTileIndex(
+        BaseMap const& map,
+        Particle* particle,
+        float2 const& rectUpperLeft,
+        float2 const& rectLowerRight,
+        int2 const& imageSize,
+        float zoom,
+        int2 const& numTiles)
+    {
+        auto particlePos = particle->absPos;
+        map.correctPosition(particlePos);
+        auto const particleImagePos = mapUniversePosToVectorImagePos(rectUpperLeft, particlePos, zoom);
+        if (!isContainedInRect({0, 0}, imageSize, particleImagePos)) {
+            return -1;
+        }
+        return RenderingTiles::calcTileIndex(particleImagePos, numTiles);
+    }
+
+    __device__ __inline__ float2 getPos(Cell* cell) { return cell->pos; }
+    __device__ __inline__ float2 getPos(Particle* particle) { return particle->absPos; }
+
+    //first call counts the entities per grid cell, second call (after cudaCalcOffsets) fills the sorted indices
+    template <typename T>
+    __device__ __inline__ void
+    binByGridCells(int2 const& universeSize, Array<T> const& entities, int* gridCounts, int const* gridOffsets, int* sortedIndices, bool fillSortedIndices)
+    {
+        auto const partition = calcAllThreadsPartition(entities.getNumEntries());
+
+        BaseMap map;
+        map.init(universeSize);
+
+        auto gridSize = RenderingTiles::calcGridSize(universeSize);
+        for (int index = partition.startIndex; index <= partition.endIndex; ++index) {
+            auto pos = getPos(entities.at(index));
+            map.correctPosition(pos);
+            RenderingTiles::binEntity(
+                index, RenderingTiles::calcGridCellIndex(pos, gridSize), gridCounts, gridOffsets, fillSortedIndices ? sortedIndices : nullptr);
+        }
+    }
+
+    //only the entities in the grid cells overlapping the visible rect are considered, each block processes whole grid rows
+    //first call counts the visible entities per tile, second call (after cudaCalcOffsets) fills the work list
+    template <typename T>
+    __device__ __inline__ void binByTiles(
+        int2 const& universeSize,
+        float2 const& rectUpperLeft,
+        float2 const& rectLowerRight,
+        Array<T> const& entities,
+        int const* gridOffsets,
+        int const* sortedIndices,
+        int2 const& imageSize,
+        float zoom,
+        RenderingData const& renderingData,
+        bool fillWorkList)
+    {
+        //particles are culled by the image bounds which may slightly exceed the rect
+        float2 visibleLowerRight{
+            max(rectLowerRight.x, rectUpperLeft.x + toFloat(imageSize.x) / zoom), max(rectLowerRight.y, rectUpperLeft.y + toFloat(imageSize.y) / zoom)};
+        auto gridSize = RenderingTiles::calcGridSize(universeSize);
+        int2 firstGridCell, lastGridCell;
+        if (!RenderingTiles::calcVisibleGridCells(rectUpperLeft, visibleLowerRight, gridSize, firstGridCell, lastGridCell)) {
+            return;
+        }
+
+        BaseMap map;
+        map.init(universeSize);
+
+        auto numTiles = RenderingTiles::calcNumTiles(imageSize);
+        for (int row = firstGridCell.y + blockIdx.x; row <= lastGridCell.y; row += gridDim.x) {
+            int startIndex, endIndex;
+            RenderingTiles::calcEntityRangeOfGridRow(gridOffsets, gridSize, firstGridCell, lastGridCell, row, startIndex, endIndex);
+            for (int index = startIndex + threadIdx.x; index < endIndex; index += blockDim.x) {
+                auto entityIndex = sortedIndices[index];
+                auto tileIndex = calcTileIndex(map, entities.at(entityIndex), rectUpperLeft, rectLowerRight, imageSize, zoom, numTiles);
+                RenderingTiles::binEntity(
+                    entityIndex, tileIndex, renderingData.tileCounts, renderingData.tileOffsets, fillWorkList ? renderingData.workList : nullptr);
+            }
+        }
     }
 
     __device__ __inline__ int3 convertHSVtoRGB(float h, float s, float v)
@@ -164,23 +269,13 @@ namespace
 
     __device__ __inline__ void drawDot(uint64_t* imageData, int2 const& imageSize, float2 const& pos, float3 const& colorToAdd)
     {
-        int2 intPos{toInt(pos.x), toInt(pos.y)};
-        if (intPos.x >= 1 && intPos.x < imageSize.x - 1 && intPos.y >= 1 && intPos.y < imageSize.y - 1) {
-
-            float2 posFrac{pos.x - intPos.x, pos.y - intPos.y};
-            unsigned int index = intPos.x + intPos.y * imageSize.x;
-
-            float3 colorToAdd1 = colorToAdd * (1.0f - posFrac.x) * (1.0f - posFrac.y);
-            drawAddingPixel(imageData, index, colorToAdd1);
-
-            float3 colorToAdd2 = colorToAdd * posFrac.x * (1.0f - posFrac.y);
-            drawAddingPixel(imageData, index + 1, colorToAdd2);
-
-            float3 colorToAdd3 = colorToAdd * (1.0f - posFrac.x) * posFrac.y;
-            drawAddingPixel(imageData, index + imageSize.x, colorToAdd3);
-
-            float3 colorToAdd4 = colorToAdd * posFrac.x * posFrac.y;
-            drawAddingPixel(imageData, index + imageSize.x + 1, colorToAdd4);
+        unsigned int index;
+        float weights[4];
+        if (RenderingTiles::calcDotPixels(imageSize, pos, index, weights)) {
+            drawAddingPixel(imageData, index, colorToAdd * weights[0]);
+            drawAddingPixel(imageData, index + 1, colorToAdd * weights[1]);
+            drawAddingPixel(imageData, index + imageSize.x, colorToAdd * weights[2]);
+            drawAddingPixel(imageData, index + imageSize.x + 1, colorToAdd * weights[3]);
         }
     }
 
@@ -236,7 +331,14 @@ namespace
 /************************************************************************/
 /* Main      															*/
 /************************************************************************/
-__global__ void cudaDrawBackground(uint64_t* imageData, int2 imageSize, int2 worldSize, float zoom, float2 rectUpperLeft, float2 rectLowerRight)
+__global__ void cudaDrawBackground(
+    uint64_t* imageData,
+    int2 imageSize,
+    int2 worldSize,
+    SpotAndSourcePositions* positions,
+    float zoom,
+    float2 rectUpperLeft,
+    float2 rectLowerRight)
 {
     int2 outsideRectUpperLeft{-min(toInt(rectUpperLeft.x * zoom), 0), -min(toInt(rectUpperLeft.y * zoom), 0)};
     int2 outsideRectLowerRight{
@@ -259,97 +361,195 @@ __global__ void cudaDrawBackground(uint64_t* imageData, int2 imageSize, int2 wor
         } else {
             float2 worldPos = {toFloat(x) / zoom + rectUpperLeft.x, toFloat(y) / zoom + rectUpperLeft.y};
 
-            auto color = SpotCalculator::calcResultingValue(map, worldPos, baseColor, spotColors);
+            auto color = SpotCalculator::calcResultingValue(map, *positions, worldPos, baseColor, spotColors);
             drawPixel(imageData, index, color);
         }
     }
 }
 
-__global__ void cudaDrawCells(uint64_t timestep, int2 universeSize, float2 rectUpperLeft, float2 rectLowerRight, Array<Cell*> cells, uint64_t* imageData, int2 imageSize, float zoom)
+__global__ void cudaResetCounts(int* counts, int numCounts)
+{
+    auto const partition = calcAllThreadsPartition(numCounts);
+    for (int index = partition.startIndex; index <= partition.endIndex; ++index) {
+        counts[index] = 0;
+    }
+}
+
+__global__ void cudaBinCellsByGridCells(int2 universeSize, Array<Cell*> cells, RenderingData renderingData, bool fillSortedIndices)
+{
+    binByGridCells(universeSize, cells, renderingData.gridCounts, renderingData.cellGridOffsets, renderingData.sortedCellIndices, fillSortedIndices);
+}
+
+__global__ void cudaBinParticlesByGridCells(int2 universeSize, Array<Particle*> particles, RenderingData renderingData, bool fillSortedIndices)
+{
+    binByGridCells(
+        universeSize, particles, renderingData.gridCounts, renderingData.particleGridOffsets, renderingData.sortedParticleIndices, fillSortedIndices);
+}
+
+__global__ void cudaBinCellsByTiles(
+    int2 universeSize,
+    float2 rectUpperLeft,
+    float2 rectLowerRight,
+    Array<Cell*> cells,
+    int2 imageSize,
+    float zoom,
+    RenderingData renderingData,
+    bool fillWorkList)
+{
+    binByTiles(
+        universeSize,
+        rectUpperLeft,
+        rectLowerRight,
+        cells,
+        renderingData.cellGridOffsets,
+        renderingData.sortedCellIndices,
+        imageSize,
+        zoom,
+        renderingData,
+        fillWorkList);
+}
+
+__global__ void cudaBinParticlesByTiles(
+    int2 universeSize,
+    float2 rectUpperLeft,
+    float2 rectLowerRight,
+    Array<Particle*> particles,
+    int2 imageSize,
+    float zoom,
+    RenderingData renderingData,
+    bool fillWorkList)
+{
+    binByTiles(
+        universeSize,
+        rectUpperLeft,
+        rectLowerRight,
+        particles,
+        renderingData.particleGridOffsets,
+        renderingData.sortedParticleIndices,
+        imageSize,
+        zoom,
+        renderingData,
+        fillWorkList);
+}
+
+//exclusive prefix sum over the counts computed by the first block (see RenderingTiles.cuh), the counts are reset for filling the bins
+__global__ void cudaCalcOffsets(int* counts, int* offsets, int numCounts)
+{
+    if (blockIdx.x != 0) {
+        return;
+    }
+    __shared__ int chunkOffsets[1024];
+
+    int startIndex, endIndex;
+    RenderingTiles::calcChunk(numCounts, threadIdx.x, blockDim.x, startIndex, endIndex);
+    chunkOffsets[threadIdx.x] = RenderingTiles::sumChunk(counts, startIndex, endIndex);
+    __syncthreads();
+
+    if (0 == threadIdx.x) {
+        offsets[numCounts] = RenderingTiles::scanChunkSums(chunkOffsets, blockDim.x);
+    }
+    __syncthreads();
+
+    RenderingTiles::writeChunkOffsets(counts, offsets, startIndex, endIndex, chunkOffsets[threadIdx.x]);
+}
+
+__global__ void cudaDrawCells(
+    uint64_t timestep,
+    int2 universeSize,
+    float2 rectUpperLeft,
+    Array<Cell*> cells,
+    RenderingData renderingData,
+    int numTiles,
+    uint64_t* imageData,
+    int2 imageSize,
+    float zoom)
 {
-    auto const partition = calcAllThreadsPartition(cells.getNumEntries());
+    auto const partition = calcAllThreadsPartition(renderingData.tileOffsets[numTiles]);
 
     BaseMap map;
     map.init(universeSize);
 
     auto shadedCells = zoom >= ZoomLevelForShadedCells;
+    auto densityRendering = zoom < ZoomLevelForDensityRendering;
     for (int index = partition.startIndex; index <= partition.endIndex; ++index) {
-        auto const& cell = cells.at(index);
+        auto const& cell = cells.at(renderingData.workList[index]);
 
         auto cellPos = cell->pos;
         map.correctPosition(cellPos);
-        if (isContainedInRect(rectUpperLeft, rectLowerRight, cellPos)) {
-            auto cellImagePos = mapUniversePosToVectorImagePos(rectUpperLeft, cellPos, zoom);
+        auto cellImagePos = mapUniversePosToVectorImagePos(rectUpperLeft, cellPos, zoom);
 
-            //draw cell
-            auto color = calcColor(cell, cell->selected);
-            auto radius = zoom / 3;
-            drawCircle(imageData, imageSize, cellImagePos, color, radius, shadedCells, true);
+        //draw cell
+        auto color = calcColor(cell, cell->selected);
+        if (densityRendering) {
+            addToDensity(renderingData, imageSize, cellImagePos, color);
+            continue;
+        }
+        auto radius = zoom / 3;
+        drawCircle(imageData, imageSize, cellImagePos, color, radius, shadedCells, true);
 
-            color = color * min((zoom - 1.0f) / 3, 1.0f);
-            if (cell->isActive() && zoom >= cudaSimulationParameters.zoomLevelNeuronalActivity) {
-                drawCircle(imageData, imageSize, cellImagePos, float3{0.3f, 0.3f, 0.3f}, radius, shadedCells);
-            }
+        color = color * min((zoom - 1.0f) / 3, 1.0f);
+        if (cell->isActive() && zoom >= cudaSimulationParameters.zoomLevelNeuronalActivity) {
+            drawCircle(imageData, imageSize, cellImagePos, float3{0.3f, 0.3f, 0.3f}, radius, shadedCells);
+        }
 
-            //draw detonation
-            if (cudaSimulationParameters.showDetonations && cell->cellFunction == CellFunction_Detonator) {
-                auto const& detonator = cell->cellFunctionData.detonator;
-                if (detonator.state == DetonatorState_Activated && detonator.countdown < 2) {
-                    auto radius = toFloat((timestep - cell->executionOrderNumber + 5) % 6 + (6 - detonator.countdown * 6));
-                    radius *= radius;
-                    radius *=  cudaSimulationParameters.cellFunctionDetonatorRadius[cell->color] * zoom / 36;
-                    drawCircle(
-                        imageData,
-                        imageSize,
-                        cellImagePos,
-                        float3{0.3f, 0.3f, 0.0f},
-                        radius,
-                        shadedCells);
-                }
+        //draw detonation
+        if (cudaSimulationParameters.showDetonations && cell->cellFunction == CellFunction_Detonator) {
+            auto const& detonator = cell->cellFunctionData.detonator;
+            if (detonator.state == DetonatorState_Activated && detonator.countdown < 2) {
+                auto radius = toFloat((timestep - cell->executionOrderNumber + 5) % 6 + (6 - detonator.countdown * 6));
+                radius *= radius;
+                radius *=  cudaSimulationParameters.cellFunctionDetonatorRadius[cell->color] * zoom / 36;
+                drawCircle(
+                    imageData,
+                    imageSize,
+                    cellImagePos,
+                    float3{0.3f, 0.3f, 0.0f},
+                    radius,
+                    shadedCells);
             }
+        }
 
-            //draw connections
-            if (zoom >= ZoomLevelForConnections) {
-                for (int i = 0; i < cell->numConnections; ++i) {
-                    auto const otherCell = cell->connections[i].cell;
-                    auto const otherCellPos = otherCell->pos;
-                    auto topologyCorrection = map.getCorrectionIncrement(cellPos, otherCellPos);
-
-                    if (Math::lengthSquared(topologyCorrection) < NEAR_ZERO) {
-                        auto distFromCellCenter = Math::normalized(otherCellPos - cellPos) / 3;
-                        auto const startImagePos = mapUniversePosToVectorImagePos(rectUpperLeft, cellPos + distFromCellCenter, zoom);
-                        auto const endImagePos = mapUniversePosToVectorImagePos(rectUpperLeft, otherCellPos - distFromCellCenter, zoom);
-                        drawLine(startImagePos, endImagePos, color, imageData, imageSize);
-                    }
+        //draw connections
+        if (zoom >= ZoomLevelForConnections) {
+            for (int i = 0; i < cell->numConnections; ++i) {
+                auto const otherCell = cell->connections[i].cell;
+                auto const otherCellPos = otherCell->pos;
+                auto topologyCorrection = map.getCorrectionIncrement(cellPos, otherCellPos);
+
+                if (Math::lengthSquared(topologyCorrection) < NEAR_ZERO) {
+                    auto distFromCellCenter = Math::normalized(otherCellPos - cellPos) / 3;
+                    auto const startImagePos = mapUniversePosToVectorImagePos(rectUpperLeft, cellPos + distFromCellCenter, zoom);
+                    auto const endImagePos = mapUniversePosToVectorImagePos(rectUpperLeft, otherCellPos - distFromCellCenter, zoom);
+                    drawLine(startImagePos, endImagePos, color, imageData, imageSize);
                 }
             }
+        }
 
-            //draw arrows
-            if (zoom >= ZoomLevelForArrows) {
-                auto inputExecutionOrderNumber = cell->inputExecutionOrderNumber;
-                if (inputExecutionOrderNumber != -1 && inputExecutionOrderNumber != cell->executionOrderNumber) {
-                    for (int i = 0; i < cell->numConnections; ++i) {
-                        auto const& otherCell = cell->connections[i].cell;
-                        if (otherCell->executionOrderNumber == inputExecutionOrderNumber && !otherCell->outputBlocked) {
-                            auto const otherCellPos = otherCell->pos;
-                            auto topologyCorrection = map.getCorrectionIncrement(cellPos, otherCellPos);
-                            if (Math::lengthSquared(topologyCorrection) > NEAR_ZERO) {
-                                continue;
-                            }
+        //draw arrows
+        if (zoom >= ZoomLevelForArrows) {
+            auto inputExecutionOrderNumber = cell->inputExecutionOrderNumber;
+            if (inputExecutionOrderNumber != -1 && inputExecutionOrderNumber != cell->executionOrderNumber) {
+                for (int i = 0; i < cell->numConnections; ++i) {
+                    auto const& otherCell = cell->connections[i].cell;
+                    if (otherCell->executionOrderNumber == inputExecutionOrderNumber && !otherCell->outputBlocked) {
+                        auto const otherCellPos = otherCell->pos;
+                        auto topologyCorrection = map.getCorrectionIncrement(cellPos, otherCellPos);
+                        if (Math::lengthSquared(topologyCorrection) > NEAR_ZERO) {
+                            continue;
+                        }
 
-                            auto const otherCellImagePos = mapUniversePosToVectorImagePos(rectUpperLeft, otherCellPos, zoom);
-                            auto const arrowEnd = mapUniversePosToVectorImagePos(rectUpperLeft, cellPos + Math::normalized(otherCellPos - cellPos) / 3, zoom);
-                            auto direction = Math::normalized(arrowEnd - otherCellImagePos);
-                            {
-                                float2 arrowPartStart = {-direction.x + direction.y, -direction.x - direction.y};
-                                arrowPartStart = arrowPartStart * zoom / 8 + arrowEnd;
-                                drawLine(arrowPartStart, arrowEnd, color, imageData, imageSize, 0.5f);
-                            }
-                            {
-                                float2 arrowPartStart = {-direction.x - direction.y, direction.x - direction.y};
-                                arrowPartStart = arrowPartStart * zoom / 8 + arrowEnd;
-                                drawLine(arrowPartStart, arrowEnd, color, imageData, imageSize, 0.5f);
-                            }
+                        auto const otherCellImagePos = mapUniversePosToVectorImagePos(rectUpperLeft, otherCellPos, zoom);
+                        auto const arrowEnd = mapUniversePosToVectorImagePos(rectUpperLeft, cellPos + Math::normalized(otherCellPos - cellPos) / 3, zoom);
+                        auto direction = Math::normalized(arrowEnd - otherCellImagePos);
+                        {
+                            float2 arrowPartStart = {-direction.x + direction.y, -direction.x - direction.y};
+                            arrowPartStart = arrowPartStart * zoom / 8 + arrowEnd;
+                            drawLine(arrowPartStart, arrowEnd, color, imageData, imageSize, 0.5f);
+                        }
+                        {
+                            float2 arrowPartStart = {-direction.x - direction.y, direction.x - direction.y};
+                            arrowPartStart = arrowPartStart * zoom / 8 + arrowEnd;
+                            drawLine(arrowPartStart, arrowEnd, color, imageData, imageSize, 0.5f);
                         }
                     }
                 }
@@ -358,34 +558,74 @@ __global__ void cudaDrawCells(uint64_t timestep, int2 universeSize, float2 rectU
     }
 }
 
-__global__ void
-cudaDrawParticles(int2 universeSize, float2 rectUpperLeft, float2 rectLowerRight, Array<Particle*> particles, uint64_t* imageData, int2 imageSize, float zoom)
+__global__ void cudaDrawParticles(
+    int2 universeSize,
+    float2 rectUpperLeft,
+    Array<Particle*> particles,
+    RenderingData renderingData,
+    int numTiles,
+    uint64_t* imageData,
+    int2 imageSize,
+    float zoom)
 {
     BaseMap map;
     map.init(universeSize);
 
-    auto const partition = calcPartition(particles.getNumEntries(), threadIdx.x + blockIdx.x * blockDim.x, blockDim.x * gridDim.x);
+    auto const partition = calcAllThreadsPartition(renderingData.tileOffsets[numTiles]);
 
+    auto densityRendering = zoom < ZoomLevelForDensityRendering;
     for (int index = partition.startIndex; index <= partition.endIndex; ++index) {
-        auto const& particle = particles.at(index);
+        auto const& particle = particles.at(renderingData.workList[index]);
         auto particlePos = particle->absPos;
         map.correctPosition(particlePos);
 
         auto const particleImagePos = mapUniversePosToVectorImagePos(rectUpperLeft, particlePos, zoom);
-        if (isContainedInRect({0, 0}, imageSize, particleImagePos)) {
-            auto const color = calcColor(particle, 0 != particle->selected);
-            auto radius = zoom / 3;
-            drawCircle(imageData, imageSize, particleImagePos, color, radius);
+        auto const color = calcColor(particle, 0 != particle->selected);
+        if (densityRendering) {
+            addToDensity(renderingData, imageSize, particleImagePos, color);
+            continue;
+        }
+        auto radius = zoom / 3;
+        drawCircle(imageData, imageSize, particleImagePos, color, radius);
+    }
+}
+
+__global__ void cudaResetDensity(RenderingData renderingData, int2 imageSize, float zoom)
+{
+    if (zoom >= ZoomLevelForDensityRendering) {
+        return;
+    }
+    auto const partition = calcAllThreadsPartition(imageSize.x * imageSize.y * 3);
+    for (int index = partition.startIndex; index <= partition.endIndex; ++index) {
+        renderingData.densityData[index] = 0;
+    }
+}
+
+__global__ void cudaDrawDensity(uint64_t* imageData, RenderingData renderingData, int2 imageSize, float zoom)
+{
+    if (zoom >= ZoomLevelForDensityRendering) {
+        return;
+    }
+
+    //exponential tone mapping: sparse pixels are about as bright as single dots, dense pixels saturate
+    auto exposure = zoom * 1.5f;
+    auto const partition = calcAllThreadsPartition(imageSize.x * imageSize.y);
+    for (int index = partition.startIndex; index <= partition.endIndex; ++index) {
+        auto r = renderingData.densityData[index * 3];
+        auto g = renderingData.densityData[index * 3 + 1];
+        auto b = renderingData.densityData[index * 3 + 2];
+        if (r + g + b > 0) {
+            drawAddingPixel(imageData, index, {1.0f - expf(-r * exposure), 1.0f - expf(-g * exposure), 1.0f - expf(-b * exposure)});
         }
     }
 }
 
-__global__ void cudaDrawRadiationSources(uint64_t* targetImage, float2 rectUpperLeft, int2 imageSize, float zoom)
+__global__ void cudaDrawRadiationSources(uint64_t* targetImage, SpotAndSourcePositions* positions, float2 rectUpperLeft, int2 imageSize, float zoom)
 {
     for (int i = 0; i < cudaSimulationParameters.numParticleSources; ++i) {
-        auto const& particleSource = cudaSimulationParameters.particleSources[i];
-        int screenPosX = toInt(particleSource.posX * zoom) - rectUpperLeft.x * zoom;
-        int screenPosY = toInt(particleSource.posY * zoom) - rectUpperLeft.y * zoom;
+        auto const& sourcePos = positions->particleSources[i];
+        int screenPosX = toInt(sourcePos.x * zoom) - rectUpperLeft.x * zoom;
+        int screenPosY = toInt(sourcePos.y * zoom) - rectUpperLeft.y * zoom;
         for (int dx = -5; dx <= 5; ++dx) {
             auto drawX = screenPosX + dx;
             auto drawY = screenPosY;
@@ -10,20 +10,60 @@
 #include "Map.cuh"
 #include "SimulationData.cuh"
 #include "RenderingData.cuh"
+#include "RenderingTiles.cuh"
 
 #include <cuda_runtime_api.h>
 #include <cuda_runtime.h>
 
-__global__ void cudaDrawBackground(uint64_t* imageData, int2 imageSize, int2 worldSize, float zoom, float2 rectUpperLeft, float2 rectLowerRight);
+__global__ void cudaDrawBackground(
+    uint64_t* imageData,
+    int2 imageSize,
+    int2 worldSize,
+    SpotAndSourcePositions* positions,
+    float zoom,
+    float2 rectUpperLeft,
+    float2 rectLowerRight);
+__global__ void cudaResetCounts(int* counts, int numCounts);
+__global__ void cudaBinCellsByGridCells(int2 universeSize, Array<Cell*> cells, RenderingData renderingData, bool fillSortedIndices);
+__global__ void cudaBinParticlesByGridCells(int2 universeSize, Array<Particle*> particles, RenderingData renderingData, bool fillSortedIndices);
+__global__ void cudaBinCellsByTiles(
+    int2 universeSize,
+    float2 rectUpperLeft,
+    float2 rectLowerRight,
+    Array<Cell*> cells,
+    int2 imageSize,
+    float zoom,
+    RenderingData renderingData,
+    bool fillWorkList);
+__global__ void cudaBinParticlesByTiles(
+    int2 universeSize,
+    float2 rectUpperLeft,
+    float2 rectLowerRight,
+    Array<Particle*> particles,
+    int2 imageSize,
+    float zoom,
+    RenderingData renderingData,
+    bool fillWorkList);
+__global__ void cudaCalcOffsets(int* counts, int* offsets, int numCounts);
 __global__ void cudaDrawCells(
     uint64_t timestep,
     int2 universeSize,
     float2 rectUpperLeft,
-    float2 rectLowerRight,
     Array<Cell*> cells,
+    RenderingData renderingData,
+    int numTiles,
+    uint64_t* imageData,
+    int2 imageSize,
+    float zoom);
+__global__ void cudaDrawParticles(
+    int2 universeSize,
+    float2 rectUpperLeft,
+    Array<Particle*> particles,
+    RenderingData renderingData,
+    int numTiles,
     uint64_t* imageData,
     int2 imageSize,
     float zoom);
-__global__ void
-cudaDrawParticles(int2 universeSize, float2 rectUpperLeft, float2 rectLowerRight, Array<Particle*> particles, uint64_t* imageData, int2 imageSize, float zoom);
-__global__ void cudaDrawRadiationSources(uint64_t* targetImage, float2 rectUpperLeft, int2 imageSize, float zoom);
+__global__ void cudaResetDensity(RenderingData renderingData, int2 imageSize, float zoom);
+__global__ void cudaDrawDensity(uint64_t* imageData, RenderingData renderingData, int2 imageSize, float zoom);
+__global__ void cudaDrawRadiationSources(uint64_t* targetImage, SpotAndSourcePositions* positions, float2 rectUpperLeft, int2 imageSize, float zoom);
@@ -2,6 +2,7 @@
 
 #include "RenderingData.cuh"
 #include "RenderingKernels.cuh"
+#include "RenderingTiles.cuh"
 
 void _RenderingKernelsLauncher::drawImage(
     GpuSettings const& gpuSettings,
@@ -14,8 +15,45 @@ void _RenderingKernelsLauncher::drawImage(
 {
     uint64_t* targetImage = renderingData.imageData;
 
-    KERNEL_CALL(cudaDrawBackground, targetImage, imageSize, data.worldSize, zoom, rectUpperLeft, rectLowerRight);
-    KERNEL_CALL(cudaDrawCells, data.timestep, data.worldSize, rectUpperLeft, rectLowerRight, data.objects.cellPointers, targetImage, imageSize, zoom);
-    KERNEL_CALL(cudaDrawParticles, data.worldSize, rectUpperLeft, rectLowerRight, data.objects.particlePointers, targetImage, imageSize, zoom);
-    KERNEL_CALL_1_1(cudaDrawRadiationSources, targetImage, rectUpperLeft, imageSize, zoom);
+    KERNEL_CALL(cudaDrawBackground, targetImage, imageSize, data.worldSize, data.spotAndSourcePositions, zoom, rectUpperLeft, rectLowerRight);
+
+    //only the visible entities are drawn, grouped by screen tiles
+    //the entities are taken from the grid cells overlapping the visible rect (see buildGrid)
+    //when zoomed out they are accumulated per pixel and drawn by cudaDrawDensity instead
+    auto numTilesXY = RenderingTiles::calcNumTiles(imageSize);
+    auto numTiles = numTilesXY.x * numTilesXY.y;
+    KERNEL_CALL(cudaResetDensity, renderingData, imageSize, zoom);
+
+    KERNEL_CALL(cudaResetCounts, renderingData.tileCounts, numTiles);
+    KERNEL_CALL(cudaBinCellsByTiles, data.worldSize, rectUpperLeft, rectLowerRight, data.objects.cellPointers, imageSize, zoom, renderingData, false);
+    KERNEL_CALL(cudaCalcOffsets, renderingData.tileCounts, renderingData.tileOffsets, numTiles);
+    KERNEL_CALL(cudaBinCellsByTiles, data.worldSize, rectUpperLeft, rectLowerRight, data.objects.cellPointers, imageSize, zoom, renderingData, true);
+    KERNEL_CALL(cudaDrawCells, data.timestep, data.worldSize, rectUpperLeft, data.objects.cellPointers, renderingData, numTiles, targetImage, imageSize, zoom);
+
+    KERNEL_CALL(cudaResetCounts, renderingData.tileCounts, numTiles);
+    KERNEL_CALL(
+        cudaBinParticlesByTiles, data.worldSize, rectUpperLeft, rectLowerRight, data.objects.particlePointers, imageSize, zoom, renderingData, false);
+    KERNEL_CALL(cudaCalcOffsets, renderingData.tileCounts, renderingData.tileOffsets, numTiles);
+    KERNEL_CALL(
+        cudaBinParticlesByTiles, data.worldSize, rectUpperLeft, rectLowerRight, data.objects.particlePointers, imageSize, zoom, renderingData, true);
+    KERNEL_CALL(cudaDrawParticles, data.worldSize, rectUpperLeft, data.objects.particlePointers, renderingData, numTiles, targetImage, imageSize, zoom);
+    KERNEL_CALL(cudaDrawDensity, targetImage, renderingData, imageSize, zoom);
+
+    KERNEL_CALL_1_1(cudaDrawRadiationSources, targetImage, data.spotAndSourcePositions, rectUpperLeft, imageSize, zoom);
+}
+
+void _RenderingKernelsLauncher::buildGrid(GpuSettings const& gpuSettings, SimulationData data, RenderingData renderingData)
+{
+    auto gridSize = RenderingTiles::calcGridSize(data.worldSize);
+    auto numGridCells = gridSize.x * gridSize.y;
+
+    KERNEL_CALL(cudaResetCounts, renderingData.gridCounts, numGridCells);
+    KERNEL_CALL(cudaBinCellsByGridCells, data.worldSize, data.objects.cellPointers, renderingData, false);
+    KERNEL_CALL(cudaCalcOffsets, renderingData.gridCounts, renderingData.cellGridOffsets, numGridCells);
+    KERNEL_CALL(cudaBinCellsByGridCells, data.worldSize, data.objects.cellPointers, renderingData, true);
+
+    KERNEL_CALL(cudaResetCounts, renderingData.gridCounts, numGridCells);
+    KERNEL_CALL(cudaBinParticlesByGridCells, data.worldSize, data.objects.particlePointers, renderingData, false);
+    KERNEL_CALL(cudaCalcOffsets, renderingData.gridCounts, renderingData.particleGridOffsets, numGridCells);
+    KERNEL_CALL(cudaBinParticlesByGridCells, data.worldSize, data.objects.particlePointers, renderingData, true);
 }
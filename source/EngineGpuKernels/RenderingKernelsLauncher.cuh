@@ -20,4 +20,7 @@ public:
         float zoom,
         SimulationData data,
         RenderingData renderingData);
+
+    //sorts the entities by grid cells such that drawImage only processes the grid cells overlapping the visible rect
+    void buildGrid(GpuSettings const& gpuSettings, SimulationData data, RenderingData renderingData);
 };
@@ -0,0 +1,175 @@
+#pragma once
+
+#include <cstdint>
+
+#include <vector_types.h>
+
+//the functions in this file do not depend on the CUDA runtime and can therefore also be used and tested on the host
+#if defined(__CUDACC__)
+#define RENDERING_TILES_FUNC __host__ __device__ __inline__
+#else
+#define RENDERING_TILES_FUNC inline
+#endif
+
+/**
+ * The visible entities are binned by screen tiles before drawing:
+ * 1) a spatial grid over the world is built after each time step, i.e. the entity indices are sorted by grid cells
+ *    (count per grid cell, exclusive prefix sum, scatter)
+ * 2) only the grid cells overlapping the visible rect are enumerated and their entities are binned by screen tiles in the same way
+ * The draw kernels then only process the per-tile work lists, i.e. neighboring threads draw neighboring entities.
+ * The binning routines below are executed per entity/chunk by the kernels and sequentially on the host in the tests.
+ */
+namespace RenderingTiles
+{
+    auto constexpr TileSize = 32;  //in pixels
+    auto constexpr GridCellSize = 16;  //in world units
+
+    RENDERING_TILES_FUNC int2 calcNumTiles(int2 const& imageSize)
+    {
+        return {(imageSize.x + TileSize - 1) / TileSize, (imageSize.y + TileSize - 1) / TileSize};
+    }
+
+    RENDERING_TILES_FUNC float2 mapWorldPosToImagePos(float2 const& rectUpperLeft, float2 const& pos, float zoom)
+    {
+        return float2{(pos.x - rectUpperLeft.x) * zoom, (pos.y - rectUpperLeft.y) * zoom};
+    }
+
+    //expects a visible position, positions on the lower right border belong to the last tile
+    RENDERING_TILES_FUNC int calcTileIndex(float2 const& imagePos, int2 const& numTiles)
+    {
+        auto x = static_cast<int>(imagePos.x) / TileSize;
+        auto y = static_cast<int>(imagePos.y) / TileSize;
+        x = x < 0 ? 0 : (x >= numTiles.x ? numTiles.x - 1 : x);
+        y = y < 0 ? 0 : (y >= numTiles.y ? numTiles.y - 1 : y);
+        return x + y * numTiles.x;
+    }
+
+    RENDERING_TILES_FUNC int2 calcGridSize(int2 const& worldSize)
+    {
+        return {(worldSize.x + GridCellSize - 1) / GridCellSize, (worldSize.y + GridCellSize - 1) / GridCellSize};
+    }
+
+    //expects a position inside the world
+    RENDERING_TILES_FUNC int calcGridCellIndex(float2 const& pos, int2 const& gridSize)
+    {
+        auto x = static_cast<int>(pos.x) / GridCellSize;
+        auto y = static_cast<int>(pos.y) / GridCellSize;
+        x = x < 0 ? 0 : (x >= gridSize.x ? gridSize.x - 1 : x);
+        y = y < 0 ? 0 : (y >= gridSize.y ? gridSize.y - 1 : y);
+        return x + y * gridSize.x;
+    }
+
+    //-1 and size denote coordinates before and after the world
+    RENDERING_TILES_FUNC int calcGridCoordinate(float value, int size)
+    {
+        if (value < 0) {
+            return -1;
+        }
+        auto result = static_cast<int>(value) / GridCellSize;
+        return result >= size ? size : result;
+    }
+
+    //grid cells overlapping the visible part of the world, returns false if there are none
+    RENDERING_TILES_FUNC bool
+    calcVisibleGridCells(float2 const& rectUpperLeft, float2 const& rectLowerRight, int2 const& gridSize, int2& firstGridCell, int2& lastGridCell)
+    {
+        firstGridCell = {calcGridCoordinate(rectUpperLeft.x, gridSize.x), calcGridCoordinate(rectUpperLeft.y, gridSize.y)};
+        lastGridCell = {calcGridCoordinate(rectLowerRight.x, gridSize.x), calcGridCoordinate(rectLowerRight.y, gridSize.y)};
+        firstGridCell = {firstGridCell.x < 0 ? 0 : firstGridCell.x, firstGridCell.y < 0 ? 0 : firstGridCell.y};
+        lastGridCell = {lastGridCell.x >= gridSize.x ? gridSize.x - 1 : lastGridCell.x, lastGridCell.y >= gridSize.y ? gridSize.y - 1 : lastGridCell.y};
+        return firstGridCell.x <= lastGridCell.x && firstGridCell.y <= lastGridCell.y;
+    }
+
+    //the sorted entity indices of consecutive grid cells in a row are adjacent, i.e. each visible row is a single range [startIndex, endIndex)
+    RENDERING_TILES_FUNC void calcEntityRangeOfGridRow(
+        int const* gridOffsets,
+        int2 const& gridSize,
+        int2 const& firstGridCell,
+        int2 const& lastGridCell,
+        int row,
+        int& startIndex,
+        int& endIndex)
+    {
+        startIndex = gridOffsets[firstGridCell.x + row * gridSize.x];
+        endIndex = gridOffsets[lastGridCell.x + 1 + row * gridSize.x];
+    }
+
+    RENDERING_TILES_FUNC int incrementCount(int* count)
+    {
+#if defined(__CUDA_ARCH__)
+        return atomicAdd(count, 1);
+#else
+        return (*count)++;
+#endif
+    }
+
+    //executed for each entity twice: first for counting (entityIndices == nullptr), then after calculating the offsets for filling
+    RENDERING_TILES_FUNC void binEntity(int entityIndex, int binIndex, int* counts, int const* offsets, int* entityIndices)
+    {
+        if (binIndex == -1) {
+            return;
+        }
+        auto positionInBin = incrementCount(&counts[binIndex]);
+        if (entityIndices) {
+            entityIndices[offsets[binIndex] + positionInBin] = entityIndex;
+        }
+    }
+
+    //exclusive prefix sum over the counts in chunks (one chunk per thread):
+    //1) sumChunk for each chunk, 2) scanChunkSums once, 3) writeChunkOffsets for each chunk
+    RENDERING_TILES_FUNC void calcChunk(int numEntries, int chunkIndex, int numChunks, int& startIndex, int& endIndex)
+    {
+        auto chunkSize = (numEntries + numChunks - 1) / numChunks;
+        startIndex = chunkIndex * chunkSize;
+        endIndex = startIndex + chunkSize < numEntries ? startIndex + chunkSize : numEntries;
+        startIndex = startIndex < endIndex ? startIndex : endIndex;
+    }
+
+    RENDERING_TILES_FUNC int sumChunk(int const* counts, int startIndex, int endIndex)
+    {
+        int result = 0;
+        for (int index = startIndex; index < endIndex; ++index) {
+            result += counts[index];
+        }
+        return result;
+    }
+
+    //replaces the chunk sums by the chunk offsets and returns the total sum
+    RENDERING_TILES_FUNC int scanChunkSums(int* chunkSums, int numChunks)
+    {
+        int result = 0;
+        for (int i = 0; i < numChunks; ++i) {
+            auto sum = chunkSums[i];
+            chunkSums[i] = result;
+            result += sum;
+        }
+        return result;
+    }
+
+    //the counts are reset for filling the bins
+    RENDERING_TILES_FUNC void writeChunkOffsets(int* counts, int* offsets, int startIndex, int endIndex, int chunkOffset)
+    {
+        for (int index = startIndex; index < endIndex; ++index) {
+            offsets[index] = chunkOffset;
+            chunkOffset += counts[index];
+            counts[index] = 0;
+        }
+    }
+
+    //pixel index and weights for distributing a dot bilinearly on 4 pixels (index, index + 1, index + width, index + width + 1),
+    //returns false if the dot is too close to the image border
+    RENDERING_TILES_FUNC bool calcDotPixels(int2 const& imageSize, float2 const& pos, unsigned int& index, float (&weights)[4])
+    {
+        int2 intPos{static_cast<int>(pos.x), static_cast<int>(pos.y)};
+        if (intPos.x < 1 || intPos.x >= imageSize.x - 1 || intPos.y < 1 || intPos.y >= imageSize.y - 1) {
+            return false;
+        }
+        float2 posFrac{pos.x - intPos.x, pos.y - intPos.y};
+        index = intPos.x + intPos.y * imageSize.x;
+        weights[0] = (1.0f - posFrac.x) * (1.0f - posFrac.y);
+        weights[1] = posFrac.x * (1.0f - posFrac.y);
+        weights[2] = (1.0f - posFrac.x) * posFrac.y;
+        weights[3] = posFrac.x * posFrac.y;
+        return true;
+    }
+}
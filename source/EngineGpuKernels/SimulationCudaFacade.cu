@@ -1,5 +1,7 @@
 #include "SimulationCudaFacade.cuh"
 
+#include <algorithm>
+#include <cstring>
 #include <functional>
 #include <iostream>
 #include <list>
@@ -17,6 +19,7 @@
 #include "EngineInterface/SimulationParameters.h"
 #include "EngineInterface/GpuSettings.h"
 #include "EngineInterface/SpaceCalculator.h"
+#include "EngineInterface/TimestepProfiler.h"
 
 #include "DataAccessKernels.cuh"
 #include "TOs.cuh"
@@ -24,6 +27,7 @@
 #include "GarbageCollectorKernels.cuh"
 #include "ConstantMemory.cuh"
 #include "CudaMemoryManager.cuh"
+#include "CudaProfilingTimer.cuh"
 #include "SimulationStatistics.cuh"
 #include "Objects.cuh"
 #include "Map.cuh"
@@ -62,7 +66,8 @@ _SimulationCudaFacade::_SimulationCudaFacade(uint64_t timestep, Settings const&
     _cudaSelectionResult = std::make_shared<SelectionResult>();
     _cudaAccessTO = std::make_shared<DataTO>();
     _cudaSimulationStatistics = std::make_shared<SimulationStatistics>();
-    _statisticsService = std::make_shared<_StatisticsService>();
+    _statisticsService = std::make_shared<_StatisticsService>(_statisticsHistory);
+    _profiler = std::make_shared<_TimestepProfiler>(std::make_shared<_CudaProfilingTimer>());
 
     _cudaSimulationData->init({settings.generalSettings.worldSizeX, settings.generalSettings.worldSizeY}, timestep);
     _cudaRenderingData->init();
@@ -98,10 +103,19 @@ _SimulationCudaFacade::~_SimulationCudaFacade()
     CudaMemoryManager::getInstance().freeMemory(_cudaAccessTO->numParticles);
     CudaMemoryManager::getInstance().freeMemory(_cudaAccessTO->numAuxiliaryData);
 
-    cudaDeviceReset();
+    _profiler.reset();  //releases the CUDA events
+
+    if (_deviceResetOnDestruction) {
+        cudaDeviceReset();
+    }
     log(Priority::Important, "close simulation");
 }
 
+void _SimulationCudaFacade::setDeviceResetOnDestruction(bool value)
+{
+    _deviceResetOnDestruction = value;
+}
+
 void* _SimulationCudaFacade::registerImageResource(GLuint image)
 {
     //unregister old resource
@@ -119,13 +133,18 @@ void* _SimulationCudaFacade::registerImageResource(GLuint image)
 void _SimulationCudaFacade::calcTimestep(uint64_t timesteps, bool forceUpdateStatistics)
 {
     for (uint64_t i = 0; i < timesteps; ++i) {
+        _profiler->beginTimestep(getCurrentTimestep());
         checkAndProcessSimulationParameterChanges();
 
         auto simulationData = getSimulationDataIntern();
-        _simulationKernels->calcTimestep(_settings, simulationData, *_cudaSimulationStatistics);
+        _simulationKernels->calcTimestep(_settings, simulationData, *_cudaSimulationStatistics, *_profiler);
         syncAndCheck();
 
         automaticResizeArrays();
+        _isRenderingGridValid = false;
+        if (_isRenderingGridUsed) {
+            updateRenderingGrid();
+        }
 
         {
             std::lock_guard lock(_mutexForSimulationData);
@@ -135,23 +154,30 @@ void _SimulationCudaFacade::calcTimestep(uint64_t timesteps, bool forceUpdateSta
         {
             std::lock_guard lock(_mutexForSimulationParameters);
             if (_simulationKernels->updateSimulationParametersAfterTimestep(_settings, simulationData, statistics)) {
-                CHECK_FOR_CUDA_ERROR(
-                    cudaMemcpyToSymbol(cudaSimulationParameters, &_settings.simulationParameters, sizeof(SimulationParameters), 0, cudaMemcpyHostToDevice));
+                uploadSimulationParameters();
             }
         }
         auto now = std::chrono::steady_clock::now();
         if (!_lastStatisticsUpdateTime || now - *_lastStatisticsUpdateTime > StatisticsUpdate) {
             _lastStatisticsUpdateTime = now;
             updateStatistics();
+            updateExternalEnergy();
+        }
+
+        //reading the entity counts requires a device-to-host transfer and is therefore only done while profiling
+        if (_profiler->isRecording()) {
+            _profiler->endTimestep(_cudaSimulationData->objects.cells.getNumEntries_host(), _cudaSimulationData->objects.particles.getNumEntries_host());
         }
     }
     if (forceUpdateStatistics) {
         updateStatistics();
+        _statisticsService->flush();  //callers calculating a fixed number of time steps (e.g. CLI, tests) expect an up-to-date history
     }
 }
 
 void _SimulationCudaFacade::applyCataclysm(int power)
 {
+    _isRenderingGridValid = false;
     for (int i = 0; i < power; ++i) {
         _editKernels->applyCataclysm(_settings.gpuSettings, getSimulationDataIntern());
         syncAndCheck();
@@ -174,11 +200,7 @@ void _SimulationCudaFacade::drawVectorGraphics(
     cudaArray* mappedArray;
     CHECK_FOR_CUDA_ERROR(cudaGraphicsSubResourceGetMappedArray(&mappedArray, cudaResourceImpl, 0, 0));
 
-    _cudaRenderingData->resizeImageIfNecessary(imageSize);
-
-    _renderingKernels->drawImage(
-        _settings.gpuSettings, rectUpperLeft, rectLowerRight, imageSize, static_cast<float>(zoom), getSimulationDataIntern(), *_cudaRenderingData);
-    syncAndCheck();
+    drawImage(rectUpperLeft, rectLowerRight, imageSize, zoom);
 
     const size_t widthBytes = sizeof(uint64_t) * imageSize.x;
     CHECK_FOR_CUDA_ERROR(cudaMemcpy2DToArray(
@@ -194,6 +216,20 @@ void _SimulationCudaFacade::drawVectorGraphics(
     CHECK_FOR_CUDA_ERROR(cudaGraphicsUnmapResources(1, &cudaResourceImpl));
 }
 
+void _SimulationCudaFacade::drawVectorGraphicsToHost(
+    float2 const& rectUpperLeft,
+    float2 const& rectLowerRight,
+    int2 const& imageSize,
+    double zoom,
+    uint64_t* hostImage)
+{
+    checkAndProcessSimulationParameterChanges();
+
+    drawImage(rectUpperLeft, rectLowerRight, imageSize, zoom);
+    CHECK_FOR_CUDA_ERROR(
+        cudaMemcpy(hostImage, _cudaRenderingData->imageData, sizeof(uint64_t) * imageSize.x * imageSize.y, cudaMemcpyDeviceToHost));
+}
+
 void _SimulationCudaFacade::getSimulationData(
     int2 const& rectUpperLeft,
     int2 const& rectLowerRight,
@@ -230,19 +266,28 @@ void _SimulationCudaFacade::getInspectedSimulationData(std::vector<uint64_t> ent
     copyDataTOtoHost(dataTO);
 }
 
-void _SimulationCudaFacade::getOverlayData(int2 const& rectUpperLeft, int2 const& rectLowerRight, DataTO const& dataTO)
+void _SimulationCudaFacade::getOverlayData_async(int2 const& rectUpperLeft, int2 const& rectLowerRight, DataTO const& dataTO)
 {
     _dataAccessKernels->getOverlayData(_settings.gpuSettings, getSimulationDataIntern(), rectUpperLeft, rectLowerRight, *_cudaAccessTO);
     syncAndCheck();
 
     copyToHost(dataTO.numCells, _cudaAccessTO->numCells);
     copyToHost(dataTO.numParticles, _cudaAccessTO->numParticles);
-    copyToHost(dataTO.cells, _cudaAccessTO->cells, *dataTO.numCells);
-    copyToHost(dataTO.particles, _cudaAccessTO->particles, *dataTO.numParticles);
+
+    //subsequent work on the default stream (including the blocking copies above of the next access) is ordered after these copies
+    CHECK_FOR_CUDA_ERROR(cudaMemcpyAsync(dataTO.cells, _cudaAccessTO->cells, sizeof(CellTO) * *dataTO.numCells, cudaMemcpyDeviceToHost));
+    CHECK_FOR_CUDA_ERROR(
+        cudaMemcpyAsync(dataTO.particles, _cudaAccessTO->particles, sizeof(ParticleTO) * *dataTO.numParticles, cudaMemcpyDeviceToHost));
+}
+
+void _SimulationCudaFacade::waitForTransfersToHost()
+{
+    CHECK_FOR_CUDA_ERROR(cudaStreamSynchronize(0));
 }
 
 void _SimulationCudaFacade::addAndSelectSimulationData(DataTO const& dataTO)
 {
+    _isRenderingGridValid = false;
     copyDataTOtoDevice(dataTO);
     _editKernels->removeSelection(_settings.gpuSettings, getSimulationDataIntern());
     _dataAccessKernels->addData(_settings.gpuSettings, getSimulationDataIntern(), *_cudaAccessTO, true, true);
@@ -252,6 +297,7 @@ void _SimulationCudaFacade::addAndSelectSimulationData(DataTO const& dataTO)
 
 void _SimulationCudaFacade::setSimulationData(DataTO const& dataTO)
 {
+    _isRenderingGridValid = false;
     copyDataTOtoDevice(dataTO);
     _dataAccessKernels->clearData(_settings.gpuSettings, getSimulationDataIntern());
     _dataAccessKernels->addData(_settings.gpuSettings, getSimulationDataIntern(), *_cudaAccessTO, false, false);
@@ -261,6 +307,7 @@ void _SimulationCudaFacade::setSimulationData(DataTO const& dataTO)
 
 void _SimulationCudaFacade::removeSelectedObjects(bool includeClusters)
 {
+    _isRenderingGridValid = false;
     _editKernels->removeSelectedObjects(_settings.gpuSettings, getSimulationDataIntern(), includeClusters);
     syncAndCheck();
     updateStatistics();
@@ -268,6 +315,7 @@ void _SimulationCudaFacade::removeSelectedObjects(bool includeClusters)
 
 void _SimulationCudaFacade::relaxSelectedObjects(bool includeClusters)
 {
+    _isRenderingGridValid = false;
     _editKernels->relaxSelectedObjects(_settings.gpuSettings, getSimulationDataIntern(), includeClusters);
     syncAndCheck();
 }
@@ -298,6 +346,7 @@ void _SimulationCudaFacade::setBarrier(bool value, bool includeClusters)
 
 void _SimulationCudaFacade::changeInspectedSimulationData(DataTO const& changeDataTO)
 {
+    _isRenderingGridValid = false;
     copyDataTOtoDevice(changeDataTO);
     _editKernels->changeSimulationData(_settings.gpuSettings, getSimulationDataIntern(), *_cudaAccessTO);
     syncAndCheck();
@@ -339,6 +388,7 @@ void _SimulationCudaFacade::setSelection(AreaSelectionData const& selectionData)
 
 void _SimulationCudaFacade::shallowUpdateSelectedObjects(ShallowUpdateSelectionData const& shallowUpdateData)
 {
+    _isRenderingGridValid = false;
     _editKernels->shallowUpdateSelectedObjects(_settings.gpuSettings, getSimulationDataIntern(), shallowUpdateData);
     syncAndCheck();
 
@@ -390,7 +440,22 @@ void _SimulationCudaFacade::setGpuConstants(GpuSettings const& gpuConstants)
 SimulationParameters _SimulationCudaFacade::getSimulationParameters() const
 {
     std::lock_guard lock(_mutexForSimulationParameters);
-    return _newSimulationParameters ? *_newSimulationParameters : _settings.simulationParameters;
+    if (_newSimulationParameters) {
+        return *_newSimulationParameters;
+    }
+
+    //positions of moving spots and particle sources are returned for the current time step
+    auto result = _settings.simulationParameters;
+    auto timestep = getCurrentTimestep();
+    auto worldSizeX = toFloat(_settings.generalSettings.worldSizeX);
+    auto worldSizeY = toFloat(_settings.generalSettings.worldSizeY);
+    for (int i = 0; i < result.numParticleSources; ++i) {
+        rebaseMotion(result.particleSources[i], timestep, result.timestepSize, worldSizeX, worldSizeY);
+    }
+    for (int i = 0; i < result.numSpots; ++i) {
+        rebaseMotion(result.spots[i], timestep, result.timestepSize, worldSizeX, worldSizeY);
+    }
+    return result;
 }
 
 void _SimulationCudaFacade::setSimulationParameters(SimulationParameters const& parameters)
@@ -420,6 +485,7 @@ RawStatisticsData _SimulationCudaFacade::getRawStatistics()
 
 void _SimulationCudaFacade::updateStatistics()
 {
+    auto startTimepoint = std::chrono::steady_clock::now();
     _statisticsKernels->updateStatistics(_settings.gpuSettings, getSimulationDataIntern(), *_cudaSimulationStatistics);
     syncAndCheck();
 
@@ -427,17 +493,21 @@ void _SimulationCudaFacade::updateStatistics()
         std::lock_guard lock(_mutexForStatistics);
         _statisticsData = _cudaSimulationStatistics->getStatistics();
     }
-    _statisticsService->addDataPoint(_statisticsHistory, _statisticsData->timeline, getCurrentTimestep());
+    _statisticsService->addDataPoint(_statisticsData->timeline, getCurrentTimestep());
+    _profiler->addStageDuration(ProfilingStage_Statistics, std::chrono::steady_clock::now() - startTimepoint);
 }
 
 StatisticsHistory const& _SimulationCudaFacade::getStatisticsHistory() const
 {
+    //readers should see the data points of all timesteps calculated so far
+    _statisticsService->flush();
     return _statisticsHistory;
 }
 
 void _SimulationCudaFacade::setStatisticsHistory(StatisticsHistoryData const& data)
 {
-    _statisticsService->rewriteHistory(_statisticsHistory, data, getCurrentTimestep());
+    _statisticsService->rewriteHistory(data, getCurrentTimestep());
+    _statisticsService->flush();
 }
 
 void _SimulationCudaFacade::resetTimeIntervalStatistics()
@@ -445,6 +515,21 @@ void _SimulationCudaFacade::resetTimeIntervalStatistics()
     _cudaSimulationStatistics->resetAccumulatedStatistics();
 }
 
+bool _SimulationCudaFacade::isProfilingEnabled() const
+{
+    return _profiler->isEnabled();
+}
+
+void _SimulationCudaFacade::setProfilingEnabled(bool value)
+{
+    _profiler->setEnabled(value);
+}
+
+std::vector<TimestepProfile> _SimulationCudaFacade::getTimestepProfiles() const
+{
+    return _profiler->getProfiles();
+}
+
 uint64_t _SimulationCudaFacade::getCurrentTimestep() const
 {
     std::lock_guard lock(_mutexForSimulationData);
@@ -457,11 +542,13 @@ void _SimulationCudaFacade::setCurrentTimestep(uint64_t timestep)
         std::lock_guard lock(_mutexForSimulationData);
         _cudaSimulationData->timestep = timestep;
     }
-    _statisticsService->resetTime(_statisticsHistory, timestep);
+    _statisticsService->resetTime(timestep);
+    _statisticsService->flush();
 }
 
 void _SimulationCudaFacade::clear()
 {
+    _isRenderingGridValid = false;
     _dataAccessKernels->clearData(_settings.gpuSettings, getSimulationDataIntern());
     syncAndCheck();
 }
@@ -475,15 +562,8 @@ void _SimulationCudaFacade::resizeArraysIfNecessary(ArraySizes const& additional
 
 void _SimulationCudaFacade::testOnly_mutate(uint64_t cellId, MutationType mutationType)
 {
-    {
-        std::lock_guard lock(_mutexForSimulationParameters);
-        if (_newSimulationParameters) {
-            _settings.simulationParameters = *_newSimulationParameters;
-            CHECK_FOR_CUDA_ERROR(
-                cudaMemcpyToSymbol(cudaSimulationParameters, &*_newSimulationParameters, sizeof(SimulationParameters), 0, cudaMemcpyHostToDevice));
-            _newSimulationParameters.reset();
-        }
-    }
+    _isRenderingGridValid = false;
+    checkAndProcessSimulationParameterChanges();
     _testKernels->testOnly_mutate(_settings.gpuSettings, getSimulationDataIntern(), cellId, mutationType);
     syncAndCheck();
 
@@ -505,6 +585,21 @@ void _SimulationCudaFacade::initCuda()
     log(Priority::Important, "device " + std::to_string(_gpuInfo.deviceNumber) + " selected");
 }
 
+void* _SimulationCudaFacade::allocatePinnedHostMemory(uint64_t size)
+{
+    void* result = nullptr;
+    if (cudaHostAlloc(&result, size, cudaHostAllocDefault) != cudaSuccess) {
+        cudaGetLastError(); //reset error code
+        return nullptr;
+    }
+    return result;
+}
+
+void _SimulationCudaFacade::freePinnedHostMemory(void* memory)
+{
+    cudaFreeHost(memory);
+}
+
 auto _SimulationCudaFacade::checkAndReturnGpuInfo() -> GpuInfo
 {
     static std::optional<GpuInfo> cachedResult;
@@ -557,6 +652,33 @@ void _SimulationCudaFacade::syncAndCheck()
     CHECK_FOR_CUDA_ERROR(cudaGetLastError());
 }
 
+void _SimulationCudaFacade::drawImage(float2 const& rectUpperLeft, float2 const& rectLowerRight, int2 const& imageSize, double zoom)
+{
+    _cudaRenderingData->resizeImageIfNecessary(imageSize);
+    _cudaRenderingData->resizeWorkListsIfNecessary(
+        imageSize,
+        std::max(_cudaSimulationData->objects.cellPointers.getSize_host(), _cudaSimulationData->objects.particlePointers.getSize_host()));
+
+    _isRenderingGridUsed = true;
+    if (!_isRenderingGridValid) {
+        updateRenderingGrid();
+    }
+
+    _renderingKernels->drawImage(
+        _settings.gpuSettings, rectUpperLeft, rectLowerRight, imageSize, static_cast<float>(zoom), getSimulationDataIntern(), *_cudaRenderingData);
+    syncAndCheck();
+}
+
+void _SimulationCudaFacade::updateRenderingGrid()
+{
+    _cudaRenderingData->resizeGridIfNecessary(
+        _cudaSimulationData->worldSize,
+        std::max(_cudaSimulationData->objects.cellPointers.getSize_host(), _cudaSimulationData->objects.particlePointers.getSize_host()));
+    _renderingKernels->buildGrid(_settings.gpuSettings, getSimulationDataIntern(), *_cudaRenderingData);
+    syncAndCheck();
+    _isRenderingGridValid = true;
+}
+
 void _SimulationCudaFacade::copyDataTOtoDevice(DataTO const& dataTO)
 {
     copyToDevice(_cudaAccessTO->numCells, dataTO.numCells);
@@ -574,9 +696,13 @@ void _SimulationCudaFacade::copyDataTOtoHost(DataTO const& dataTO)
     copyToHost(dataTO.numParticles, _cudaAccessTO->numParticles);
     copyToHost(dataTO.numAuxiliaryData, _cudaAccessTO->numAuxiliaryData);
 
-    copyToHost(dataTO.cells, _cudaAccessTO->cells, *dataTO.numCells);
-    copyToHost(dataTO.particles, _cudaAccessTO->particles, *dataTO.numParticles);
-    copyToHost(dataTO.auxiliaryData, _cudaAccessTO->auxiliaryData, *dataTO.numAuxiliaryData);
+    //the arrays are copied asynchronously (overlapping if the host memory is page-locked) and synchronized once
+    CHECK_FOR_CUDA_ERROR(cudaMemcpyAsync(dataTO.cells, _cudaAccessTO->cells, sizeof(CellTO) * *dataTO.numCells, cudaMemcpyDeviceToHost));
+    CHECK_FOR_CUDA_ERROR(
+        cudaMemcpyAsync(dataTO.particles, _cudaAccessTO->particles, sizeof(ParticleTO) * *dataTO.numParticles, cudaMemcpyDeviceToHost));
+    CHECK_FOR_CUDA_ERROR(
+        cudaMemcpyAsync(dataTO.auxiliaryData, _cudaAccessTO->auxiliaryData, *dataTO.numAuxiliaryData, cudaMemcpyDeviceToHost));
+    CHECK_FOR_CUDA_ERROR(cudaStreamSynchronize(0));
 }
 
 void _SimulationCudaFacade::automaticResizeArrays()
@@ -594,12 +720,16 @@ void _SimulationCudaFacade::automaticResizeArrays()
 
 void _SimulationCudaFacade::resizeArrays(ArraySizes const& additionals)
 {
+    _isRenderingGridValid = false;
     log(Priority::Important, "resize arrays");
+    auto startTimepoint = std::chrono::steady_clock::now();
 
     _cudaSimulationData->resizeTargetObjects(additionals);
     if (!_cudaSimulationData->isEmpty()) {
+        auto garbageCollectionStartTimepoint = std::chrono::steady_clock::now();
         _garbageCollectorKernels->copyArrays(_settings.gpuSettings, getSimulationDataIntern());
         syncAndCheck();
+        logPerformanceEvent(PerformanceEvent::GarbageCollection, std::chrono::steady_clock::now() - garbageCollectionStartTimepoint);
 
         _cudaSimulationData->resizeObjects();
 
@@ -628,19 +758,74 @@ void _SimulationCudaFacade::resizeArrays(ArraySizes const& additionals)
 
     auto const memorySizeAfter = CudaMemoryManager::getInstance().getSizeOfAcquiredMemory();
     log(Priority::Important, std::to_string(memorySizeAfter / (1024 * 1024)) + " MB GPU memory used");
+
+    auto duration = std::chrono::steady_clock::now() - startTimepoint;
+    logPerformanceEvent(PerformanceEvent::ResizeArrays, duration);
+    _profiler->addStageDuration(ProfilingStage_ResizeArrays, duration);
 }
 
 void _SimulationCudaFacade::checkAndProcessSimulationParameterChanges()
 {
     std::lock_guard lock(_mutexForSimulationParameters);
     if (_newSimulationParameters) {
+        //the external energy pool on the device is only overwritten if the caller has changed the value last set by the host
+        auto const& newExternalEnergy = _newSimulationParameters->cellFunctionConstructorExternalEnergy;
+        auto const& lastExternalEnergy = _settings.simulationParameters.cellFunctionConstructorExternalEnergy;
+        auto uploadExternalEnergy =
+            !_isExternalEnergyUploaded || !std::equal(std::begin(newExternalEnergy), std::end(newExternalEnergy), std::begin(lastExternalEnergy));
+
         _settings.simulationParameters = *_newSimulationParameters;
-        CHECK_FOR_CUDA_ERROR(cudaMemcpyToSymbol(cudaSimulationParameters, &*_newSimulationParameters, sizeof(SimulationParameters), 0, cudaMemcpyHostToDevice));
         _newSimulationParameters.reset();
 
         if (_cudaSimulationData) {
-            _simulationKernels->prepareForSimulationParametersChanges(_settings, getSimulationDataIntern());
+            if (!uploadExternalEnergy) {
+                _simulationKernels->getExternalEnergy(_settings.simulationParameters.cellFunctionConstructorExternalEnergy, getSimulationDataIntern());
+            }
+
+            //the given positions of spots and particle sources refer to the current time step
+            auto timestep = getCurrentTimestep();
+            auto& parameters = _settings.simulationParameters;
+            for (int i = 0; i < MAX_PARTICLE_SOURCES; ++i) {
+                parameters.particleSources[i].motion.referenceTimestep = timestep;
+            }
+            for (int i = 0; i < MAX_SPOTS; ++i) {
+                parameters.spots[i].motion.referenceTimestep = timestep;
+            }
         }
+        uploadSimulationParameters();
+
+        if (_cudaSimulationData) {
+            _simulationKernels->prepareForSimulationParametersChanges(_settings, getSimulationDataIntern(), uploadExternalEnergy);
+            _isExternalEnergyUploaded = true;
+        }
+    }
+}
+
+void _SimulationCudaFacade::updateExternalEnergy()
+{
+    std::lock_guard lock(_mutexForSimulationParameters);
+    auto& externalEnergy = _settings.simulationParameters.cellFunctionConstructorExternalEnergy;
+    if (std::any_of(std::begin(externalEnergy), std::end(externalEnergy), [](float energy) { return energy > 0; })) {
+        _simulationKernels->getExternalEnergy(externalEnergy, getSimulationDataIntern());
+    }
+}
+
+void _SimulationCudaFacade::uploadSimulationParameters()
+{
+    auto const& parameters = _settings.simulationParameters;
+    if (!_uploadedSimulationParameters) {
+        CHECK_FOR_CUDA_ERROR(cudaMemcpyToSymbol(cudaSimulationParameters, &parameters, sizeof(SimulationParameters), 0, cudaMemcpyHostToDevice));
+        _uploadedSimulationParameters = std::make_unique<SimulationParameters>(parameters);
+        return;
+    }
+
+    //only the changed parts are copied, e.g. the reference time steps of the motions or the balanced max ages
+    SimulationParametersDiffService::calcChangedByteRanges(_changedParameterRanges, *_uploadedSimulationParameters, parameters);
+    auto source = reinterpret_cast<char const*>(&parameters);
+    auto uploaded = reinterpret_cast<char*>(_uploadedSimulationParameters.get());
+    for (auto const& range : _changedParameterRanges) {
+        CHECK_FOR_CUDA_ERROR(cudaMemcpyToSymbol(cudaSimulationParameters, source + range.offset, range.size, range.offset, cudaMemcpyHostToDevice));
+        std::memcpy(uploaded + range.offset, source + range.offset, range.size);
     }
 }
 
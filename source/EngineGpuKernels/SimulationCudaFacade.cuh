@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <mutex>
 #include <vector>
 #include <optional>
@@ -14,10 +15,12 @@
 
 #include "EngineInterface/RawStatisticsData.h"
 #include "EngineInterface/Settings.h"
+#include "EngineInterface/SimulationParametersDiffService.h"
 #include "EngineInterface/SelectionShallowData.h"
 #include "EngineInterface/ShallowUpdateSelectionData.h"
 #include "EngineInterface/MutationType.h"
 #include "EngineInterface/StatisticsHistory.h"
+#include "EngineInterface/TimestepProfile.h"
 
 #include "Definitions.cuh"
 
@@ -33,19 +36,30 @@ public:
     };
     static GpuInfo checkAndReturnGpuInfo();
 
+    //page-locked host memory for faster transfers, returns nullptr on failure
+    static void* allocatePinnedHostMemory(uint64_t size);
+    static void freePinnedHostMemory(void* memory);
+
     _SimulationCudaFacade(uint64_t timestep, Settings const& settings);
     ~_SimulationCudaFacade();
 
+    void setDeviceResetOnDestruction(bool value);
+
     void* registerImageResource(GLuint image);
 
     void calcTimestep(uint64_t timesteps, bool forceUpdateStatistics);
     void applyCataclysm(int power);
 
     void drawVectorGraphics(float2 const& rectUpperLeft, float2 const& rectLowerRight, void* cudaResource, int2 const& imageSize, double zoom);
+    void drawVectorGraphicsToHost(float2 const& rectUpperLeft, float2 const& rectLowerRight, int2 const& imageSize, double zoom, uint64_t* hostImage);
     void getSimulationData(int2 const& rectUpperLeft, int2 const& rectLowerRight, DataTO const& dataTO);
     void getSelectedSimulationData(bool includeClusters, DataTO const& dataTO);
     void getInspectedSimulationData(std::vector<uint64_t> entityIds, DataTO const& dataTO);
-    void getOverlayData(int2 const& rectUpperLeft, int2 const& rectLowerRight, DataTO const& dataTO);
+
+    //only the entry counts are available on return, the arrays are copied asynchronously until the next data access or waitForTransfersToHost()
+    void getOverlayData_async(int2 const& rectUpperLeft, int2 const& rectLowerRight, DataTO const& dataTO);
+    void waitForTransfersToHost();
+
     void addAndSelectSimulationData(DataTO const& dataTO);
     void setSimulationData(DataTO const& dataTO);
     void removeSelectedObjects(bool includeClusters);
@@ -76,10 +90,15 @@ public:
 
     RawStatisticsData getRawStatistics();
     void updateStatistics();
-    StatisticsHistory const& getStatisticsHistory() const;
+    StatisticsHistory const& getStatisticsHistory() const;  //waits until pending data points have been added
     void setStatisticsHistory(StatisticsHistoryData const& data);
 
     void resetTimeIntervalStatistics();
+
+    bool isProfilingEnabled() const;
+    void setProfilingEnabled(bool value);
+    std::vector<TimestepProfile> getTimestepProfiles() const;
+
     uint64_t getCurrentTimestep() const;
     void setCurrentTimestep(uint64_t timestep);
 
@@ -94,35 +113,47 @@ private:
     void initCuda();
 
     void syncAndCheck();
+    void drawImage(float2 const& rectUpperLeft, float2 const& rectLowerRight, int2 const& imageSize, double zoom);
+    void updateRenderingGrid();
     void copyDataTOtoDevice(DataTO const& dataTO);
     void copyDataTOtoHost(DataTO const& dataTO);
     void automaticResizeArrays();
     void resizeArrays(ArraySizes const& additionals = ArraySizes());
     void checkAndProcessSimulationParameterChanges();
+    void uploadSimulationParameters();  //copies the changes of _settings.simulationParameters to the constant memory
+    void updateExternalEnergy();  //the external energy pool is consumed on the device, its host copy is only updated periodically
 
     SimulationData getSimulationDataIntern() const;
 
     GpuInfo _gpuInfo;
     cudaGraphicsResource* _cudaResource = nullptr;
+    bool _deviceResetOnDestruction = true;
 
     mutable std::mutex _mutexForSimulationParameters;
     std::optional<SimulationParameters> _newSimulationParameters;
     Settings _settings;
+    std::unique_ptr<SimulationParameters> _uploadedSimulationParameters;  //copy of the constant memory content
+    std::vector<ParameterByteRange> _changedParameterRanges;
+    bool _isExternalEnergyUploaded = false;
 
     mutable std::mutex _mutexForSimulationData;
     std::shared_ptr<SimulationData> _cudaSimulationData;
 
     std::shared_ptr<RenderingData> _cudaRenderingData;
+    bool _isRenderingGridUsed = false;  //the grid is maintained after each time step once an image has been drawn
+    bool _isRenderingGridValid = false;  //is reset by time steps and data manipulations changing positions or the entity arrays
     std::shared_ptr<SelectionResult> _cudaSelectionResult;
     std::shared_ptr<DataTO> _cudaAccessTO;
 
     mutable std::mutex _mutexForStatistics;
     std::optional<std::chrono::steady_clock::time_point> _lastStatisticsUpdateTime;
     std::optional<RawStatisticsData> _statisticsData;
-    StatisticsService _statisticsService;
     StatisticsHistory _statisticsHistory;
+    StatisticsService _statisticsService;  //is destroyed before _statisticsHistory since its background thread writes to it
     std::shared_ptr<SimulationStatistics> _cudaSimulationStatistics;
 
+    TimestepProfiler _profiler;
+
     SimulationKernelsLauncher _simulationKernels;
     DataAccessKernelsLauncher _dataAccessKernels;
     GarbageCollectorKernelsLauncher _garbageCollectorKernels;
@@ -14,6 +14,7 @@ void SimulationData::init(int2 const& worldSize_, uint64_t timestep_)
     cellMap.init(worldSize);
     particleMap.init(worldSize);
 
+    CudaMemoryManager::getInstance().acquireMemory<SpotAndSourcePositions>(1, spotAndSourcePositions);
     CudaMemoryManager::getInstance().acquireMemory<ColorVector<float>>(1, externalEnergy);
     CudaMemoryManager::getInstance().acquireMemory<double>(1, residualEnergy);
     CHECK_FOR_CUDA_ERROR(cudaMemset(residualEnergy, 0, sizeof(double)));
@@ -42,13 +43,16 @@ __device__ void SimulationData::prepareForNextTimestep()
     for (int i = 0; i < CellFunction_WithoutNone_Count; ++i) {
         cellFunctionOperations[i].setMemory(processMemory.getTypedSubArray<CellFunctionOperation>(maxCellFunctionOperations), maxCellFunctionOperations);
     }
-    for (int i = 0; i < MAX_COLORS; ++i) {
-        (*externalEnergy)[i] = cudaSimulationParameters.cellFunctionConstructorExternalEnergy[i];
-    }
+    calcSpotAndSourcePositions();
 
     objects.saveNumEntries();
 }
 
+__device__ void SimulationData::calcSpotAndSourcePositions()
+{
+    spotAndSourcePositions->calc(timestep, worldSize);
+}
+
 bool SimulationData::shouldResize(ArraySizes const& additionals)
 {
     auto cellAndParticleArraySizeInc = std::max(additionals.cellArraySize, additionals.particleArraySize);
@@ -102,6 +106,7 @@ void SimulationData::free()
     numberGen1.free();
     numberGen2.free();
     processMemory.free();
+    CudaMemoryManager::getInstance().freeMemory(spotAndSourcePositions);
     CudaMemoryManager::getInstance().freeMemory(externalEnergy);
     CudaMemoryManager::getInstance().freeMemory(residualEnergy);
 
@@ -13,6 +13,7 @@
 #include "Objects.cuh"
 #include "Map.cuh"
 #include "Operations.cuh"
+#include "SpotAndSourcePositions.cuh"
 
 struct SimulationData
 {
@@ -26,6 +27,9 @@ struct SimulationData
     Objects objects;
     Objects tempObjects;
 
+    //evaluated time-dependent parameters
+    SpotAndSourcePositions* spotAndSourcePositions;
+
     //additional data for cell functions
     ColorVector<float>* externalEnergy;
     double* residualEnergy;
@@ -48,6 +52,7 @@ struct SimulationData
     void free();
 
     __device__ void prepareForNextTimestep();
+    __device__ void calcSpotAndSourcePositions();
 
 private:
     template <typename Entity>
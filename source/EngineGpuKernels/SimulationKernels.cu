@@ -211,6 +211,11 @@ __global__ void cudaResetDensity(SimulationData data)
     CellProcessor::resetDensity(data);
 }
 
+__global__ void cudaCalcSpotAndSourcePositions(SimulationData data)
+{
+    data.calcSpotAndSourcePositions();
+}
+
 
 //This is the only calcKernel that uses dynamic parallelism.
 //When it is removed, performance drops by about 20% for unknown reasons.
@@ -41,3 +41,4 @@ __global__ void cudaAccumulateClusterAngularProp(SimulationData data);
 __global__ void cudaApplyClusterData(SimulationData data);
 
 __global__ void cudaResetDensity(SimulationData data);
+__global__ void cudaCalcSpotAndSourcePositions(SimulationData data);
@@ -1,7 +1,5 @@
 ﻿#include "SimulationKernelsLauncher.cuh"
 
-#include "EngineInterface/SpaceCalculator.h"
-
 #include "SimulationKernels.cuh"
 #include "FlowFieldKernels.cuh"
 #include "GarbageCollectorKernelsLauncher.cuh"
@@ -24,16 +22,21 @@ namespace
     }
 }
 
-void _SimulationKernelsLauncher::calcTimestep(Settings const& settings, SimulationData const& data, SimulationStatistics const& statistics)
+void _SimulationKernelsLauncher::calcTimestep(
+    Settings const& settings,
+    SimulationData const& data,
+    SimulationStatistics const& statistics,
+    _TimestepProfiler& profiler)
 {
     auto const gpuSettings = settings.gpuSettings;
-    KERNEL_CALL_1_1(cudaNextTimestep_prepare, data, statistics);
 
     //not all kernels need to be executed in each time step for performance reasons
     bool considerForcesFromAngleDifferences = (data.timestep % 3 == 0);
     bool considerInnerFriction = (data.timestep % 3 == 0);
     bool considerRigidityUpdate = (data.timestep % 3 == 0);
 
+    profiler.startStage(ProfilingStage_Physics);
+    KERNEL_CALL_1_1(cudaNextTimestep_prepare, data, statistics);
     KERNEL_CALL(cudaNextTimestep_physics_init, data);
     KERNEL_CALL(cudaNextTimestep_physics_fillMaps, data);
     if (settings.simulationParameters.motionType == MotionType_Fluid) {
@@ -50,30 +53,66 @@ void _SimulationKernelsLauncher::calcTimestep(Settings const& settings, Simulati
     KERNEL_CALL(cudaNextTimestep_physics_verletPositionUpdate, data);
     KERNEL_CALL(cudaNextTimestep_physics_calcConnectionForces, data, considerForcesFromAngleDifferences);
     KERNEL_CALL(cudaNextTimestep_physics_verletVelocityUpdate, data);
+    profiler.stopStage(ProfilingStage_Physics);
 
     //cell functions
+    profiler.startStage(ProfilingStage_CellFunctionPreparation);
     KERNEL_CALL(cudaNextTimestep_cellFunction_prepare_substep1, data);
     KERNEL_CALL(cudaNextTimestep_cellFunction_prepare_substep2, data);
+    profiler.stopStage(ProfilingStage_CellFunctionPreparation);
+
+    profiler.startStage(ProfilingStage_Nerve);
     KERNEL_CALL(cudaNextTimestep_cellFunction_nerve, data, statistics);
+    profiler.stopStage(ProfilingStage_Nerve);
+
+    profiler.startStage(ProfilingStage_Neuron);
     KERNEL_CALL(cudaNextTimestep_cellFunction_neuron, data, statistics);
+    profiler.stopStage(ProfilingStage_Neuron);
+
+    profiler.startStage(ProfilingStage_Constructor);
     if (settings.simulationParameters.cellFunctionConstructorCheckCompletenessForSelfReplication) {
         KERNEL_CALL(cudaNextTimestep_cellFunction_constructor_completenessCheck, data, statistics);
     }
     KERNEL_CALL(cudaNextTimestep_cellFunction_constructor_process, data, statistics);
+    profiler.stopStage(ProfilingStage_Constructor);
+
+    profiler.startStage(ProfilingStage_Injector);
     KERNEL_CALL(cudaNextTimestep_cellFunction_injector, data, statistics);
+    profiler.stopStage(ProfilingStage_Injector);
+
+    profiler.startStage(ProfilingStage_Attacker);
     KERNEL_CALL(cudaNextTimestep_cellFunction_attacker, data, statistics);
+    profiler.stopStage(ProfilingStage_Attacker);
+
+    profiler.startStage(ProfilingStage_Transmitter);
     KERNEL_CALL(cudaNextTimestep_cellFunction_transmitter, data, statistics);
+    profiler.stopStage(ProfilingStage_Transmitter);
+
+    profiler.startStage(ProfilingStage_Muscle);
     KERNEL_CALL(cudaNextTimestep_cellFunction_muscle, data, statistics);
+    profiler.stopStage(ProfilingStage_Muscle);
+
+    profiler.startStage(ProfilingStage_Sensor);
     KERNEL_CALL(cudaNextTimestep_cellFunction_sensor, data, statistics);
+    profiler.stopStage(ProfilingStage_Sensor);
+
+    profiler.startStage(ProfilingStage_Reconnector);
     KERNEL_CALL(cudaNextTimestep_cellFunction_reconnector, data, statistics);
+    profiler.stopStage(ProfilingStage_Reconnector);
+
+    profiler.startStage(ProfilingStage_Detonator);
     KERNEL_CALL(cudaNextTimestep_cellFunction_detonator, data, statistics);
+    profiler.stopStage(ProfilingStage_Detonator);
 
+    profiler.startStage(ProfilingStage_Physics);
     if (considerInnerFriction) {
         KERNEL_CALL(cudaNextTimestep_physics_substep7_innerFriction, data);
     }
     KERNEL_CALL(cudaNextTimestep_physics_substep8, data);
+    profiler.stopStage(ProfilingStage_Physics);
 
     if (considerRigidityUpdate && isRigidityUpdateEnabled(settings)) {
+        profiler.startStage(ProfilingStage_Clusters);
         KERNEL_CALL(cudaInitClusterData, data);
         KERNEL_CALL(cudaFindClusterIteration, data);  //3 iterations should provide a good approximation
         KERNEL_CALL(cudaFindClusterIteration, data);
@@ -82,14 +121,20 @@ void _SimulationKernelsLauncher::calcTimestep(Settings const& settings, Simulati
         KERNEL_CALL(cudaAccumulateClusterPosAndVel, data);
         KERNEL_CALL(cudaAccumulateClusterAngularProp, data);
         KERNEL_CALL(cudaApplyClusterData, data);
+        profiler.stopStage(ProfilingStage_Clusters);
     }
+
+    profiler.startStage(ProfilingStage_StructuralOperations);
     KERNEL_CALL_1_1(cudaNextTimestep_structuralOperations_substep1, data);
     KERNEL_CALL(cudaNextTimestep_structuralOperations_substep2, data);
     KERNEL_CALL(cudaNextTimestep_structuralOperations_substep3, data);
     KERNEL_CALL(cudaNextTimestep_structuralOperations_substep4, data);
     KERNEL_CALL(cudaNextTimestep_structuralOperations_substep5, data);
+    profiler.stopStage(ProfilingStage_StructuralOperations);
 
+    profiler.startStage(ProfilingStage_GarbageCollection);
     _garbageCollector->cleanupAfterTimestep(settings.gpuSettings, data);
+    profiler.stopStage(ProfilingStage_GarbageCollection);
 }
 
 bool _SimulationKernelsLauncher::updateSimulationParametersAfterTimestep(
@@ -97,62 +142,26 @@ bool _SimulationKernelsLauncher::updateSimulationParametersAfterTimestep(
     SimulationData const& simulationData,
     RawStatisticsData const& statistics)
 {
-    auto result = false;
-
-    auto const& worldSizeX = settings.generalSettings.worldSizeX;
-    auto const& worldSizeY = settings.generalSettings.worldSizeY;
-    SpaceCalculator space({worldSizeX, worldSizeY});
-    for (int i = 0; i < settings.simulationParameters.numParticleSources; ++i) {
-        auto& source = settings.simulationParameters.particleSources[i];
-        if (source.velX != 0) {
-            source.posX += source.velX * settings.simulationParameters.timestepSize;
-            result = true;
-        }
-        if (source.velY != 0) {
-            source.posY += source.velY * settings.simulationParameters.timestepSize;
-            result = true;
-        }
-        auto correctedPosition = space.getCorrectedPosition({source.posX, source.posY});
-        source.posX = correctedPosition.x;
-        source.posY = correctedPosition.y;
-    }
-    for (int i = 0; i < settings.simulationParameters.numSpots; ++i) {
-        auto& spot = settings.simulationParameters.spots[i];
-        if (spot.velX != 0) {
-            spot.posX += spot.velX * settings.simulationParameters.timestepSize;
-            result = true;
-        }
-        if (spot.velY != 0) {
-            spot.posY += spot.velY * settings.simulationParameters.timestepSize;
-            result = true;
-        }
-        auto correctedPosition = space.getCorrectedPosition({spot.posX, spot.posY});
-        spot.posX = correctedPosition.x;
-        spot.posY = correctedPosition.y;
-    }
+    //spot and particle source motions are evaluated on the device in each time step (see SpotAndSourcePositions)
+    return _maxAgeBalancer->balance(settings.simulationParameters, statistics, simulationData.timestep);
+}
 
-    auto externalEnergyPresent = false;
-    for (int i = 0; i < MAX_COLORS; ++i) {
-        externalEnergyPresent |= settings.simulationParameters.cellFunctionConstructorExternalEnergy[i] > 0;
-    }
-    if (externalEnergyPresent) {
+void _SimulationKernelsLauncher::prepareForSimulationParametersChanges(Settings const& settings, SimulationData const& data, bool uploadExternalEnergy)
+{
+    auto const gpuSettings = settings.gpuSettings;
+    KERNEL_CALL(cudaResetDensity, data);
+    KERNEL_CALL_1_1(cudaCalcSpotAndSourcePositions, data);
+
+    //the external energy pool is consumed on the device and only reset if its value has been changed
+    if (uploadExternalEnergy) {
         CHECK_FOR_CUDA_ERROR(cudaMemcpy(
-            &settings.simulationParameters.cellFunctionConstructorExternalEnergy,
-            simulationData.externalEnergy,
-            sizeof(ColorVector<float>),
-            cudaMemcpyDeviceToHost));
-        result = true;
+            data.externalEnergy, &settings.simulationParameters.cellFunctionConstructorExternalEnergy, sizeof(ColorVector<float>), cudaMemcpyHostToDevice));
     }
-
-    result |= _maxAgeBalancer->balance(settings.simulationParameters, statistics, simulationData.timestep);
-
-    return result;
 }
 
-void _SimulationKernelsLauncher::prepareForSimulationParametersChanges(Settings const& settings, SimulationData const& data)
+void _SimulationKernelsLauncher::getExternalEnergy(ColorVector<float>& externalEnergy, SimulationData const& data)
 {
-    auto const gpuSettings = settings.gpuSettings;
-    KERNEL_CALL(cudaResetDensity, data);
+    CHECK_FOR_CUDA_ERROR(cudaMemcpy(&externalEnergy, data.externalEnergy, sizeof(ColorVector<float>), cudaMemcpyDeviceToHost));
 }
 
 bool _SimulationKernelsLauncher::isRigidityUpdateEnabled(Settings const& settings) const
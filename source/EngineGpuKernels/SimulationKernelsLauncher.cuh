@@ -2,6 +2,7 @@
 
 #include "EngineInterface/Settings.h"
 #include "EngineInterface/RawStatisticsData.h"
+#include "EngineInterface/TimestepProfiler.h"
 
 #include "Definitions.cuh"
 #include "Macros.cuh"
@@ -11,12 +12,17 @@ class _SimulationKernelsLauncher
 public:
     _SimulationKernelsLauncher();
 
-    void calcTimestep(Settings const& settings, SimulationData const& simulationData, SimulationStatistics const& statistics);
+    void calcTimestep(
+        Settings const& settings,
+        SimulationData const& simulationData,
+        SimulationStatistics const& statistics,
+        _TimestepProfiler& profiler);
     bool updateSimulationParametersAfterTimestep(
         Settings& settings,
         SimulationData const& simulationData,
         RawStatisticsData const& statistics);  //returns true if parameters have been changed
-    void prepareForSimulationParametersChanges(Settings const& settings, SimulationData const& simulationData);
+    void prepareForSimulationParametersChanges(Settings const& settings, SimulationData const& simulationData, bool uploadExternalEnergy);
+    void getExternalEnergy(ColorVector<float>& externalEnergy, SimulationData const& simulationData);
 
 private:
     bool isRigidityUpdateEnabled(Settings const& settings) const;
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "cuda_runtime_api.h"
+
+#include "EngineInterface/ParameterMotion.h"
+
+#include "Base.cuh"
+#include "ConstantMemory.cuh"
+
+//positions of the spots and particle sources in the current time step, evaluated once per time step from their motions
+struct SpotAndSourcePositions
+{
+    float2 spots[MAX_SPOTS];
+    float2 particleSources[MAX_PARTICLE_SOURCES];
+
+    __device__ __inline__ void calc(uint64_t timestep, int2 const& worldSize)
+    {
+        auto const& parameters = cudaSimulationParameters;
+        auto worldSizeX = toFloat(worldSize.x);
+        auto worldSizeY = toFloat(worldSize.y);
+        for (int i = 0; i < parameters.numSpots; ++i) {
+            calcMotionPosition(spots[i].x, spots[i].y, parameters.spots[i], timestep, parameters.timestepSize, worldSizeX, worldSizeY);
+        }
+        for (int i = 0; i < parameters.numParticleSources; ++i) {
+            calcMotionPosition(
+                particleSources[i].x, particleSources[i].y, parameters.particleSources[i], timestep, parameters.timestepSize, worldSizeX, worldSizeY);
+        }
+    }
+};
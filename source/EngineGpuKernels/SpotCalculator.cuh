@@ -4,6 +4,7 @@
 
 #include "EngineInterface/SimulationParametersSpotValues.h"
 #include "ConstantMemory.cuh"
+#include "SpotAndSourcePositions.cuh"
 #include "Util.cuh"
 #include "Math.cuh"
 
@@ -13,6 +14,7 @@ public:
     template <typename T>
     __device__ __inline__ static T calcResultingValue(
         BaseMap const& map,
+        SpotAndSourcePositions const& positions,
         float2 const& worldPos,
         T const& baseValue,
         T (&spotValues)[MAX_SPOTS],
@@ -25,8 +27,7 @@ public:
             int numValues = 0;
             for (int i = 0; i < cudaSimulationParameters.numSpots; ++i) {
                 if (cudaSimulationParameters.spots[i].activatedValues.*valueActivated) {
-                    float2 spotPos = {cudaSimulationParameters.spots[i].posX, cudaSimulationParameters.spots[i].posY};
-                    auto delta = map.getCorrectedDirection(spotPos - worldPos);
+                    auto delta = map.getCorrectedDirection(positions.spots[i] - worldPos);
                     spotWeights[numValues++] = calcWeight(delta, i);
                 }
             }
@@ -35,15 +36,15 @@ public:
     }
 
     template <typename T>
-    __device__ __inline__ static T calcResultingValue(BaseMap const& map, float2 const& worldPos, T const& baseValue, T (&spotValues)[MAX_SPOTS])
+    __device__ __inline__ static T
+    calcResultingValue(BaseMap const& map, SpotAndSourcePositions const& positions, float2 const& worldPos, T const& baseValue, T (&spotValues)[MAX_SPOTS])
     {
         if (0 == cudaSimulationParameters.numSpots) {
             return baseValue;
         } else {
             float spotWeights[MAX_SPOTS];
             for (int i = 0; i < cudaSimulationParameters.numSpots; ++i) {
-                float2 spotPos = {cudaSimulationParameters.spots[i].posX, cudaSimulationParameters.spots[i].posY};
-                auto delta = map.getCorrectedDirection(spotPos - worldPos);
+                auto delta = map.getCorrectedDirection(positions.spots[i] - worldPos);
                 spotWeights[i] = calcWeight(delta, i);
             }
             return mix(baseValue, spotValues, spotWeights);
@@ -53,6 +54,7 @@ public:
     template <typename T>
     __device__ __inline__ static T calcResultingFlowField(
         BaseMap const& map,
+        SpotAndSourcePositions const& positions,
         float2 const& worldPos,
         T const& baseValue,
         T (&spotValues)[MAX_SPOTS])
@@ -64,8 +66,7 @@ public:
             int numValues = 0;
             for (int i = 0; i < cudaSimulationParameters.numSpots; ++i) {
                 if (cudaSimulationParameters.spots[i].flowType != FlowType_None) {
-                    float2 spotPos = {cudaSimulationParameters.spots[i].posX, cudaSimulationParameters.spots[i].posY};
-                    auto delta = map.getCorrectedDirection(spotPos - worldPos);
+                    auto delta = map.getCorrectedDirection(positions.spots[i] - worldPos);
                     spotWeights[numValues++] = calcWeight(delta, i);
                 }
             }
@@ -87,7 +88,7 @@ public:
             }
         }
 
-        return calcResultingValue(data.cellMap, worldPos, cudaSimulationParameters.baseValues.*value, spotValues, valueActivated);
+        return calcResultingValue(data.cellMap, *data.spotAndSourcePositions, worldPos, cudaSimulationParameters.baseValues.*value, spotValues, valueActivated);
     }
 
     __device__ __inline__ static float calcParameter(
@@ -105,7 +106,7 @@ public:
             }
         }
 
-        return calcResultingValue(data.cellMap, worldPos, (cudaSimulationParameters.baseValues.*value)[color], spotValues, valueActivated);
+        return calcResultingValue(data.cellMap, *data.spotAndSourcePositions, worldPos, (cudaSimulationParameters.baseValues.*value)[color], spotValues, valueActivated);
     }
 
     __device__ __inline__ static int calcParameter(
@@ -122,7 +123,7 @@ public:
             }
         }
 
-        return toInt(calcResultingValue(data.cellMap, worldPos, toFloat(cudaSimulationParameters.baseValues.*value), spotValues, valueActivated));
+        return toInt(calcResultingValue(data.cellMap, *data.spotAndSourcePositions, worldPos, toFloat(cudaSimulationParameters.baseValues.*value), spotValues, valueActivated));
     }
 
     __device__ __inline__ static float calcParameter(
@@ -141,7 +142,7 @@ public:
             }
         }
 
-        return calcResultingValue(data.cellMap, worldPos, (cudaSimulationParameters.baseValues.*value)[color1][color2], spotValues, valueActivated);
+        return calcResultingValue(data.cellMap, *data.spotAndSourcePositions, worldPos, (cudaSimulationParameters.baseValues.*value)[color1][color2], spotValues, valueActivated);
     }
 
     //return -1 for base
@@ -152,10 +153,10 @@ public:
             return -1;
         } else {
             auto const& map = data.cellMap;
+            auto const& positions = *data.spotAndSourcePositions;
             for (int i = 0; i < cudaSimulationParameters.numSpots; ++i) {
                 if (cudaSimulationParameters.spots[i].activatedValues.*valueActivated) {
-                    float2 spotPos = {cudaSimulationParameters.spots[i].posX, cudaSimulationParameters.spots[i].posY};
-                    auto delta = map.getCorrectedDirection(spotPos - worldPos);
+                    auto delta = map.getCorrectedDirection(positions.spots[i] - worldPos);
                     if(calcWeight(delta, i) < NEAR_ZERO) {
                         return i;
                     }
@@ -1,5 +1,6 @@
 #include "StatisticsService.cuh"
 
+#include "Base/LoggingService.h"
 #include "EngineInterface/StatisticsConverterService.h"
 
 #include "Base.cuh"
@@ -9,10 +10,120 @@ namespace
     auto constexpr MaxSamples = 1000;
 }
 
-void _StatisticsService::addDataPoint(StatisticsHistory& history, TimelineStatistics const& newRawStatistics, uint64_t timestep)
+_StatisticsService::_StatisticsService(StatisticsHistory& history)
+    : _history(history)
 {
-    std::lock_guard lock(history.getMutex());
-    auto& historyData = history.getDataRef();
+    _thread = std::thread([this] { processTasks(); });
+}
+
+_StatisticsService::~_StatisticsService()
+{
+    _shutdown = true;
+    _wakeUpCounter.fetch_add(1);
+    _wakeUpCounter.notify_one();
+    _thread.join();
+}
+
+void _StatisticsService::addDataPoint(TimelineStatistics const& newRawStatistics, uint64_t timestep)
+{
+    Task task;
+    task.type = TaskType::AddDataPoint;
+    task.timestep = timestep;
+    task.rawStatistics = newRawStatistics;
+
+    //a full queue means that the history is blocked by a reader, skipping a data point is preferred to waiting
+    if (!tryPush(std::move(task))) {
+        _numDroppedDataPoints.fetch_add(1);
+    }
+}
+
+void _StatisticsService::resetTime(uint64_t timestep)
+{
+    Task task;
+    task.type = TaskType::ResetTime;
+    task.timestep = timestep;
+    push(std::move(task));
+}
+
+void _StatisticsService::rewriteHistory(StatisticsHistoryData const& newHistoryData, uint64_t timestep)
+{
+    Task task;
+    task.type = TaskType::RewriteHistory;
+    task.timestep = timestep;
+    task.historyData = newHistoryData;
+    push(std::move(task));
+}
+
+void _StatisticsService::flush()
+{
+    auto numPushedTasks = _numPushedTasks.load();
+    auto numProcessedTasks = _numProcessedTasks.load();
+    while (numProcessedTasks < numPushedTasks) {
+        _numProcessedTasks.wait(numProcessedTasks);
+        numProcessedTasks = _numProcessedTasks.load();
+    }
+}
+
+bool _StatisticsService::tryPush(Task&& task)
+{
+    if (!_tasks.tryPush(std::move(task))) {
+        return false;
+    }
+    _numPushedTasks.fetch_add(1);
+    _wakeUpCounter.fetch_add(1);
+    _wakeUpCounter.notify_one();
+    return true;
+}
+
+void _StatisticsService::push(Task&& task)
+{
+    while (!tryPush(std::move(task))) {
+        std::this_thread::yield();
+    }
+}
+
+void _StatisticsService::processTasks()
+{
+    uint64_t numProcessedTasks = 0;
+    Task task;
+    while (true) {
+        auto wakeUpCounter = _wakeUpCounter.load();
+        if (numProcessedTasks < _numPushedTasks.load()) {
+
+            //a producer may have reserved a slot without having filled it yet
+            if (!_tasks.tryPop(task)) {
+                std::this_thread::yield();
+                continue;
+            }
+            switch (task.type) {
+            case TaskType::AddDataPoint:
+                if (auto numDroppedDataPoints = _numDroppedDataPoints.exchange(0)) {
+                    log(Priority::Unimportant, "statistics: " + std::to_string(numDroppedDataPoints) + " data point(s) dropped due to a full queue");
+                }
+                addDataPointIntern(task.rawStatistics, task.timestep);
+                break;
+            case TaskType::ResetTime:
+                resetTimeIntern(task.timestep);
+                break;
+            case TaskType::RewriteHistory:
+                rewriteHistoryIntern(task.historyData, task.timestep);
+                break;
+            }
+            ++numProcessedTasks;
+            _numProcessedTasks.store(numProcessedTasks);
+            _numProcessedTasks.notify_all();
+        } else if (_shutdown) {
+            return;
+        } else {
+            _wakeUpCounter.wait(wakeUpCounter);
+        }
+    }
+}
+
+void _StatisticsService::addDataPointIntern(TimelineStatistics const& newRawStatistics, uint64_t timestep)
+{
+    std::lock_guard lock(_history.getMutex());
+    auto& historyData = _history.getDataRef();
 
     if (!historyData.empty() && historyData.back().time > toDouble(timestep) + NEAR_ZERO) {
         historyData.clear();
@@ -57,14 +168,13 @@ void _StatisticsService::addDataPoint(StatisticsHistory& history, TimelineStatis
     }
 }
 
-void _StatisticsService::resetTime(StatisticsHistory& history, uint64_t timestep)
+void _StatisticsService::resetTimeIntern(uint64_t timestep)
 {
-    std::lock_guard lock(history.getMutex());
-    auto& data = history.getDataRef();
+    std::lock_guard lock(_history.getMutex());
+    auto& data = _history.getDataRef();
 
-    auto prevTimestep = data.back().time;
-    if (!data.empty() && prevTimestep > 0) {
-        _longtermTimestepDelta *= toDouble(timestep) / prevTimestep;
+    if (!data.empty() && data.back().time > 0) {
+        _longtermTimestepDelta *= toDouble(timestep) / data.back().time;
         if (_longtermTimestepDelta < DefaultTimeStepDelta) {
             _longtermTimestepDelta = DefaultTimeStepDelta;
         }
@@ -82,7 +192,7 @@ void _StatisticsService::resetTime(StatisticsHistory& history, uint64_t timestep
     data.swap(newData);
 }
 
-void _StatisticsService::rewriteHistory(StatisticsHistory& history, StatisticsHistoryData const& newHistoryData, uint64_t timestep)
+void _StatisticsService::rewriteHistoryIntern(StatisticsHistoryData const& newHistoryData, uint64_t timestep)
 {
     _lastRawStatistics.reset();
     _lastTimestep.reset();
@@ -92,6 +202,6 @@ void _StatisticsService::rewriteHistory(StatisticsHistory& history, StatisticsHi
         _longtermTimestepDelta = DefaultTimeStepDelta;
     }
 
-    std::lock_guard lock(history.getMutex());
-    history.getDataRef() = newHistoryData;
+    std::lock_guard lock(_history.getMutex());
+    _history.getDataRef() = newHistoryData;
 }
@@ -1,20 +1,66 @@
+#pragma once
+
+#include <atomic>
 #include <optional>
+#include <thread>
 
+#include "Base/MpscRingBuffer.h"
+#include "EngineInterface/RawStatisticsData.h"
 #include "EngineInterface/StatisticsHistory.h"
 #include "Definitions.cuh"
 
+//maintains the statistics history on a background thread (conversion of raw statistics, downsampling)
+//the public methods only enqueue tasks, thus the simulation thread does not wait for readers holding the history mutex
 class _StatisticsService
 {
 public:
-    void addDataPoint(StatisticsHistory& history, TimelineStatistics const& newRawStatistics, uint64_t timestep);
-    void resetTime(StatisticsHistory& history, uint64_t timestep);
-    void rewriteHistory(StatisticsHistory& history, StatisticsHistoryData const& newHistoryData, uint64_t timestep);
+    _StatisticsService(StatisticsHistory& history);
+    ~_StatisticsService();
+
+    void addDataPoint(TimelineStatistics const& newRawStatistics, uint64_t timestep);  //data point is dropped if the queue is full
+    void resetTime(uint64_t timestep);
+    void rewriteHistory(StatisticsHistoryData const& newHistoryData, uint64_t timestep);
+
+    //blocks until all tasks enqueued so far have been applied to the history
+    void flush();
 
 private:
+    enum class TaskType
+    {
+        AddDataPoint,
+        ResetTime,
+        RewriteHistory
+    };
+    struct Task
+    {
+        TaskType type = TaskType::AddDataPoint;
+        uint64_t timestep = 0;
+        TimelineStatistics rawStatistics;
+        StatisticsHistoryData historyData;
+    };
+    bool tryPush(Task&& task);
+    void push(Task&& task);
+    void processTasks();
+
+    void addDataPointIntern(TimelineStatistics const& newRawStatistics, uint64_t timestep);
+    void resetTimeIntern(uint64_t timestep);
+    void rewriteHistoryIntern(StatisticsHistoryData const& newHistoryData, uint64_t timestep);
+
     static auto constexpr DefaultTimeStepDelta = 10.0;
+    static auto constexpr TaskQueueCapacity = 64;
 
-    double _longtermTimestepDelta = DefaultTimeStepDelta;
+    StatisticsHistory& _history;
 
+    //only accessed by the background thread
+    double _longtermTimestepDelta = DefaultTimeStepDelta;
     std::optional<TimelineStatistics> _lastRawStatistics;
     std::optional<uint64_t> _lastTimestep;
+
+    MpscRingBuffer<Task, TaskQueueCapacity> _tasks;
+    std::atomic<uint64_t> _numPushedTasks = 0;
+    std::atomic<uint64_t> _numProcessedTasks = 0;
+    std::atomic<uint64_t> _numDroppedDataPoints = 0;  //since the last log message
+    std::atomic<uint64_t> _wakeUpCounter = 0;  //is increased to wake up the background thread
+    std::atomic<bool> _shutdown = false;
+    std::thread _thread;
 };
@@ -1,63 +1,132 @@
 #include "AccessDataTOCache.h"
 
-_AccessDataTOCache::_AccessDataTOCache()
+#include <algorithm>
+#include <new>
+#include <stdexcept>
+
+namespace
+{
+    uint64_t constexpr Alignment = 64;
+
+    uint64_t alignUp(uint64_t size)
+    {
+        return (size + Alignment - 1) / Alignment * Alignment;
+    }
+
+    uint64_t growCapacity(uint64_t capacity, uint64_t size)
+    {
+        return capacity >= size ? capacity : std::max(size, capacity * 2);
+    }
+
+    void* allocateAlignedMemory(uint64_t size)
+    {
+        return ::operator new(size, std::align_val_t{Alignment}, std::nothrow);
+    }
+
+    void freeAlignedMemory(void* memory)
+    {
+        ::operator delete(memory, std::align_val_t{Alignment});
+    }
+}
+
+_AccessDataTOCache::_AccessDataTOCache(int numBuffers)
+    : _AccessDataTOCache(HostMemoryAllocator{allocateAlignedMemory, freeAlignedMemory}, numBuffers)
+{}
+
+_AccessDataTOCache::_AccessDataTOCache(HostMemoryAllocator const& allocator, int numBuffers)
+    : _allocator(allocator)
+    , _buffers(numBuffers)
 {}
 
 _AccessDataTOCache::~_AccessDataTOCache()
 {
-    if(_dataTO) {
-        deleteDataTO(*_dataTO);
+    for (auto& buffer : _buffers) {
+        freeBuffer(buffer);
     }
 }
 
 DataTO _AccessDataTOCache::getDataTO(ArraySizes const& arraySizes)
 {
-    if (_dataTO) {
-        auto existingArraySizes = getArraySizes(*_dataTO);
-        if (fits(existingArraySizes, arraySizes)) {
-            *_dataTO->numCells = 0;
-            *_dataTO->numParticles = 0;
-            *_dataTO->numAuxiliaryData = 0;
-            return *_dataTO;
-        } else {
-            deleteDataTO(*_dataTO);
-        }
+    _lastBufferIndex = (_lastBufferIndex + 1) % toInt(_buffers.size());
+    ++_numHandedOutBuffers;
+
+    auto& buffer = _buffers.at(_lastBufferIndex);
+    if (!buffer.memory || !fits(buffer.capacities, arraySizes)) {
+        auto newCapacities = calcNewCapacities(buffer.capacities, arraySizes);
+        freeBuffer(buffer);
+        allocateBuffer(buffer, newCapacities);
     }
-    try {
-        DataTO result;
-        result.numCells = new uint64_t;
-        result.numParticles = new uint64_t;
-        result.numAuxiliaryData = new uint64_t;
-        *result.numCells = 0;
-        *result.numParticles = 0;
-        *result.numAuxiliaryData = 0;
-        result.cells = new CellTO[arraySizes.cellArraySize];
-        result.particles = new ParticleTO[arraySizes.particleArraySize];
-        result.auxiliaryData = new uint8_t[arraySizes.auxiliaryDataSize];
-        _dataTO = result;
-        return result;
-    } catch (std::bad_alloc const&) {
-        throw std::runtime_error("There is not sufficient CPU memory available.");
+    *buffer.dataTO.numCells = 0;
+    *buffer.dataTO.numParticles = 0;
+    *buffer.dataTO.numAuxiliaryData = 0;
+    return buffer.dataTO;
+}
+
+std::optional<DataTO> _AccessDataTOCache::getPreviousDataTO() const
+{
+    if (_buffers.size() < 2 || _numHandedOutBuffers < 2) {
+        return std::nullopt;
     }
+    auto numBuffers = toInt(_buffers.size());
+    return _buffers.at((_lastBufferIndex + numBuffers - 1) % numBuffers).dataTO;
 }
 
-bool _AccessDataTOCache::fits(ArraySizes const& left, ArraySizes const& right) const
+bool _AccessDataTOCache::fits(ArraySizes const& capacities, ArraySizes const& arraySizes) const
 {
-    return left.cellArraySize >= right.cellArraySize && left.particleArraySize >= right.particleArraySize
-        && left.auxiliaryDataSize >= right.auxiliaryDataSize;
+    return capacities.cellArraySize >= arraySizes.cellArraySize && capacities.particleArraySize >= arraySizes.particleArraySize
+        && capacities.auxiliaryDataSize >= arraySizes.auxiliaryDataSize;
 }
 
-auto _AccessDataTOCache::getArraySizes(DataTO const& dataTO) const -> ArraySizes
+auto _AccessDataTOCache::calcNewCapacities(ArraySizes const& capacities, ArraySizes const& arraySizes) const -> ArraySizes
 {
-    return {*dataTO.numCells, *dataTO.numParticles, *dataTO.numAuxiliaryData};
+    return {
+        growCapacity(capacities.cellArraySize, arraySizes.cellArraySize),
+        growCapacity(capacities.particleArraySize, arraySizes.particleArraySize),
+        growCapacity(capacities.auxiliaryDataSize, arraySizes.auxiliaryDataSize)};
+}
+
+void _AccessDataTOCache::allocateBuffer(TransferBuffer& buffer, ArraySizes const& capacities)
+{
+    //counters and arrays are placed in one allocation
+    auto countersSize = alignUp(sizeof(uint64_t) * 3);
+    auto cellsSize = alignUp(sizeof(CellTO) * capacities.cellArraySize);
+    auto particlesSize = alignUp(sizeof(ParticleTO) * capacities.particleArraySize);
+    auto auxiliaryDataSize = alignUp(capacities.auxiliaryDataSize);
+
+    auto size = countersSize + cellsSize + particlesSize + auxiliaryDataSize;
+    auto memory = _allocator.allocate(size);
+
+    //e.g. page-locked memory is exhausted, transfers to pageable memory are only slower
+    auto isFallbackMemory = false;
+    if (!memory) {
+        memory = allocateAlignedMemory(size);
+        isFallbackMemory = true;
+    }
+    if (!memory) {
+        throw std::runtime_error("There is not sufficient CPU memory available.");
+    }
+    auto bytes = static_cast<uint8_t*>(memory);
+    auto counters = reinterpret_cast<uint64_t*>(bytes);
+
+    buffer.memory = memory;
+    buffer.isFallbackMemory = isFallbackMemory;
+    buffer.capacities = capacities;
+    buffer.dataTO.numCells = counters;
+    buffer.dataTO.numParticles = counters + 1;
+    buffer.dataTO.numAuxiliaryData = counters + 2;
+    buffer.dataTO.cells = reinterpret_cast<CellTO*>(bytes + countersSize);
+    buffer.dataTO.particles = reinterpret_cast<ParticleTO*>(bytes + countersSize + cellsSize);
+    buffer.dataTO.auxiliaryData = bytes + countersSize + cellsSize + particlesSize;
 }
 
-void _AccessDataTOCache::deleteDataTO(DataTO const& dataTO)
+void _AccessDataTOCache::freeBuffer(TransferBuffer& buffer)
 {
-    delete dataTO.numCells;
-    delete dataTO.numParticles;
-    delete dataTO.numAuxiliaryData;
-    delete[] dataTO.cells;
-    delete[] dataTO.particles;
-    delete[] dataTO.auxiliaryData;
+    if (buffer.memory) {
+        if (buffer.isFallbackMemory) {
+            freeAlignedMemory(buffer.memory);
+        } else {
+            _allocator.free(buffer.memory);
+        }
+    }
+    buffer = TransferBuffer();
 }
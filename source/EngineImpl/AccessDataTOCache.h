@@ -1,5 +1,9 @@
 #pragma once
 
+#include <functional>
+#include <optional>
+#include <vector>
+
 #include "Base/Definitions.h"
 
 #include "EngineInterface/ArraySizes.h"
@@ -8,19 +12,53 @@
 
 #include "Definitions.h"
 
+//allocation functions for the host memory of the transfer buffers, allocate returns nullptr on failure
+struct HostMemoryAllocator
+{
+    std::function<void*(uint64_t size)> allocate;
+    std::function<void(void* memory)> free;
+};
+
+/**
+ * Pool of reusable transfer buffers which are handed out in turn.
+ * With two buffers, the data of the previous transfer can be read while the next transfer fills the other buffer (double buffering).
+ * Each buffer is a single allocation whose capacities grow geometrically,
+ * i.e. it is only reallocated if the requested array sizes exceed the capacities.
+ */
 class _AccessDataTOCache
 {
 public:
-    _AccessDataTOCache();
+    //uses plain aligned host memory
+    _AccessDataTOCache(int numBuffers = 1);
+    //e.g. for page-locked memory when a device is present, falls back to plain aligned host memory if an allocation fails
+    _AccessDataTOCache(HostMemoryAllocator const& allocator, int numBuffers = 1);
     ~_AccessDataTOCache();
 
+    _AccessDataTOCache(_AccessDataTOCache const&) = delete;
+    void operator=(_AccessDataTOCache const&) = delete;
+
+    //returns the next buffer with reset entry counts, the content of the DataTO returned numBuffers calls before becomes invalid
     DataTO getDataTO(ArraySizes const& arraySizes);
 
+    //buffer from the call before the last getDataTO call, its content is left untouched (requires two buffers)
+    std::optional<DataTO> getPreviousDataTO() const;
+
 private:
-    bool fits(ArraySizes const& left, ArraySizes const& right) const;
-    ArraySizes getArraySizes(DataTO const& dataTO) const;
-    void deleteDataTO(DataTO const& dataTO);
+    struct TransferBuffer
+    {
+        void* memory = nullptr;
+        bool isFallbackMemory = false;
+        ArraySizes capacities;
+        DataTO dataTO;
+    };
 
-    std::optional<DataTO> _dataTO;
-};
+    bool fits(ArraySizes const& capacities, ArraySizes const& arraySizes) const;
+    ArraySizes calcNewCapacities(ArraySizes const& capacities, ArraySizes const& arraySizes) const;
+    void allocateBuffer(TransferBuffer& buffer, ArraySizes const& capacities);
+    void freeBuffer(TransferBuffer& buffer);
 
+    HostMemoryAllocator _allocator;
+    std::vector<TransferBuffer> _buffers;
+    int _lastBufferIndex = -1;
+    int _numHandedOutBuffers = 0;
+};
@@ -1,102 +1,285 @@
 #include "DescriptionConverter.h"
 
 #include <algorithm>
-#include <boost/range/adaptor/map.hpp>
+#include <cstring>
 
+#include "Base/DisjointSets.h"
 #include "Base/NumberGenerator.h"
 #include "Base/Exceptions.h"
+#include "Base/ParallelExecution.h"
 #include "EngineInterface/Descriptions.h"
 #include "EngineInterface/GenomeConstants.h"
 
 
 namespace
 {
-    union BytesAsFloat
-    {
-        float f;
-        uint8_t b[4];
-    };
-
     void convert(DataTO const& dataTO, uint64_t sourceSize, uint64_t sourceIndex, std::vector<uint8_t>& target)
     {
         target.resize(sourceSize);
-        for (int i = 0; i < sourceSize; ++i) {
-            target[i] = dataTO.auxiliaryData[sourceIndex + i];
+        if (sourceSize > 0) {
+            std::memcpy(target.data(), dataTO.auxiliaryData + sourceIndex, sourceSize);
         }
     }
 
-    void convert(DataTO const& dataTO, uint64_t sourceSize, uint64_t sourceIndex, std::vector<float>& target)
+    static_assert(sizeof(NeuronDescription::weights) == sizeof(float) * MAX_CHANNELS * MAX_CHANNELS);
+    static_assert(sizeof(NeuronDescription::biases) == sizeof(float) * MAX_CHANNELS);
+
+    //cells are processed in ranges of this size by the worker threads
+    auto constexpr CellRangeSize = 4096;
+
+    //writes at auxiliaryDataIndex and advances it, returns the position where the data has been written
+    uint64_t writeAuxiliaryData(DataTO const& dataTO, uint64_t& auxiliaryDataIndex, void const* source, uint64_t size)
     {
-        BytesAsFloat bytesAsFloat;
-        target.resize(sourceSize / 4);
-        for (uint64_t i = 0; i < sourceSize / 4; ++i) {
-            for (int j = 0; j < 4; ++j) {
-                bytesAsFloat.b[j] = dataTO.auxiliaryData[sourceIndex + i * 4 + j];
-            }
-            target[i] = bytesAsFloat.f;
+        auto result = auxiliaryDataIndex;
+        if (size > 0) {
+            std::memcpy(dataTO.auxiliaryData + auxiliaryDataIndex, source, size);
+            auxiliaryDataIndex += size;
         }
+        return result;
     }
 
-    template<typename Container>
-    void convert(DataTO const& dataTO, Container const& source, int& targetSize, uint64_t& targetIndex)
+    uint64_t copyToAuxiliaryData(DataTO const& dataTO, void const* source, uint64_t size)
     {
-        targetSize = source.size();
-        if (targetSize > 0) {
-            targetIndex = *dataTO.numAuxiliaryData;
-            uint64_t size = source.size();
-            for (uint64_t i = 0; i < size; ++i) {
-                dataTO.auxiliaryData[targetIndex + i] = source.at(i);
-            }
+        auto result = *dataTO.numAuxiliaryData;
+        if (size > 0) {
+            std::memcpy(dataTO.auxiliaryData + result, source, size);
             (*dataTO.numAuxiliaryData) += size;
         }
+        return result;
     }
 
-    template <>
-    void convert(DataTO const& dataTO, std::vector<float> const& source, int& targetSize, uint64_t& targetIndex)
+    struct CellIndexEntry
     {
-        BytesAsFloat bytesAsFloat;
-        targetSize = source.size() * 4;
-        if (targetSize > 0) {
-            targetIndex = *dataTO.numAuxiliaryData;
-            uint64_t size = source.size();
-            for (uint64_t i = 0; i < size; ++i) {
-                bytesAsFloat.f = source.at(i);
-                for (int j = 0; j < 4; ++j) {
-                    dataTO.auxiliaryData[targetIndex + i * 4 + j] = bytesAsFloat.b[j];
-                }
-            }
-            (*dataTO.numAuxiliaryData) += targetSize;
-        }
+        uint64_t id;
+        int index;
+    };
+
+    void sortCellIndexByIds(std::vector<CellIndexEntry>& cellIndexByIds)
+    {
+        std::stable_sort(cellIndexByIds.begin(), cellIndexByIds.end(), [](auto const& left, auto const& right) { return left.id < right.id; });
     }
 
-    std::vector<float> unitWeightsAndBias(std::vector<std::vector<float>> const& weights, std::vector<float> const& bias)
+    //the last entry wins if an id occurs several times
+    int findCellIndex(std::vector<CellIndexEntry> const& cellIndexByIds, uint64_t id)
     {
-        std::vector<float> result(MAX_CHANNELS * MAX_CHANNELS + MAX_CHANNELS, 0);
-        for (int row = 0; row < MAX_CHANNELS; ++row) {
-            for (int col = 0; col < MAX_CHANNELS; ++col) {
-                result[col + row * MAX_CHANNELS] = weights[row][col];
+        auto findResult =
+            std::upper_bound(cellIndexByIds.begin(), cellIndexByIds.end(), id, [](uint64_t id, auto const& entry) { return id < entry.id; });
+        CHECK(findResult != cellIndexByIds.begin() && std::prev(findResult)->id == id)
+        return std::prev(findResult)->index;
+    }
+
+    void setConnections(CellTO& cellTO, CellDescription const& cellToAdd, std::vector<CellIndexEntry> const& cellIndexByIds)
+    {
+        int index = 0;
+        float angleOffset = 0;
+        for (ConnectionDescription const& connection : cellToAdd.connections) {
+            if (connection.cellId != 0) {
+                cellTO.connections[index].cellIndex = findCellIndex(cellIndexByIds, connection.cellId);
+                cellTO.connections[index].distance = connection.distance;
+                cellTO.connections[index].angleFromPrevious = connection.angleFromPrevious + angleOffset;
+                ++index;
+                angleOffset = 0;
+            } else {
+                angleOffset += connection.angleFromPrevious;
             }
         }
-        for (int col = 0; col < MAX_CHANNELS; ++col) {
-            result[col + MAX_CHANNELS * MAX_CHANNELS] = bias[col];
+        if (angleOffset != 0 && index > 0) {
+            cellTO.connections[0].angleFromPrevious += angleOffset;
         }
+        cellTO.numConnections = index;
+    }
 
-        return result;
+    //position of the next row to be read in each cell function section of the columnar data
+    struct CellFunctionCursors
+    {
+        size_t neuron = 0;
+        size_t transmitter = 0;
+        size_t constructor = 0;
+        size_t sensor = 0;
+        size_t nerve = 0;
+        size_t attacker = 0;
+        size_t injector = 0;
+        size_t muscle = 0;
+        size_t defender = 0;
+        size_t reconnector = 0;
+        size_t detonator = 0;
+    };
+
+    void addCellFunctionToColumnarData(ColumnarData& data, DataTO const& dataTO, CellTO const& cellTO)
+    {
+        auto const& cellFunctionTO = cellTO.cellFunctionData;
+        switch (cellTO.cellFunction) {
+        case CellFunction_Neuron: {
+            //auxiliary data is not aligned for floats
+            auto source = dataTO.auxiliaryData + cellFunctionTO.neuron.weightsAndBiasesDataIndex;
+            auto& weights = data.neurons.weights;
+            auto& biases = data.neurons.biases;
+            weights.resize(weights.size() + MAX_CHANNELS * MAX_CHANNELS);
+            biases.resize(biases.size() + MAX_CHANNELS);
+            std::memcpy(&weights[weights.size() - MAX_CHANNELS * MAX_CHANNELS], source, sizeof(float) * MAX_CHANNELS * MAX_CHANNELS);
+            std::memcpy(&biases[biases.size() - MAX_CHANNELS], source + sizeof(float) * MAX_CHANNELS * MAX_CHANNELS, sizeof(float) * MAX_CHANNELS);
+            data.neurons.activationFunctions.insert(
+                data.neurons.activationFunctions.end(), cellFunctionTO.neuron.activationFunctions, cellFunctionTO.neuron.activationFunctions + MAX_CHANNELS);
+        } break;
+        case CellFunction_Transmitter: {
+            data.transmitters.mode.emplace_back(cellFunctionTO.transmitter.mode);
+        } break;
+        case CellFunction_Constructor: {
+            auto const& constructorTO = cellFunctionTO.constructor;
+            auto& target = data.constructors;
+            target.activationMode.emplace_back(constructorTO.activationMode);
+            target.constructionActivationTime.emplace_back(constructorTO.constructionActivationTime);
+            target.genomeIndex.emplace_back(data.genomePool.addGenome(dataTO.auxiliaryData + constructorTO.genomeDataIndex, constructorTO.genomeSize));
+            target.genomeGeneration.emplace_back(constructorTO.genomeGeneration);
+            target.constructionAngle1.emplace_back(constructorTO.constructionAngle1);
+            target.constructionAngle2.emplace_back(constructorTO.constructionAngle2);
+            target.lastConstructedCellId.emplace_back(constructorTO.lastConstructedCellId);
+            target.genomeCurrentNodeIndex.emplace_back(constructorTO.genomeCurrentNodeIndex);
+            target.genomeCurrentRepetition.emplace_back(constructorTO.genomeCurrentRepetition);
+            target.isConstructionBuilt.emplace_back(constructorTO.isConstructionBuilt ? 1 : 0);
+            target.offspringCreatureId.emplace_back(constructorTO.offspringCreatureId);
+            target.offspringMutationId.emplace_back(constructorTO.offspringMutationId);
+        } break;
+        case CellFunction_Sensor: {
+            auto const& sensorTO = cellFunctionTO.sensor;
+            auto& target = data.sensors;
+            target.hasFixedAngle.emplace_back(sensorTO.mode == SensorMode_FixedAngle ? 1 : 0);
+            target.fixedAngle.emplace_back(sensorTO.mode == SensorMode_FixedAngle ? sensorTO.angle : 0.0f);
+            target.minDensity.emplace_back(sensorTO.minDensity);
+            target.color.emplace_back(sensorTO.color);
+            target.targetedCreatureId.emplace_back(sensorTO.targetedCreatureId);
+            target.memoryChannel1.emplace_back(sensorTO.memoryChannel1);
+            target.memoryChannel2.emplace_back(sensorTO.memoryChannel2);
+            target.memoryChannel3.emplace_back(sensorTO.memoryChannel3);
+        } break;
+        case CellFunction_Nerve: {
+            data.nerves.pulseMode.emplace_back(cellFunctionTO.nerve.pulseMode);
+            data.nerves.alternationMode.emplace_back(cellFunctionTO.nerve.alternationMode);
+        } break;
+        case CellFunction_Attacker: {
+            data.attackers.mode.emplace_back(cellFunctionTO.attacker.mode);
+        } break;
+        case CellFunction_Injector: {
+            auto const& injectorTO = cellFunctionTO.injector;
+            data.injectors.mode.emplace_back(injectorTO.mode);
+            data.injectors.counter.emplace_back(injectorTO.counter);
+            data.injectors.genomeIndex.emplace_back(data.genomePool.addGenome(dataTO.auxiliaryData + injectorTO.genomeDataIndex, injectorTO.genomeSize));
+            data.injectors.genomeGeneration.emplace_back(injectorTO.genomeGeneration);
+        } break;
+        case CellFunction_Muscle: {
+            data.muscles.mode.emplace_back(cellFunctionTO.muscle.mode);
+            data.muscles.lastBendingDirection.emplace_back(cellFunctionTO.muscle.lastBendingDirection);
+            data.muscles.lastBendingSourceIndex.emplace_back(cellFunctionTO.muscle.lastBendingSourceIndex);
+            data.muscles.consecutiveBendingAngle.emplace_back(cellFunctionTO.muscle.consecutiveBendingAngle);
+        } break;
+        case CellFunction_Defender: {
+            data.defenders.mode.emplace_back(cellFunctionTO.defender.mode);
+        } break;
+        case CellFunction_Reconnector: {
+            data.reconnectors.color.emplace_back(cellFunctionTO.reconnector.color);
+        } break;
+        case CellFunction_Detonator: {
+            data.detonators.state.emplace_back(cellFunctionTO.detonator.state);
+            data.detonators.countdown.emplace_back(cellFunctionTO.detonator.countdown);
+        } break;
+        }
     }
 
-    std::pair<std::vector<std::vector<float>>, std::vector<float>> splitWeightsAndBias(std::vector<float> const& weightsAndBias)
+    void setCellFunctionFromColumnarData(
+        CellTO& cellTO,
+        DataTO const& dataTO,
+        ColumnarData const& data,
+        std::vector<uint64_t> const& genomeOffsets,
+        CellFunctionCursors& cursors)
     {
-        std::vector<std::vector<float>> weights(MAX_CHANNELS, std::vector<float>(MAX_CHANNELS, 0));
-        for (int row = 0; row < MAX_CHANNELS; ++row) {
-            for (int col = 0; col < MAX_CHANNELS; ++col) {
-                weights[row][col] = weightsAndBias[col + row * MAX_CHANNELS];
+        auto& cellFunctionTO = cellTO.cellFunctionData;
+        switch (cellTO.cellFunction) {
+        case CellFunction_Neuron: {
+            auto index = cursors.neuron++;
+            cellFunctionTO.neuron.weightsAndBiasesDataIndex = copyToAuxiliaryData(
+                dataTO, &data.neurons.weights.at(index * MAX_CHANNELS * MAX_CHANNELS), sizeof(float) * MAX_CHANNELS * MAX_CHANNELS);
+            copyToAuxiliaryData(dataTO, &data.neurons.biases.at(index * MAX_CHANNELS), sizeof(float) * MAX_CHANNELS);
+            for (int i = 0; i < MAX_CHANNELS; ++i) {
+                cellFunctionTO.neuron.activationFunctions[i] = data.neurons.activationFunctions.at(index * MAX_CHANNELS + i);
             }
+        } break;
+        case CellFunction_Transmitter: {
+            cellFunctionTO.transmitter.mode = data.transmitters.mode.at(cursors.transmitter++);
+        } break;
+        case CellFunction_Constructor: {
+            auto const& source = data.constructors;
+            auto index = cursors.constructor++;
+            auto& constructorTO = cellFunctionTO.constructor;
+            constructorTO.activationMode = source.activationMode.at(index);
+            constructorTO.constructionActivationTime = source.constructionActivationTime.at(index);
+            auto genomeIndex = source.genomeIndex.at(index);
+            constructorTO.genomeSize = data.genomePool.genomeSize.at(genomeIndex);
+            CHECK(constructorTO.genomeSize >= Const::GenomeHeaderSize)
+            constructorTO.genomeDataIndex =
+                copyToAuxiliaryData(dataTO, data.genomePool.bytes.data() + genomeOffsets.at(genomeIndex), constructorTO.genomeSize);
+            constructorTO.genomeGeneration = source.genomeGeneration.at(index);
+            constructorTO.constructionAngle1 = source.constructionAngle1.at(index);
+            constructorTO.constructionAngle2 = source.constructionAngle2.at(index);
+            constructorTO.lastConstructedCellId = source.lastConstructedCellId.at(index);
+            constructorTO.genomeCurrentNodeIndex = source.genomeCurrentNodeIndex.at(index);
+            constructorTO.genomeCurrentRepetition = source.genomeCurrentRepetition.at(index);
+            constructorTO.isConstructionBuilt = source.isConstructionBuilt.at(index) != 0;
+            constructorTO.offspringCreatureId = source.offspringCreatureId.at(index);
+            constructorTO.offspringMutationId = source.offspringMutationId.at(index);
+        } break;
+        case CellFunction_Sensor: {
+            auto const& source = data.sensors;
+            auto index = cursors.sensor++;
+            auto& sensorTO = cellFunctionTO.sensor;
+            sensorTO.mode = source.hasFixedAngle.at(index) != 0 ? SensorMode_FixedAngle : SensorMode_Neighborhood;
+            sensorTO.angle = source.fixedAngle.at(index);
+            sensorTO.minDensity = source.minDensity.at(index);
+            sensorTO.color = source.color.at(index);
+            sensorTO.targetedCreatureId = source.targetedCreatureId.at(index);
+            sensorTO.memoryChannel1 = source.memoryChannel1.at(index);
+            sensorTO.memoryChannel2 = source.memoryChannel2.at(index);
+            sensorTO.memoryChannel3 = source.memoryChannel3.at(index);
+        } break;
+        case CellFunction_Nerve: {
+            auto index = cursors.nerve++;
+            cellFunctionTO.nerve.pulseMode = data.nerves.pulseMode.at(index);
+            cellFunctionTO.nerve.alternationMode = data.nerves.alternationMode.at(index);
+        } break;
+        case CellFunction_Attacker: {
+            cellFunctionTO.attacker.mode = data.attackers.mode.at(cursors.attacker++);
+        } break;
+        case CellFunction_Injector: {
+            auto const& source = data.injectors;
+            auto index = cursors.injector++;
+            auto& injectorTO = cellFunctionTO.injector;
+            injectorTO.mode = source.mode.at(index);
+            injectorTO.counter = source.counter.at(index);
+            auto genomeIndex = source.genomeIndex.at(index);
+            injectorTO.genomeSize = data.genomePool.genomeSize.at(genomeIndex);
+            CHECK(injectorTO.genomeSize >= Const::GenomeHeaderSize)
+            injectorTO.genomeDataIndex = copyToAuxiliaryData(dataTO, data.genomePool.bytes.data() + genomeOffsets.at(genomeIndex), injectorTO.genomeSize);
+            injectorTO.genomeGeneration = source.genomeGeneration.at(index);
+        } break;
+        case CellFunction_Muscle: {
+            auto const& source = data.muscles;
+            auto index = cursors.muscle++;
+            cellFunctionTO.muscle.mode = source.mode.at(index);
+            cellFunctionTO.muscle.lastBendingDirection = source.lastBendingDirection.at(index);
+            cellFunctionTO.muscle.lastBendingSourceIndex = source.lastBendingSourceIndex.at(index);
+            cellFunctionTO.muscle.consecutiveBendingAngle = source.consecutiveBendingAngle.at(index);
+        } break;
+        case CellFunction_Defender: {
+            cellFunctionTO.defender.mode = data.defenders.mode.at(cursors.defender++);
+        } break;
+        case CellFunction_Reconnector: {
+            cellFunctionTO.reconnector.color = data.reconnectors.color.at(cursors.reconnector++);
+        } break;
+        case CellFunction_Detonator: {
+            auto index = cursors.detonator++;
+            cellFunctionTO.detonator.state = data.detonators.state.at(index);
+            cellFunctionTO.detonator.countdown = data.detonators.countdown.at(index);
+        } break;
         }
-
-        std::vector<float> bias;
-        bias = std::vector<float>(weightsAndBias.begin() + MAX_CHANNELS * MAX_CHANNELS, weightsAndBias.end());
-
-        return std::make_pair(weights, bias);
     }
 }
 
@@ -128,33 +311,45 @@ ArraySizes DescriptionConverter::getArraySizes(ClusteredDataDescription const& d
     return result;
 }
 
+ArraySizes DescriptionConverter::getArraySizes(ColumnarData const& data) const
+{
+    ArraySizes result;
+    result.cellArraySize = data.cells.id.size();
+    result.particleArraySize = data.particles.id.size();
+    result.auxiliaryDataSize = data.metadata.chars.size();
+    for (auto const& cellFunction : data.cells.cellFunction) {
+        if (cellFunction == CellFunction_Neuron) {
+            result.auxiliaryDataSize += MAX_CHANNELS * (MAX_CHANNELS + 1) * sizeof(float);
+        }
+    }
+
+    //genomes are shared in the pool but each cell needs its own copy
+    for (auto const& genomeIndex : data.constructors.genomeIndex) {
+        result.auxiliaryDataSize += data.genomePool.genomeSize.at(genomeIndex);
+    }
+    for (auto const& genomeIndex : data.injectors.genomeIndex) {
+        result.auxiliaryDataSize += data.genomePool.genomeSize.at(genomeIndex);
+    }
+    return result;
+}
+
 ClusteredDataDescription DescriptionConverter::convertTOtoClusteredDataDescription(DataTO const& dataTO) const
 {
 	ClusteredDataDescription result;
 
     //cells
-    std::vector<ClusterDescription> clusters;
-    std::unordered_set<int> freeCellIndices;
-    for (int i = 0; i < *dataTO.numCells; ++i) {
-        freeCellIndices.insert(i);
-    }
-    std::unordered_map<int, int> cellTOIndexToCellDescIndex;
-    std::unordered_map<int, int> cellTOIndexToClusterDescIndex;
-    int clusterDescIndex = 0;
-    while (!freeCellIndices.empty()) {
-        auto freeCellIndex = *freeCellIndices.begin();
-        auto createClusterData = scanAndCreateClusterDescription(dataTO, freeCellIndex, freeCellIndices);
-        clusters.emplace_back(createClusterData.cluster);
-
-        //update index maps
-        cellTOIndexToCellDescIndex.insert(
-            createClusterData.cellTOIndexToCellDescIndex.begin(), createClusterData.cellTOIndexToCellDescIndex.end());
-        for (auto const& cellTOIndex : createClusterData.cellTOIndexToCellDescIndex | boost::adaptors::map_keys) {
-            cellTOIndexToClusterDescIndex.emplace(cellTOIndex, clusterDescIndex);
+    auto clusterSets = calcClusterSets(dataTO);
+    auto numClusters = clusterSets.offsets.size() - 1;
+    result.clusters.resize(numClusters);
+    for (uint64_t clusterIndex = 0; clusterIndex < numClusters; ++clusterIndex) {
+        auto& cells = result.clusters[clusterIndex].cells;
+        auto begin = clusterSets.offsets[clusterIndex];
+        auto end = clusterSets.offsets[clusterIndex + 1];
+        cells.reserve(end - begin);
+        for (auto i = begin; i < end; ++i) {
+            cells.emplace_back(createCellDescription(dataTO, toInt(clusterSets.elements[i])));
         }
-        ++clusterDescIndex;
     }
-    result.addClusters(clusters);
 
     //particles
     std::vector<ParticleDescription> particles;
@@ -229,19 +424,13 @@ OverlayDescription DescriptionConverter::convertTOtoOverlayDescription(DataTO co
 
 void DescriptionConverter::convertDescriptionToTO(DataTO& result, ClusteredDataDescription const& description) const
 {
-    std::unordered_map<uint64_t, int> cellIndexByIds;
-    for (auto const& cluster: description.clusters) {
-        for (auto const& cell : cluster.cells) {
-            addCell(result, cell, cellIndexByIds);
-        }
-    }
+    std::vector<CellDescription const*> cells;
     for (auto const& cluster : description.clusters) {
         for (auto const& cell : cluster.cells) {
-            if (cell.id != 0) {
-                setConnections(result, cell, cellIndexByIds);
-            }
+            cells.emplace_back(&cell);
         }
     }
+    addCells(result, cells, true);
     for (auto const& particle : description.particles) {
         addParticle(result, particle);
     }
@@ -249,15 +438,12 @@ void DescriptionConverter::convertDescriptionToTO(DataTO& result, ClusteredDataD
 
 void DescriptionConverter::convertDescriptionToTO(DataTO& result, DataDescription const& description) const
 {
-    std::unordered_map<uint64_t, int> cellIndexByIds;
-    for (auto const& cell : description.cells) {
-        addCell(result, cell, cellIndexByIds);
-    }
+    std::vector<CellDescription const*> cells;
+    cells.reserve(description.cells.size());
     for (auto const& cell : description.cells) {
-        if (cell.id != 0) {
-            setConnections(result, cell, cellIndexByIds);
-        }
+        cells.emplace_back(&cell);
     }
+    addCells(result, cells, true);
     for (auto const& particle : description.particles) {
         addParticle(result, particle);
     }
@@ -265,8 +451,7 @@ void DescriptionConverter::convertDescriptionToTO(DataTO& result, DataDescriptio
 
 void DescriptionConverter::convertDescriptionToTO(DataTO& result, CellDescription const& cell) const
 {
-    std::unordered_map<uint64_t, int> cellIndexByIds;
-    addCell(result, cell, cellIndexByIds);
+    addCells(result, {&cell}, false);
 }
 
 void DescriptionConverter::convertDescriptionToTO(DataTO& result, ParticleDescription const& particle) const
@@ -274,6 +459,175 @@ void DescriptionConverter::convertDescriptionToTO(DataTO& result, ParticleDescri
     addParticle(result, particle);
 }
 
+ColumnarData DescriptionConverter::convertTOtoColumnarData(DataTO const& dataTO) const
+{
+    ColumnarData result;
+
+    //cells
+    auto numCells = *dataTO.numCells;
+    auto& cells = result.cells;
+    cells.visit([&](auto& column) { column.reserve(numCells); });
+    cells.activity.reserve(numCells * MAX_CHANNELS);
+    result.metadata.nameSize.reserve(numCells);
+    result.metadata.descriptionSize.reserve(numCells);
+    for (uint64_t i = 0; i < numCells; ++i) {
+        auto const& cellTO = dataTO.cells[i];
+        cells.id.emplace_back(cellTO.id);
+        cells.posX.emplace_back(cellTO.pos.x);
+        cells.posY.emplace_back(cellTO.pos.y);
+        cells.velX.emplace_back(cellTO.vel.x);
+        cells.velY.emplace_back(cellTO.vel.y);
+        cells.energy.emplace_back(cellTO.energy);
+        cells.stiffness.emplace_back(cellTO.stiffness);
+        cells.color.emplace_back(cellTO.color);
+        cells.maxConnections.emplace_back(cellTO.maxConnections);
+        cells.numConnections.emplace_back(static_cast<uint8_t>(cellTO.numConnections));
+        cells.barrier.emplace_back(cellTO.barrier ? 1 : 0);
+        cells.age.emplace_back(cellTO.age);
+        cells.livingState.emplace_back(cellTO.livingState);
+        cells.creatureId.emplace_back(cellTO.creatureId);
+        cells.mutationId.emplace_back(cellTO.mutationId);
+        cells.executionOrderNumber.emplace_back(cellTO.executionOrderNumber);
+        cells.inputExecutionOrderNumber.emplace_back(cellTO.inputExecutionOrderNumber >= 0 ? cellTO.inputExecutionOrderNumber : -1);
+        cells.outputBlocked.emplace_back(cellTO.outputBlocked ? 1 : 0);
+        cells.cellFunction.emplace_back(cellTO.cellFunction);
+        cells.activity.insert(cells.activity.end(), cellTO.activity.channels, cellTO.activity.channels + MAX_CHANNELS);
+        cells.activationTime.emplace_back(cellTO.activationTime);
+        cells.genomeNumNodes.emplace_back(cellTO.genomeNumNodes);
+
+        for (int j = 0; j < cellTO.numConnections; ++j) {
+            auto const& connectionTO = cellTO.connections[j];
+            result.connections.cellId.emplace_back(connectionTO.cellIndex != -1 ? dataTO.cells[connectionTO.cellIndex].id : 0);
+            result.connections.distance.emplace_back(connectionTO.distance);
+            result.connections.angleFromPrevious.emplace_back(connectionTO.angleFromPrevious);
+        }
+
+        auto const& metadataTO = cellTO.metadata;
+        auto& chars = result.metadata.chars;
+        result.metadata.nameSize.emplace_back(metadataTO.nameSize);
+        result.metadata.descriptionSize.emplace_back(metadataTO.descriptionSize);
+        if (metadataTO.nameSize > 0) {
+            auto name = reinterpret_cast<char const*>(dataTO.auxiliaryData + metadataTO.nameDataIndex);
+            chars.insert(chars.end(), name, name + metadataTO.nameSize);
+        }
+        if (metadataTO.descriptionSize > 0) {
+            auto description = reinterpret_cast<char const*>(dataTO.auxiliaryData + metadataTO.descriptionDataIndex);
+            chars.insert(chars.end(), description, description + metadataTO.descriptionSize);
+        }
+
+        addCellFunctionToColumnarData(result, dataTO, cellTO);
+    }
+
+    //particles
+    auto numParticles = *dataTO.numParticles;
+    auto& particles = result.particles;
+    particles.visit([&](auto& column) { column.reserve(numParticles); });
+    for (uint64_t i = 0; i < numParticles; ++i) {
+        auto const& particleTO = dataTO.particles[i];
+        particles.id.emplace_back(particleTO.id);
+        particles.posX.emplace_back(particleTO.pos.x);
+        particles.posY.emplace_back(particleTO.pos.y);
+        particles.velX.emplace_back(particleTO.vel.x);
+        particles.velY.emplace_back(particleTO.vel.y);
+        particles.energy.emplace_back(particleTO.energy);
+        particles.color.emplace_back(particleTO.color);
+    }
+    return result;
+}
+
+void DescriptionConverter::convertColumnarDataToTO(DataTO& result, ColumnarData const& data) const
+{
+    auto genomeOffsets = data.genomePool.calcGenomeOffsets();
+    auto const& cells = data.cells;
+    auto numCells = cells.id.size();
+
+    //cells
+    std::vector<CellIndexEntry> cellIndexByIds;
+    cellIndexByIds.reserve(numCells);
+    std::vector<int> cellIndices(numCells);
+    size_t metadataCharIndex = 0;
+    CellFunctionCursors cursors;
+    for (size_t i = 0; i < numCells; ++i) {
+        int cellIndex = (*result.numCells)++;
+        CellTO& cellTO = result.cells[cellIndex];
+        cellTO.id = cells.id[i] == 0 ? NumberGenerator::getInstance().getId() : cells.id[i];
+        cellTO.pos = {cells.posX.at(i), cells.posY.at(i)};
+        cellTO.vel = {cells.velX.at(i), cells.velY.at(i)};
+        cellTO.energy = cells.energy.at(i);
+        cellTO.stiffness = cells.stiffness.at(i);
+        cellTO.color = cells.color.at(i);
+        cellTO.maxConnections = cells.maxConnections.at(i);
+        cellTO.numConnections = 0;
+        cellTO.barrier = cells.barrier.at(i) != 0;
+        cellTO.age = cells.age.at(i);
+        cellTO.livingState = cells.livingState.at(i);
+        cellTO.creatureId = cells.creatureId.at(i);
+        cellTO.mutationId = cells.mutationId.at(i);
+        cellTO.executionOrderNumber = cells.executionOrderNumber.at(i);
+        cellTO.inputExecutionOrderNumber = cells.inputExecutionOrderNumber.at(i);
+        cellTO.outputBlocked = cells.outputBlocked.at(i) != 0;
+        cellTO.cellFunction = cells.cellFunction.at(i);
+        for (int j = 0; j < MAX_CHANNELS; ++j) {
+            cellTO.activity.channels[j] = cells.activity.at(i * MAX_CHANNELS + j);
+        }
+        cellTO.activationTime = cells.activationTime.at(i);
+        cellTO.genomeNumNodes = cells.genomeNumNodes.at(i);
+
+        auto nameSize = data.metadata.nameSize.at(i);
+        auto descriptionSize = data.metadata.descriptionSize.at(i);
+        CHECK(metadataCharIndex + nameSize + descriptionSize <= data.metadata.chars.size())
+        cellTO.metadata.nameSize = nameSize;
+        cellTO.metadata.nameDataIndex = copyToAuxiliaryData(result, data.metadata.chars.data() + metadataCharIndex, nameSize);
+        cellTO.metadata.descriptionSize = descriptionSize;
+        cellTO.metadata.descriptionDataIndex = copyToAuxiliaryData(result, data.metadata.chars.data() + metadataCharIndex + nameSize, descriptionSize);
+        metadataCharIndex += nameSize + descriptionSize;
+
+        setCellFunctionFromColumnarData(cellTO, result, data, genomeOffsets, cursors);
+
+        cellIndices[i] = cellIndex;
+        if (cells.id[i] != 0) {
+            cellIndexByIds.emplace_back(CellIndexEntry{cells.id[i], cellIndex});
+        }
+    }
+    sortCellIndexByIds(cellIndexByIds);
+
+    //connections can only be set when all cells are added
+    size_t connectionIndex = 0;
+    for (size_t i = 0; i < numCells; ++i) {
+        auto& cellTO = result.cells[cellIndices[i]];
+        int index = 0;
+        float angleOffset = 0;
+        for (int j = 0; j < cells.numConnections.at(i); ++j, ++connectionIndex) {
+            auto connectedCellId = data.connections.cellId.at(connectionIndex);
+            if (connectedCellId != 0) {
+                cellTO.connections[index].cellIndex = findCellIndex(cellIndexByIds, connectedCellId);
+                cellTO.connections[index].distance = data.connections.distance.at(connectionIndex);
+                cellTO.connections[index].angleFromPrevious = data.connections.angleFromPrevious.at(connectionIndex) + angleOffset;
+                ++index;
+                angleOffset = 0;
+            } else {
+                angleOffset += data.connections.angleFromPrevious.at(connectionIndex);
+            }
+        }
+        if (angleOffset != 0 && index > 0) {
+            cellTO.connections[0].angleFromPrevious += angleOffset;
+        }
+        cellTO.numConnections = index;
+    }
+
+    //particles
+    auto const& particles = data.particles;
+    for (size_t i = 0; i < particles.id.size(); ++i) {
+        auto particleIndex = (*result.numParticles)++;
+        ParticleTO& particleTO = result.particles[particleIndex];
+        particleTO.id = particles.id[i] == 0 ? NumberGenerator::getInstance().getId() : particles.id[i];
+        particleTO.pos = {particles.posX.at(i), particles.posY.at(i)};
+        particleTO.vel = {particles.velX.at(i), particles.velY.at(i)};
+        particleTO.energy = particles.energy.at(i);
+        particleTO.color = particles.color.at(i);
+    }
+}
+
 void DescriptionConverter::addAdditionalDataSizeForCell(CellDescription const& cell, uint64_t& additionalDataSize) const
 {
     additionalDataSize += cell.metadata.name.size() + cell.metadata.description.size();
@@ -306,57 +660,19 @@ void DescriptionConverter::addAdditionalDataSizeForCell(CellDescription const& c
     }
 }    
 
-namespace
+DisjointSets::Sets DescriptionConverter::calcClusterSets(DataTO const& dataTO) const
 {
-    template <typename T>
-    void setInplaceDifference(std::unordered_set<T>& a, std::unordered_set<T> const& b)
-    {
-        for (auto const& element : b) {
-            a.erase(element);
-        }
-    }
-}
-
-auto DescriptionConverter::scanAndCreateClusterDescription(
-    DataTO const& dataTO,
-    int startCellIndex,
-    std::unordered_set<int>& freeCellIndices) const
-    -> CreateClusterReturnData
-{
-    CreateClusterReturnData result; 
-
-    std::unordered_set<int> currentCellIndices;
-    currentCellIndices.insert(startCellIndex);
-    std::unordered_set<int> scannedCellIndices = currentCellIndices;
-
-    std::vector<CellDescription> cells;
-    std::unordered_set<int> nextCellIndices;
-    int cellDescIndex = 0;
-    do {
-        for (auto const& currentCellIndex : currentCellIndices) {
-            cells.emplace_back(createCellDescription(dataTO, currentCellIndex));
-            result.cellTOIndexToCellDescIndex.emplace(currentCellIndex, cellDescIndex);
-            auto const& cellTO = dataTO.cells[currentCellIndex];
-            for (int i = 0; i < cellTO.numConnections; ++i) {
-                auto connectionTO = cellTO.connections[i];
-                if (connectionTO.cellIndex != -1) {
-                    if (scannedCellIndices.find(connectionTO.cellIndex) == scannedCellIndices.end()) {
-                        nextCellIndices.insert(connectionTO.cellIndex);
-                        scannedCellIndices.insert(connectionTO.cellIndex);
-                    }
-                }
+    DisjointSets cellSets(*dataTO.numCells);
+    for (uint64_t i = 0; i < *dataTO.numCells; ++i) {
+        auto const& cellTO = dataTO.cells[i];
+        for (int j = 0; j < cellTO.numConnections; ++j) {
+            auto connectedCellIndex = cellTO.connections[j].cellIndex;
+            if (connectedCellIndex != -1) {
+                cellSets.unite(i, connectedCellIndex);
             }
-            ++cellDescIndex;
         }
-        currentCellIndices = nextCellIndices;
-        nextCellIndices.clear();
-    } while (!currentCellIndices.empty());
-
-    setInplaceDifference(freeCellIndices, scannedCellIndices);
-
-    result.cluster.addCells(cells);
-
-    return result;
+    }
+    return cellSets.getSets();
 }
 
 CellDescription DescriptionConverter::createCellDescription(DataTO const& dataTO, int cellIndex) const
@@ -411,12 +727,10 @@ CellDescription DescriptionConverter::createCellDescription(DataTO const& dataTO
     switch (cellTO.cellFunction) {
     case CellFunction_Neuron: {
         NeuronDescription neuron;
-        std::vector<float> weigthsAndBias;
-        convert(dataTO, sizeof(float) * MAX_CHANNELS * (MAX_CHANNELS + 1), cellTO.cellFunctionData.neuron.weightsAndBiasesDataIndex, weigthsAndBias);
-        std::tie(neuron.weights, neuron.biases) = splitWeightsAndBias(weigthsAndBias);
-        for (int i = 0; i < MAX_CHANNELS; ++i) {
-            neuron.activationFunctions[i] = cellTO.cellFunctionData.neuron.activationFunctions[i];
-        }
+        auto source = dataTO.auxiliaryData + cellTO.cellFunctionData.neuron.weightsAndBiasesDataIndex;
+        std::memcpy(neuron.weights.data(), source, sizeof(neuron.weights));
+        std::memcpy(neuron.biases.data(), source + sizeof(neuron.weights), sizeof(neuron.biases));
+        std::copy_n(cellTO.cellFunctionData.neuron.activationFunctions, MAX_CHANNELS, neuron.activationFunctions.begin());
         result.cellFunction = neuron;
     } break;
     case CellFunction_Transmitter: {
@@ -517,12 +831,44 @@ void DescriptionConverter::addParticle(DataTO const& dataTO, ParticleDescription
     particleTO.color = particleDesc.color;
 }
 
-void DescriptionConverter::addCell(
-    DataTO const& dataTO, CellDescription const& cellDesc, std::unordered_map<uint64_t, int>& cellIndexTOByIds) const
+void DescriptionConverter::addCells(DataTO const& dataTO, std::vector<CellDescription const*> const& cells, bool withConnections) const
+{
+    auto numCells = cells.size();
+    auto firstCellIndex = toInt(*dataTO.numCells);
+
+    //first pass: ids and positions in the auxiliary data
+    std::vector<uint64_t> cellIds(numCells);
+    std::vector<uint64_t> auxiliaryDataIndices(numCells + 1);
+    std::vector<CellIndexEntry> cellIndexByIds(numCells);
+    auxiliaryDataIndices[0] = *dataTO.numAuxiliaryData;
+    for (size_t i = 0; i < numCells; ++i) {
+        auto const& cell = *cells[i];
+        cellIds[i] = cell.id == 0 ? NumberGenerator::getInstance().getId() : cell.id;
+        cellIndexByIds[i] = CellIndexEntry{cellIds[i], firstCellIndex + toInt(i)};
+        auxiliaryDataIndices[i + 1] = auxiliaryDataIndices[i];
+        addAdditionalDataSizeForCell(cell, auxiliaryDataIndices[i + 1]);
+    }
+    sortCellIndexByIds(cellIndexByIds);
+
+    //second pass: cell slots are filled in parallel
+    ParallelExecution::executeForRanges(numCells, CellRangeSize, [&](size_t begin, size_t end) {
+        for (auto i = begin; i < end; ++i) {
+            auto cellIndex = firstCellIndex + toInt(i);
+            setCell(dataTO, *cells[i], cellIndex, cellIds[i], auxiliaryDataIndices[i]);
+            if (withConnections && cells[i]->id != 0) {
+                setConnections(dataTO.cells[cellIndex], *cells[i], cellIndexByIds);
+            }
+        }
+    });
+
+    *dataTO.numCells += numCells;
+    *dataTO.numAuxiliaryData = auxiliaryDataIndices[numCells];
+}
+
+void DescriptionConverter::setCell(DataTO const& dataTO, CellDescription const& cellDesc, int cellIndex, uint64_t cellId, uint64_t auxiliaryDataIndex) const
 {
-    int cellIndex = (*dataTO.numCells)++;
     CellTO& cellTO = dataTO.cells[cellIndex];
-    cellTO.id = cellDesc.id == 0 ? NumberGenerator::getInstance().getId() : cellDesc.id;
+    cellTO.id = cellId;
 	cellTO.pos= { cellDesc.pos.x, cellDesc.pos.y };
     cellTO.vel = {cellDesc.vel.x, cellDesc.vel.y};
     cellTO.energy = cellDesc.energy;
@@ -539,13 +885,9 @@ void DescriptionConverter::addCell(
     case CellFunction_Neuron: {
         NeuronTO neuronTO;
         auto const& neuronDesc = std::get<NeuronDescription>(*cellDesc.cellFunction);
-        std::vector<float> weigthsAndBias = unitWeightsAndBias(neuronDesc.weights, neuronDesc.biases);
-        int targetSize;
-        convert(dataTO, weigthsAndBias, targetSize, neuronTO.weightsAndBiasesDataIndex);
-        CHECK(targetSize == sizeof(float) * MAX_CHANNELS * (MAX_CHANNELS + 1));
-        for (int i = 0; i < MAX_CHANNELS; ++i) {
-            neuronTO.activationFunctions[i] = neuronDesc.activationFunctions[i];
-        }
+        neuronTO.weightsAndBiasesDataIndex = writeAuxiliaryData(dataTO, auxiliaryDataIndex, neuronDesc.weights.data(), sizeof(neuronDesc.weights));
+        writeAuxiliaryData(dataTO, auxiliaryDataIndex, neuronDesc.biases.data(), sizeof(neuronDesc.biases));
+        std::copy(neuronDesc.activationFunctions.begin(), neuronDesc.activationFunctions.end(), neuronTO.activationFunctions);
         cellTO.cellFunctionData.neuron = neuronTO;
     } break;
     case CellFunction_Transmitter: {
@@ -560,7 +902,8 @@ void DescriptionConverter::addCell(
         constructorTO.activationMode = constructorDesc.activationMode;
         constructorTO.constructionActivationTime = constructorDesc.constructionActivationTime;
         CHECK(constructorDesc.genome.size() >= Const::GenomeHeaderSize)
-        convert(dataTO, constructorDesc.genome, constructorTO.genomeSize, constructorTO.genomeDataIndex);
+        constructorTO.genomeSize = toInt(constructorDesc.genome.size());
+        constructorTO.genomeDataIndex = writeAuxiliaryData(dataTO, auxiliaryDataIndex, constructorDesc.genome.data(), constructorDesc.genome.size());
         constructorTO.lastConstructedCellId = constructorDesc.lastConstructedCellId;
         constructorTO.genomeCurrentNodeIndex = constructorDesc.genomeCurrentNodeIndex;
         constructorTO.genomeCurrentRepetition = constructorDesc.genomeCurrentRepetition;
@@ -604,7 +947,8 @@ void DescriptionConverter::addCell(
         injectorTO.mode = injectorDesc.mode;
         injectorTO.counter = injectorDesc.counter;
         CHECK(injectorDesc.genome.size() >= Const::GenomeHeaderSize)
-        convert(dataTO, injectorDesc.genome, injectorTO.genomeSize, injectorTO.genomeDataIndex);
+        injectorTO.genomeSize = toInt(injectorDesc.genome.size());
+        injectorTO.genomeDataIndex = writeAuxiliaryData(dataTO, auxiliaryDataIndex, injectorDesc.genome.data(), injectorDesc.genome.size());
         injectorTO.genomeGeneration = injectorDesc.genomeGeneration;
         cellTO.cellFunctionData.injector = injectorTO;
     } break;
@@ -646,29 +990,9 @@ void DescriptionConverter::addCell(
     cellTO.age = cellDesc.age;
     cellTO.color = cellDesc.color;
     cellTO.genomeNumNodes = cellDesc.genomeNumNodes;
-    convert(dataTO, cellDesc.metadata.name, cellTO.metadata.nameSize, cellTO.metadata.nameDataIndex);
-    convert(dataTO, cellDesc.metadata.description, cellTO.metadata.descriptionSize, cellTO.metadata.descriptionDataIndex);
-	cellIndexTOByIds.insert_or_assign(cellTO.id, cellIndex);
+    auto const& metadata = cellDesc.metadata;
+    cellTO.metadata.nameSize = toInt(metadata.name.size());
+    cellTO.metadata.nameDataIndex = writeAuxiliaryData(dataTO, auxiliaryDataIndex, metadata.name.data(), metadata.name.size());
+    cellTO.metadata.descriptionSize = toInt(metadata.description.size());
+    cellTO.metadata.descriptionDataIndex = writeAuxiliaryData(dataTO, auxiliaryDataIndex, metadata.description.data(), metadata.description.size());
 }
-
-void DescriptionConverter::setConnections(DataTO const& dataTO, CellDescription const& cellToAdd, std::unordered_map<uint64_t, int> const& cellIndexByIds) const
-{
-    int index = 0;
-    auto& cellTO = dataTO.cells[cellIndexByIds.at(cellToAdd.id)];
-    float angleOffset = 0;
-    for (ConnectionDescription const& connection : cellToAdd.connections) {
-        if (connection.cellId != 0) {
-            cellTO.connections[index].cellIndex = cellIndexByIds.at(connection.cellId);
-            cellTO.connections[index].distance = connection.distance;
-            cellTO.connections[index].angleFromPrevious = connection.angleFromPrevious + angleOffset;
-            ++index;
-            angleOffset = 0;
-        } else {
-            angleOffset += connection.angleFromPrevious;
-        }
-    }
-    if (angleOffset != 0 && index > 0) {
-        cellTO.connections[0].angleFromPrevious += angleOffset;
-    }
-    cellTO.numConnections = index;
-}
\ No newline at end of file
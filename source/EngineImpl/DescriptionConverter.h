@@ -1,9 +1,11 @@
 #pragma once
 
-#include <unordered_map>
+#include <vector>
 
+#include "Base/DisjointSets.h"
 #include "EngineInterface/Definitions.h"
 #include "EngineInterface/ArraySizes.h"
+#include "EngineInterface/ColumnarData.h"
 #include "EngineInterface/Descriptions.h"
 #include "EngineInterface/OverlayDescriptions.h"
 #include "EngineInterface/SimulationParameters.h"
@@ -17,10 +19,16 @@ public:
 
     ArraySizes getArraySizes(DataDescription const& data) const;
     ArraySizes getArraySizes(ClusteredDataDescription const& data) const;
+    ArraySizes getArraySizes(ColumnarData const& data) const;
 
     ClusteredDataDescription convertTOtoClusteredDataDescription(DataTO const& dataTO) const;
     DataDescription convertTOtoDataDescription(DataTO const& dataTO) const;
     OverlayDescription convertTOtoOverlayDescription(DataTO const& dataTO) const;
+
+    //columnar data is converted without building the cluster tree, i.e. the cells are not grouped into clusters
+    ColumnarData convertTOtoColumnarData(DataTO const& dataTO) const;
+    void convertColumnarDataToTO(DataTO& result, ColumnarData const& data) const;
+
     void convertDescriptionToTO(DataTO& result, ClusteredDataDescription const& description) const;
     void convertDescriptionToTO(DataTO& result, DataDescription const& description) const;
     void convertDescriptionToTO(DataTO& result, CellDescription const& cell) const;
@@ -29,24 +37,15 @@ public:
 private:
     void addAdditionalDataSizeForCell(CellDescription const& cell, uint64_t& additionalDataSize) const;
 
-	struct CreateClusterReturnData
-    {
-        ClusterDescription cluster;
-        std::unordered_map<int, int> cellTOIndexToCellDescIndex;
-	};
-    CreateClusterReturnData scanAndCreateClusterDescription(
-        DataTO const& dataTO,
-        int startCellIndex,
-        std::unordered_set<int>& freeCellIndices) const;
+    //cells of each cluster in ascending order of their indices
+    DisjointSets::Sets calcClusterSets(DataTO const& dataTO) const;
     CellDescription createCellDescription(DataTO const& dataTO, int cellIndex) const;
 
-	void addCell(
-        DataTO const& dataTO, CellDescription const& cellToAdd, std::unordered_map<uint64_t, int>& cellIndexTOByIds) const;
+    //ids and auxiliary data positions are determined sequentially, afterwards the cells are filled in parallel
+    void addCells(DataTO const& dataTO, std::vector<CellDescription const*> const& cells, bool withConnections) const;
+    void setCell(DataTO const& dataTO, CellDescription const& cellDesc, int cellIndex, uint64_t cellId, uint64_t auxiliaryDataIndex) const;
     void addParticle(DataTO const& dataTO, ParticleDescription const& particleDesc) const;
 
-	void setConnections(
-        DataTO const& dataTO, CellDescription const& cellToAdd, std::unordered_map<uint64_t, int> const& cellIndexByIds) const;
-
 private:
 	SimulationParameters _parameters;
 };
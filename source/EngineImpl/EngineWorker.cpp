@@ -17,8 +17,10 @@ void EngineWorker::newSimulation(uint64_t timestep, GeneralSettings const& gener
     _accessState = 0;
     _settings.generalSettings = generalSettings;
     _settings.simulationParameters = parameters;
-    _dataTOCache = std::make_shared<_AccessDataTOCache>();
     _simulationCudaFacade = std::make_shared<_SimulationCudaFacade>(timestep, _settings);
+    HostMemoryAllocator pinnedMemoryAllocator{_SimulationCudaFacade::allocatePinnedHostMemory, _SimulationCudaFacade::freePinnedHostMemory};
+    _dataTOCache = std::make_shared<_AccessDataTOCache>(pinnedMemoryAllocator);
+    _overlayDataTOCache = std::make_shared<_AccessDataTOCache>(pinnedMemoryAllocator, 2);
 
     if (_imageResource) {
         _cudaResource = _simulationCudaFacade->registerImageResource(*_imageResource);
@@ -82,15 +84,20 @@ std::optional<OverlayDescription> EngineWorker::tryDrawVectorGraphicsAndReturnOv
             {imageSize.x, imageSize.y},
             zoom);
 
-        DataTO dataTO = provideTO();
-
-        _simulationCudaFacade->getOverlayData(
+        DataTO dataTO = _overlayDataTOCache->getDataTO(_simulationCudaFacade->getArraySizes());
+        _simulationCudaFacade->getOverlayData_async(
             {toInt(rectUpperLeft.x), toInt(rectUpperLeft.y)},
             int2{toInt(rectLowerRight.x), toInt(rectLowerRight.y)},
             dataTO);
 
+        //the overlay of the previous frame is already on the host and is converted while the current one is transferred
+        auto previousDataTO = _overlayDataTOCache->getPreviousDataTO();
+        if (!previousDataTO) {
+            _simulationCudaFacade->waitForTransfersToHost();
+            previousDataTO = dataTO;
+        }
         DescriptionConverter converter(_settings.simulationParameters);
-        auto result = converter.convertTOtoOverlayDescription(dataTO);
+        auto result = converter.convertTOtoOverlayDescription(*previousDataTO);
 
         syncSimulationWithRenderingIfDesired();
         return result;
@@ -98,6 +105,20 @@ std::optional<OverlayDescription> EngineWorker::tryDrawVectorGraphicsAndReturnOv
     return std::nullopt;
 }
 
+void EngineWorker::drawVectorGraphicsToHost(
+    RealVector2D const& rectUpperLeft,
+    RealVector2D const& rectLowerRight,
+    IntVector2D const& imageSize,
+    double zoom,
+    std::vector<uint64_t>& image)
+{
+    EngineWorkerGuard access(this);
+
+    image.resize(toInt(imageSize.x) * toInt(imageSize.y));
+    _simulationCudaFacade->drawVectorGraphicsToHost(
+        {rectUpperLeft.x, rectUpperLeft.y}, {rectLowerRight.x, rectLowerRight.y}, {imageSize.x, imageSize.y}, zoom, image.data());
+}
+
 bool EngineWorker::isSyncSimulationWithRendering() const
 {
     return _syncSimulationWithRendering;
@@ -190,6 +211,19 @@ DataDescription EngineWorker::getInspectedSimulationData(std::vector<uint64_t> o
     return result;
 }
 
+ColumnarData EngineWorker::getColumnarSimulationData(IntVector2D const& rectUpperLeft, IntVector2D const& rectLowerRight)
+{
+    EngineWorkerGuard access(this);
+
+    DataTO dataTO = provideTO();
+
+    _simulationCudaFacade->getSimulationData({rectUpperLeft.x, rectUpperLeft.y}, int2{rectLowerRight.x, rectLowerRight.y}, dataTO);
+
+    DescriptionConverter converter(_settings.simulationParameters);
+
+    return converter.convertTOtoColumnarData(dataTO);
+}
+
 RawStatisticsData EngineWorker::getRawStatistics() const
 {
     return _simulationCudaFacade->getRawStatistics();
@@ -251,6 +285,20 @@ void EngineWorker::setSimulationData(DataDescription const& dataToUpdate)
     _simulationCudaFacade->setSimulationData(dataTO);
 }
 
+void EngineWorker::setColumnarSimulationData(ColumnarData const& dataToUpdate)
+{
+    DescriptionConverter converter(_settings.simulationParameters);
+
+    EngineWorkerGuard access(this);
+
+    _simulationCudaFacade->resizeArraysIfNecessary(converter.getArraySizes(dataToUpdate));
+
+    DataTO dataTO = provideTO();
+    converter.convertColumnarDataToTO(dataTO, dataToUpdate);
+
+    _simulationCudaFacade->setSimulationData(dataTO);
+}
+
 void EngineWorker::removeSelectedObjects(bool includeClusters)
 {
     EngineWorkerGuard access(this);
@@ -339,9 +387,18 @@ void EngineWorker::endShutdown()
 {
     _isSimulationRunning = false;
     _isShutdown = false;
+    _simulationCudaFacade->waitForTransfersToHost();
+    _dataTOCache.reset();  //page-locked memory has to be freed before the device is reset
+    _overlayDataTOCache.reset();
+    _simulationCudaFacade->setDeviceResetOnDestruction(_deviceResetOnClose);
     _simulationCudaFacade.reset();
 }
 
+void EngineWorker::setDeviceResetOnClose(bool value)
+{
+    _deviceResetOnClose = value;
+}
+
 int EngineWorker::getTpsRestriction() const
 {
     auto result = _tpsRestriction.load();
@@ -358,6 +415,21 @@ float EngineWorker::getTps() const
     return _tps.load();
 }
 
+bool EngineWorker::isProfilingEnabled() const
+{
+    return _simulationCudaFacade->isProfilingEnabled();
+}
+
+void EngineWorker::setProfilingEnabled(bool value)
+{
+    _simulationCudaFacade->setProfilingEnabled(value);
+}
+
+std::vector<TimestepProfile> EngineWorker::getTimestepProfiles() const
+{
+    return _simulationCudaFacade->getTimestepProfiles();
+}
+
 uint64_t EngineWorker::getCurrentTimestep() const
 {
     return _simulationCudaFacade->getCurrentTimestep();
@@ -21,6 +21,7 @@
 #include "EngineInterface/ShallowUpdateSelectionData.h"
 #include "EngineInterface/MutationType.h"
 #include "EngineInterface/StatisticsHistory.h"
+#include "EngineInterface/TimestepProfile.h"
 
 #include "EngineGpuKernels/Definitions.h"
 
@@ -47,6 +48,12 @@ public:
     void tryDrawVectorGraphics(RealVector2D const& rectUpperLeft, RealVector2D const& rectLowerRight, IntVector2D const& imageSize, double zoom);
     std::optional<OverlayDescription>
     tryDrawVectorGraphicsAndReturnOverlay(RealVector2D const& rectUpperLeft, RealVector2D const& rectLowerRight, IntVector2D const& imageSize, double zoom);
+    void drawVectorGraphicsToHost(
+        RealVector2D const& rectUpperLeft,
+        RealVector2D const& rectLowerRight,
+        IntVector2D const& imageSize,
+        double zoom,
+        std::vector<uint64_t>& image);
 
     bool isSyncSimulationWithRendering() const;
     void setSyncSimulationWithRendering(bool value);
@@ -58,6 +65,7 @@ public:
     ClusteredDataDescription getSelectedClusteredSimulationData(bool includeClusters);
     DataDescription getSelectedSimulationData(bool includeClusters);
     DataDescription getInspectedSimulationData(std::vector<uint64_t> objectsIds);
+    ColumnarData getColumnarSimulationData(IntVector2D const& rectUpperLeft, IntVector2D const& rectLowerRight);
     RawStatisticsData getRawStatistics() const;
     StatisticsHistory const& getStatisticsHistory() const;
     void setStatisticsHistory(StatisticsHistoryData const& data);
@@ -65,6 +73,7 @@ public:
     void addAndSelectSimulationData(DataDescription const& dataToUpdate);
     void setClusteredSimulationData(ClusteredDataDescription const& dataToUpdate);
     void setSimulationData(DataDescription const& dataToUpdate);
+    void setColumnarSimulationData(ColumnarData const& dataToUpdate);
     void removeSelectedObjects(bool includeClusters);
     void relaxSelectedObjects(bool includeClusters);
     void uniformVelocitiesForSelectedObjects(bool includeClusters);
@@ -79,11 +88,15 @@ public:
 
     void beginShutdown(); //caller should wait for termination of thread
     void endShutdown();
+    void setDeviceResetOnClose(bool value);
 
     int getTpsRestriction() const;
     void setTpsRestriction(int value);
 
     float getTps() const;
+    bool isProfilingEnabled() const;
+    void setProfilingEnabled(bool value);
+    std::vector<TimestepProfile> getTimestepProfiles() const;
     uint64_t getCurrentTimestep() const;
     void setCurrentTimestep(uint64_t value);
 
@@ -134,6 +147,7 @@ private:
     std::atomic<int> _accessState{0};  //0 = worker thread has access, 1 = require access from other thread, 2 = access granted to other thread
     std::atomic<bool> _isSimulationRunning{false};
     std::atomic<bool> _isShutdown{false};
+    bool _deviceResetOnClose = true;
     ExceptionData _exceptionData;
 
     //async jobs
@@ -161,6 +175,7 @@ private:
     //internals
     void* _cudaResource;
     AccessDataTOCache _dataTOCache;
+    AccessDataTOCache _overlayDataTOCache;  //double-buffered: the previous overlay is converted while the next one is transferred
 };
 
 class EngineWorkerGuard
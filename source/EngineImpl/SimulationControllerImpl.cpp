@@ -1,5 +1,6 @@
 #include "SimulationControllerImpl.h"
 
+#include "EngineInterface/ColumnarData.h"
 #include "EngineInterface/Descriptions.h"
 
 void _SimulationControllerImpl::newSimulation(uint64_t timestep, GeneralSettings const& generalSettings, SimulationParameters const& parameters)
@@ -12,6 +13,7 @@ void _SimulationControllerImpl::newSimulation(uint64_t timestep, GeneralSettings
     _thread = new std::thread(&EngineWorker::runThreadLoop, &_worker);
 
     _selectionNeedsUpdate = true;
+    ++_simulationId;
 }
 
 void _SimulationControllerImpl::clear()
@@ -21,6 +23,11 @@ void _SimulationControllerImpl::clear()
     _selectionNeedsUpdate = true;
 }
 
+uint64_t _SimulationControllerImpl::getSimulationId() const
+{
+    return _simulationId.load();
+}
+
 void _SimulationControllerImpl::setImageResource(void* image)
 {
     _worker.setImageResource(image);
@@ -49,6 +56,16 @@ std::optional<OverlayDescription> _SimulationControllerImpl::tryDrawVectorGraphi
     return _worker.tryDrawVectorGraphicsAndReturnOverlay(rectUpperLeft, rectLowerRight, imageSize, zoom);
 }
 
+void _SimulationControllerImpl::drawVectorGraphicsToHost(
+    RealVector2D const& rectUpperLeft,
+    RealVector2D const& rectLowerRight,
+    IntVector2D const& imageSize,
+    double zoom,
+    std::vector<uint64_t>& image)
+{
+    _worker.drawVectorGraphicsToHost(rectUpperLeft, rectLowerRight, imageSize, zoom, image);
+}
+
 bool _SimulationControllerImpl::isSyncSimulationWithRendering() const
 {
     return _worker.isSyncSimulationWithRendering();
@@ -98,6 +115,18 @@ DataDescription _SimulationControllerImpl::getInspectedSimulationData(std::vecto
     return _worker.getInspectedSimulationData(objectIds);
 }
 
+ColumnarData _SimulationControllerImpl::getColumnarSimulationData()
+{
+    auto size = getWorldSize();
+    return _worker.getColumnarSimulationData({-10, -10}, {size.x + 10, size.y + 10});
+}
+
+void _SimulationControllerImpl::setColumnarSimulationData(ColumnarData const& data)
+{
+    _worker.setColumnarSimulationData(data);
+    _selectionNeedsUpdate = true;
+}
+
 void _SimulationControllerImpl::addAndSelectSimulationData(DataDescription const& dataToAdd)
 {
     _worker.addAndSelectSimulationData(dataToAdd);
@@ -207,6 +236,11 @@ void _SimulationControllerImpl::closeSimulation()
     _selectionNeedsUpdate = true;
 }
 
+void _SimulationControllerImpl::setDeviceResetOnClose(bool value)
+{
+    _worker.setDeviceResetOnClose(value);
+}
+
 uint64_t _SimulationControllerImpl::getCurrentTimestep() const
 {
     return _worker.getCurrentTimestep();
@@ -343,6 +377,21 @@ float _SimulationControllerImpl::getTps() const
     return _worker.getTps();
 }
 
+bool _SimulationControllerImpl::isProfilingEnabled() const
+{
+    return _worker.isProfilingEnabled();
+}
+
+void _SimulationControllerImpl::setProfilingEnabled(bool value)
+{
+    _worker.setProfilingEnabled(value);
+}
+
+std::vector<TimestepProfile> _SimulationControllerImpl::getTimestepProfiles() const
+{
+    return _worker.getTimestepProfiles();
+}
+
 void _SimulationControllerImpl::testOnly_mutate(uint64_t cellId, MutationType mutationType)
 {
     _worker.testOnly_mutate(cellId, mutationType);
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <thread>
 
 #include "EngineInterface/Definitions.h"
@@ -17,6 +18,7 @@ class _SimulationControllerImpl : public _SimulationController
 public:
     void newSimulation(uint64_t timestep, GeneralSettings const& generalSettings, SimulationParameters const& parameters) override;
     void clear() override;
+    uint64_t getSimulationId() const override;
 
     void setImageResource(void* image) override;
     std::string getGpuName() const override;
@@ -36,6 +38,12 @@ public:
         RealVector2D const& rectLowerRight,
         IntVector2D const& imageSize,
         double zoom) override;
+    void drawVectorGraphicsToHost(
+        RealVector2D const& rectUpperLeft,
+        RealVector2D const& rectLowerRight,
+        IntVector2D const& imageSize,
+        double zoom,
+        std::vector<uint64_t>& image) override;
 
     bool isSyncSimulationWithRendering() const override;
     void setSyncSimulationWithRendering(bool value) override;
@@ -48,6 +56,9 @@ public:
     DataDescription getSelectedSimulationData(bool includeClusters) override;
     DataDescription getInspectedSimulationData(std::vector<uint64_t> objectIds) override;
 
+    ColumnarData getColumnarSimulationData() override;
+    void setColumnarSimulationData(ColumnarData const& data) override;
+
     void addAndSelectSimulationData(DataDescription const& dataToAdd) override;
     void setClusteredSimulationData(ClusteredDataDescription const& dataToUpdate) override;
     void setSimulationData(DataDescription const& dataToUpdate) override;
@@ -71,6 +82,7 @@ public:
     bool isSimulationRunning() const override;
 
     void closeSimulation() override;
+    void setDeviceResetOnClose(bool value) override;
 
     uint64_t getCurrentTimestep() const override;
     void setCurrentTimestep(uint64_t value) override;
@@ -105,11 +117,16 @@ public:
 
     float getTps() const override;
 
+    bool isProfilingEnabled() const override;
+    void setProfilingEnabled(bool value) override;
+    std::vector<TimestepProfile> getTimestepProfiles() const override;
+
     //for tests
     void testOnly_mutate(uint64_t cellId, MutationType mutationType) override;
 
 private:
     bool _selectionNeedsUpdate = false;
+    std::atomic<uint64_t> _simulationId = 0;
 
     Settings _origSettings;
     GeneralSettings _generalSettings;
@@ -1,924 +1,581 @@
 #include "AuxiliaryDataParserService.h"
 
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <span>
+#include <sstream>
+#include <unordered_map>
+
+#include <boost/property_tree/json_parser.hpp>
+
+#include "Base/JsonReader.h"
+
 #include "GeneralSettings.h"
 #include "Settings.h"
+#include "SimulationParametersFields.h"
 
 namespace
 {
-    template <typename T>
-    void encodeDecodeProperty(boost::property_tree::ptree& tree, T& parameter, T const& defaultValue, std::string const& node, ParserTask task)
+    auto constexpr GeneralNode = "general";
+    auto constexpr SimulationParametersNode = "simulation parameters";
+    auto constexpr ParticleSourcesNode = "particle sources";
+    auto constexpr SpotsNode = "spots";
+
+    uint32_t constexpr BinaryFormatId = 0x31505341;  //"ASP1"
+    auto constexpr DefaultZoom = 4.0f;
+
+    using FlatValues = std::unordered_map<std::string, std::string>;  //node path -> value
+
+    template <typename Object>
+    std::span<ParameterField<Object> const> getFields();
+
+    template <>
+    std::span<ParameterField<AuxiliaryData> const> getFields()
     {
-        JsonParser::encodeDecode(tree, parameter, defaultValue, node, task);
+        return AuxiliaryDataFields;
     }
 
     template <>
-    void encodeDecodeProperty(
-        boost::property_tree::ptree& tree,
-        ColorVector<float>& parameter,
-        ColorVector<float> const& defaultValue,
-        std::string const& node,
-        ParserTask task)
+    std::span<ParameterField<SimulationParameters> const> getFields()
     {
-        for (int i = 0; i < MAX_COLORS; ++i) {
-            encodeDecodeProperty(tree, parameter[i], defaultValue[i], node + "[" + std::to_string(i) + "]", task);
-        }
+        return SimulationParametersFields;
     }
 
     template <>
-    void encodeDecodeProperty(
-        boost::property_tree::ptree& tree,
-        ColorVector<int>& parameter,
-        ColorVector<int> const& defaultValue,
-        std::string const& node,
-        ParserTask task)
+    std::span<ParameterField<RadiationSource> const> getFields()
     {
-        for (int i = 0; i < MAX_COLORS; ++i) {
-            encodeDecodeProperty(tree, parameter[i], defaultValue[i], node + "[" + std::to_string(i) + "]", task);
-        }
+        return RadiationSourceFields;
     }
 
     template <>
-    void encodeDecodeProperty<ColorMatrix<float>>(
-        boost::property_tree::ptree& tree,
-        ColorMatrix<float>& parameter,
-        ColorMatrix<float> const& defaultValue,
-        std::string const& node,
-        ParserTask task)
+    std::span<ParameterField<SimulationParametersSpot> const> getFields()
     {
-        for (int i = 0; i < MAX_COLORS; ++i) {
-            for (int j = 0; j < MAX_COLORS; ++j) {
-                encodeDecodeProperty(tree, parameter[i][j], defaultValue[i][j], node + "[" + std::to_string(i) + ", " + std::to_string(j) + "]", task);
+        return SimulationParametersSpotFields;
+    }
+
+    //relative node paths of all elements of each field, e.g. "cell.normal energy[3]"
+    template <typename Object>
+    std::vector<std::vector<std::string>> const& getElementNodes()
+    {
+        static auto const result = [] {
+            std::vector<std::vector<std::string>> result;
+            for (auto const& field : getFields<Object>()) {
+                auto& elementNodes = result.emplace_back();
+                auto numElements = getNumParameterFieldElements(field.type);
+                if (numElements == 1) {
+                    elementNodes.emplace_back(field.name);
+                } else if (numElements == MAX_COLORS) {
+                    for (int i = 0; i < MAX_COLORS; ++i) {
+                        elementNodes.emplace_back(std::string(field.name) + "[" + std::to_string(i) + "]");
+                    }
+                } else {
+                    for (int i = 0; i < MAX_COLORS; ++i) {
+                        for (int j = 0; j < MAX_COLORS; ++j) {
+                            elementNodes.emplace_back(std::string(field.name) + "[" + std::to_string(i) + ", " + std::to_string(j) + "]");
+                        }
+                    }
+                }
             }
+            return result;
+        }();
+        return result;
+    }
+
+    template <typename Object>
+    bool isRelevant(ParameterField<Object> const& field, Object const& object)
+    {
+        return !field.isRelevant || field.isRelevant(object);
+    }
+
+    void appendValue(std::string& output, ParameterFieldType type, void const* value, int elementIndex)
+    {
+        char buffer[64];
+        switch (type) {
+        case ParameterFieldType::Bool:
+        case ParameterFieldType::ColorMatrixBool: {
+            output += static_cast<bool const*>(value)[elementIndex] ? "true" : "false";
+        } break;
+        case ParameterFieldType::Int:
+        case ParameterFieldType::ColorVectorInt:
+        case ParameterFieldType::ColorMatrixInt: {
+            output.append(buffer, std::to_chars(buffer, buffer + sizeof(buffer), static_cast<int const*>(value)[elementIndex]).ptr);
+        } break;
+        case ParameterFieldType::UInt32: {
+            output.append(buffer, std::to_chars(buffer, buffer + sizeof(buffer), *static_cast<uint32_t const*>(value)).ptr);
+        } break;
+        case ParameterFieldType::UInt64: {
+            output.append(buffer, std::to_chars(buffer, buffer + sizeof(buffer), *static_cast<uint64_t const*>(value)).ptr);
+        } break;
+        case ParameterFieldType::Float:
+        case ParameterFieldType::ColorVectorFloat:
+        case ParameterFieldType::ColorMatrixFloat: {
+            //same representation as before (fixed notation with 8 digits)
+            auto length = std::snprintf(buffer, sizeof(buffer), "%.8f", static_cast<float const*>(value)[elementIndex]);
+            if (length > 0 && length < static_cast<int>(sizeof(buffer))) {
+                output.append(buffer, length);
+            } else {
+                output += std::to_string(static_cast<float const*>(value)[elementIndex]);
+            }
+        } break;
         }
     }
 
-    template <>
-    void encodeDecodeProperty<ColorMatrix<int>>(
-        boost::property_tree::ptree& tree,
-        ColorMatrix<int>& parameter,
-        ColorMatrix<int> const& defaultValue,
-        std::string const& node,
-        ParserTask task)
+    template <typename T>
+    void parseNumber(std::string_view text, T& value)
     {
-        for (int i = 0; i < MAX_COLORS; ++i) {
-            for (int j = 0; j < MAX_COLORS; ++j) {
-                encodeDecodeProperty(tree, parameter[i][j], defaultValue[i][j], node + "[" + std::to_string(i) + ", " + std::to_string(j) + "]", task);
+        T result;
+        auto [ptr, errorCode] = std::from_chars(text.data(), text.data() + text.size(), result);
+        if (errorCode == std::errc() && ptr == text.data() + text.size()) {
+            value = result;
+        }
+    }
+
+    //the value remains unchanged if the text cannot be parsed
+    void parseValue(std::string_view text, ParameterFieldType type, void* value, int elementIndex)
+    {
+        switch (type) {
+        case ParameterFieldType::Bool:
+        case ParameterFieldType::ColorMatrixBool: {
+            if (text == "true" || text == "1") {
+                static_cast<bool*>(value)[elementIndex] = true;
+            } else if (text == "false" || text == "0") {
+                static_cast<bool*>(value)[elementIndex] = false;
             }
+        } break;
+        case ParameterFieldType::Int:
+        case ParameterFieldType::ColorVectorInt:
+        case ParameterFieldType::ColorMatrixInt: {
+            parseNumber(text, static_cast<int*>(value)[elementIndex]);
+        } break;
+        case ParameterFieldType::UInt32: {
+            parseNumber(text, *static_cast<uint32_t*>(value));
+        } break;
+        case ParameterFieldType::UInt64: {
+            parseNumber(text, *static_cast<uint64_t*>(value));
+        } break;
+        case ParameterFieldType::Float:
+        case ParameterFieldType::ColorVectorFloat:
+        case ParameterFieldType::ColorMatrixFloat: {
+            parseNumber(text, static_cast<float*>(value)[elementIndex]);
+        } break;
         }
     }
 
-    template <>
-    void encodeDecodeProperty<ColorMatrix<bool>>(
-        boost::property_tree::ptree& tree,
-        ColorMatrix<bool>& parameter,
-        ColorMatrix<bool> const& defaultValue,
-        std::string const& node,
-        ParserTask task)
+    /**
+     * JSON writer
+     * The fields are arranged in a tree of nodes once such that values sharing a node path prefix are grouped
+     * as in boost::property_tree, but without any string operations on encoding.
+     */
+    struct JsonNode
+    {
+        std::string key;
+        std::vector<JsonNode> children;
+        int fieldIndex = -1;  //for leaves
+        int elementIndex = 0;
+    };
+
+    template <typename Object>
+    JsonNode const& getJsonLayout()
     {
-        for (int i = 0; i < MAX_COLORS; ++i) {
-            for (int j = 0; j < MAX_COLORS; ++j) {
-                encodeDecodeProperty(tree, parameter[i][j], defaultValue[i][j], node + "[" + std::to_string(i) + ", " + std::to_string(j) + "]", task);
+        static auto const result = [] {
+            JsonNode result;
+            auto const& elementNodes = getElementNodes<Object>();
+            for (int fieldIndex = 0; fieldIndex < static_cast<int>(elementNodes.size()); ++fieldIndex) {
+                for (int elementIndex = 0; elementIndex < static_cast<int>(elementNodes[fieldIndex].size()); ++elementIndex) {
+                    std::string_view path = elementNodes[fieldIndex][elementIndex];
+                    auto node = &result;
+                    while (true) {
+                        auto separatorPos = path.find('.');
+                        auto key = path.substr(0, separatorPos);
+                        auto findResult = std::find_if(node->children.begin(), node->children.end(), [&](auto const& child) { return child.key == key; });
+                        if (findResult == node->children.end()) {
+                            node = &node->children.emplace_back(JsonNode{.key = std::string(key)});
+                        } else {
+                            node = &*findResult;
+                        }
+                        if (separatorPos == std::string_view::npos) {
+                            break;
+                        }
+                        path.remove_prefix(separatorPos + 1);
+                    }
+                    node->fieldIndex = fieldIndex;
+                    node->elementIndex = elementIndex;
+                }
+            }
+            return result;
+        }();
+        return result;
+    }
+
+    void appendIndentation(std::string& output, int depth)
+    {
+        output.append(depth * 4, ' ');
+    }
+
+    void appendKey(std::string& output, std::string_view key, int depth)
+    {
+        appendIndentation(output, depth);
+        output += '"';
+        output += key;
+        output += "\": ";
+    }
+
+    template <typename Object>
+    bool appendJsonObject(std::string& output, JsonNode const& node, Object& object, int depth);
+
+    template <typename Object>
+    void appendJsonArray(std::string& output, Object* elements, int numElements, int depth, bool& empty)
+    {
+        for (int i = 0; i < numElements; ++i) {
+            auto startSize = output.size();
+            if (!empty) {
+                output += ",\n";
+            }
+            appendKey(output, std::to_string(i), depth);
+            if (appendJsonObject(output, getJsonLayout<Object>(), elements[i], depth)) {
+                empty = false;
+            } else {
+                output.resize(startSize);
             }
         }
     }
 
-    template <typename T>
-    void encodeDecodeSpotProperty(
-        boost::property_tree::ptree& tree,
-        T& parameter,
-        bool& isActivated,
-        T const& defaultValue,
-        std::string const& node,
-        ParserTask task)
+    //appends {...} with all relevant fields below node, returns false (and appends nothing) if there are none
+    template <typename Object>
+    bool appendJsonObject(std::string& output, JsonNode const& node, Object& object, int depth)
     {
-        encodeDecodeProperty(tree, isActivated, false, node + ".activated", task);
-        encodeDecodeProperty(tree, parameter, defaultValue, node + ".value", task);
+        auto const fields = getFields<Object>();
+        auto objectStartSize = output.size();
+        output += "{\n";
+        auto empty = true;
+        for (auto const& child : node.children) {
+            auto startSize = output.size();
+            if (!empty) {
+                output += ",\n";
+            }
+            appendKey(output, child.key, depth + 1);
+            if (child.children.empty()) {
+                auto const& field = fields[child.fieldIndex];
+                if (!isRelevant(field, object)) {
+                    output.resize(startSize);
+                    continue;
+                }
+                output += '"';
+                appendValue(output, field.type, field.getValueRef(object), child.elementIndex);
+                output += '"';
+            } else if (!appendJsonObject(output, child, object, depth + 1)) {
+                output.resize(startSize);
+                continue;
+            }
+            empty = false;
+        }
+
+        //particle sources and spots are stored under their index
+        if constexpr (std::is_same_v<Object, SimulationParameters>) {
+            auto const& topLevelNodes = getJsonLayout<SimulationParameters>().children;
+            if (!topLevelNodes.empty() && &node >= &topLevelNodes.front() && &node <= &topLevelNodes.back()) {
+                if (node.key == ParticleSourcesNode) {
+                    appendJsonArray(output, object.particleSources, std::min(object.numParticleSources, MAX_PARTICLE_SOURCES), depth + 1, empty);
+                }
+                if (node.key == SpotsNode) {
+                    appendJsonArray(output, object.spots, std::min(object.numSpots, MAX_SPOTS), depth + 1, empty);
+                }
+            }
+        }
+
+        if (empty) {
+            output.resize(objectStartSize);
+            return false;
+        }
+        output += '\n';
+        appendIndentation(output, depth);
+        output += '}';
+        return true;
     }
 
-    template <>
-    void encodeDecodeSpotProperty(
-        boost::property_tree::ptree& tree,
-        ColorVector<float>& parameter,
-        bool& isActivated,
-        ColorVector<float> const& defaultValue,
-        std::string const& node,
-        ParserTask task)
+    template <typename Object>
+    void appendJsonMember(std::string& output, std::string_view key, Object& object, bool& empty)
     {
-        encodeDecodeProperty(tree, isActivated, false, node + ".activated", task);
-        encodeDecodeProperty(tree, parameter, defaultValue, node, task);
+        auto startSize = output.size();
+        if (!empty) {
+            output += ",\n";
+        }
+        appendKey(output, key, 1);
+        if (appendJsonObject(output, getJsonLayout<Object>(), object, 1)) {
+            empty = false;
+        } else {
+            output.resize(startSize);
+        }
     }
 
-    template <>
-    void encodeDecodeSpotProperty(
-        boost::property_tree::ptree& tree,
-        ColorVector<int>& parameter,
-        bool& isActivated,
-        ColorVector<int> const& defaultValue,
-        std::string const& node,
-        ParserTask task)
+    std::string encodeJson(AuxiliaryData* data, SimulationParameters& parameters)
     {
-        encodeDecodeProperty(tree, isActivated, false, node + ".activated", task);
-        encodeDecodeProperty(tree, parameter, defaultValue, node, task);
+        std::string result;
+        result.reserve(64 * 1024);
+        result += "{\n";
+        auto empty = true;
+        if (data) {
+            appendJsonMember(result, GeneralNode, *data, empty);
+        }
+        appendJsonMember(result, SimulationParametersNode, parameters, empty);
+        result += "\n}\n";
+        return result;
     }
 
-    void encodeDecode(boost::property_tree::ptree& tree, SimulationParameters& parameters, ParserTask parserTask)
+    /**
+     * JSON reader
+     */
+    void readFlatValues(JsonReader& reader, std::string& path, FlatValues& values)
     {
-        //simulation parameters
-        SimulationParameters defaultParameters;
-        encodeDecodeProperty(tree, parameters.backgroundColor, defaultParameters.backgroundColor, "simulation parameters.background color", parserTask);
-        encodeDecodeProperty(tree, parameters.cellColorization, defaultParameters.cellColorization, "simulation parameters.cell colorization", parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.zoomLevelNeuronalActivity,
-            defaultParameters.zoomLevelNeuronalActivity,
-            "simulation parameters.zoom level.neural activity",
-            parserTask);
-        encodeDecodeProperty(tree, parameters.showDetonations, defaultParameters.showDetonations, "simulation parameters.show detonations", parserTask);
-        encodeDecodeProperty(tree, parameters.timestepSize, defaultParameters.timestepSize, "simulation parameters.time step size", parserTask);
-
-        encodeDecodeProperty(tree, parameters.motionType, defaultParameters.motionType, "simulation parameters.motion.type", parserTask);
-        if (parameters.motionType == MotionType_Fluid) {
-            encodeDecodeProperty(
-                tree,
-                parameters.motionData.fluidMotion.smoothingLength,
-                defaultParameters.motionData.fluidMotion.smoothingLength,
-                "simulation parameters.fluid.smoothing length",
-                parserTask);
-            encodeDecodeProperty(
-                tree,
-                parameters.motionData.fluidMotion.pressureStrength,
-                defaultParameters.motionData.fluidMotion.pressureStrength,
-                "simulation parameters.fluid.pressure strength",
-                parserTask);
-            encodeDecodeProperty(
-                tree,
-                parameters.motionData.fluidMotion.viscosityStrength,
-                defaultParameters.motionData.fluidMotion.viscosityStrength,
-                "simulation parameters.fluid.viscosity strength",
-                parserTask);
+        if (reader.isObject()) {
+            auto pathSize = path.size();
+            std::string key;
+            reader.beginObject();
+            while (reader.nextMember(key)) {
+                path.resize(pathSize);
+                if (pathSize > 0) {
+                    path += '.';
+                }
+                path += key;
+                readFlatValues(reader, path, values);
+            }
+            path.resize(pathSize);
+        } else if (reader.isArray()) {
+            reader.skipValue();
         } else {
-            encodeDecodeProperty(
-                tree,
-                parameters.motionData.collisionMotion.cellMaxCollisionDistance,
-                defaultParameters.motionData.collisionMotion.cellMaxCollisionDistance,
-                "simulation parameters.motion.collision.max distance",
-                parserTask);
-            encodeDecodeProperty(
-                tree,
-                parameters.motionData.collisionMotion.cellRepulsionStrength,
-                defaultParameters.motionData.collisionMotion.cellRepulsionStrength,
-                "simulation parameters.motion.collision.repulsion strength",
-                parserTask);
+            values.emplace(path, reader.readScalar());
         }
+    }
 
-        encodeDecodeProperty(tree, parameters.baseValues.friction, defaultParameters.baseValues.friction, "simulation parameters.friction", parserTask);
-        encodeDecodeProperty(tree, parameters.baseValues.rigidity, defaultParameters.baseValues.rigidity, "simulation parameters.rigidity", parserTask);
-        encodeDecodeProperty(tree, parameters.cellMaxVelocity, defaultParameters.cellMaxVelocity, "simulation parameters.cell.max velocity", parserTask);
-        encodeDecodeProperty(
-            tree, parameters.cellMaxBindingDistance, defaultParameters.cellMaxBindingDistance, "simulation parameters.cell.max binding distance", parserTask);
-        encodeDecodeProperty(tree, parameters.cellNormalEnergy, defaultParameters.cellNormalEnergy, "simulation parameters.cell.normal energy", parserTask);
-
-        encodeDecodeProperty(tree, parameters.cellMinDistance, defaultParameters.cellMinDistance, "simulation parameters.cell.min distance", parserTask);
-        encodeDecodeProperty(
-            tree, parameters.baseValues.cellMaxForce, defaultParameters.baseValues.cellMaxForce, "simulation parameters.cell.max force", parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.cellMaxForceDecayProb,
-            defaultParameters.cellMaxForceDecayProb,
-            "simulation parameters.cell.max force decay probability",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.cellNumExecutionOrderNumbers,
-            defaultParameters.cellNumExecutionOrderNumbers,
-            "simulation parameters.cell.max execution order number",
-            parserTask);
-        encodeDecodeProperty(
-            tree, parameters.baseValues.cellMinEnergy, defaultParameters.baseValues.cellMinEnergy, "simulation parameters.cell.min energy", parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.baseValues.cellFusionVelocity,
-            defaultParameters.baseValues.cellFusionVelocity,
-            "simulation parameters.cell.fusion velocity",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.baseValues.cellMaxBindingEnergy,
-            parameters.baseValues.cellMaxBindingEnergy,
-            "simulation parameters.cell.max binding energy",
-            parserTask);
-        encodeDecodeProperty(tree, parameters.cellMaxAge, defaultParameters.cellMaxAge, "simulation parameters.cell.max age", parserTask);
-        encodeDecodeProperty(
-            tree, parameters.cellMaxAgeBalancer, defaultParameters.cellMaxAgeBalancer, "simulation parameters.cell.max age.balance.enabled", parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.cellMaxAgeBalancerInterval,
-            defaultParameters.cellMaxAgeBalancerInterval,
-            "simulation parameters.cell.max age.balance.interval",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.baseValues.cellColorTransitionDuration,
-            defaultParameters.baseValues.cellColorTransitionDuration,
-            "simulation parameters.cell.color transition rules.duration",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.baseValues.cellColorTransitionTargetColor,
-            defaultParameters.baseValues.cellColorTransitionTargetColor,
-            "simulation parameters.cell.color transition rules.target color",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.baseValues.radiationCellAgeStrength,
-            defaultParameters.baseValues.radiationCellAgeStrength,
-            "simulation parameters.radiation.factor",
-            parserTask);
-        encodeDecodeProperty(tree, parameters.radiationProb, defaultParameters.radiationProb, "simulation parameters.radiation.probability", parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.radiationVelocityMultiplier,
-            defaultParameters.radiationVelocityMultiplier,
-            "simulation parameters.radiation.velocity multiplier",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.radiationVelocityPerturbation,
-            defaultParameters.radiationVelocityPerturbation,
-            "simulation parameters.radiation.velocity perturbation",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.baseValues.radiationAbsorption,
-            defaultParameters.baseValues.radiationAbsorption,
-            "simulation parameters.radiation.absorption",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.radiationAbsorptionVelocityPenalty,
-            defaultParameters.radiationAbsorptionVelocityPenalty,
-            "simulation parameters.radiation.absorption velocity penalty",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.highRadiationMinCellEnergy,
-            defaultParameters.highRadiationMinCellEnergy,
-            "simulation parameters.high radiation.min cell energy",
-            parserTask);
-        encodeDecodeProperty(
-            tree, parameters.highRadiationFactor, defaultParameters.highRadiationFactor, "simulation parameters.high radiation.factor", parserTask);
-        encodeDecodeProperty(
-            tree, parameters.radiationMinCellAge, defaultParameters.radiationMinCellAge, "simulation parameters.radiation.min cell age", parserTask);
-
-        encodeDecodeProperty(tree, parameters.clusterDecay, defaultParameters.clusterDecay, "simulation parameters.cluster.decay", parserTask);
-        encodeDecodeProperty(
-            tree, parameters.clusterDecayProb, defaultParameters.clusterDecayProb, "simulation parameters.cluster.decay probability", parserTask);
-
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionConstructorPumpEnergyFactor,
-            defaultParameters.cellFunctionConstructorPumpEnergyFactor,
-            "simulation parameters.cell.function.constructor.pump energy factor",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionConstructorOffspringDistance,
-            defaultParameters.cellFunctionConstructorOffspringDistance,
-            "simulation parameters.cell.function.constructor.offspring distance",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionConstructorConnectingCellMaxDistance,
-            defaultParameters.cellFunctionConstructorConnectingCellMaxDistance,
-            "simulation parameters.cell.function.constructor.connecting cell max distance",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionConstructorActivityThreshold,
-            defaultParameters.cellFunctionConstructorActivityThreshold,
-            "simulation parameters.cell.function.constructor.activity threshold",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.baseValues.cellFunctionConstructorMutationNeuronDataProbability,
-            defaultParameters.baseValues.cellFunctionConstructorMutationNeuronDataProbability,
-            "simulation parameters.cell.function.constructor.mutation probability.neuron data",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.baseValues.cellFunctionConstructorMutationPropertiesProbability,
-            defaultParameters.baseValues.cellFunctionConstructorMutationPropertiesProbability,
-            "simulation parameters.cell.function.constructor.mutation probability.data",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.baseValues.cellFunctionConstructorMutationGeometryProbability,
-            defaultParameters.baseValues.cellFunctionConstructorMutationGeometryProbability,
-            "simulation parameters.cell.function.constructor.mutation probability.geometry",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.baseValues.cellFunctionConstructorMutationCustomGeometryProbability,
-            defaultParameters.baseValues.cellFunctionConstructorMutationCustomGeometryProbability,
-            "simulation parameters.cell.function.constructor.mutation probability.custom geometry",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.baseValues.cellFunctionConstructorMutationCellFunctionProbability,
-            defaultParameters.baseValues.cellFunctionConstructorMutationCellFunctionProbability,
-            "simulation parameters.cell.function.constructor.mutation probability.cell function",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.baseValues.cellFunctionConstructorMutationInsertionProbability,
-            defaultParameters.baseValues.cellFunctionConstructorMutationInsertionProbability,
-            "simulation parameters.cell.function.constructor.mutation probability.insertion",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.baseValues.cellFunctionConstructorMutationDeletionProbability,
-            defaultParameters.baseValues.cellFunctionConstructorMutationDeletionProbability,
-            "simulation parameters.cell.function.constructor.mutation probability.deletion",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.baseValues.cellFunctionConstructorMutationTranslationProbability,
-            defaultParameters.baseValues.cellFunctionConstructorMutationTranslationProbability,
-            "simulation parameters.cell.function.constructor.mutation probability.translation",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.baseValues.cellFunctionConstructorMutationDuplicationProbability,
-            defaultParameters.baseValues.cellFunctionConstructorMutationDuplicationProbability,
-            "simulation parameters.cell.function.constructor.mutation probability.duplication",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.baseValues.cellFunctionConstructorMutationColorProbability,
-            defaultParameters.baseValues.cellFunctionConstructorMutationColorProbability,
-            "simulation parameters.cell.function.constructor.mutation probability.color",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.baseValues.cellFunctionConstructorMutationUniformColorProbability,
-            defaultParameters.baseValues.cellFunctionConstructorMutationUniformColorProbability,
-            "simulation parameters.cell.function.constructor.mutation probability.uniform color",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionConstructorMutationColorTransitions,
-            defaultParameters.cellFunctionConstructorMutationColorTransitions,
-            "simulation parameters.cell.function.constructor.mutation color transition",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionConstructorMutationSelfReplication,
-            defaultParameters.cellFunctionConstructorMutationSelfReplication,
-            "simulation parameters.cell.function.constructor.mutation self replication",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionConstructorMutationPreventDepthIncrease,
-            defaultParameters.cellFunctionConstructorMutationPreventDepthIncrease,
-            "simulation parameters.cell.function.constructor.mutation prevent depth increase",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionConstructorCheckCompletenessForSelfReplication,
-            defaultParameters.cellFunctionConstructorCheckCompletenessForSelfReplication,
-            "simulation parameters.cell.function.constructor.completeness check for self-replication",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionConstructorExternalEnergy,
-            defaultParameters.cellFunctionConstructorExternalEnergy,
-            "simulation parameters.cell.function.constructor.external energy",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionConstructorExternalEnergySupplyRate,
-            defaultParameters.cellFunctionConstructorExternalEnergySupplyRate,
-            "simulation parameters.cell.function.constructor.external energy supply rate",
-            parserTask);
-
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionInjectorRadius,
-            defaultParameters.cellFunctionInjectorRadius,
-            "simulation parameters.cell.function.injector.radius",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionInjectorDurationColorMatrix,
-            defaultParameters.cellFunctionInjectorDurationColorMatrix,
-            "simulation parameters.cell.function.injector.duration",
-            parserTask);
-
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionAttackerRadius,
-            defaultParameters.cellFunctionAttackerRadius,
-            "simulation parameters.cell.function.attacker.radius",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionAttackerStrength,
-            defaultParameters.cellFunctionAttackerStrength,
-            "simulation parameters.cell.function.attacker.strength",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionAttackerEnergyDistributionRadius,
-            defaultParameters.cellFunctionAttackerEnergyDistributionRadius,
-            "simulation parameters.cell.function.attacker.energy distribution radius",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionAttackerEnergyDistributionValue,
-            defaultParameters.cellFunctionAttackerEnergyDistributionValue,
-            "simulation parameters.cell.function.attacker.energy distribution value",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionAttackerColorInhomogeneityFactor,
-            defaultParameters.cellFunctionAttackerColorInhomogeneityFactor,
-            "simulation parameters.cell.function.attacker.color inhomogeneity factor",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionAttackerActivityThreshold,
-            defaultParameters.cellFunctionAttackerActivityThreshold,
-            "simulation parameters.cell.function.attacker.activity threshold",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.baseValues.cellFunctionAttackerEnergyCost,
-            defaultParameters.baseValues.cellFunctionAttackerEnergyCost,
-            "simulation parameters.cell.function.attacker.energy cost",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.baseValues.cellFunctionAttackerGeometryDeviationExponent,
-            defaultParameters.baseValues.cellFunctionAttackerGeometryDeviationExponent,
-            "simulation parameters.cell.function.attacker.geometry deviation exponent",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.baseValues.cellFunctionAttackerFoodChainColorMatrix,
-            defaultParameters.baseValues.cellFunctionAttackerFoodChainColorMatrix,
-            "simulation parameters.cell.function.attacker.food chain color matrix",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.baseValues.cellFunctionAttackerConnectionsMismatchPenalty,
-            defaultParameters.baseValues.cellFunctionAttackerConnectionsMismatchPenalty,
-            "simulation parameters.cell.function.attacker.connections mismatch penalty",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionAttackerGenomeSizeBonus,
-            defaultParameters.cellFunctionAttackerGenomeSizeBonus,
-            "simulation parameters.cell.function.attacker.genome size bonus",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionAttackerSameMutantPenalty,
-            defaultParameters.cellFunctionAttackerSameMutantPenalty,
-            "simulation parameters.cell.function.attacker.same mutant penalty",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionAttackerSensorDetectionFactor,
-            defaultParameters.cellFunctionAttackerSensorDetectionFactor,
-            "simulation parameters.cell.function.attacker.sensor detection factor",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionAttackerDestroyCells,
-            defaultParameters.cellFunctionAttackerDestroyCells,
-            "simulation parameters.cell.function.attacker.destroy cells",
-            parserTask);
-
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionDefenderAgainstAttackerStrength,
-            defaultParameters.cellFunctionDefenderAgainstAttackerStrength,
-            "simulation parameters.cell.function.defender.against attacker strength",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionDefenderAgainstInjectorStrength,
-            defaultParameters.cellFunctionDefenderAgainstInjectorStrength,
-            "simulation parameters.cell.function.defender.against injector strength",
-            parserTask);
-
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionTransmitterEnergyDistributionSameCreature,
-            defaultParameters.cellFunctionTransmitterEnergyDistributionSameCreature,
-            "simulation parameters.cell.function.transmitter.energy distribution same creature",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionTransmitterEnergyDistributionRadius,
-            defaultParameters.cellFunctionTransmitterEnergyDistributionRadius,
-            "simulation parameters.cell.function.transmitter.energy distribution radius",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionTransmitterEnergyDistributionValue,
-            defaultParameters.cellFunctionTransmitterEnergyDistributionValue,
-            "simulation parameters.cell.function.transmitter.energy distribution value",
-            parserTask);
-
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionMuscleContractionExpansionDelta,
-            defaultParameters.cellFunctionMuscleContractionExpansionDelta,
-            "simulation parameters.cell.function.muscle.contraction expansion delta",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionMuscleMovementAcceleration,
-            defaultParameters.cellFunctionMuscleMovementAcceleration,
-            "simulation parameters.cell.function.muscle.movement acceleration",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionMuscleBendingAngle,
-            defaultParameters.cellFunctionMuscleBendingAngle,
-            "simulation parameters.cell.function.muscle.bending angle",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionMuscleBendingAcceleration,
-            defaultParameters.cellFunctionMuscleBendingAcceleration,
-            "simulation parameters.cell.function.muscle.bending acceleration",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionMuscleBendingAccelerationThreshold,
-            defaultParameters.cellFunctionMuscleBendingAccelerationThreshold,
-            "simulation parameters.cell.function.muscle.bending acceleration threshold",
-            parserTask);
-
-        encodeDecodeProperty(
-            tree,
-            parameters.particleTransformationAllowed,
-            defaultParameters.particleTransformationAllowed,
-            "simulation parameters.particle.transformation allowed",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.particleTransformationRandomCellFunction,
-            defaultParameters.particleTransformationRandomCellFunction,
-            "simulation parameters.particle.transformation.random cell function",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.particleTransformationMaxGenomeSize,
-            defaultParameters.particleTransformationMaxGenomeSize,
-            "simulation parameters.particle.transformation.max genome size",
-            parserTask);
-
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionSensorRange,
-            defaultParameters.cellFunctionSensorRange,
-            "simulation parameters.cell.function.sensor.range",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionSensorActivityThreshold,
-            defaultParameters.cellFunctionSensorActivityThreshold,
-            "simulation parameters.cell.function.sensor.activity threshold",
-            parserTask);
-
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionReconnectorRadius,
-            defaultParameters.cellFunctionReconnectorRadius,
-            "simulation parameters.cell.function.reconnector.radius",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionReconnectorActivityThreshold,
-            defaultParameters.cellFunctionReconnectorActivityThreshold,
-            "simulation parameters.cell.function.reconnector.activity threshold",
-            parserTask);
-
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionDetonatorRadius,
-            defaultParameters.cellFunctionDetonatorRadius,
-            "simulation parameters.cell.function.detonator.radius",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionDetonatorChainExplosionProbability,
-            defaultParameters.cellFunctionDetonatorChainExplosionProbability,
-            "simulation parameters.cell.function.detonator.chain explosion probability",
-            parserTask);
-        encodeDecodeProperty(
-            tree,
-            parameters.cellFunctionDetonatorActivityThreshold,
-            defaultParameters.cellFunctionDetonatorActivityThreshold,
-            "simulation parameters.cell.function.detonator.activity threshold",
-            parserTask);
-
-        //particle sources
-        encodeDecodeProperty(
-            tree, parameters.numParticleSources, defaultParameters.numParticleSources, "simulation parameters.particle sources.num sources", parserTask);
-        for (int index = 0; index < parameters.numParticleSources; ++index) {
-            std::string base = "simulation parameters.particle sources." + std::to_string(index) + ".";
-            auto& source = parameters.particleSources[index];
-            auto& defaultSource = defaultParameters.particleSources[index];
-            encodeDecodeProperty(tree, source.posX, defaultSource.posX, base + "pos.x", parserTask);
-            encodeDecodeProperty(tree, source.posY, defaultSource.posY, base + "pos.y", parserTask);
-            encodeDecodeProperty(tree, source.velX, defaultSource.velX, base + "vel.x", parserTask);
-            encodeDecodeProperty(tree, source.velY, defaultSource.velY, base + "vel.y", parserTask);
-            encodeDecodeProperty(tree, source.useAngle, defaultSource.useAngle, base + "use angle", parserTask);
-            encodeDecodeProperty(tree, source.angle, defaultSource.angle, base + "angle", parserTask);
-            encodeDecodeProperty(tree, source.shapeType, defaultSource.shapeType, base + "shape.type", parserTask);
-            if (source.shapeType == SpotShapeType_Circular) {
-                encodeDecodeProperty(
-                    tree,
-                    source.shapeData.circularRadiationSource.radius,
-                    defaultSource.shapeData.circularRadiationSource.radius,
-                    base + "shape.circular.radius",
-                    parserTask);
+    FlatValues readFlatValues(std::string_view json)
+    {
+        FlatValues result;
+        JsonReader reader(json);
+        std::string path;
+        readFlatValues(reader, path, result);
+        return result;
+    }
+
+    void addFlatValues(boost::property_tree::ptree const& tree, std::string& path, FlatValues& values)
+    {
+        auto pathSize = path.size();
+        for (auto const& [key, child] : tree) {
+            path.resize(pathSize);
+            if (pathSize > 0) {
+                path += '.';
             }
-            if (source.shapeType == SpotShapeType_Rectangular) {
-                encodeDecodeProperty(
-                    tree,
-                    source.shapeData.rectangularRadiationSource.width,
-                    defaultSource.shapeData.rectangularRadiationSource.width,
-                    base + "shape.rectangular.width",
-                    parserTask);
-                encodeDecodeProperty(
-                    tree,
-                    source.shapeData.rectangularRadiationSource.height,
-                    defaultSource.shapeData.rectangularRadiationSource.height,
-                    base + "shape.rectangular.height",
-                    parserTask);
+            path += key;
+            if (child.empty()) {
+                values.emplace(path, child.data());
+            } else {
+                addFlatValues(child, path, values);
             }
         }
+        path.resize(pathSize);
+    }
 
-        //spots
-        encodeDecodeProperty(tree, parameters.numSpots, defaultParameters.numSpots, "simulation parameters.spots.num spots", parserTask);
-        for (int index = 0; index < parameters.numSpots; ++index) {
-            std::string base = "simulation parameters.spots." + std::to_string(index) + ".";
-            auto& spot = parameters.spots[index];
-            auto& defaultSpot = defaultParameters.spots[index];
-            encodeDecodeProperty(tree, spot.color, defaultSpot.color, base + "color", parserTask);
-            encodeDecodeProperty(tree, spot.posX, defaultSpot.posX, base + "pos.x", parserTask);
-            encodeDecodeProperty(tree, spot.posY, defaultSpot.posY, base + "pos.y", parserTask);
-            encodeDecodeProperty(tree, spot.velX, defaultSpot.velX, base + "vel.x", parserTask);
-            encodeDecodeProperty(tree, spot.velY, defaultSpot.velY, base + "vel.y", parserTask);
-
-            encodeDecodeProperty(tree, spot.shapeType, defaultSpot.shapeType, base + "shape.type", parserTask);
-            if (spot.shapeType == SpotShapeType_Circular) {
-                encodeDecodeProperty(
-                    tree,
-                    spot.shapeData.circularSpot.coreRadius,
-                    defaultSpot.shapeData.circularSpot.coreRadius,
-                    base + "shape.circular.core radius",
-                    parserTask);
+    //path contains the node of the object followed by '.'
+    template <typename Object>
+    void decodeFields(FlatValues const& values, std::string& path, Object& object)
+    {
+        auto const fields = getFields<Object>();
+        auto const& elementNodes = getElementNodes<Object>();
+        auto pathSize = path.size();
+        for (size_t fieldIndex = 0; fieldIndex < fields.size(); ++fieldIndex) {
+            auto const& field = fields[fieldIndex];
+            if (!isRelevant(field, object)) {
+                continue;
             }
-            if (spot.shapeType == SpotShapeType_Rectangular) {
-                encodeDecodeProperty(
-                    tree, spot.shapeData.rectangularSpot.width, defaultSpot.shapeData.rectangularSpot.width, base + "shape.rectangular.core width", parserTask);
-                encodeDecodeProperty(
-                    tree,
-                    spot.shapeData.rectangularSpot.height,
-                    defaultSpot.shapeData.rectangularSpot.height,
-                    base + "shape.rectangular.core height",
-                    parserTask);
+            for (size_t elementIndex = 0; elementIndex < elementNodes[fieldIndex].size(); ++elementIndex) {
+                path.resize(pathSize);
+                path += elementNodes[fieldIndex][elementIndex];
+                auto findResult = values.find(path);
+                if (findResult != values.end()) {
+                    parseValue(findResult->second, field.type, field.getValueRef(object), toInt(elementIndex));
+                }
             }
-            encodeDecodeProperty(tree, spot.flowType, defaultSpot.flowType, base + "flow.type", parserTask);
-            if (spot.flowType == FlowType_Radial) {
-                encodeDecodeProperty(
-                    tree, spot.flowData.radialFlow.orientation, defaultSpot.flowData.radialFlow.orientation, base + "flow.radial.orientation", parserTask);
-                encodeDecodeProperty(
-                    tree, spot.flowData.radialFlow.strength, defaultSpot.flowData.radialFlow.strength, base + "flow.radial.strength", parserTask);
-                encodeDecodeProperty(
-                    tree, spot.flowData.radialFlow.driftAngle, defaultSpot.flowData.radialFlow.driftAngle, base + "flow.radial.drift angle", parserTask);
+        }
+        path.resize(pathSize);
+    }
+
+    void decodeSimulationParametersFromValues(FlatValues const& values, SimulationParameters& parameters)
+    {
+        std::string path = std::string(SimulationParametersNode) + ".";
+        decodeFields(values, path, parameters);
+        parameters.numParticleSources = std::max(0, std::min(parameters.numParticleSources, MAX_PARTICLE_SOURCES));
+        for (int i = 0; i < parameters.numParticleSources; ++i) {
+            path = std::string(SimulationParametersNode) + "." + ParticleSourcesNode + "." + std::to_string(i) + ".";
+            decodeFields(values, path, parameters.particleSources[i]);
+        }
+        parameters.numSpots = std::max(0, std::min(parameters.numSpots, MAX_SPOTS));
+        for (int i = 0; i < parameters.numSpots; ++i) {
+            path = std::string(SimulationParametersNode) + "." + SpotsNode + "." + std::to_string(i) + ".";
+            decodeFields(values, path, parameters.spots[i]);
+        }
+    }
+
+    AuxiliaryData decodeAuxiliaryDataFromValues(FlatValues const& values)
+    {
+        AuxiliaryData result{};
+        result.zoom = DefaultZoom;
+        std::string path = std::string(GeneralNode) + ".";
+        decodeFields(values, path, result);
+        decodeSimulationParametersFromValues(values, result.simulationParameters);
+        return result;
+    }
+
+    /**
+     * Binary encoding: format id and layout hash followed by the raw values of all relevant fields in table order
+     */
+    template <typename Object>
+    void appendBinary(std::string& output, Object& object)
+    {
+        for (auto const& field : getFields<Object>()) {
+            if (isRelevant(field, object)) {
+                output.append(
+                    static_cast<char const*>(field.getValueRef(object)), getNumParameterFieldElements(field.type) * getParameterFieldElementSize(field.type));
+            }
+        }
+    }
+
+    template <typename Object>
+    bool readBinary(std::string_view& input, Object& object)
+    {
+        for (auto const& field : getFields<Object>()) {
+            if (!isRelevant(field, object)) {
+                continue;
             }
-            if (spot.flowType == FlowType_Central) {
-                encodeDecodeProperty(
-                    tree, spot.flowData.centralFlow.strength, defaultSpot.flowData.centralFlow.strength, base + "flow.central.strength", parserTask);
+            auto numElements = getNumParameterFieldElements(field.type);
+            auto size = static_cast<size_t>(numElements * getParameterFieldElementSize(field.type));
+            if (input.size() < size) {
+                return false;
             }
-            if (spot.flowType == FlowType_Linear) {
-                encodeDecodeProperty(tree, spot.flowData.linearFlow.angle, defaultSpot.flowData.linearFlow.angle, base + "flow.linear.angle", parserTask);
-                encodeDecodeProperty(
-                    tree, spot.flowData.linearFlow.strength, defaultSpot.flowData.linearFlow.strength, base + "flow.linear.strength", parserTask);
+            auto value = field.getValueRef(object);
+            if (field.type == ParameterFieldType::Bool || field.type == ParameterFieldType::ColorMatrixBool) {
+                for (int i = 0; i < numElements; ++i) {
+                    static_cast<bool*>(value)[i] = input[i] != 0;
+                }
+            } else {
+                std::memcpy(value, input.data(), size);
             }
-            encodeDecodeProperty(tree, spot.fadeoutRadius, defaultSpot.fadeoutRadius, base + "fadeout radius", parserTask);
-
-            encodeDecodeSpotProperty(tree, spot.values.friction, spot.activatedValues.friction, defaultSpot.values.friction, base + "friction", parserTask);
-            encodeDecodeSpotProperty(tree, spot.values.rigidity, spot.activatedValues.rigidity, defaultSpot.values.rigidity, base + "rigidity", parserTask);
-            encodeDecodeSpotProperty(
-                tree,
-                spot.values.radiationAbsorption,
-                spot.activatedValues.radiationAbsorption,
-                defaultSpot.values.radiationAbsorption,
-                base + "radiation.absorption",
-                parserTask);
-            encodeDecodeSpotProperty(
-                tree,
-                spot.values.radiationCellAgeStrength,
-                spot.activatedValues.radiationCellAgeStrength,
-                defaultSpot.values.radiationCellAgeStrength,
-                base + "radiation.factor",
-                parserTask);
-            encodeDecodeSpotProperty(
-                tree, spot.values.cellMaxForce, spot.activatedValues.cellMaxForce, defaultSpot.values.cellMaxForce, base + "cell.max force", parserTask);
-            encodeDecodeSpotProperty(
-                tree, spot.values.cellMinEnergy, spot.activatedValues.cellMinEnergy, defaultSpot.values.cellMinEnergy, base + "cell.min energy", parserTask);
-
-            encodeDecodeSpotProperty(
-                tree,
-                spot.values.cellFusionVelocity,
-                spot.activatedValues.cellFusionVelocity,
-                defaultSpot.values.cellFusionVelocity,
-                base + "cell.fusion velocity",
-                parserTask);
-            encodeDecodeSpotProperty(
-                tree,
-                spot.values.cellMaxBindingEnergy,
-                spot.activatedValues.cellMaxBindingEnergy,
-                defaultSpot.values.cellMaxBindingEnergy,
-                base + "cell.max binding energy",
-                parserTask);
-
-            encodeDecodeProperty(tree, spot.activatedValues.cellColorTransition, false, base + "cell.color transition rules.activated", parserTask);
-            encodeDecodeProperty(
-                tree,
-                spot.values.cellColorTransitionDuration,
-                defaultSpot.values.cellColorTransitionDuration,
-                base + "cell.color transition rules.duration",
-                parserTask);
-            encodeDecodeProperty(
-                tree,
-                spot.values.cellColorTransitionTargetColor,
-                defaultSpot.values.cellColorTransitionTargetColor,
-                base + "cell.color transition rules.target color",
-                parserTask);
-
-            encodeDecodeSpotProperty(
-                tree,
-                spot.values.cellFunctionAttackerEnergyCost,
-                spot.activatedValues.cellFunctionAttackerEnergyCost,
-                defaultSpot.values.cellFunctionAttackerEnergyCost,
-                base + "cell.function.attacker.energy cost",
-                parserTask);
-            encodeDecodeProperty(
-                tree,
-                spot.activatedValues.cellFunctionAttackerFoodChainColorMatrix,
-                false,
-                base + "cell.function.attacker.food chain color matrix.activated",
-                parserTask);
-            encodeDecodeProperty(
-                tree,
-                spot.values.cellFunctionAttackerFoodChainColorMatrix,
-                defaultSpot.values.cellFunctionAttackerFoodChainColorMatrix,
-                base + "cell.function.attacker.food chain color matrix",
-                parserTask);
-            encodeDecodeSpotProperty(
-                tree,
-                spot.values.cellFunctionAttackerGeometryDeviationExponent,
-                spot.activatedValues.cellFunctionAttackerGeometryDeviationExponent,
-                defaultSpot.values.cellFunctionAttackerGeometryDeviationExponent,
-                base + "cell.function.attacker.geometry deviation exponent",
-                parserTask);
-            encodeDecodeSpotProperty(
-                tree,
-                spot.values.cellFunctionAttackerConnectionsMismatchPenalty,
-                spot.activatedValues.cellFunctionAttackerConnectionsMismatchPenalty,
-                defaultSpot.values.cellFunctionAttackerConnectionsMismatchPenalty,
-                base + "cell.function.attacker.connections mismatch penalty",
-                parserTask);
-
-            encodeDecodeSpotProperty(
-                tree,
-                spot.values.cellFunctionConstructorMutationNeuronDataProbability,
-                spot.activatedValues.cellFunctionConstructorMutationNeuronDataProbability,
-                defaultSpot.values.cellFunctionConstructorMutationNeuronDataProbability,
-                base + "cell.function.constructor.mutation probability.neuron data",
-                parserTask);
-            encodeDecodeSpotProperty(
-                tree,
-                spot.values.cellFunctionConstructorMutationPropertiesProbability,
-                spot.activatedValues.cellFunctionConstructorMutationPropertiesProbability,
-                defaultSpot.values.cellFunctionConstructorMutationPropertiesProbability,
-                base + "cell.function.constructor.mutation probability.data ",
-                parserTask);
-            encodeDecodeSpotProperty(
-                tree,
-                spot.values.cellFunctionConstructorMutationGeometryProbability,
-                spot.activatedValues.cellFunctionConstructorMutationGeometryProbability,
-                defaultSpot.values.cellFunctionConstructorMutationGeometryProbability,
-                base + "cell.function.constructor.mutation probability.geometry",
-                parserTask);
-            encodeDecodeSpotProperty(
-                tree,
-                spot.values.cellFunctionConstructorMutationCustomGeometryProbability,
-                spot.activatedValues.cellFunctionConstructorMutationCustomGeometryProbability,
-                defaultSpot.values.cellFunctionConstructorMutationCustomGeometryProbability,
-                base + "cell.function.constructor.mutation probability.custom geometry",
-                parserTask);
-            encodeDecodeSpotProperty(
-                tree,
-                spot.values.cellFunctionConstructorMutationCellFunctionProbability,
-                spot.activatedValues.cellFunctionConstructorMutationCellFunctionProbability,
-                defaultSpot.values.cellFunctionConstructorMutationCellFunctionProbability,
-                base + "cell.function.constructor.mutation probability.cell function",
-                parserTask);
-            encodeDecodeSpotProperty(
-                tree,
-                spot.values.cellFunctionConstructorMutationInsertionProbability,
-                spot.activatedValues.cellFunctionConstructorMutationInsertionProbability,
-                defaultSpot.values.cellFunctionConstructorMutationInsertionProbability,
-                base + "cell.function.constructor.mutation probability.insertion",
-                parserTask);
-            encodeDecodeSpotProperty(
-                tree,
-                spot.values.cellFunctionConstructorMutationDeletionProbability,
-                spot.activatedValues.cellFunctionConstructorMutationDeletionProbability,
-                defaultSpot.values.cellFunctionConstructorMutationDeletionProbability,
-                base + "cell.function.constructor.mutation probability.deletion",
-                parserTask);
-            encodeDecodeSpotProperty(
-                tree,
-                spot.values.cellFunctionConstructorMutationTranslationProbability,
-                spot.activatedValues.cellFunctionConstructorMutationTranslationProbability,
-                defaultSpot.values.cellFunctionConstructorMutationTranslationProbability,
-                base + "cell.function.constructor.mutation probability.translation",
-                parserTask);
-            encodeDecodeSpotProperty(
-                tree,
-                spot.values.cellFunctionConstructorMutationDuplicationProbability,
-                spot.activatedValues.cellFunctionConstructorMutationDuplicationProbability,
-                defaultSpot.values.cellFunctionConstructorMutationDuplicationProbability,
-                base + "cell.function.constructor.mutation probability.duplication",
-                parserTask);
-            encodeDecodeSpotProperty(
-                tree,
-                spot.values.cellFunctionConstructorMutationColorProbability,
-                spot.activatedValues.cellFunctionConstructorMutationColorProbability,
-                defaultSpot.values.cellFunctionConstructorMutationColorProbability,
-                base + "cell.function.constructor.mutation probability.color",
-                parserTask);
-            encodeDecodeSpotProperty(
-                tree,
-                spot.values.cellFunctionConstructorMutationUniformColorProbability,
-                spot.activatedValues.cellFunctionConstructorMutationUniformColorProbability,
-                defaultSpot.values.cellFunctionConstructorMutationUniformColorProbability,
-                base + "cell.function.constructor.mutation probability.uniform color",
-                parserTask);
+            input.remove_prefix(size);
         }
+        return true;
     }
+}
 
-    void encodeDecode(boost::property_tree::ptree& tree, AuxiliaryData& data, ParserTask parserTask)
-    {
-        AuxiliaryData defaultSettings;
+std::string AuxiliaryDataParserService::encodeAuxiliaryDataToJson(AuxiliaryData const& data)
+{
+    auto& dataRef = const_cast<AuxiliaryData&>(data);
+    return encodeJson(&dataRef, dataRef.simulationParameters);
+}
 
-        //general settings
-        encodeDecodeProperty(tree, data.timestep, uint64_t(0), "general.time step", parserTask);
-        encodeDecodeProperty(tree, data.zoom, 4.0f, "general.zoom", parserTask);
-        encodeDecodeProperty(tree, data.center.x, 0.0f, "general.center.x", parserTask);
-        encodeDecodeProperty(tree, data.center.y, 0.0f, "general.center.y", parserTask);
-        encodeDecodeProperty(tree, data.generalSettings.worldSizeX, defaultSettings.generalSettings.worldSizeX, "general.world size.x", parserTask);
-        encodeDecodeProperty(tree, data.generalSettings.worldSizeY, defaultSettings.generalSettings.worldSizeY, "general.world size.y", parserTask);
+AuxiliaryData AuxiliaryDataParserService::decodeAuxiliaryDataFromJson(std::string_view json)
+{
+    return decodeAuxiliaryDataFromValues(readFlatValues(json));
+}
 
-        encodeDecode(tree, data.simulationParameters, parserTask);
+std::string AuxiliaryDataParserService::encodeSimulationParametersToJson(SimulationParameters const& parameters)
+{
+    return encodeJson(nullptr, const_cast<SimulationParameters&>(parameters));
+}
+
+SimulationParameters AuxiliaryDataParserService::decodeSimulationParametersFromJson(std::string_view json)
+{
+    SimulationParameters result;
+    decodeSimulationParametersFromValues(readFlatValues(json), result);
+    return result;
+}
+
+std::string AuxiliaryDataParserService::encodeSimulationParametersToBinary(SimulationParameters const& parameters)
+{
+    auto& parametersRef = const_cast<SimulationParameters&>(parameters);
+    std::string result;
+    result.reserve(sizeof(SimulationParameters));
+    auto layoutHash = calcParameterFieldsLayoutHash();
+    result.append(reinterpret_cast<char const*>(&BinaryFormatId), sizeof(BinaryFormatId));
+    result.append(reinterpret_cast<char const*>(&layoutHash), sizeof(layoutHash));
+    appendBinary(result, parametersRef);
+    for (int i = 0; i < std::min(parameters.numParticleSources, MAX_PARTICLE_SOURCES); ++i) {
+        appendBinary(result, parametersRef.particleSources[i]);
+    }
+    for (int i = 0; i < std::min(parameters.numSpots, MAX_SPOTS); ++i) {
+        appendBinary(result, parametersRef.spots[i]);
+    }
+    return result;
+}
+
+bool AuxiliaryDataParserService::decodeSimulationParametersFromBinary(SimulationParameters& parameters, std::string_view data)
+{
+    uint32_t formatId;
+    uint64_t layoutHash;
+    if (data.size() < sizeof(formatId) + sizeof(layoutHash)) {
+        return false;
+    }
+    std::memcpy(&formatId, data.data(), sizeof(formatId));
+    std::memcpy(&layoutHash, data.data() + sizeof(formatId), sizeof(layoutHash));
+    if (formatId != BinaryFormatId || layoutHash != calcParameterFieldsLayoutHash()) {
+        return false;
+    }
+    data.remove_prefix(sizeof(formatId) + sizeof(layoutHash));
+
+    SimulationParameters result;
+    if (!readBinary(data, result)) {
+        return false;
+    }
+    if (result.numParticleSources < 0 || result.numParticleSources > MAX_PARTICLE_SOURCES || result.numSpots < 0 || result.numSpots > MAX_SPOTS) {
+        return false;
+    }
+    for (int i = 0; i < result.numParticleSources; ++i) {
+        if (!readBinary(data, result.particleSources[i])) {
+            return false;
+        }
+    }
+    for (int i = 0; i < result.numSpots; ++i) {
+        if (!readBinary(data, result.spots[i])) {
+            return false;
+        }
+    }
+    if (!data.empty()) {
+        return false;
     }
+    parameters = result;
+    return true;
 }
 
 boost::property_tree::ptree AuxiliaryDataParserService::encodeAuxiliaryData(AuxiliaryData const& data)
 {
-    boost::property_tree::ptree tree;
-    encodeDecode(tree, const_cast<AuxiliaryData&>(data), ParserTask::Encode);
-    return tree;
+    auto json = encodeAuxiliaryDataToJson(data);
+    std::stringstream stream(json);
+    boost::property_tree::ptree result;
+    boost::property_tree::read_json(stream, result);
+    return result;
 }
 
 AuxiliaryData AuxiliaryDataParserService::decodeAuxiliaryData(boost::property_tree::ptree tree)
 {
-    AuxiliaryData result;
-    encodeDecode(tree, result, ParserTask::Decode);
-    return result;
+    FlatValues values;
+    std::string path;
+    addFlatValues(tree, path, values);
+    return decodeAuxiliaryDataFromValues(values);
 }
 
 boost::property_tree::ptree AuxiliaryDataParserService::encodeSimulationParameters(SimulationParameters const& data)
 {
-    boost::property_tree::ptree tree;
-    encodeDecode(tree, const_cast<SimulationParameters&>(data), ParserTask::Encode);
-    return tree;
+    auto json = encodeSimulationParametersToJson(data);
+    std::stringstream stream(json);
+    boost::property_tree::ptree result;
+    boost::property_tree::read_json(stream, result);
+    return result;
 }
 
 SimulationParameters AuxiliaryDataParserService::decodeSimulationParameters(boost::property_tree::ptree tree)
 {
+    FlatValues values;
+    std::string path;
+    addFlatValues(tree, path, values);
     SimulationParameters result;
-    encodeDecode(tree, result, ParserTask::Decode);
+    decodeSimulationParametersFromValues(values, result);
     return result;
 }
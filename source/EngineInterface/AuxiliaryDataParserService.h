@@ -1,5 +1,8 @@
 #pragma once
 
+#include <string>
+#include <string_view>
+
 #include <boost/property_tree/ptree.hpp>
 
 #include "Base/JsonParser.h"
@@ -8,9 +11,23 @@
 #include "AuxiliaryData.h"
 #include "Definitions.h"
 
+/**
+ * Encoding of settings driven by the field tables in SimulationParametersFields.h.
+ * - JSON: format of the .settings.json files, written and read directly without building a property tree
+ * - Binary: compact raw encoding for in-process use (e.g. parameter snapshots), only readable by builds with the same field layout
+ */
 class AuxiliaryDataParserService
 {
 public:
+    static std::string encodeAuxiliaryDataToJson(AuxiliaryData const& data);
+    static AuxiliaryData decodeAuxiliaryDataFromJson(std::string_view json);  //throws std::runtime_error for invalid JSON
+
+    static std::string encodeSimulationParametersToJson(SimulationParameters const& parameters);
+    static SimulationParameters decodeSimulationParametersFromJson(std::string_view json);  //throws std::runtime_error for invalid JSON
+
+    static std::string encodeSimulationParametersToBinary(SimulationParameters const& parameters);
+    static bool decodeSimulationParametersFromBinary(SimulationParameters& parameters, std::string_view data);  //returns false for a different layout
+
     static boost::property_tree::ptree encodeAuxiliaryData(AuxiliaryData const& data);
     static AuxiliaryData decodeAuxiliaryData(boost::property_tree::ptree tree);
 
@@ -0,0 +1,147 @@
+#include "ChunkedCompressionService.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#include <zlib.h>
+
+#include "Base/ParallelExecution.h"
+
+namespace
+{
+    //the first byte must differ from the first byte of gzip and zlib streams written by older versions
+    char constexpr Magic[] = {'A', 'L', 'I', 'E', 'N', 'Z', 'I', 'P'};
+    uint32_t constexpr FormatVersion = 1;
+
+    struct BlockIndexEntry
+    {
+        uint64_t uncompressedSize;
+        uint64_t compressedSize;
+    };
+
+    void checkData(bool condition)
+    {
+        if (!condition) {
+            throw std::runtime_error("Compressed data is corrupt.");
+        }
+    }
+
+    template <typename T>
+    void writeValue(std::string& output, T const& value)
+    {
+        output.append(reinterpret_cast<char const*>(&value), sizeof(T));
+    }
+
+    template <typename T>
+    void readValue(std::string_view const& input, size_t& pos, T& value)
+    {
+        checkData(sizeof(T) <= input.size() - pos);
+        std::memcpy(&value, input.data() + pos, sizeof(T));
+        pos += sizeof(T);
+    }
+}
+
+std::string ChunkedCompressionService::compress(std::string const& input, uint64_t blockSize, int compressionLevel)
+{
+    if (blockSize == 0) {
+        throw std::runtime_error("Invalid block size.");
+    }
+    auto numBlocks = (input.size() + blockSize - 1) / blockSize;
+
+    std::vector<std::string> compressedBlocks(numBlocks);
+    ParallelExecution::execute(numBlocks, [&](size_t blockIndex) {
+        auto offset = blockIndex * blockSize;
+        auto size = std::min<uint64_t>(blockSize, input.size() - offset);
+
+        auto& compressedBlock = compressedBlocks[blockIndex];
+        auto compressedSize = compressBound(static_cast<uLong>(size));
+        compressedBlock.resize(compressedSize);
+        if (compress2(
+                reinterpret_cast<Bytef*>(compressedBlock.data()),
+                &compressedSize,
+                reinterpret_cast<Bytef const*>(input.data() + offset),
+                static_cast<uLong>(size),
+                compressionLevel)
+            != Z_OK) {
+            throw std::runtime_error("Compression failed.");
+        }
+        compressedBlock.resize(compressedSize);
+    });
+
+    std::string result;
+    auto totalCompressedSize = 0ull;
+    for (auto const& compressedBlock : compressedBlocks) {
+        totalCompressedSize += compressedBlock.size();
+    }
+    result.reserve(sizeof(Magic) + sizeof(uint32_t) + 2 * sizeof(uint64_t) + numBlocks * sizeof(BlockIndexEntry) + totalCompressedSize);
+
+    result.append(Magic, sizeof(Magic));
+    writeValue(result, FormatVersion);
+    writeValue<uint64_t>(result, input.size());
+    writeValue<uint64_t>(result, numBlocks);
+    for (size_t blockIndex = 0; blockIndex < numBlocks; ++blockIndex) {
+        BlockIndexEntry entry{std::min<uint64_t>(blockSize, input.size() - blockIndex * blockSize), compressedBlocks[blockIndex].size()};
+        writeValue(result, entry);
+    }
+    for (auto const& compressedBlock : compressedBlocks) {
+        result.append(compressedBlock);
+    }
+    return result;
+}
+
+std::string ChunkedCompressionService::decompress(std::string_view const& input)
+{
+    checkData(isChunkedFormat(input));
+    size_t pos = sizeof(Magic);
+
+    uint32_t version;
+    readValue(input, pos, version);
+    if (version > FormatVersion) {
+        throw std::runtime_error("Format version not supported.");
+    }
+
+    uint64_t uncompressedSize;
+    uint64_t numBlocks;
+    readValue(input, pos, uncompressedSize);
+    readValue(input, pos, numBlocks);
+    checkData(numBlocks <= (input.size() - pos) / sizeof(BlockIndexEntry));
+
+    std::vector<BlockIndexEntry> index(numBlocks);
+    std::vector<uint64_t> compressedOffsets(numBlocks);
+    std::vector<uint64_t> uncompressedOffsets(numBlocks);
+    for (size_t blockIndex = 0; blockIndex < numBlocks; ++blockIndex) {
+        readValue(input, pos, index[blockIndex]);
+    }
+    uint64_t compressedOffset = pos;
+    uint64_t uncompressedOffset = 0;
+    for (size_t blockIndex = 0; blockIndex < numBlocks; ++blockIndex) {
+        auto const& entry = index[blockIndex];
+        checkData(entry.compressedSize <= input.size() - compressedOffset);
+        checkData(entry.uncompressedSize <= uncompressedSize - uncompressedOffset);
+        compressedOffsets[blockIndex] = compressedOffset;
+        uncompressedOffsets[blockIndex] = uncompressedOffset;
+        compressedOffset += entry.compressedSize;
+        uncompressedOffset += entry.uncompressedSize;
+    }
+    checkData(uncompressedOffset == uncompressedSize);
+
+    std::string result(uncompressedSize, '\0');
+    ParallelExecution::execute(numBlocks, [&](size_t blockIndex) {
+        auto const& entry = index[blockIndex];
+        auto size = static_cast<uLong>(entry.uncompressedSize);
+        auto status = uncompress(
+            reinterpret_cast<Bytef*>(result.data() + uncompressedOffsets[blockIndex]),
+            &size,
+            reinterpret_cast<Bytef const*>(input.data() + compressedOffsets[blockIndex]),
+            static_cast<uLong>(entry.compressedSize));
+        checkData(status == Z_OK && size == entry.uncompressedSize);
+    });
+    return result;
+}
+
+bool ChunkedCompressionService::isChunkedFormat(std::string_view const& input)
+{
+    return input.size() >= sizeof(Magic) && std::equal(std::begin(Magic), std::end(Magic), input.begin());
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/**
+ * Container format for compressed data consisting of independently compressed blocks.
+ * A header with an index of the block sizes precedes the blocks so that compression
+ * and decompression can be distributed among all available cores.
+ */
+class ChunkedCompressionService
+{
+public:
+    static uint64_t constexpr DefaultBlockSize = 4 << 20;
+    static int constexpr DefaultCompressionLevel = -1;  //zlib default
+    static int constexpr NoCompression = 0;  //blocks are only stored, i.e. decompression is mainly copying
+
+    static std::string
+    compress(std::string const& input, uint64_t blockSize = DefaultBlockSize, int compressionLevel = DefaultCompressionLevel);
+    static std::string decompress(std::string_view const& input);
+
+    static bool isChunkedFormat(std::string_view const& input);
+};
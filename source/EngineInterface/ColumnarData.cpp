@@ -0,0 +1,56 @@
+#include "ColumnarData.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string_view>
+
+uint32_t GenomePoolColumns::addGenome(uint8_t const* genome, uint64_t size)
+{
+    updateIndex();
+
+    auto hash = std::hash<std::string_view>{}(std::string_view(reinterpret_cast<char const*>(genome), size));
+    auto& genomeIndices = _genomeIndicesByHash[hash];
+    for (auto const& genomeIndex : genomeIndices) {
+        if (genomeSize[genomeIndex] == size && std::equal(genome, genome + size, bytes.begin() + _genomeOffsets[genomeIndex])) {
+            return genomeIndex;
+        }
+    }
+
+    auto result = static_cast<uint32_t>(genomeSize.size());
+    genomeSize.emplace_back(static_cast<uint32_t>(size));
+    _genomeOffsets.emplace_back(bytes.size());
+    bytes.insert(bytes.end(), genome, genome + size);
+    genomeIndices.emplace_back(result);
+    _numIndexedBytes = bytes.size();
+    return result;
+}
+
+std::vector<uint64_t> GenomePoolColumns::calcGenomeOffsets() const
+{
+    std::vector<uint64_t> result;
+    result.reserve(genomeSize.size());
+    uint64_t offset = 0;
+    for (auto const& size : genomeSize) {
+        result.emplace_back(offset);
+        offset += size;
+    }
+    if (offset > bytes.size()) {
+        throw std::runtime_error("Simulation data is corrupt.");
+    }
+    return result;
+}
+
+void GenomePoolColumns::updateIndex()
+{
+    if (_genomeOffsets.size() == genomeSize.size() && _numIndexedBytes == bytes.size()) {
+        return;
+    }
+    _genomeOffsets = calcGenomeOffsets();
+    _genomeIndicesByHash.clear();
+    for (uint32_t genomeIndex = 0; genomeIndex < genomeSize.size(); ++genomeIndex) {
+        auto hash = std::hash<std::string_view>{}(
+            std::string_view(reinterpret_cast<char const*>(bytes.data() + _genomeOffsets[genomeIndex]), genomeSize[genomeIndex]));
+        _genomeIndicesByHash[hash].emplace_back(genomeIndex);
+    }
+    _numIndexedBytes = bytes.size();
+}
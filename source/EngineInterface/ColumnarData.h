@@ -0,0 +1,332 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+struct ClusterColumns
+{
+    std::vector<uint32_t> numCells;
+
+    template <typename Visitor>
+    void visit(Visitor&& visitor)
+    {
+        visitor(numCells);
+    }
+};
+
+struct CellColumns
+{
+    std::vector<uint64_t> id;
+    std::vector<float> posX;
+    std::vector<float> posY;
+    std::vector<float> velX;
+    std::vector<float> velY;
+    std::vector<float> energy;
+    std::vector<float> stiffness;
+    std::vector<int32_t> color;
+    std::vector<int32_t> maxConnections;
+    std::vector<uint8_t> numConnections;
+    std::vector<uint8_t> barrier;
+    std::vector<int32_t> age;
+    std::vector<int32_t> livingState;
+    std::vector<int32_t> creatureId;
+    std::vector<int32_t> mutationId;
+    std::vector<int32_t> executionOrderNumber;
+    std::vector<int32_t> inputExecutionOrderNumber;  //-1 = none
+    std::vector<uint8_t> outputBlocked;
+    std::vector<int32_t> cellFunction;
+    std::vector<float> activity;  //MAX_CHANNELS values per cell
+    std::vector<int32_t> activationTime;
+    std::vector<int32_t> genomeNumNodes;
+
+    template <typename Visitor>
+    void visit(Visitor&& visitor)
+    {
+        visitor(id);
+        visitor(posX);
+        visitor(posY);
+        visitor(velX);
+        visitor(velY);
+        visitor(energy);
+        visitor(stiffness);
+        visitor(color);
+        visitor(maxConnections);
+        visitor(numConnections);
+        visitor(barrier);
+        visitor(age);
+        visitor(livingState);
+        visitor(creatureId);
+        visitor(mutationId);
+        visitor(executionOrderNumber);
+        visitor(inputExecutionOrderNumber);
+        visitor(outputBlocked);
+        visitor(cellFunction);
+        visitor(activity);
+        visitor(activationTime);
+        visitor(genomeNumNodes);
+    }
+};
+
+struct ConnectionColumns
+{
+    std::vector<uint64_t> cellId;
+    std::vector<float> distance;
+    std::vector<float> angleFromPrevious;
+
+    template <typename Visitor>
+    void visit(Visitor&& visitor)
+    {
+        visitor(cellId);
+        visitor(distance);
+        visitor(angleFromPrevious);
+    }
+};
+
+struct MetadataColumns
+{
+    std::vector<uint32_t> nameSize;
+    std::vector<uint32_t> descriptionSize;
+    std::vector<char> chars;
+
+    template <typename Visitor>
+    void visit(Visitor&& visitor)
+    {
+        visitor(nameSize);
+        visitor(descriptionSize);
+        visitor(chars);
+    }
+};
+
+struct NeuronColumns
+{
+    std::vector<float> weights;  //MAX_CHANNELS * MAX_CHANNELS values per neuron
+    std::vector<float> biases;  //MAX_CHANNELS values per neuron
+    std::vector<int32_t> activationFunctions;  //MAX_CHANNELS values per neuron
+
+    template <typename Visitor>
+    void visit(Visitor&& visitor)
+    {
+        visitor(weights);
+        visitor(biases);
+        visitor(activationFunctions);
+    }
+};
+
+struct ModeColumns
+{
+    std::vector<int32_t> mode;
+
+    template <typename Visitor>
+    void visit(Visitor&& visitor)
+    {
+        visitor(mode);
+    }
+};
+
+struct ConstructorColumns
+{
+    std::vector<int32_t> activationMode;
+    std::vector<int32_t> constructionActivationTime;
+    std::vector<uint32_t> genomeIndex;
+    std::vector<int32_t> genomeGeneration;
+    std::vector<float> constructionAngle1;
+    std::vector<float> constructionAngle2;
+    std::vector<uint64_t> lastConstructedCellId;
+    std::vector<int32_t> genomeCurrentNodeIndex;
+    std::vector<int32_t> genomeCurrentRepetition;
+    std::vector<uint8_t> isConstructionBuilt;
+    std::vector<int32_t> offspringCreatureId;
+    std::vector<int32_t> offspringMutationId;
+
+    template <typename Visitor>
+    void visit(Visitor&& visitor)
+    {
+        visitor(activationMode);
+        visitor(constructionActivationTime);
+        visitor(genomeIndex);
+        visitor(genomeGeneration);
+        visitor(constructionAngle1);
+        visitor(constructionAngle2);
+        visitor(lastConstructedCellId);
+        visitor(genomeCurrentNodeIndex);
+        visitor(genomeCurrentRepetition);
+        visitor(isConstructionBuilt);
+        visitor(offspringCreatureId);
+        visitor(offspringMutationId);
+    }
+};
+
+struct SensorColumns
+{
+    std::vector<uint8_t> hasFixedAngle;
+    std::vector<float> fixedAngle;
+    std::vector<float> minDensity;
+    std::vector<int32_t> color;
+    std::vector<int32_t> targetedCreatureId;
+    std::vector<float> memoryChannel1;
+    std::vector<float> memoryChannel2;
+    std::vector<float> memoryChannel3;
+
+    template <typename Visitor>
+    void visit(Visitor&& visitor)
+    {
+        visitor(hasFixedAngle);
+        visitor(fixedAngle);
+        visitor(minDensity);
+        visitor(color);
+        visitor(targetedCreatureId);
+        visitor(memoryChannel1);
+        visitor(memoryChannel2);
+        visitor(memoryChannel3);
+    }
+};
+
+struct NerveColumns
+{
+    std::vector<int32_t> pulseMode;
+    std::vector<int32_t> alternationMode;
+
+    template <typename Visitor>
+    void visit(Visitor&& visitor)
+    {
+        visitor(pulseMode);
+        visitor(alternationMode);
+    }
+};
+
+struct InjectorColumns
+{
+    std::vector<int32_t> mode;
+    std::vector<int32_t> counter;
+    std::vector<uint32_t> genomeIndex;
+    std::vector<int32_t> genomeGeneration;
+
+    template <typename Visitor>
+    void visit(Visitor&& visitor)
+    {
+        visitor(mode);
+        visitor(counter);
+        visitor(genomeIndex);
+        visitor(genomeGeneration);
+    }
+};
+
+struct MuscleColumns
+{
+    std::vector<int32_t> mode;
+    std::vector<int32_t> lastBendingDirection;
+    std::vector<int32_t> lastBendingSourceIndex;
+    std::vector<float> consecutiveBendingAngle;
+
+    template <typename Visitor>
+    void visit(Visitor&& visitor)
+    {
+        visitor(mode);
+        visitor(lastBendingDirection);
+        visitor(lastBendingSourceIndex);
+        visitor(consecutiveBendingAngle);
+    }
+};
+
+struct ReconnectorColumns
+{
+    std::vector<int32_t> color;
+
+    template <typename Visitor>
+    void visit(Visitor&& visitor)
+    {
+        visitor(color);
+    }
+};
+
+struct DetonatorColumns
+{
+    std::vector<int32_t> state;
+    std::vector<int32_t> countdown;
+
+    template <typename Visitor>
+    void visit(Visitor&& visitor)
+    {
+        visitor(state);
+        visitor(countdown);
+    }
+};
+
+//genomes are stored only once per content, cells refer to them by index
+struct GenomePoolColumns
+{
+    std::vector<uint32_t> genomeSize;
+    std::vector<uint8_t> bytes;
+
+    //returns the index of an identical genome in the pool if present
+    uint32_t addGenome(uint8_t const* genome, uint64_t size);
+    //start positions of the genomes in bytes, throws std::runtime_error if the pool is inconsistent
+    std::vector<uint64_t> calcGenomeOffsets() const;
+
+    template <typename Visitor>
+    void visit(Visitor&& visitor)
+    {
+        visitor(genomeSize);
+        visitor(bytes);
+    }
+
+private:
+    //rebuilds the index if the columns have been filled without addGenome (e.g. by deserialization)
+    void updateIndex();
+
+    //not serialized: used for deduplication while writing
+    std::vector<uint64_t> _genomeOffsets;
+    std::unordered_map<size_t, std::vector<uint32_t>> _genomeIndicesByHash;
+    uint64_t _numIndexedBytes = 0;
+};
+
+struct ParticleColumns
+{
+    std::vector<uint64_t> id;
+    std::vector<float> posX;
+    std::vector<float> posY;
+    std::vector<float> velX;
+    std::vector<float> velY;
+    std::vector<float> energy;
+    std::vector<int32_t> color;
+
+    template <typename Visitor>
+    void visit(Visitor&& visitor)
+    {
+        visitor(id);
+        visitor(posX);
+        visitor(posY);
+        visitor(velX);
+        visitor(velY);
+        visitor(energy);
+        visitor(color);
+    }
+};
+
+/**
+ * Simulation main data as struct of arrays in the layout of the columnar file format.
+ * The rows of the cell function columns follow the order of the cells with the corresponding cell function.
+ * Cells are stored consecutively per cluster. If no cluster sizes are given, the cells are not grouped into clusters.
+ */
+struct ColumnarData
+{
+    ClusterColumns clusters;
+    CellColumns cells;
+    ConnectionColumns connections;
+    MetadataColumns metadata;
+    NeuronColumns neurons;
+    ModeColumns transmitters;
+    ConstructorColumns constructors;
+    SensorColumns sensors;
+    NerveColumns nerves;
+    ModeColumns attackers;
+    InjectorColumns injectors;
+    MuscleColumns muscles;
+    ModeColumns defenders;
+    ReconnectorColumns reconnectors;
+    DetonatorColumns detonators;
+    GenomePoolColumns genomePool;
+    ParticleColumns particles;
+};
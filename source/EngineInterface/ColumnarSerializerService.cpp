@@ -0,0 +1,755 @@
+#include "ColumnarSerializerService.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "Base/DisjointSets.h"
+#include "Base/Resources.h"
+#include "Base/VersionChecker.h"
+
+namespace
+{
+    //the first byte must differ from 0 and 1 since these are the possible first bytes of a cereal portable binary archive
+    char constexpr Magic[] = {'A', 'L', 'I', 'E', 'N', 'S', 'O', 'A'};
+
+    //should only be increased for incompatible changes; new sections and new columns at the end of a section remain readable
+    uint32_t constexpr FormatVersion = 1;
+
+    enum class SectionId : uint32_t
+    {
+        End = 0,
+        Clusters = 1,
+        Cells = 2,
+        Connections = 3,
+        Metadata = 4,
+        Neurons = 5,
+        Transmitters = 6,
+        Constructors = 7,
+        Sensors = 8,
+        Nerves = 9,
+        Attackers = 10,
+        Injectors = 11,
+        Muscles = 12,
+        Defenders = 13,
+        Reconnectors = 14,
+        Detonators = 15,
+        GenomePool = 16,
+        Particles = 17,
+    };
+
+    void checkData(bool condition)
+    {
+        if (!condition) {
+            throw std::runtime_error("Simulation data is corrupt.");
+        }
+    }
+
+    template <typename T>
+    void writeValue(std::ostream& stream, T const& value)
+    {
+        stream.write(reinterpret_cast<char const*>(&value), sizeof(T));
+    }
+
+    template <typename T>
+    void readValue(std::istream& stream, T& value)
+    {
+        stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+        checkData(static_cast<bool>(stream));
+    }
+
+    template <typename T>
+    uint64_t getColumnSize(std::vector<T> const& column)
+    {
+        return sizeof(uint64_t) + sizeof(T) * column.size();
+    }
+
+    template <typename T>
+    void writeColumn(std::ostream& stream, std::vector<T> const& column)
+    {
+        writeValue<uint64_t>(stream, column.size());
+        if (!column.empty()) {
+            stream.write(reinterpret_cast<char const*>(column.data()), sizeof(T) * column.size());
+        }
+    }
+
+    template <typename T>
+    void readColumn(std::istream& stream, std::vector<T>& column, uint64_t& remainingSectionSize)
+    {
+        checkData(remainingSectionSize >= sizeof(uint64_t));
+        uint64_t numElements;
+        readValue(stream, numElements);
+        remainingSectionSize -= sizeof(uint64_t);
+
+        checkData(numElements <= remainingSectionSize / sizeof(T));
+        column.resize(numElements);
+        if (numElements > 0) {
+            stream.read(reinterpret_cast<char*>(column.data()), sizeof(T) * numElements);
+            checkData(static_cast<bool>(stream));
+        }
+        remainingSectionSize -= sizeof(T) * numElements;
+    }
+
+    template <typename Columns>
+    void writeSection(std::ostream& stream, SectionId id, Columns& columns)
+    {
+        uint64_t sectionSize = 0;
+        columns.visit([&](auto& column) { sectionSize += getColumnSize(column); });
+
+        writeValue(stream, id);
+        writeValue(stream, sectionSize);
+        columns.visit([&](auto& column) { writeColumn(stream, column); });
+    }
+
+    template <typename Columns>
+    void readSection(std::istream& stream, uint64_t sectionSize, Columns& columns)
+    {
+        columns.visit([&](auto& column) {
+            if (sectionSize > 0) {
+                readColumn(stream, column, sectionSize);
+            }
+        });
+
+        //skip columns added in later versions
+        if (sectionSize > 0) {
+            stream.ignore(static_cast<std::streamsize>(sectionSize));
+            checkData(static_cast<bool>(stream));
+        }
+    }
+
+    //returns the default value for columns which are not present in older files
+    template <typename T>
+    T getValue(std::vector<T> const& column, size_t index, T const& defaultValue)
+    {
+        return index < column.size() ? column[index] : defaultValue;
+    }
+
+    template <typename T>
+    bool hasRow(std::vector<T> const& column, size_t index, size_t rowSize)
+    {
+        return (index + 1) * rowSize <= column.size();
+    }
+
+    template <typename Visitor>
+    void visitSections(ColumnarData& data, Visitor&& visitor)
+    {
+        visitor(SectionId::Clusters, data.clusters);
+        visitor(SectionId::Cells, data.cells);
+        visitor(SectionId::Connections, data.connections);
+        visitor(SectionId::Metadata, data.metadata);
+        visitor(SectionId::Neurons, data.neurons);
+        visitor(SectionId::Transmitters, data.transmitters);
+        visitor(SectionId::Constructors, data.constructors);
+        visitor(SectionId::Sensors, data.sensors);
+        visitor(SectionId::Nerves, data.nerves);
+        visitor(SectionId::Attackers, data.attackers);
+        visitor(SectionId::Injectors, data.injectors);
+        visitor(SectionId::Muscles, data.muscles);
+        visitor(SectionId::Defenders, data.defenders);
+        visitor(SectionId::Reconnectors, data.reconnectors);
+        visitor(SectionId::Detonators, data.detonators);
+        visitor(SectionId::GenomePool, data.genomePool);
+        visitor(SectionId::Particles, data.particles);
+    }
+
+    void addCellFunction(ColumnarData& columns, CellDescription const& cell)
+    {
+        switch (cell.getCellFunctionType()) {
+        case CellFunction_Neuron: {
+            auto const& neuron = std::get<NeuronDescription>(*cell.cellFunction);
+            auto weights = neuron.weights.front().data();
+            columns.neurons.weights.insert(columns.neurons.weights.end(), weights, weights + MAX_CHANNELS * MAX_CHANNELS);
+            columns.neurons.biases.insert(columns.neurons.biases.end(), neuron.biases.begin(), neuron.biases.end());
+            columns.neurons.activationFunctions.insert(
+                columns.neurons.activationFunctions.end(), neuron.activationFunctions.begin(), neuron.activationFunctions.end());
+        } break;
+        case CellFunction_Transmitter: {
+            auto const& transmitter = std::get<TransmitterDescription>(*cell.cellFunction);
+            columns.transmitters.mode.emplace_back(transmitter.mode);
+        } break;
+        case CellFunction_Constructor: {
+            auto const& constructor = std::get<ConstructorDescription>(*cell.cellFunction);
+            auto& target = columns.constructors;
+            target.activationMode.emplace_back(constructor.activationMode);
+            target.constructionActivationTime.emplace_back(constructor.constructionActivationTime);
+            target.genomeIndex.emplace_back(columns.genomePool.addGenome(constructor.genome.data(), constructor.genome.size()));
+            target.genomeGeneration.emplace_back(constructor.genomeGeneration);
+            target.constructionAngle1.emplace_back(constructor.constructionAngle1);
+            target.constructionAngle2.emplace_back(constructor.constructionAngle2);
+            target.lastConstructedCellId.emplace_back(constructor.lastConstructedCellId);
+            target.genomeCurrentNodeIndex.emplace_back(constructor.genomeCurrentNodeIndex);
+            target.genomeCurrentRepetition.emplace_back(constructor.genomeCurrentRepetition);
+            target.isConstructionBuilt.emplace_back(constructor.isConstructionBuilt ? 1 : 0);
+            target.offspringCreatureId.emplace_back(constructor.offspringCreatureId);
+            target.offspringMutationId.emplace_back(constructor.offspringMutationId);
+        } break;
+        case CellFunction_Sensor: {
+            auto const& sensor = std::get<SensorDescription>(*cell.cellFunction);
+            auto& target = columns.sensors;
+            target.hasFixedAngle.emplace_back(sensor.fixedAngle.has_value() ? 1 : 0);
+            target.fixedAngle.emplace_back(sensor.fixedAngle.value_or(0.0f));
+            target.minDensity.emplace_back(sensor.minDensity);
+            target.color.emplace_back(sensor.color);
+            target.targetedCreatureId.emplace_back(sensor.targetedCreatureId);
+            target.memoryChannel1.emplace_back(sensor.memoryChannel1);
+            target.memoryChannel2.emplace_back(sensor.memoryChannel2);
+            target.memoryChannel3.emplace_back(sensor.memoryChannel3);
+        } break;
+        case CellFunction_Nerve: {
+            auto const& nerve = std::get<NerveDescription>(*cell.cellFunction);
+            columns.nerves.pulseMode.emplace_back(nerve.pulseMode);
+            columns.nerves.alternationMode.emplace_back(nerve.alternationMode);
+        } break;
+        case CellFunction_Attacker: {
+            auto const& attacker = std::get<AttackerDescription>(*cell.cellFunction);
+            columns.attackers.mode.emplace_back(attacker.mode);
+        } break;
+        case CellFunction_Injector: {
+            auto const& injector = std::get<InjectorDescription>(*cell.cellFunction);
+            columns.injectors.mode.emplace_back(injector.mode);
+            columns.injectors.counter.emplace_back(injector.counter);
+            columns.injectors.genomeIndex.emplace_back(columns.genomePool.addGenome(injector.genome.data(), injector.genome.size()));
+            columns.injectors.genomeGeneration.emplace_back(injector.genomeGeneration);
+        } break;
+        case CellFunction_Muscle: {
+            auto const& muscle = std::get<MuscleDescription>(*cell.cellFunction);
+            columns.muscles.mode.emplace_back(muscle.mode);
+            columns.muscles.lastBendingDirection.emplace_back(muscle.lastBendingDirection);
+            columns.muscles.lastBendingSourceIndex.emplace_back(muscle.lastBendingSourceIndex);
+            columns.muscles.consecutiveBendingAngle.emplace_back(muscle.consecutiveBendingAngle);
+        } break;
+        case CellFunction_Defender: {
+            auto const& defender = std::get<DefenderDescription>(*cell.cellFunction);
+            columns.defenders.mode.emplace_back(defender.mode);
+        } break;
+        case CellFunction_Reconnector: {
+            auto const& reconnector = std::get<ReconnectorDescription>(*cell.cellFunction);
+            columns.reconnectors.color.emplace_back(reconnector.color);
+        } break;
+        case CellFunction_Detonator: {
+            auto const& detonator = std::get<DetonatorDescription>(*cell.cellFunction);
+            columns.detonators.state.emplace_back(detonator.state);
+            columns.detonators.countdown.emplace_back(detonator.countdown);
+        } break;
+        }
+    }
+
+    void addCell(ColumnarData& columns, CellDescription const& cell)
+    {
+        auto& target = columns.cells;
+        target.id.emplace_back(cell.id);
+        target.posX.emplace_back(cell.pos.x);
+        target.posY.emplace_back(cell.pos.y);
+        target.velX.emplace_back(cell.vel.x);
+        target.velY.emplace_back(cell.vel.y);
+        target.energy.emplace_back(cell.energy);
+        target.stiffness.emplace_back(cell.stiffness);
+        target.color.emplace_back(cell.color);
+        target.maxConnections.emplace_back(cell.maxConnections);
+        target.numConnections.emplace_back(static_cast<uint8_t>(cell.connections.size()));
+        target.barrier.emplace_back(cell.barrier ? 1 : 0);
+        target.age.emplace_back(cell.age);
+        target.livingState.emplace_back(cell.livingState);
+        target.creatureId.emplace_back(cell.creatureId);
+        target.mutationId.emplace_back(cell.mutationId);
+        target.executionOrderNumber.emplace_back(cell.executionOrderNumber);
+        target.inputExecutionOrderNumber.emplace_back(cell.inputExecutionOrderNumber.value_or(-1));
+        target.outputBlocked.emplace_back(cell.outputBlocked ? 1 : 0);
+        target.cellFunction.emplace_back(cell.getCellFunctionType());
+        target.activity.insert(target.activity.end(), cell.activity.channels.begin(), cell.activity.channels.end());
+        target.activationTime.emplace_back(cell.activationTime);
+        target.genomeNumNodes.emplace_back(cell.genomeNumNodes);
+
+        for (auto const& connection : cell.connections) {
+            columns.connections.cellId.emplace_back(connection.cellId);
+            columns.connections.distance.emplace_back(connection.distance);
+            columns.connections.angleFromPrevious.emplace_back(connection.angleFromPrevious);
+        }
+
+        columns.metadata.nameSize.emplace_back(static_cast<uint32_t>(cell.metadata.name.size()));
+        columns.metadata.descriptionSize.emplace_back(static_cast<uint32_t>(cell.metadata.description.size()));
+        columns.metadata.chars.insert(columns.metadata.chars.end(), cell.metadata.name.begin(), cell.metadata.name.end());
+        columns.metadata.chars.insert(columns.metadata.chars.end(), cell.metadata.description.begin(), cell.metadata.description.end());
+
+        addCellFunction(columns, cell);
+    }
+
+    void addParticle(ParticleColumns& columns, ParticleDescription const& particle)
+    {
+        columns.id.emplace_back(particle.id);
+        columns.posX.emplace_back(particle.pos.x);
+        columns.posY.emplace_back(particle.pos.y);
+        columns.velX.emplace_back(particle.vel.x);
+        columns.velY.emplace_back(particle.vel.y);
+        columns.energy.emplace_back(particle.energy);
+        columns.color.emplace_back(particle.color);
+    }
+
+    void reserveColumns(ColumnarData& columns, ClusteredDataDescription const& data)
+    {
+        size_t numCells = 0;
+        for (auto const& cluster : data.clusters) {
+            numCells += cluster.cells.size();
+        }
+        columns.clusters.numCells.reserve(data.clusters.size());
+        columns.cells.visit([&](auto& column) { column.reserve(numCells); });
+        columns.cells.activity.reserve(numCells * MAX_CHANNELS);
+        columns.metadata.nameSize.reserve(numCells);
+        columns.metadata.descriptionSize.reserve(numCells);
+        columns.particles.visit([&](auto& column) { column.reserve(data.particles.size()); });
+    }
+
+    //position of the next row to be read in each section
+    struct ReadCursors
+    {
+        size_t connection = 0;
+        size_t metadataChar = 0;
+        size_t neuron = 0;
+        size_t transmitter = 0;
+        size_t constructor = 0;
+        size_t sensor = 0;
+        size_t nerve = 0;
+        size_t attacker = 0;
+        size_t injector = 0;
+        size_t muscle = 0;
+        size_t defender = 0;
+        size_t reconnector = 0;
+        size_t detonator = 0;
+    };
+
+    std::vector<uint8_t> getGenome(GenomePoolColumns const& genomePool, std::vector<uint64_t> const& genomeOffsets, uint32_t genomeIndex)
+    {
+        checkData(genomeIndex < genomePool.genomeSize.size());
+        auto offset = genomeOffsets.at(genomeIndex);
+        auto size = genomePool.genomeSize[genomeIndex];
+        return std::vector<uint8_t>(genomePool.bytes.begin() + offset, genomePool.bytes.begin() + offset + size);
+    }
+
+    CellFunctionDescription createCellFunction(
+        ColumnarData const& columns,
+        std::vector<uint64_t> const& genomeOffsets,
+        ReadCursors& cursors,
+        CellFunction cellFunction)
+    {
+        switch (cellFunction) {
+        case CellFunction_Neuron: {
+            auto const& source = columns.neurons;
+            auto index = cursors.neuron++;
+            checkData(
+                hasRow(source.weights, index, MAX_CHANNELS * MAX_CHANNELS) && hasRow(source.biases, index, MAX_CHANNELS)
+                && hasRow(source.activationFunctions, index, MAX_CHANNELS));
+            NeuronDescription neuron;
+            std::memcpy(neuron.weights.data(), &source.weights[index * MAX_CHANNELS * MAX_CHANNELS], sizeof(neuron.weights));
+            std::memcpy(neuron.biases.data(), &source.biases[index * MAX_CHANNELS], sizeof(neuron.biases));
+            std::copy_n(&source.activationFunctions[index * MAX_CHANNELS], MAX_CHANNELS, neuron.activationFunctions.begin());
+            return neuron;
+        }
+        case CellFunction_Transmitter: {
+            auto index = cursors.transmitter++;
+            TransmitterDescription defaultObject;
+            TransmitterDescription transmitter;
+            transmitter.mode = getValue(columns.transmitters.mode, index, defaultObject.mode);
+            return transmitter;
+        }
+        case CellFunction_Constructor: {
+            auto const& source = columns.constructors;
+            auto index = cursors.constructor++;
+            checkData(index < source.genomeIndex.size());
+            ConstructorDescription defaultObject;
+            ConstructorDescription constructor;
+            constructor.activationMode = getValue(source.activationMode, index, defaultObject.activationMode);
+            constructor.constructionActivationTime = getValue(source.constructionActivationTime, index, defaultObject.constructionActivationTime);
+            constructor.genome = getGenome(columns.genomePool, genomeOffsets, source.genomeIndex[index]);
+            constructor.genomeGeneration = getValue(source.genomeGeneration, index, defaultObject.genomeGeneration);
+            constructor.constructionAngle1 = getValue(source.constructionAngle1, index, defaultObject.constructionAngle1);
+            constructor.constructionAngle2 = getValue(source.constructionAngle2, index, defaultObject.constructionAngle2);
+            constructor.lastConstructedCellId = getValue(source.lastConstructedCellId, index, defaultObject.lastConstructedCellId);
+            constructor.genomeCurrentNodeIndex = getValue(source.genomeCurrentNodeIndex, index, defaultObject.genomeCurrentNodeIndex);
+            constructor.genomeCurrentRepetition = getValue(source.genomeCurrentRepetition, index, defaultObject.genomeCurrentRepetition);
+            constructor.isConstructionBuilt = getValue(source.isConstructionBuilt, index, uint8_t(defaultObject.isConstructionBuilt ? 1 : 0)) != 0;
+            constructor.offspringCreatureId = getValue(source.offspringCreatureId, index, defaultObject.offspringCreatureId);
+            constructor.offspringMutationId = getValue(source.offspringMutationId, index, defaultObject.offspringMutationId);
+            return constructor;
+        }
+        case CellFunction_Sensor: {
+            auto const& source = columns.sensors;
+            auto index = cursors.sensor++;
+            SensorDescription defaultObject;
+            SensorDescription sensor;
+            if (getValue(source.hasFixedAngle, index, uint8_t(0)) != 0) {
+                sensor.fixedAngle = getValue(source.fixedAngle, index, 0.0f);
+            }
+            sensor.minDensity = getValue(source.minDensity, index, defaultObject.minDensity);
+            sensor.color = getValue(source.color, index, defaultObject.color);
+            sensor.targetedCreatureId = getValue(source.targetedCreatureId, index, defaultObject.targetedCreatureId);
+            sensor.memoryChannel1 = getValue(source.memoryChannel1, index, defaultObject.memoryChannel1);
+            sensor.memoryChannel2 = getValue(source.memoryChannel2, index, defaultObject.memoryChannel2);
+            sensor.memoryChannel3 = getValue(source.memoryChannel3, index, defaultObject.memoryChannel3);
+            return sensor;
+        }
+        case CellFunction_Nerve: {
+            auto index = cursors.nerve++;
+            NerveDescription defaultObject;
+            NerveDescription nerve;
+            nerve.pulseMode = getValue(columns.nerves.pulseMode, index, defaultObject.pulseMode);
+            nerve.alternationMode = getValue(columns.nerves.alternationMode, index, defaultObject.alternationMode);
+            return nerve;
+        }
+        case CellFunction_Attacker: {
+            auto index = cursors.attacker++;
+            AttackerDescription defaultObject;
+            AttackerDescription attacker;
+            attacker.mode = getValue(columns.attackers.mode, index, defaultObject.mode);
+            return attacker;
+        }
+        case CellFunction_Injector: {
+            auto const& source = columns.injectors;
+            auto index = cursors.injector++;
+            checkData(index < source.genomeIndex.size());
+            InjectorDescription defaultObject;
+            InjectorDescription injector;
+            injector.mode = getValue(source.mode, index, defaultObject.mode);
+            injector.counter = getValue(source.counter, index, defaultObject.counter);
+            injector.genome = getGenome(columns.genomePool, genomeOffsets, source.genomeIndex[index]);
+            injector.genomeGeneration = getValue(source.genomeGeneration, index, defaultObject.genomeGeneration);
+            return injector;
+        }
+        case CellFunction_Muscle: {
+            auto const& source = columns.muscles;
+            auto index = cursors.muscle++;
+            MuscleDescription defaultObject;
+            MuscleDescription muscle;
+            muscle.mode = getValue(source.mode, index, defaultObject.mode);
+            muscle.lastBendingDirection = getValue(source.lastBendingDirection, index, defaultObject.lastBendingDirection);
+            muscle.lastBendingSourceIndex = getValue(source.lastBendingSourceIndex, index, defaultObject.lastBendingSourceIndex);
+            muscle.consecutiveBendingAngle = getValue(source.consecutiveBendingAngle, index, defaultObject.consecutiveBendingAngle);
+            return muscle;
+        }
+        case CellFunction_Defender: {
+            auto index = cursors.defender++;
+            DefenderDescription defaultObject;
+            DefenderDescription defender;
+            defender.mode = getValue(columns.defenders.mode, index, defaultObject.mode);
+            return defender;
+        }
+        case CellFunction_Reconnector: {
+            auto index = cursors.reconnector++;
+            ReconnectorDescription defaultObject;
+            ReconnectorDescription reconnector;
+            reconnector.color = getValue(columns.reconnectors.color, index, defaultObject.color);
+            return reconnector;
+        }
+        case CellFunction_Detonator: {
+            auto index = cursors.detonator++;
+            DetonatorDescription defaultObject;
+            DetonatorDescription detonator;
+            detonator.state = getValue(columns.detonators.state, index, defaultObject.state);
+            detonator.countdown = getValue(columns.detonators.countdown, index, defaultObject.countdown);
+            return detonator;
+        }
+        }
+        return std::nullopt;
+    }
+
+    CellDescription createCell(ColumnarData const& columns, std::vector<uint64_t> const& genomeOffsets, ReadCursors& cursors, size_t index)
+    {
+        auto const& source = columns.cells;
+        CellDescription defaultObject;
+        CellDescription result;
+        result.id = source.id[index];
+        result.pos = {getValue(source.posX, index, 0.0f), getValue(source.posY, index, 0.0f)};
+        result.vel = {getValue(source.velX, index, 0.0f), getValue(source.velY, index, 0.0f)};
+        result.energy = getValue(source.energy, index, defaultObject.energy);
+        result.stiffness = getValue(source.stiffness, index, defaultObject.stiffness);
+        result.color = getValue(source.color, index, defaultObject.color);
+        result.maxConnections = getValue(source.maxConnections, index, defaultObject.maxConnections);
+        result.barrier = getValue(source.barrier, index, uint8_t(0)) != 0;
+        result.age = getValue(source.age, index, defaultObject.age);
+        result.livingState = getValue(source.livingState, index, defaultObject.livingState);
+        result.creatureId = getValue(source.creatureId, index, defaultObject.creatureId);
+        result.mutationId = getValue(source.mutationId, index, defaultObject.mutationId);
+        result.executionOrderNumber = getValue(source.executionOrderNumber, index, defaultObject.executionOrderNumber);
+        auto inputExecutionOrderNumber = getValue(source.inputExecutionOrderNumber, index, -1);
+        result.inputExecutionOrderNumber = inputExecutionOrderNumber >= 0 ? std::make_optional(inputExecutionOrderNumber) : std::nullopt;
+        result.outputBlocked = getValue(source.outputBlocked, index, uint8_t(0)) != 0;
+        if (hasRow(source.activity, index, MAX_CHANNELS)) {
+            auto activityBegin = source.activity.begin() + index * MAX_CHANNELS;
+            result.activity.channels.assign(activityBegin, activityBegin + MAX_CHANNELS);
+        }
+        result.activationTime = getValue(source.activationTime, index, defaultObject.activationTime);
+        result.genomeNumNodes = getValue(source.genomeNumNodes, index, defaultObject.genomeNumNodes);
+
+        auto numConnections = getValue(source.numConnections, index, uint8_t(0));
+        checkData(cursors.connection + numConnections <= columns.connections.cellId.size());
+        result.connections.reserve(numConnections);
+        for (int i = 0; i < numConnections; ++i, ++cursors.connection) {
+            ConnectionDescription connection;
+            connection.cellId = columns.connections.cellId[cursors.connection];
+            connection.distance = getValue(columns.connections.distance, cursors.connection, 0.0f);
+            connection.angleFromPrevious = getValue(columns.connections.angleFromPrevious, cursors.connection, 0.0f);
+            result.connections.emplace_back(connection);
+        }
+
+        auto nameSize = getValue(columns.metadata.nameSize, index, 0u);
+        auto descriptionSize = getValue(columns.metadata.descriptionSize, index, 0u);
+        checkData(cursors.metadataChar + nameSize + descriptionSize <= columns.metadata.chars.size());
+        auto charsBegin = columns.metadata.chars.begin() + cursors.metadataChar;
+        result.metadata.name.assign(charsBegin, charsBegin + nameSize);
+        result.metadata.description.assign(charsBegin + nameSize, charsBegin + nameSize + descriptionSize);
+        cursors.metadataChar += nameSize + descriptionSize;
+
+        auto cellFunction = getValue(source.cellFunction, index, static_cast<int32_t>(CellFunction_None));
+        result.cellFunction = createCellFunction(columns, genomeOffsets, cursors, cellFunction);
+        return result;
+    }
+
+    ParticleDescription createParticle(ParticleColumns const& source, size_t index)
+    {
+        ParticleDescription defaultObject;
+        ParticleDescription result;
+        result.id = source.id[index];
+        result.pos = {getValue(source.posX, index, 0.0f), getValue(source.posY, index, 0.0f)};
+        result.vel = {getValue(source.velX, index, 0.0f), getValue(source.velY, index, 0.0f)};
+        result.energy = getValue(source.energy, index, defaultObject.energy);
+        result.color = getValue(source.color, index, defaultObject.color);
+        return result;
+    }
+
+    //groups connected cells into clusters preserving the order of the cells within each cluster
+    std::vector<ClusterDescription> groupCellsIntoClusters(std::vector<CellDescription>&& cells)
+    {
+        std::unordered_map<uint64_t, size_t> cellIndexById;
+        cellIndexById.reserve(cells.size());
+        for (size_t i = 0; i < cells.size(); ++i) {
+            cellIndexById.emplace(cells[i].id, i);
+        }
+
+        DisjointSets cellSets(cells.size());
+        for (size_t i = 0; i < cells.size(); ++i) {
+            for (auto const& connection : cells[i].connections) {
+                auto findResult = cellIndexById.find(connection.cellId);
+                if (findResult != cellIndexById.end()) {
+                    cellSets.unite(i, findResult->second);
+                }
+            }
+        }
+
+        auto clusterSets = cellSets.getSets();
+        std::vector<ClusterDescription> result(clusterSets.offsets.size() - 1);
+        for (size_t clusterIndex = 0; clusterIndex < result.size(); ++clusterIndex) {
+            auto& clusterCells = result[clusterIndex].cells;
+            clusterCells.reserve(clusterSets.offsets[clusterIndex + 1] - clusterSets.offsets[clusterIndex]);
+            for (auto i = clusterSets.offsets[clusterIndex]; i < clusterSets.offsets[clusterIndex + 1]; ++i) {
+                clusterCells.emplace_back(std::move(cells[clusterSets.elements[i]]));
+            }
+        }
+        return result;
+    }
+
+    template <typename Columns>
+    bool hasRows(Columns& columns, size_t numRows)
+    {
+        auto result = true;
+        columns.visit([&](auto const& column) { result &= column.size() == numRows; });
+        return result;
+    }
+
+    //false if the data was written by an older version which lacks some columns
+    bool hasCompleteColumns(ColumnarData& data)
+    {
+        auto numCells = data.cells.id.size();
+        std::vector<size_t> numCellsByFunction(CellFunction_Count, 0);
+        size_t numConnections = 0;
+        size_t numMetadataChars = 0;
+        auto result = true;
+        data.cells.visit([&](auto const& column) {
+            auto numRows = static_cast<void const*>(&column) == &data.cells.activity ? numCells * MAX_CHANNELS : numCells;
+            result &= column.size() == numRows;
+        });
+        result &= data.metadata.nameSize.size() == numCells && data.metadata.descriptionSize.size() == numCells;
+        if (!result) {
+            return false;
+        }
+        for (size_t i = 0; i < numCells; ++i) {
+            auto cellFunction = data.cells.cellFunction[i];
+            if (cellFunction >= 0 && cellFunction < CellFunction_Count) {
+                ++numCellsByFunction[cellFunction];
+            }
+            numConnections += data.cells.numConnections[i];
+            numMetadataChars += data.metadata.nameSize[i] + data.metadata.descriptionSize[i];
+        }
+        auto const& neurons = data.neurons;
+        auto numNeurons = numCellsByFunction[CellFunction_Neuron];
+        return hasRows(data.connections, numConnections) && data.metadata.chars.size() == numMetadataChars
+            && neurons.weights.size() == numNeurons * MAX_CHANNELS * MAX_CHANNELS && neurons.biases.size() == numNeurons * MAX_CHANNELS
+            && neurons.activationFunctions.size() == numNeurons * MAX_CHANNELS && hasRows(data.transmitters, numCellsByFunction[CellFunction_Transmitter])
+            && hasRows(data.constructors, numCellsByFunction[CellFunction_Constructor]) && hasRows(data.sensors, numCellsByFunction[CellFunction_Sensor])
+            && hasRows(data.nerves, numCellsByFunction[CellFunction_Nerve]) && hasRows(data.attackers, numCellsByFunction[CellFunction_Attacker])
+            && hasRows(data.injectors, numCellsByFunction[CellFunction_Injector]) && hasRows(data.muscles, numCellsByFunction[CellFunction_Muscle])
+            && hasRows(data.defenders, numCellsByFunction[CellFunction_Defender])
+            && hasRows(data.reconnectors, numCellsByFunction[CellFunction_Reconnector])
+            && hasRows(data.detonators, numCellsByFunction[CellFunction_Detonator]) && hasRows(data.particles, data.particles.id.size());
+    }
+
+    void writeHeader(std::ostream& stream)
+    {
+        stream.write(Magic, sizeof(Magic));
+        writeValue(stream, FormatVersion);
+        writeValue<uint8_t>(stream, std::endian::native == std::endian::little ? 1 : 0);
+        writeValue<uint32_t>(stream, static_cast<uint32_t>(Const::ProgramVersion.size()));
+        stream.write(Const::ProgramVersion.data(), Const::ProgramVersion.size());
+    }
+
+    void readHeader(std::istream& stream)
+    {
+        char magic[sizeof(Magic)];
+        stream.read(magic, sizeof(magic));
+        checkData(static_cast<bool>(stream) && std::memcmp(magic, Magic, sizeof(Magic)) == 0);
+
+        uint32_t formatVersion;
+        readValue(stream, formatVersion);
+        if (formatVersion > FormatVersion) {
+            throw std::runtime_error("Format version not supported.");
+        }
+
+        uint8_t littleEndian;
+        readValue(stream, littleEndian);
+        if ((littleEndian != 0) != (std::endian::native == std::endian::little)) {
+            throw std::runtime_error("Byte order not supported.");
+        }
+
+        uint32_t versionSize;
+        readValue(stream, versionSize);
+        checkData(versionSize < 256);
+        std::string version(versionSize, '\0');
+        stream.read(version.data(), versionSize);
+        checkData(static_cast<bool>(stream));
+
+        if (!VersionChecker::isVersionValid(version)) {
+            throw std::runtime_error("No version detected.");
+        }
+        if (VersionChecker::isVersionOutdated(version)) {
+            throw std::runtime_error("Version not supported.");
+        }
+    }
+}
+
+void ColumnarSerializerService::serialize(ClusteredDataDescription const& data, std::ostream& stream)
+{
+    serialize(convertDescriptionToColumnarData(data), stream);
+}
+
+void ColumnarSerializerService::deserialize(ClusteredDataDescription& data, std::istream& stream)
+{
+    ColumnarData columns;
+    deserialize(columns, stream);
+    data = convertColumnarDataToDescription(columns);
+}
+
+void ColumnarSerializerService::serialize(ColumnarData const& data, std::ostream& stream)
+{
+    writeHeader(stream);
+    visitSections(const_cast<ColumnarData&>(data), [&](SectionId id, auto& section) { writeSection(stream, id, section); });
+    writeValue(stream, SectionId::End);
+    writeValue<uint64_t>(stream, 0);
+}
+
+void ColumnarSerializerService::deserialize(ColumnarData& data, std::istream& stream)
+{
+    readHeader(stream);
+
+    data = ColumnarData();
+    while (true) {
+        SectionId id;
+        uint64_t sectionSize;
+        readValue(stream, id);
+        readValue(stream, sectionSize);
+        if (id == SectionId::End) {
+            break;
+        }
+        auto sectionFound = false;
+        visitSections(data, [&](SectionId sectionId, auto& section) {
+            if (sectionId == id) {
+                readSection(stream, sectionSize, section);
+                sectionFound = true;
+            }
+        });
+
+        //skip sections added in later versions
+        if (!sectionFound) {
+            stream.ignore(static_cast<std::streamsize>(sectionSize));
+            checkData(static_cast<bool>(stream));
+        }
+    }
+
+    //fill columns missing in older files with default values
+    if (!hasCompleteColumns(data)) {
+        data = convertDescriptionToColumnarData(convertColumnarDataToDescription(data));
+    }
+}
+
+ColumnarData ColumnarSerializerService::convertDescriptionToColumnarData(ClusteredDataDescription const& data)
+{
+    ColumnarData result;
+    reserveColumns(result, data);
+    for (auto const& cluster : data.clusters) {
+        result.clusters.numCells.emplace_back(static_cast<uint32_t>(cluster.cells.size()));
+        for (auto const& cell : cluster.cells) {
+            addCell(result, cell);
+        }
+    }
+    for (auto const& particle : data.particles) {
+        addParticle(result.particles, particle);
+    }
+    return result;
+}
+
+ClusteredDataDescription ColumnarSerializerService::convertColumnarDataToDescription(ColumnarData const& data)
+{
+    auto genomeOffsets = data.genomePool.calcGenomeOffsets();
+    auto numCells = data.cells.id.size();
+
+    //cell function rows are assigned in the order of the cells
+    std::vector<CellDescription> cells;
+    cells.reserve(numCells);
+    ReadCursors cursors;
+    for (size_t cellIndex = 0; cellIndex < numCells; ++cellIndex) {
+        cells.emplace_back(createCell(data, genomeOffsets, cursors, cellIndex));
+    }
+
+    ClusteredDataDescription result;
+    if (!data.clusters.numCells.empty() || numCells == 0) {
+        auto const& clusterSizes = data.clusters.numCells;
+        uint64_t numClusteredCells = 0;
+        for (auto const& clusterSize : clusterSizes) {
+            numClusteredCells += clusterSize;
+        }
+        checkData(numClusteredCells == numCells);
+
+        result.clusters.reserve(clusterSizes.size());
+        auto cellIter = cells.begin();
+        for (auto const& clusterSize : clusterSizes) {
+            ClusterDescription cluster;
+            cluster.cells.assign(std::make_move_iterator(cellIter), std::make_move_iterator(cellIter + clusterSize));
+            cellIter += clusterSize;
+            result.clusters.emplace_back(std::move(cluster));
+        }
+    } else {
+        result.clusters = groupCellsIntoClusters(std::move(cells));
+    }
+
+    auto numParticles = data.particles.id.size();
+    result.particles.reserve(numParticles);
+    for (size_t i = 0; i < numParticles; ++i) {
+        result.particles.emplace_back(createParticle(data.particles, i));
+    }
+    return result;
+}
+
+bool ColumnarSerializerService::isColumnarFormat(std::istream& stream)
+{
+    return stream.peek() == std::char_traits<char>::to_int_type(Magic[0]);
+}
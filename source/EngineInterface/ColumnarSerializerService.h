@@ -0,0 +1,31 @@
+#pragma once
+
+#include <istream>
+#include <ostream>
+
+#include "ColumnarData.h"
+#include "Definitions.h"
+#include "Descriptions.h"
+
+/**
+ * Flat binary format for the main data of a simulation file.
+ * Cells, particles and cell function payloads are stored as struct-of-arrays sections
+ * behind a small header containing a format version. Each section and column carries its size
+ * so that readers can skip unknown sections and fill missing columns with default values.
+ * Genomes are kept as raw bytes in a pool where identical genomes are stored only once.
+ */
+class ColumnarSerializerService
+{
+public:
+    static void serialize(ClusteredDataDescription const& data, std::ostream& stream);
+    static void deserialize(ClusteredDataDescription& data, std::istream& stream);
+
+    static void serialize(ColumnarData const& data, std::ostream& stream);
+    static void deserialize(ColumnarData& data, std::istream& stream);
+
+    static ColumnarData convertDescriptionToColumnarData(ClusteredDataDescription const& data);
+    static ClusteredDataDescription convertColumnarDataToDescription(ColumnarData const& data);
+
+    //checks the first byte of the stream without consuming it
+    static bool isColumnarFormat(std::istream& stream);
+};
@@ -15,6 +15,8 @@ struct DataDescription;
 struct ClusterDescription;
 struct CellDescription;
 struct ParticleDescription;
+struct ColumnarData;
+struct DeserializedSimulation;
 
 struct GpuSettings;
 
@@ -36,3 +38,11 @@ using ShapeGenerator = std::shared_ptr<_ShapeGenerator>;
 class ShapeGeneratorResult;
 
 class StatisticsHistory;
+
+struct TimestepProfile;
+
+class _ProfilingTimer;
+using ProfilingTimer = std::shared_ptr<_ProfilingTimer>;
+
+class _TimestepProfiler;
+using TimestepProfiler = std::shared_ptr<_TimestepProfiler>;
\ No newline at end of file
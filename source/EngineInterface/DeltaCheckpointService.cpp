@@ -0,0 +1,359 @@
+#include "DeltaCheckpointService.h"
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_map>
+
+#include "ColumnarSerializerService.h"
+
+namespace
+{
+    //the first byte must differ from the first byte of the columnar format
+    char constexpr Magic[] = {'D', 'E', 'L', 'T', 'A', 'C', 'H', 'K'};
+    uint32_t constexpr FormatVersion = 1;
+
+    void checkData(bool condition)
+    {
+        if (!condition) {
+            throw std::runtime_error("Simulation data is corrupt.");
+        }
+    }
+
+    template <typename T>
+    void writeValue(std::ostream& stream, T const& value)
+    {
+        stream.write(reinterpret_cast<char const*>(&value), sizeof(T));
+    }
+
+    template <typename T>
+    void readValue(std::istream& stream, T& value)
+    {
+        stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+        checkData(static_cast<bool>(stream));
+    }
+
+    template <typename T>
+    void writeVector(std::ostream& stream, std::vector<T> const& values)
+    {
+        writeValue<uint64_t>(stream, values.size());
+        if (!values.empty()) {
+            stream.write(reinterpret_cast<char const*>(values.data()), sizeof(T) * values.size());
+        }
+    }
+
+    template <typename T>
+    void readVector(std::istream& stream, std::vector<T>& values)
+    {
+        uint64_t size;
+        readValue(stream, size);
+        values.resize(size);
+        if (size > 0) {
+            stream.read(reinterpret_cast<char*>(values.data()), sizeof(T) * size);
+            checkData(static_cast<bool>(stream));
+        }
+    }
+
+    //order of clusters, cells and particles
+    struct Layout
+    {
+        std::vector<uint32_t> clusterSizes;
+        std::vector<uint64_t> cellIds;
+        std::vector<uint64_t> particleIds;
+
+        bool operator==(Layout const&) const = default;
+    };
+
+    //fields of cells whose structure is unchanged
+    struct MotionColumns
+    {
+        std::vector<uint64_t> id;
+        std::vector<float> posX;
+        std::vector<float> posY;
+        std::vector<float> velX;
+        std::vector<float> velY;
+        std::vector<float> energy;
+        std::vector<int32_t> age;
+        std::vector<float> activity;  //MAX_CHANNELS values per cell
+
+        template <typename Visitor>
+        void visit(Visitor&& visitor)
+        {
+            visitor(id);
+            visitor(posX);
+            visitor(posY);
+            visitor(velX);
+            visitor(velY);
+            visitor(energy);
+            visitor(age);
+            visitor(activity);
+        }
+    };
+
+    //all fields of CellDescription except those in MotionColumns
+    auto getStructuralFields(CellDescription const& cell)
+    {
+        return std::tie(
+            cell.id,
+            cell.connections,
+            cell.stiffness,
+            cell.color,
+            cell.maxConnections,
+            cell.barrier,
+            cell.livingState,
+            cell.creatureId,
+            cell.mutationId,
+            cell.executionOrderNumber,
+            cell.inputExecutionOrderNumber,
+            cell.outputBlocked,
+            cell.cellFunction,
+            cell.activationTime,
+            cell.genomeNumNodes,
+            cell.metadata);
+    }
+
+    Layout getLayout(ClusteredDataDescription const& data)
+    {
+        Layout result;
+        result.clusterSizes.reserve(data.clusters.size());
+        for (auto const& cluster : data.clusters) {
+            result.clusterSizes.emplace_back(static_cast<uint32_t>(cluster.cells.size()));
+            for (auto const& cell : cluster.cells) {
+                result.cellIds.emplace_back(cell.id);
+            }
+        }
+        result.particleIds.reserve(data.particles.size());
+        for (auto const& particle : data.particles) {
+            result.particleIds.emplace_back(particle.id);
+        }
+        return result;
+    }
+
+    template <typename Entity>
+    std::unordered_map<uint64_t, Entity*> getEntitiesById(std::vector<Entity>& entities)
+    {
+        std::unordered_map<uint64_t, Entity*> result;
+        result.reserve(entities.size());
+        for (auto& entity : entities) {
+            if (!result.emplace(entity.id, &entity).second) {
+                throw std::runtime_error("Ids are not unique.");
+            }
+        }
+        return result;
+    }
+
+    std::unordered_map<uint64_t, CellDescription*> getCellsById(ClusteredDataDescription& data)
+    {
+        std::unordered_map<uint64_t, CellDescription*> result;
+        for (auto& cluster : data.clusters) {
+            for (auto& cell : cluster.cells) {
+                if (!result.emplace(cell.id, &cell).second) {
+                    throw std::runtime_error("Ids are not unique.");
+                }
+            }
+        }
+        return result;
+    }
+
+    void addMotion(MotionColumns& motion, CellDescription const& cell)
+    {
+        motion.id.emplace_back(cell.id);
+        motion.posX.emplace_back(cell.pos.x);
+        motion.posY.emplace_back(cell.pos.y);
+        motion.velX.emplace_back(cell.vel.x);
+        motion.velY.emplace_back(cell.vel.y);
+        motion.energy.emplace_back(cell.energy);
+        motion.age.emplace_back(cell.age);
+        motion.activity.insert(motion.activity.end(), cell.activity.channels.begin(), cell.activity.channels.end());
+    }
+
+    void applyMotion(CellDescription& cell, MotionColumns const& motion, size_t index)
+    {
+        cell.pos = {motion.posX[index], motion.posY[index]};
+        cell.vel = {motion.velX[index], motion.velY[index]};
+        cell.energy = motion.energy[index];
+        cell.age = motion.age[index];
+        cell.activity.channels.assign(motion.activity.begin() + index * MAX_CHANNELS, motion.activity.begin() + (index + 1) * MAX_CHANNELS);
+    }
+
+    //replaces entities with the same id and returns the entities which could not be matched
+    template <typename Entity>
+    std::vector<Entity> replaceEntities(std::unordered_map<uint64_t, Entity*> const& entityById, std::vector<Entity>& changedEntities)
+    {
+        std::vector<Entity> result;
+        for (auto& changedEntity : changedEntities) {
+            auto findResult = entityById.find(changedEntity.id);
+            if (findResult != entityById.end()) {
+                *findResult->second = std::move(changedEntity);
+            } else {
+                result.emplace_back(std::move(changedEntity));
+            }
+        }
+        return result;
+    }
+}
+
+void DeltaCheckpointService::serialize(
+    std::string const& baseFilename,
+    ClusteredDataDescription const& base,
+    ClusteredDataDescription const& data,
+    std::ostream& stream)
+{
+    stream.write(Magic, sizeof(Magic));
+    writeValue(stream, FormatVersion);
+    writeValue(stream, static_cast<uint32_t>(baseFilename.size()));
+    stream.write(baseFilename.data(), baseFilename.size());
+
+    auto layout = getLayout(data);
+    auto sameLayout = layout == getLayout(base);
+    writeValue<uint8_t>(stream, sameLayout ? 1 : 0);
+    if (!sameLayout) {
+        writeVector(stream, layout.clusterSizes);
+        writeVector(stream, layout.cellIds);
+        writeVector(stream, layout.particleIds);
+    }
+
+    std::unordered_map<uint64_t, CellDescription const*> baseCellById;
+    for (auto const& cluster : base.clusters) {
+        for (auto const& cell : cluster.cells) {
+            baseCellById.emplace(cell.id, &cell);
+        }
+    }
+    std::unordered_map<uint64_t, ParticleDescription const*> baseParticleById;
+    for (auto const& particle : base.particles) {
+        baseParticleById.emplace(particle.id, &particle);
+    }
+
+    MotionColumns motion;
+    ClusterDescription changedCells;
+    for (auto const& cluster : data.clusters) {
+        for (auto const& cell : cluster.cells) {
+            auto findResult = baseCellById.find(cell.id);
+            if (findResult == baseCellById.end()) {
+                changedCells.cells.emplace_back(cell);
+                continue;
+            }
+            auto const& baseCell = *findResult->second;
+            if (getStructuralFields(cell) != getStructuralFields(baseCell) || cell.activity.channels.size() != MAX_CHANNELS) {
+                changedCells.cells.emplace_back(cell);
+            } else if (cell != baseCell) {
+                addMotion(motion, cell);
+            }
+        }
+    }
+    ClusteredDataDescription changedEntities;
+    if (!changedCells.cells.empty()) {
+        changedEntities.clusters.emplace_back(std::move(changedCells));
+    }
+    for (auto const& particle : data.particles) {
+        auto findResult = baseParticleById.find(particle.id);
+        if (findResult == baseParticleById.end() || *findResult->second != particle) {
+            changedEntities.particles.emplace_back(particle);
+        }
+    }
+
+    motion.visit([&](auto const& column) { writeVector(stream, column); });
+    ColumnarSerializerService::serialize(changedEntities, stream);
+}
+
+bool DeltaCheckpointService::isDeltaFormat(std::istream& stream)
+{
+    return stream.peek() == Magic[0];
+}
+
+std::string DeltaCheckpointService::deserializeBaseFilename(std::istream& stream)
+{
+    char magic[sizeof(Magic)];
+    stream.read(magic, sizeof(magic));
+    checkData(stream && std::equal(std::begin(Magic), std::end(Magic), magic));
+
+    uint32_t version;
+    readValue(stream, version);
+    if (version > FormatVersion) {
+        throw std::runtime_error("Format version not supported.");
+    }
+
+    uint32_t baseFilenameSize;
+    readValue(stream, baseFilenameSize);
+    std::string result(baseFilenameSize, '\0');
+    stream.read(result.data(), baseFilenameSize);
+    checkData(static_cast<bool>(stream));
+    return result;
+}
+
+void DeltaCheckpointService::applyDelta(ClusteredDataDescription& data, std::istream& stream)
+{
+    uint8_t sameLayout;
+    readValue(stream, sameLayout);
+    Layout layout;
+    if (!sameLayout) {
+        readVector(stream, layout.clusterSizes);
+        readVector(stream, layout.cellIds);
+        readVector(stream, layout.particleIds);
+    }
+
+    MotionColumns motion;
+    motion.visit([&](auto& column) { readVector(stream, column); });
+    auto numMotions = motion.id.size();
+    checkData(
+        motion.posX.size() == numMotions && motion.posY.size() == numMotions && motion.velX.size() == numMotions && motion.velY.size() == numMotions
+        && motion.energy.size() == numMotions && motion.age.size() == numMotions && motion.activity.size() == numMotions * MAX_CHANNELS);
+
+    ClusteredDataDescription changedEntities;
+    ColumnarSerializerService::deserialize(changedEntities, stream);
+
+    //update cells and particles contained in the base
+    auto cellById = getCellsById(data);
+    for (size_t index = 0; index < numMotions; ++index) {
+        auto findResult = cellById.find(motion.id[index]);
+        checkData(findResult != cellById.end());
+        applyMotion(*findResult->second, motion, index);
+    }
+    std::vector<CellDescription> changedCells;
+    for (auto& cluster : changedEntities.clusters) {
+        std::move(cluster.cells.begin(), cluster.cells.end(), std::back_inserter(changedCells));
+    }
+    auto addedCells = replaceEntities(cellById, changedCells);
+    auto particleById = getEntitiesById(data.particles);
+    auto addedParticles = replaceEntities(particleById, changedEntities.particles);
+
+    if (sameLayout) {
+        checkData(addedCells.empty() && addedParticles.empty());
+        return;
+    }
+
+    //rebuild clusters and particles in the order of the layout
+    for (auto& cell : addedCells) {
+        checkData(cellById.emplace(cell.id, &cell).second);
+    }
+    auto cellIdIter = layout.cellIds.begin();
+    std::vector<ClusterDescription> clusters(layout.clusterSizes.size());
+    for (size_t clusterIndex = 0; clusterIndex < clusters.size(); ++clusterIndex) {
+        auto& cells = clusters[clusterIndex].cells;
+        cells.reserve(layout.clusterSizes[clusterIndex]);
+        for (uint32_t i = 0; i < layout.clusterSizes[clusterIndex]; ++i) {
+            checkData(cellIdIter != layout.cellIds.end());
+            auto findResult = cellById.find(*cellIdIter++);
+            checkData(findResult != cellById.end());
+            cells.emplace_back(std::move(*findResult->second));
+            cellById.erase(findResult);
+        }
+    }
+    checkData(cellIdIter == layout.cellIds.end());
+
+    for (auto& particle : addedParticles) {
+        checkData(particleById.emplace(particle.id, &particle).second);
+    }
+    std::vector<ParticleDescription> particles;
+    particles.reserve(layout.particleIds.size());
+    for (auto const& particleId : layout.particleIds) {
+        auto findResult = particleById.find(particleId);
+        checkData(findResult != particleById.end());
+        particles.emplace_back(std::move(*findResult->second));
+        particleById.erase(findResult);
+    }
+
+    data.clusters = std::move(clusters);
+    data.particles = std::move(particles);
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <istream>
+#include <ostream>
+#include <string>
+
+#include "Definitions.h"
+#include "Descriptions.h"
+
+/**
+ * Delta checkpoints store the difference between the simulation main data and a base snapshot.
+ * Cells and particles are matched by id. For cells whose structure is unchanged only the motion related fields
+ * are written, changed or added entities are written completely and removed entities by their id.
+ * The cluster layout is only stored if it differs from the base.
+ */
+class DeltaCheckpointService
+{
+public:
+    static void serialize(std::string const& baseFilename, ClusteredDataDescription const& base, ClusteredDataDescription const& data, std::ostream& stream);
+
+    static bool isDeltaFormat(std::istream& stream);
+
+    //reads the header of a delta checkpoint and returns the file name of the base as passed to serialize()
+    static std::string deserializeBaseFilename(std::istream& stream);
+
+    //expects the base in data and applies the rest of the delta checkpoint on it
+    static void applyDelta(ClusteredDataDescription& data, std::istream& stream);
+};
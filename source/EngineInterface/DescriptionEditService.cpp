@@ -8,7 +8,7 @@
 #include "Base/Math.h"
 #include "GenomeDescriptions.h"
 #include "SpaceCalculator.h"
-#include "GenomeDescriptionService.h"
+#include "GenomeView.h"
 
 DataDescription DescriptionEditService::createRect(CreateRectParameters const& parameters)
 {
@@ -428,16 +428,24 @@ void DescriptionEditService::randomizeCellColors(ClusteredDataDescription& data,
 
 namespace
 {
-    void colorizeGenomeNodes(std::vector<uint8_t>& genome, int color)
+    //the views of sub-genomes refer to the bytes of genome, hence node addresses can be translated to positions in genome
+    void colorizeGenomeNodes(std::vector<uint8_t>& genome, GenomeView const& view, int color)
     {
-        auto desc = GenomeDescriptionService::convertBytesToDescription(genome);
-        for (auto& node : desc.cells) {
-            node.color = color;
-            if (node.hasGenome()) {
-                colorizeGenomeNodes(node.getGenomeRef(), color);
+        auto offset = view.getBytes().data() - genome.data();
+        for (auto const& node : view) {
+            auto colorPos = offset + node.getAddress() + Const::CellColorPos;
+            if (colorPos < toInt(genome.size())) {
+                genome[colorPos] = static_cast<uint8_t>(color);
+            }
+            if (node.hasGenome() && !node.isMakeGenomeCopy()) {
+                colorizeGenomeNodes(genome, node.getSubGenome(), color);
             }
         }
-        genome = GenomeDescriptionService::convertDescriptionToBytes(desc);
+    }
+
+    void colorizeGenomeNodes(std::vector<uint8_t>& genome, int color)
+    {
+        colorizeGenomeNodes(genome, GenomeView(genome), color);
     }
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <variant>
 
 #include "Base/Definitions.h"
@@ -69,16 +70,10 @@ struct ActivityDescription
 
 struct NeuronDescription
 {
-    std::vector<std::vector<float>> weights;
-    std::vector<float> biases;
-    std::vector<NeuronActivationFunction> activationFunctions;
+    std::array<std::array<float, MAX_CHANNELS>, MAX_CHANNELS> weights = {};  //weights[output channel][input channel], same layout as NeuronFunction::NeuronState
+    std::array<float, MAX_CHANNELS> biases = {};
+    std::array<NeuronActivationFunction, MAX_CHANNELS> activationFunctions = {};
 
-    NeuronDescription()
-    {
-        weights.resize(MAX_CHANNELS, std::vector<float>(MAX_CHANNELS, 0));
-        biases.resize(MAX_CHANNELS, 0);
-        activationFunctions.resize(MAX_CHANNELS, 0);
-    }
     auto operator<=>(NeuronDescription const&) const = default;
 };
 
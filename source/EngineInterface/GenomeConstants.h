@@ -16,8 +16,10 @@ namespace Const
     auto constexpr GenomeHeaderConcatenationAngle2Pos = 8;
 
     auto constexpr CellAnglePos = 1;
+    auto constexpr CellEnergyPos = 2;
     auto constexpr CellRequiredConnectionsPos = 3;
     auto constexpr CellColorPos = 5;
+    auto constexpr CellOutputBlockedPos = 7;
 
     auto constexpr ConstructorConstructionAngle1Pos = 3;
     auto constexpr ConstructorConstructionAngle2Pos = 4;
@@ -69,7 +69,7 @@ namespace
         }
     }
 
-    uint8_t readByte(std::vector<uint8_t> const& data, int& pos)
+    uint8_t readByte(std::span<uint8_t const> data, int& pos)
     {
         if (pos >= data.size()) {
             return 0;
@@ -77,77 +77,45 @@ namespace
         uint8_t result = data[pos++];
         return result;
     }
-    std::optional<int> readOptionalByte(std::vector<uint8_t> const& data, int& pos, int moduloValue)
+    std::optional<int> readOptionalByte(std::span<uint8_t const> data, int& pos, int moduloValue)
     {
         auto value = static_cast<int>(readByte(data, pos));
         return value > 127 ? std::nullopt : std::make_optional(value % moduloValue);
     }
-
-    int convertByteToByteWithInfinity(uint8_t const& b)
+    int readWord(std::span<uint8_t const> data, int& pos)
     {
-        return b == 255 ? std::numeric_limits<int>::max() : b;
-
+        auto b1 = readByte(data, pos);
+        auto b2 = readByte(data, pos);
+        return GenomeView::convertBytesToWord(b1, b2);
     }
-    int readByteWithInfinity(std::vector<uint8_t> const& data, int& pos)
+    float readAngle(std::span<uint8_t const> data, int& pos)
     {
-        return convertByteToByteWithInfinity(readByte(data, pos));
+        return GenomeView::convertByteToAngle(readByte(data, pos));
     }
-    bool readBool(std::vector<uint8_t> const& data, int& pos)
+    float readEnergy(std::span<uint8_t const> data, int& pos)
     {
-        return static_cast<int8_t>(readByte(data, pos)) > 0;
+        return GenomeView::convertByteToEnergy(readByte(data, pos));
     }
-    int readWord(std::vector<uint8_t> const& data, int& pos)
+    float readDensity(std::span<uint8_t const> data, int& pos)
     {
-        return static_cast<int>(readByte(data, pos)) | (static_cast<int>(readByte(data, pos) << 8));
+        return GenomeView::convertByteToDensity(readByte(data, pos));
     }
-    //between -1 and 1
-    float readFloat(std::vector<uint8_t> const& data, int& pos)
+    float readNeuronProperty(std::span<uint8_t const> data, int& pos)
     {
-        return static_cast<float>(static_cast<int8_t>(readByte(data, pos))) / 128;
+        return GenomeView::convertByteToNeuronProperty(readByte(data, pos));
     }
-    //between -180 and 180
-    float readAngle(std::vector<uint8_t> const& data, int& pos)
+    bool readBool(std::span<uint8_t const> data, int& pos)
     {
-        return static_cast<float>(static_cast<int8_t>(readByte(data, pos))) / 120 * 180;
-    }
-    //between 36 and 1060
-    float readEnergy(std::vector<uint8_t> const& data, int& pos)
-    {
-        return readFloat(data, pos) * 512 + 548.0f; 
-    }
-    //between 0 and 1
-    float readDensity(std::vector<uint8_t> const& data, int& pos)
-    {
-        return (readFloat(data, pos) + 1.0f) / 2;
-    }
-    float readNeuronProperty(std::vector<uint8_t> const& data, int& pos) { return readFloat(data, pos) * 4; }
-    float readDistance(std::vector<uint8_t> const& data, int& pos)
-    {
-        return toFloat(readByte(data, pos)) / 255 + 0.5f;
-    }
-    float readStiffness(std::vector<uint8_t> const& data, int& pos)
-    {
-        return toFloat(readByte(data, pos)) / 255;
+        return GenomeView::convertByteToBool(readByte(data, pos));
     }
 
-    std::variant<MakeGenomeCopy, std::vector<uint8_t>> readGenome(std::vector<uint8_t> const& data, int& pos)
+    std::variant<MakeGenomeCopy, std::vector<uint8_t>> readGenome(GenomeNodeView const& node)
     {
-        std::variant<MakeGenomeCopy, std::vector<uint8_t>> result;
-
-        bool makeGenomeCopy = readBool(data, pos);
-        if (makeGenomeCopy) {
-            result = MakeGenomeCopy();
-        } else {
-            auto size = readWord(data, pos);
-            size = std::min(size, toInt(data.size()) - pos);
-            std::vector<uint8_t> copiedGenome;
-            copiedGenome.reserve(size);
-            for (int i = 0; i < size; ++i) {
-                copiedGenome.emplace_back(readByte(data, pos));
-            }
-            result = copiedGenome;
+        if (node.isMakeGenomeCopy()) {
+            return MakeGenomeCopy();
         }
-        return result;
+        auto subGenome = node.getSubGenome().getBytes();
+        return std::vector<uint8_t>(subGenome.begin(), subGenome.end());
     }
 }
 
@@ -250,173 +218,141 @@ std::vector<uint8_t> GenomeDescriptionService::convertDescriptionToBytes(GenomeD
     return result;
 }
 
-namespace
+GenomeDescription GenomeDescriptionService::convertBytesToDescription(std::vector<uint8_t> const& data, GenomeEncodingSpecification const& spec)
 {
-    struct ConversionResult
-    {
-        GenomeDescription genome;
-        int lastBytePosition = 0;
-    };
-    
-    ConversionResult convertBytesToDescriptionIntern(
-        std::vector<uint8_t> const& data,
-        size_t maxBytePosition,
-        size_t maxEntries,
-        GenomeEncodingSpecification const& spec)
-    {
-        SimulationParameters parameters;
-        ConversionResult result;
+    static auto const numExecutionOrderNumbers = SimulationParameters().cellNumExecutionOrderNumbers;
 
-        int nodeIndex = 0;
-        auto& bytePosition = result.lastBytePosition;
+    GenomeView view(data, spec);
+    GenomeDescription result;
+    result.header.shape = view.getShape();
+    result.header.singleConstruction = view.isSingleConstruction();
+    result.header.separateConstruction = view.isSeparateConstruction();
+    result.header.angleAlignment = view.getAngleAlignment();
+    result.header.stiffness = view.getStiffness();
+    result.header.connectionDistance = view.getConnectionDistance();
+    if (spec._numRepetitions) {
+        result.header.numRepetitions = view.getNumRepetitions();
+    }
+    if (spec._concatenationAngle1) {
+        result.header.concatenationAngle1 = view.getConcatenationAngle1();
+    }
+    if (spec._concatenationAngle2) {
+        result.header.concatenationAngle2 = view.getConcatenationAngle2();
+    }
 
-        result.genome.header.shape = readByte(data, bytePosition) % ConstructionShape_Count;
-        result.genome.header.singleConstruction = readBool(data, bytePosition);
-        result.genome.header.separateConstruction = readBool(data, bytePosition);
-        result.genome.header.angleAlignment = readByte(data, bytePosition) % ConstructorAngleAlignment_Count;
-        result.genome.header.stiffness = readStiffness(data, bytePosition);
-        result.genome.header.connectionDistance = readDistance(data, bytePosition);
-        if (spec._numRepetitions) {
-            result.genome.header.numRepetitions = readByteWithInfinity(data, bytePosition);
-        }
-        if (spec._concatenationAngle1) {
-            result.genome.header.concatenationAngle1 = readAngle(data, bytePosition);
-        }
-        if (spec._concatenationAngle2) {
-            result.genome.header.concatenationAngle2 = readAngle(data, bytePosition);
-        }
-        
-        while (bytePosition < maxBytePosition && nodeIndex < maxEntries) {
-            CellFunction cellFunction = readByte(data, bytePosition) % CellFunction_Count;
+    result.cells.reserve(view.getNumNodes());
+    for (auto const& node : view) {
+        auto bytePosition = node.getAddress() + 1;
 
-            CellGenomeDescription cell;
-            cell.referenceAngle = readAngle(data, bytePosition);
-            cell.energy = readEnergy(data, bytePosition);
-            cell.numRequiredAdditionalConnections = readOptionalByte(data, bytePosition, MAX_CELL_BONDS + 1);
-            cell.executionOrderNumber = readByte(data, bytePosition) % parameters.cellNumExecutionOrderNumbers;
-            cell.color = readByte(data, bytePosition) % MAX_COLORS;
-            cell.inputExecutionOrderNumber = readOptionalByte(data, bytePosition, parameters.cellNumExecutionOrderNumbers);
-            cell.outputBlocked = readBool(data, bytePosition);
+        CellGenomeDescription cell;
+        cell.referenceAngle = readAngle(data, bytePosition);
+        cell.energy = readEnergy(data, bytePosition);
+        cell.numRequiredAdditionalConnections = readOptionalByte(data, bytePosition, MAX_CELL_BONDS + 1);
+        cell.executionOrderNumber = readByte(data, bytePosition) % numExecutionOrderNumbers;
+        cell.color = readByte(data, bytePosition) % MAX_COLORS;
+        cell.inputExecutionOrderNumber = readOptionalByte(data, bytePosition, numExecutionOrderNumbers);
+        cell.outputBlocked = readBool(data, bytePosition);
 
-            switch (cellFunction) {
-            case CellFunction_Neuron: {
-                NeuronGenomeDescription neuron;
-                for (int row = 0; row < MAX_CHANNELS; ++row) {
-                    for (int col = 0; col < MAX_CHANNELS; ++col) {
-                        neuron.weights[row][col] = readNeuronProperty(data, bytePosition);
-                    }
-                }
-                for (int i = 0; i < MAX_CHANNELS; ++i) {
-                    neuron.biases[i] = readNeuronProperty(data, bytePosition);
-                }
-                for (int i = 0; i < MAX_CHANNELS; ++i) {
-                    neuron.activationFunctions[i] = readByte(data, bytePosition) % NeuronActivationFunction_Count;
-                }
-                cell.cellFunction = neuron;
-            } break;
-            case CellFunction_Transmitter: {
-                TransmitterGenomeDescription transmitter;
-                transmitter.mode = readByte(data, bytePosition) % EnergyDistributionMode_Count;
-                cell.cellFunction = transmitter;
-            } break;
-            case CellFunction_Constructor: {
-                ConstructorGenomeDescription constructor;
-                constructor.mode = readByte(data, bytePosition);
-                constructor.constructionActivationTime = readWord(data, bytePosition);
-                constructor.constructionAngle1 = readAngle(data, bytePosition);
-                constructor.constructionAngle2 = readAngle(data, bytePosition);
-                constructor.genome = readGenome(data, bytePosition);
-                cell.cellFunction = constructor;
-            } break;
-            case CellFunction_Sensor: {
-                SensorGenomeDescription sensor;
-                auto mode = readByte(data, bytePosition) % SensorMode_Count;
-                auto angle = readAngle(data, bytePosition);
-                if (mode == SensorMode_FixedAngle) {
-                    sensor.fixedAngle = angle;
+        switch (node.getCellFunctionType()) {
+        case CellFunction_Neuron: {
+            NeuronGenomeDescription neuron;
+            for (int row = 0; row < MAX_CHANNELS; ++row) {
+                for (int col = 0; col < MAX_CHANNELS; ++col) {
+                    neuron.weights[row][col] = readNeuronProperty(data, bytePosition);
                 }
-                sensor.minDensity = readDensity(data, bytePosition);
-                sensor.color = readByte(data, bytePosition) % MAX_COLORS;
-                cell.cellFunction = sensor;
-            } break;
-            case CellFunction_Nerve: {
-                NerveGenomeDescription nerve;
-                nerve.pulseMode = readByte(data, bytePosition);
-                nerve.alternationMode = readByte(data, bytePosition);
-                cell.cellFunction = nerve;
-            } break;
-            case CellFunction_Attacker: {
-                AttackerGenomeDescription attacker;
-                attacker.mode = readByte(data, bytePosition) % EnergyDistributionMode_Count;
-                cell.cellFunction = attacker;
-            } break;
-            case CellFunction_Injector: {
-                InjectorGenomeDescription injector;
-                injector.mode = readByte(data, bytePosition) % InjectorMode_Count;
-                injector.genome = readGenome(data, bytePosition);
-                cell.cellFunction = injector;
-            } break;
-            case CellFunction_Muscle: {
-                MuscleGenomeDescription muscle;
-                muscle.mode = readByte(data, bytePosition) % MuscleMode_Count;
-                cell.cellFunction = muscle;
-            } break;
-            case CellFunction_Defender: {
-                DefenderGenomeDescription defender;
-                defender.mode = readByte(data, bytePosition) % DefenderMode_Count;
-                cell.cellFunction = defender;
-            } break;
-            case CellFunction_Reconnector: {
-                ReconnectorGenomeDescription reconnector;
-                reconnector.color = readByte(data, bytePosition) % MAX_COLORS;
-                cell.cellFunction = reconnector;
-            } break;
-            case CellFunction_Detonator: {
-                DetonatorGenomeDescription detonator;
-                detonator.countdown = readWord(data, bytePosition);
-                cell.cellFunction = detonator;
-            } break;
             }
-            result.genome.cells.emplace_back(cell);
-            ++nodeIndex;
+            for (int i = 0; i < MAX_CHANNELS; ++i) {
+                neuron.biases[i] = readNeuronProperty(data, bytePosition);
+            }
+            for (int i = 0; i < MAX_CHANNELS; ++i) {
+                neuron.activationFunctions[i] = readByte(data, bytePosition) % NeuronActivationFunction_Count;
+            }
+            cell.cellFunction = neuron;
+        } break;
+        case CellFunction_Transmitter: {
+            TransmitterGenomeDescription transmitter;
+            transmitter.mode = readByte(data, bytePosition) % EnergyDistributionMode_Count;
+            cell.cellFunction = transmitter;
+        } break;
+        case CellFunction_Constructor: {
+            ConstructorGenomeDescription constructor;
+            constructor.mode = readByte(data, bytePosition);
+            constructor.constructionActivationTime = readWord(data, bytePosition);
+            constructor.constructionAngle1 = readAngle(data, bytePosition);
+            constructor.constructionAngle2 = readAngle(data, bytePosition);
+            constructor.genome = readGenome(node);
+            cell.cellFunction = constructor;
+        } break;
+        case CellFunction_Sensor: {
+            SensorGenomeDescription sensor;
+            auto mode = readByte(data, bytePosition) % SensorMode_Count;
+            auto angle = readAngle(data, bytePosition);
+            if (mode == SensorMode_FixedAngle) {
+                sensor.fixedAngle = angle;
+            }
+            sensor.minDensity = readDensity(data, bytePosition);
+            sensor.color = readByte(data, bytePosition) % MAX_COLORS;
+            cell.cellFunction = sensor;
+        } break;
+        case CellFunction_Nerve: {
+            NerveGenomeDescription nerve;
+            nerve.pulseMode = readByte(data, bytePosition);
+            nerve.alternationMode = readByte(data, bytePosition);
+            cell.cellFunction = nerve;
+        } break;
+        case CellFunction_Attacker: {
+            AttackerGenomeDescription attacker;
+            attacker.mode = readByte(data, bytePosition) % EnergyDistributionMode_Count;
+            cell.cellFunction = attacker;
+        } break;
+        case CellFunction_Injector: {
+            InjectorGenomeDescription injector;
+            injector.mode = readByte(data, bytePosition) % InjectorMode_Count;
+            injector.genome = readGenome(node);
+            cell.cellFunction = injector;
+        } break;
+        case CellFunction_Muscle: {
+            MuscleGenomeDescription muscle;
+            muscle.mode = readByte(data, bytePosition) % MuscleMode_Count;
+            cell.cellFunction = muscle;
+        } break;
+        case CellFunction_Defender: {
+            DefenderGenomeDescription defender;
+            defender.mode = readByte(data, bytePosition) % DefenderMode_Count;
+            cell.cellFunction = defender;
+        } break;
+        case CellFunction_Reconnector: {
+            ReconnectorGenomeDescription reconnector;
+            reconnector.color = readByte(data, bytePosition) % MAX_COLORS;
+            cell.cellFunction = reconnector;
+        } break;
+        case CellFunction_Detonator: {
+            DetonatorGenomeDescription detonator;
+            detonator.countdown = readWord(data, bytePosition);
+            cell.cellFunction = detonator;
+        } break;
         }
-        return result;
+        result.cells.emplace_back(cell);
     }
-
-}
-
-GenomeDescription GenomeDescriptionService::convertBytesToDescription(std::vector<uint8_t> const& data, GenomeEncodingSpecification const& spec)
-{
-    return convertBytesToDescriptionIntern(data, data.size(), data.size(), spec).genome;
+    return result;
 }
 
 int GenomeDescriptionService::convertNodeAddressToNodeIndex(std::vector<uint8_t> const& data, int nodeAddress, GenomeEncodingSpecification const& spec)
 {
-    //wasteful approach but sufficient for GUI
-    return convertBytesToDescriptionIntern(data, nodeAddress, data.size(), spec).genome.cells.size();
+    return GenomeView(data, spec).getNodeIndex(nodeAddress);
 }
 
 int GenomeDescriptionService::convertNodeIndexToNodeAddress(std::vector<uint8_t> const& data, int nodeIndex, GenomeEncodingSpecification const& spec)
 {
-    //wasteful approach but sufficient for GUI
-    return convertBytesToDescriptionIntern(data, data.size(), nodeIndex, spec).lastBytePosition;
+    return GenomeView(data, spec).getNodeAddress(nodeIndex);
 }
 
 int GenomeDescriptionService::getNumNodesRecursively(std::vector<uint8_t> const& data, bool includeRepetitions, GenomeEncodingSpecification const& spec)
 {
-    auto genome = convertBytesToDescriptionIntern(data, data.size(), data.size(), spec).genome;
-    auto result = toInt(genome.cells.size());
-    for (auto const& node : genome.cells) {
-        if (auto subgenome = node.getGenome()) {
-            result += getNumNodesRecursively(*subgenome, includeRepetitions, spec);
-        }
-    }
-
-    auto numRepetitions = genome.header.numRepetitions == std::numeric_limits<int>::max() ? 1 : genome.header.numRepetitions;
-    return includeRepetitions ? result * numRepetitions : result;
+    return GenomeView(data, spec).getNumNodesRecursively(includeRepetitions);
 }
 
 int GenomeDescriptionService::getNumRepetitions(std::vector<uint8_t> const& data)
 {
-    return convertByteToByteWithInfinity(data.at(Const::GenomeHeaderNumRepetitionsPos));
+    return GenomeView::convertByteToByteWithInfinity(data.at(Const::GenomeHeaderNumRepetitionsPos));
 }
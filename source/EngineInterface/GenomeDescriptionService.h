@@ -3,15 +3,9 @@
 #include <vector>
 
 #include "GenomeDescriptions.h"
+#include "GenomeView.h"
 #include "SimulationParameters.h"
 
-struct GenomeEncodingSpecification
-{
-    MEMBER_DECLARATION(GenomeEncodingSpecification, bool, numRepetitions, true);
-    MEMBER_DECLARATION(GenomeEncodingSpecification, bool, concatenationAngle1, true);
-    MEMBER_DECLARATION(GenomeEncodingSpecification, bool, concatenationAngle2, true);
-};
-
 class GenomeDescriptionService
 {
 public:
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <cstdint>
 #include <vector>
 #include <optional>
@@ -17,16 +18,10 @@ struct MakeGenomeCopy
 
 struct NeuronGenomeDescription
 {
-    std::vector<std::vector<float>> weights;
-    std::vector<float> biases;
-    std::vector<NeuronActivationFunction> activationFunctions;
+    std::array<std::array<float, MAX_CHANNELS>, MAX_CHANNELS> weights = {};  //weights[output channel][input channel]
+    std::array<float, MAX_CHANNELS> biases = {};
+    std::array<NeuronActivationFunction, MAX_CHANNELS> activationFunctions = {};
 
-    NeuronGenomeDescription()
-    {
-        weights.resize(MAX_CHANNELS, std::vector<float>(MAX_CHANNELS, 0));
-        biases.resize(MAX_CHANNELS, 0);
-        activationFunctions.resize(MAX_CHANNELS, 0);
-    }
     auto operator<=>(NeuronGenomeDescription const&) const = default;
 };
 
@@ -0,0 +1,473 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <span>
+
+#include "Base/Definitions.h"
+
+#include "CellFunctionConstants.h"
+#include "EngineConstants.h"
+#include "GenomeConstants.h"
+
+struct GenomeEncodingSpecification
+{
+    MEMBER_DECLARATION(GenomeEncodingSpecification, bool, numRepetitions, true);
+    MEMBER_DECLARATION(GenomeEncodingSpecification, bool, concatenationAngle1, true);
+    MEMBER_DECLARATION(GenomeEncodingSpecification, bool, concatenationAngle2, true);
+};
+
+class GenomeView;
+
+//read-only access to a single node of an encoded genome
+//addresses are relative to the genome the node belongs to
+class GenomeNodeView
+{
+public:
+    GenomeNodeView(std::span<uint8_t const> genome, int address, GenomeEncodingSpecification const& spec);
+
+    int getAddress() const;
+    int getSize() const;  //including cell function data and sub-genome, clamped to the genome size
+    CellFunction getCellFunctionType() const;
+    float getReferenceAngle() const;
+    float getEnergy() const;
+    int getColor() const;
+    bool isOutputBlocked() const;
+
+    //sub-genome (only for constructors and injectors)
+    bool hasGenome() const;
+    bool isMakeGenomeCopy() const;  //prerequisite: hasGenome()
+    GenomeView getSubGenome() const;  //prerequisites: hasGenome() and !isMakeGenomeCopy()
+
+private:
+    int getGenomeAddress() const;
+    int getSubGenomeSize() const;
+    uint8_t readByte(int address) const;
+
+    std::span<uint8_t const> _genome;
+    int _address = 0;
+    GenomeEncodingSpecification _spec;
+};
+
+//read-only view on the bytes of an encoded genome for walking header, nodes and sub-genomes without decoding them
+//host counterpart of GenomeDecoder; the viewed bytes must outlive the view
+class GenomeView
+{
+public:
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = GenomeNodeView;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = GenomeNodeView;
+
+        Iterator() = default;
+        Iterator(std::span<uint8_t const> genome, int address, GenomeEncodingSpecification const& spec);
+
+        GenomeNodeView operator*() const;
+        Iterator& operator++();
+        Iterator operator++(int);
+        bool operator==(Iterator const& other) const;
+
+    private:
+        std::span<uint8_t const> _genome;
+        int _address = 0;
+        GenomeEncodingSpecification _spec;
+    };
+
+    GenomeView(std::span<uint8_t const> genome, GenomeEncodingSpecification const& spec = GenomeEncodingSpecification());
+
+    std::span<uint8_t const> getBytes() const;
+
+    //header
+    int getHeaderSize() const;
+    ConstructionShape getShape() const;
+    bool isSingleConstruction() const;
+    bool isSeparateConstruction() const;
+    ConstructorAngleAlignment getAngleAlignment() const;
+    float getStiffness() const;
+    float getConnectionDistance() const;
+    int getNumRepetitions(bool countInfinityAsOne = false) const;  //std::numeric_limits<int>::max() for infinity
+    float getConcatenationAngle1() const;
+    float getConcatenationAngle2() const;
+
+    //nodes
+    Iterator begin() const;
+    Iterator end() const;
+    int getNumNodes() const;
+    int getNodeIndex(int nodeAddress) const;  //number of nodes starting before nodeAddress
+    int getNodeAddress(int nodeIndex) const;  //returns genome size if nodeIndex exceeds the number of nodes
+
+    //func(int depth, GenomeNodeView const& node, int repetitions) is called for all nodes including those of sub-genomes,
+    //repetitions = product of the number of repetitions of the node's genome and all enclosing genomes (infinity counts as one)
+    template <typename Func>
+    void executeForEachNodeRecursively(Func const& func) const;
+    int getNumNodesRecursively(bool includeRepetitions) const;
+
+    //conversion methods
+    static bool convertByteToBool(uint8_t b);
+    static int convertBytesToWord(uint8_t b1, uint8_t b2);
+    static int convertByteToByteWithInfinity(uint8_t b);
+    static float convertByteToFloat(uint8_t b);  //between -1 and 1
+    static float convertByteToAngle(uint8_t b);  //between -180 and 180
+    static float convertByteToEnergy(uint8_t b);  //between 36 and 1060
+    static float convertByteToDensity(uint8_t b);  //between 0 and 1
+    static float convertByteToNeuronProperty(uint8_t b);
+    static float convertByteToDistance(uint8_t b);
+    static float convertByteToStiffness(uint8_t b);
+
+private:
+    template <typename Func>
+    void executeForEachNodeRecursivelyIntern(Func const& func, int depth, int repetitions) const;
+    uint8_t readByte(int address) const;
+    int getHeaderPos(int pos) const;
+
+    std::span<uint8_t const> _genome;
+    GenomeEncodingSpecification _spec;
+};
+
+/************************************************************************/
+/* Implementation                                                       */
+/************************************************************************/
+
+inline GenomeNodeView::GenomeNodeView(std::span<uint8_t const> genome, int address, GenomeEncodingSpecification const& spec)
+    : _genome(genome)
+    , _address(address)
+    , _spec(spec)
+{}
+
+inline int GenomeNodeView::getAddress() const
+{
+    return _address;
+}
+
+inline int GenomeNodeView::getSize() const
+{
+    auto result = Const::CellBasicBytes;
+    switch (getCellFunctionType()) {
+    case CellFunction_Neuron:
+        result += Const::NeuronBytes;
+        break;
+    case CellFunction_Transmitter:
+        result += Const::TransmitterBytes;
+        break;
+    case CellFunction_Constructor:
+        result += Const::ConstructorFixedBytes + 1;
+        break;
+    case CellFunction_Sensor:
+        result += Const::SensorBytes;
+        break;
+    case CellFunction_Nerve:
+        result += Const::NerveBytes;
+        break;
+    case CellFunction_Attacker:
+        result += Const::AttackerBytes;
+        break;
+    case CellFunction_Injector:
+        result += Const::InjectorFixedBytes + 1;
+        break;
+    case CellFunction_Muscle:
+        result += Const::MuscleBytes;
+        break;
+    case CellFunction_Defender:
+        result += Const::DefenderBytes;
+        break;
+    case CellFunction_Reconnector:
+        result += Const::ReconnectorBytes;
+        break;
+    case CellFunction_Detonator:
+        result += Const::DetonatorBytes;
+        break;
+    }
+    if (hasGenome() && !isMakeGenomeCopy()) {
+        result += 2 + getSubGenomeSize();
+    }
+    return std::min(result, toInt(_genome.size()) - _address);
+}
+
+inline CellFunction GenomeNodeView::getCellFunctionType() const
+{
+    return readByte(_address) % CellFunction_Count;
+}
+
+inline float GenomeNodeView::getReferenceAngle() const
+{
+    return GenomeView::convertByteToAngle(readByte(_address + Const::CellAnglePos));
+}
+
+inline float GenomeNodeView::getEnergy() const
+{
+    return GenomeView::convertByteToEnergy(readByte(_address + Const::CellEnergyPos));
+}
+
+inline int GenomeNodeView::getColor() const
+{
+    return readByte(_address + Const::CellColorPos) % MAX_COLORS;
+}
+
+inline bool GenomeNodeView::isOutputBlocked() const
+{
+    return GenomeView::convertByteToBool(readByte(_address + Const::CellOutputBlockedPos));
+}
+
+inline bool GenomeNodeView::hasGenome() const
+{
+    auto cellFunction = getCellFunctionType();
+    return cellFunction == CellFunction_Constructor || cellFunction == CellFunction_Injector;
+}
+
+inline bool GenomeNodeView::isMakeGenomeCopy() const
+{
+    return GenomeView::convertByteToBool(readByte(getGenomeAddress()));
+}
+
+inline GenomeView GenomeNodeView::getSubGenome() const
+{
+    auto subGenomeAddress = std::min(getGenomeAddress() + 3, toInt(_genome.size()));
+    return GenomeView(_genome.subspan(subGenomeAddress, getSubGenomeSize()), _spec);
+}
+
+inline int GenomeNodeView::getGenomeAddress() const
+{
+    auto fixedBytes = getCellFunctionType() == CellFunction_Constructor ? Const::ConstructorFixedBytes : Const::InjectorFixedBytes;
+    return _address + Const::CellBasicBytes + fixedBytes;
+}
+
+inline int GenomeNodeView::getSubGenomeSize() const
+{
+    auto genomeAddress = getGenomeAddress();
+    auto size = GenomeView::convertBytesToWord(readByte(genomeAddress + 1), readByte(genomeAddress + 2));
+    return std::max(0, std::min(size, toInt(_genome.size()) - genomeAddress - 3));
+}
+
+inline uint8_t GenomeNodeView::readByte(int address) const
+{
+    return address < toInt(_genome.size()) ? _genome[address] : 0;
+}
+
+inline GenomeView::Iterator::Iterator(std::span<uint8_t const> genome, int address, GenomeEncodingSpecification const& spec)
+    : _genome(genome)
+    , _address(address)
+    , _spec(spec)
+{}
+
+inline GenomeNodeView GenomeView::Iterator::operator*() const
+{
+    return GenomeNodeView(_genome, _address, _spec);
+}
+
+inline GenomeView::Iterator& GenomeView::Iterator::operator++()
+{
+    _address += GenomeNodeView(_genome, _address, _spec).getSize();
+    return *this;
+}
+
+inline GenomeView::Iterator GenomeView::Iterator::operator++(int)
+{
+    auto result = *this;
+    ++*this;
+    return result;
+}
+
+inline bool GenomeView::Iterator::operator==(Iterator const& other) const
+{
+    return _address == other._address && _genome.data() == other._genome.data();
+}
+
+inline GenomeView::GenomeView(std::span<uint8_t const> genome, GenomeEncodingSpecification const& spec)
+    : _genome(genome)
+    , _spec(spec)
+{}
+
+inline std::span<uint8_t const> GenomeView::getBytes() const
+{
+    return _genome;
+}
+
+inline int GenomeView::getHeaderSize() const
+{
+    auto result = Const::GenomeHeaderNumRepetitionsPos;
+    result += _spec._numRepetitions ? 1 : 0;
+    result += _spec._concatenationAngle1 ? 1 : 0;
+    result += _spec._concatenationAngle2 ? 1 : 0;
+    return result;
+}
+
+inline ConstructionShape GenomeView::getShape() const
+{
+    return readByte(Const::GenomeHeaderShapePos) % ConstructionShape_Count;
+}
+
+inline bool GenomeView::isSingleConstruction() const
+{
+    return convertByteToBool(readByte(Const::GenomeHeaderSingleConstruction));
+}
+
+inline bool GenomeView::isSeparateConstruction() const
+{
+    return convertByteToBool(readByte(Const::GenomeHeaderSeparationPos));
+}
+
+inline ConstructorAngleAlignment GenomeView::getAngleAlignment() const
+{
+    return readByte(Const::GenomeHeaderAlignmentPos) % ConstructorAngleAlignment_Count;
+}
+
+inline float GenomeView::getStiffness() const
+{
+    return convertByteToStiffness(readByte(Const::GenomeHeaderStiffnessPos));
+}
+
+inline float GenomeView::getConnectionDistance() const
+{
+    return convertByteToDistance(readByte(Const::GenomeHeaderConstructionDistancePos));
+}
+
+inline int GenomeView::getNumRepetitions(bool countInfinityAsOne) const
+{
+    if (!_spec._numRepetitions) {
+        return 1;
+    }
+    auto result = convertByteToByteWithInfinity(readByte(Const::GenomeHeaderNumRepetitionsPos));
+    return countInfinityAsOne && result == std::numeric_limits<int>::max() ? 1 : result;
+}
+
+inline float GenomeView::getConcatenationAngle1() const
+{
+    return _spec._concatenationAngle1 ? convertByteToAngle(readByte(getHeaderPos(Const::GenomeHeaderConcatenationAngle1Pos))) : 0.0f;
+}
+
+inline float GenomeView::getConcatenationAngle2() const
+{
+    return _spec._concatenationAngle2 ? convertByteToAngle(readByte(getHeaderPos(Const::GenomeHeaderConcatenationAngle2Pos))) : 0.0f;
+}
+
+inline GenomeView::Iterator GenomeView::begin() const
+{
+    return Iterator(_genome, std::min(getHeaderSize(), toInt(_genome.size())), _spec);
+}
+
+inline GenomeView::Iterator GenomeView::end() const
+{
+    return Iterator(_genome, toInt(_genome.size()), _spec);
+}
+
+inline int GenomeView::getNumNodes() const
+{
+    return toInt(std::distance(begin(), end()));
+}
+
+inline int GenomeView::getNodeIndex(int nodeAddress) const
+{
+    auto result = 0;
+    for (auto it = begin(); it != end() && (*it).getAddress() < nodeAddress; ++it) {
+        ++result;
+    }
+    return result;
+}
+
+inline int GenomeView::getNodeAddress(int nodeIndex) const
+{
+    auto it = begin();
+    for (int i = 0; i < nodeIndex && it != end(); ++i) {
+        ++it;
+    }
+    return (*it).getAddress();
+}
+
+template <typename Func>
+void GenomeView::executeForEachNodeRecursively(Func const& func) const
+{
+    executeForEachNodeRecursivelyIntern(func, 0, 1);
+}
+
+inline int GenomeView::getNumNodesRecursively(bool includeRepetitions) const
+{
+    auto result = 0;
+    executeForEachNodeRecursively([&](int depth, GenomeNodeView const& node, int repetitions) { result += includeRepetitions ? repetitions : 1; });
+    return result;
+}
+
+inline bool GenomeView::convertByteToBool(uint8_t b)
+{
+    return static_cast<int8_t>(b) > 0;
+}
+
+inline int GenomeView::convertBytesToWord(uint8_t b1, uint8_t b2)
+{
+    return static_cast<int>(b1) | (static_cast<int>(b2) << 8);
+}
+
+inline int GenomeView::convertByteToByteWithInfinity(uint8_t b)
+{
+    return b == 255 ? std::numeric_limits<int>::max() : b;
+}
+
+inline float GenomeView::convertByteToFloat(uint8_t b)
+{
+    return static_cast<float>(static_cast<int8_t>(b)) / 128;
+}
+
+inline float GenomeView::convertByteToAngle(uint8_t b)
+{
+    return static_cast<float>(static_cast<int8_t>(b)) / 120 * 180;
+}
+
+inline float GenomeView::convertByteToEnergy(uint8_t b)
+{
+    return convertByteToFloat(b) * 512 + 548.0f;
+}
+
+inline float GenomeView::convertByteToDensity(uint8_t b)
+{
+    return (convertByteToFloat(b) + 1.0f) / 2;
+}
+
+inline float GenomeView::convertByteToNeuronProperty(uint8_t b)
+{
+    return convertByteToFloat(b) * 4;
+}
+
+inline float GenomeView::convertByteToDistance(uint8_t b)
+{
+    return toFloat(b) / 255 + 0.5f;
+}
+
+inline float GenomeView::convertByteToStiffness(uint8_t b)
+{
+    return toFloat(b) / 255;
+}
+
+template <typename Func>
+void GenomeView::executeForEachNodeRecursivelyIntern(Func const& func, int depth, int repetitions) const
+{
+    repetitions *= getNumRepetitions(true);
+    for (auto const& node : *this) {
+        func(depth, node, repetitions);
+        if (node.hasGenome() && !node.isMakeGenomeCopy()) {
+            node.getSubGenome().executeForEachNodeRecursivelyIntern(func, depth + 1, repetitions);
+        }
+    }
+}
+
+inline uint8_t GenomeView::readByte(int address) const
+{
+    return address < toInt(_genome.size()) ? _genome[address] : 0;
+}
+
+//returns the actual position of an optional header entry given its position in the full header
+inline int GenomeView::getHeaderPos(int pos) const
+{
+    auto result = Const::GenomeHeaderNumRepetitionsPos;
+    if (pos > Const::GenomeHeaderNumRepetitionsPos && _spec._numRepetitions) {
+        ++result;
+    }
+    if (pos > Const::GenomeHeaderConcatenationAngle1Pos && _spec._concatenationAngle1) {
+        ++result;
+    }
+    return result;
+}
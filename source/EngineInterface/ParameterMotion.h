@@ -0,0 +1,187 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+/**
+ * NOTE: header is also included in kernel code
+ *
+ * Time-dependent positions of spots and particle sources. The position is a function of the time step, hence it can be
+ * evaluated on the device (once per time step) and on the host (tests, previews) without per-time-step updates of the parameters:
+ * - Linear:      (posX, posY) + (velX, velY) * timestepSize * (timestep - referenceTimestep)
+ * - Oscillation: linear motion plus amplitude * sin(360 * (timestep - referenceTimestep) / period + phase)
+ * - Keyframes:   linear interpolation between positions at given time steps (velocity is ignored)
+ * The result is corrected for the periodic world.
+ */
+
+#if defined(__CUDACC__)
+#define PARAMETER_MOTION_FUNCTION __host__ __device__ __inline__
+#else
+#define PARAMETER_MOTION_FUNCTION inline
+#endif
+
+#define MAX_MOTION_KEYFRAMES 4
+
+using ParameterMotionType = int;
+enum ParameterMotionType_
+{
+    ParameterMotionType_Linear,
+    ParameterMotionType_Oscillation,
+    ParameterMotionType_Keyframes
+};
+
+struct OscillationMotion
+{
+    float amplitudeX = 100.0f;
+    float amplitudeY = 0;
+    float period = 1000.0f;  //in time steps
+    float phase = 0;  //in degrees
+
+    bool operator==(OscillationMotion const& other) const
+    {
+        return amplitudeX == other.amplitudeX && amplitudeY == other.amplitudeY && period == other.period && phase == other.phase;
+    }
+    bool operator!=(OscillationMotion const& other) const { return !operator==(other); }
+};
+
+struct KeyframeMotion
+{
+    int numKeyframes = 0;
+    bool repeat = false;
+    uint64_t timesteps[MAX_MOTION_KEYFRAMES] = {};  //ascending
+    float posX[MAX_MOTION_KEYFRAMES] = {};
+    float posY[MAX_MOTION_KEYFRAMES] = {};
+
+    bool operator==(KeyframeMotion const& other) const
+    {
+        if (numKeyframes != other.numKeyframes || repeat != other.repeat) {
+            return false;
+        }
+        for (int i = 0; i < numKeyframes && i < MAX_MOTION_KEYFRAMES; ++i) {
+            if (timesteps[i] != other.timesteps[i] || posX[i] != other.posX[i] || posY[i] != other.posY[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+    bool operator!=(KeyframeMotion const& other) const { return !operator==(other); }
+};
+
+struct ParameterMotion
+{
+    ParameterMotionType type = ParameterMotionType_Linear;
+    OscillationMotion oscillation;
+    KeyframeMotion keyframes;
+
+    //time step at which the object is located at (posX, posY), not persisted and set by the engine when parameters are applied
+    uint64_t referenceTimestep = 0;
+
+    bool operator==(ParameterMotion const& other) const
+    {
+        if (type != other.type) {
+            return false;
+        }
+        if (type == ParameterMotionType_Oscillation && oscillation != other.oscillation) {
+            return false;
+        }
+        if (type == ParameterMotionType_Keyframes && keyframes != other.keyframes) {
+            return false;
+        }
+        return true;
+    }
+    bool operator!=(ParameterMotion const& other) const { return !operator==(other); }
+};
+
+namespace ParameterMotionDetail
+{
+    auto constexpr Pi = 3.14159265358979323846;
+
+    PARAMETER_MOTION_FUNCTION double calcTimestepDelta(uint64_t timestep, uint64_t referenceTimestep)
+    {
+        return timestep >= referenceTimestep ? static_cast<double>(timestep - referenceTimestep) : -static_cast<double>(referenceTimestep - timestep);
+    }
+
+    PARAMETER_MOTION_FUNCTION float correctCoordinate(double value, float worldSize)
+    {
+        auto result = fmod(value, static_cast<double>(worldSize));
+        if (result < 0) {
+            result += worldSize;
+        }
+        return static_cast<float>(result);
+    }
+
+    PARAMETER_MOTION_FUNCTION void calcKeyframePosition(double& resultX, double& resultY, KeyframeMotion const& keyframes, uint64_t timestep)
+    {
+        auto numKeyframes = keyframes.numKeyframes < MAX_MOTION_KEYFRAMES ? keyframes.numKeyframes : MAX_MOTION_KEYFRAMES;
+        auto lastIndex = numKeyframes - 1;
+        auto const& firstTimestep = keyframes.timesteps[0];
+        auto const& lastTimestep = keyframes.timesteps[lastIndex];
+        if (keyframes.repeat && timestep > lastTimestep && lastTimestep > firstTimestep) {
+            timestep = firstTimestep + (timestep - firstTimestep) % (lastTimestep - firstTimestep);
+        }
+        if (timestep <= firstTimestep) {
+            resultX = keyframes.posX[0];
+            resultY = keyframes.posY[0];
+            return;
+        }
+        for (int i = 0; i < lastIndex; ++i) {
+            auto const& startTimestep = keyframes.timesteps[i];
+            auto const& endTimestep = keyframes.timesteps[i + 1];
+            if (timestep < endTimestep && startTimestep < endTimestep) {
+                auto factor = static_cast<double>(timestep - startTimestep) / static_cast<double>(endTimestep - startTimestep);
+                resultX = keyframes.posX[i] + (keyframes.posX[i + 1] - keyframes.posX[i]) * factor;
+                resultY = keyframes.posY[i] + (keyframes.posY[i + 1] - keyframes.posY[i]) * factor;
+                return;
+            }
+        }
+        resultX = keyframes.posX[lastIndex];
+        resultY = keyframes.posY[lastIndex];
+    }
+}
+
+//MovingObject: SimulationParametersSpot or RadiationSource
+template <typename MovingObject>
+PARAMETER_MOTION_FUNCTION void
+calcMotionPosition(float& resultX, float& resultY, MovingObject const& object, uint64_t timestep, float timestepSize, float worldSizeX, float worldSizeY)
+{
+    auto const& motion = object.motion;
+    double x = object.posX;
+    double y = object.posY;
+    if (motion.type == ParameterMotionType_Keyframes) {
+        if (motion.keyframes.numKeyframes > 0) {
+            ParameterMotionDetail::calcKeyframePosition(x, y, motion.keyframes, timestep);
+        }
+    } else {
+        auto delta = ParameterMotionDetail::calcTimestepDelta(timestep, motion.referenceTimestep);
+        x += object.velX * timestepSize * delta;
+        y += object.velY * timestepSize * delta;
+        if (motion.type == ParameterMotionType_Oscillation && motion.oscillation.period > 0) {
+            auto angle = 2 * ParameterMotionDetail::Pi * (delta / motion.oscillation.period + motion.oscillation.phase / 360.0);
+            x += motion.oscillation.amplitudeX * sin(angle);
+            y += motion.oscillation.amplitudeY * sin(angle);
+        }
+    }
+    resultX = ParameterMotionDetail::correctCoordinate(x, worldSizeX);
+    resultY = ParameterMotionDetail::correctCoordinate(y, worldSizeY);
+}
+
+//moves the reference time step to the given one without changing the motion, such that (posX, posY) shows the current (center) position
+template <typename MovingObject>
+PARAMETER_MOTION_FUNCTION void rebaseMotion(MovingObject& object, uint64_t timestep, float timestepSize, float worldSizeX, float worldSizeY)
+{
+    auto& motion = object.motion;
+    if (motion.type == ParameterMotionType_Keyframes) {
+        calcMotionPosition(object.posX, object.posY, object, timestep, timestepSize, worldSizeX, worldSizeY);
+    } else {
+        auto delta = ParameterMotionDetail::calcTimestepDelta(timestep, motion.referenceTimestep);
+        double x = object.posX + object.velX * timestepSize * delta;
+        double y = object.posY + object.velY * timestepSize * delta;
+        object.posX = ParameterMotionDetail::correctCoordinate(x, worldSizeX);
+        object.posY = ParameterMotionDetail::correctCoordinate(y, worldSizeY);
+        if (motion.type == ParameterMotionType_Oscillation && motion.oscillation.period > 0) {
+            auto phase = fmod(motion.oscillation.phase + 360.0 * delta / motion.oscillation.period, 360.0);
+            motion.oscillation.phase = static_cast<float>(phase < 0 ? phase + 360.0 : phase);
+        }
+    }
+    motion.referenceTimestep = timestep;
+}
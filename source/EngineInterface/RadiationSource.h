@@ -4,6 +4,8 @@
  * NOTE: header is also included in kernel code
  */
 
+#include "ParameterMotion.h"
+
 struct CircularRadiationSource
 {
     float radius = 1;
@@ -40,6 +42,7 @@ struct RadiationSource
     float posY = 0;
     float velX = 0;
     float velY = 0;
+    ParameterMotion motion;
     bool useAngle = false;
     float angle = 0;
 
@@ -61,7 +64,8 @@ struct RadiationSource
                 return false;
             }
         }
-        return posX == other.posX && posY == other.posY && velX == other.velX && velY == other.velY && useAngle == other.useAngle && angle == other.angle;
+        return posX == other.posX && posY == other.posY && velX == other.velX && velY == other.velY && motion == other.motion && useAngle == other.useAngle
+            && angle == other.angle;
     }
     bool operator!=(RadiationSource const& other) const { return !operator==(other); }
 };
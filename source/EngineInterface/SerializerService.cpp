@@ -1,8 +1,11 @@
 #include "SerializerService.h"
 
+#include <algorithm>
 #include <sstream>
 #include <stdexcept>
 #include <filesystem>
+#include <fstream>
+#include <iterator>
 
 #include <optional>
 #include <cereal/archives/portable_binary.hpp>
@@ -25,6 +28,9 @@
 #include "Descriptions.h"
 #include "SimulationParameters.h"
 #include "AuxiliaryDataParserService.h"
+#include "ChunkedCompressionService.h"
+#include "ColumnarSerializerService.h"
+#include "DeltaCheckpointService.h"
 #include "GenomeConstants.h"
 #include "GenomeDescriptions.h"
 #include "GenomeDescriptionService.h"
@@ -165,6 +171,43 @@ namespace
         Load,
         Save
     };
+
+    //writes to a temporary file first such that an interrupted write does not destroy an existing file
+    bool writeFile(std::string const& filename, std::string const& content)
+    {
+        auto tempFilename = filename + ".tmp";
+        std::error_code error;
+        {
+            std::ofstream stream(tempFilename, std::ios::binary);
+            if (!stream) {
+                return false;
+            }
+            stream.write(content.data(), content.size());
+            stream.close();
+            if (!stream) {
+                std::filesystem::remove(tempFilename, error);
+                return false;
+            }
+        }
+        std::filesystem::rename(tempFilename, filename, error);
+        if (error) {
+            std::filesystem::remove(tempFilename, error);
+            return false;
+        }
+        return true;
+    }
+
+    bool readFile(std::string& content, std::string const& filename)
+    {
+        std::ifstream stream(filename, std::ios::binary | std::ios::ate);
+        if (!stream) {
+            return false;
+        }
+        content.resize(static_cast<size_t>(stream.tellg()));
+        stream.seekg(0);
+        stream.read(content.data(), content.size());
+        return static_cast<bool>(stream);
+    }
 }
 
 namespace cereal
@@ -203,6 +246,49 @@ namespace cereal
         }
     }
 
+    //weights and biases are stored in the layout of cereal's std::vector<std::vector<float>> and std::vector<float> encoding
+    //so that files remain compatible while the rows are copied in bulk
+    template <class Archive, typename NeuronDesc>
+    void loadSaveNeuron(SerializationTask task, Archive& ar, NeuronDesc& data, int activationFunctionsId)
+    {
+        auto auxiliaries = getLoadSaveMap(task, ar);
+        std::vector<int> activationFunctions(data.activationFunctions.begin(), data.activationFunctions.end());
+        loadSave<std::vector<int>>(task, auxiliaries, activationFunctionsId, activationFunctions, std::vector<int>(MAX_CHANNELS, 0));
+        if (task == SerializationTask::Load) {
+            activationFunctions.resize(MAX_CHANNELS, 0);
+            std::copy_n(activationFunctions.begin(), MAX_CHANNELS, data.activationFunctions.begin());
+        }
+        setLoadSaveMap(task, ar, auxiliaries);
+
+        auto loadSaveRow = [&](float* row) {
+            if (task == SerializationTask::Save) {
+                ar(cereal::make_size_tag(static_cast<cereal::size_type>(MAX_CHANNELS)));
+                ar(cereal::binary_data(row, sizeof(float) * MAX_CHANNELS));
+            } else {
+                cereal::size_type size;
+                ar(cereal::make_size_tag(size));
+                if (size == MAX_CHANNELS) {
+                    ar(cereal::binary_data(row, sizeof(float) * MAX_CHANNELS));
+                } else {
+                    std::vector<float> values(size);
+                    ar(cereal::binary_data(values.data(), sizeof(float) * values.size()));
+                    values.resize(MAX_CHANNELS, 0.0f);
+                    std::copy_n(values.begin(), MAX_CHANNELS, row);
+                }
+            }
+        };
+        cereal::size_type numRows = MAX_CHANNELS;
+        ar(cereal::make_size_tag(numRows));
+        for (cereal::size_type i = 0; i < numRows; ++i) {
+            std::array<float, MAX_CHANNELS> ignoredRow;
+            loadSaveRow(i < MAX_CHANNELS ? data.weights[i].data() : ignoredRow.data());
+        }
+        for (auto i = numRows; i < MAX_CHANNELS; ++i) {
+            data.weights[i].fill(0.0f);
+        }
+        loadSaveRow(data.biases.data());
+    }
+
     template <class Archive>
     void serialize(Archive& ar, IntVector2D& data)
     {
@@ -217,12 +303,7 @@ namespace cereal
     template <class Archive>
     void loadSave(SerializationTask task, Archive& ar, NeuronGenomeDescription& data)
     {
-        NeuronGenomeDescription defaultObject;
-        auto auxiliaries = getLoadSaveMap(task, ar);
-        loadSave<std::vector<int>>(task, auxiliaries, Id_NeuronGenome_ActivationFunctions, data.activationFunctions, defaultObject.activationFunctions);
-        setLoadSaveMap(task, ar, auxiliaries);
-
-        ar(data.weights, data.biases);
+        loadSaveNeuron(task, ar, data, Id_NeuronGenome_ActivationFunctions);
     }
     SPLIT_SERIALIZATION(NeuronGenomeDescription)
 
@@ -478,12 +559,7 @@ namespace cereal
     template <class Archive>
     void loadSave(SerializationTask task, Archive& ar, NeuronDescription& data)
     {
-        NeuronDescription defaultObject;
-        auto auxiliaries = getLoadSaveMap(task, ar);
-        loadSave<std::vector<int>>(task, auxiliaries, Id_Neuron_ActivationFunctions, data.activationFunctions, defaultObject.activationFunctions);
-        setLoadSaveMap(task, ar, auxiliaries);
-
-        ar(data.weights, data.biases);
+        loadSaveNeuron(task, ar, data, Id_Neuron_ActivationFunctions);
     }
     SPLIT_SERIALIZATION(NeuronDescription)
 
@@ -737,83 +813,125 @@ bool SerializerService::serializeSimulationToFiles(std::string const& filename,
 {
     try {
         log(Priority::Important, "save simulation to " + filename);
-        std::filesystem::path settingsFilename(filename);
-        settingsFilename.replace_extension(std::filesystem::path(".settings.json"));
-        std::filesystem::path statisticsFilename(filename);
-        statisticsFilename.replace_extension(std::filesystem::path(".statistics.csv"));
-
-        {
-            zstr::ofstream stream(filename, std::ios::binary);
-            if (!stream) {
-                return false;
-            }
-            serializeDataDescription(data.mainData, stream);
+        auto startTimepoint = std::chrono::steady_clock::now();
+        if (!writeFile(filename, compressDataDescription(data.mainData))) {
+            return false;
         }
-        {
-            std::ofstream stream(settingsFilename.string(), std::ios::binary);
-            if (!stream) {
-                return false;
-            }
-            serializeAuxiliaryData(data.auxiliaryData, stream);
+        auto result = serializeSettingsAndStatisticsToFiles(filename, data.auxiliaryData, data.statistics);
+        logPerformanceEvent(PerformanceEvent::SaveSimulation, std::chrono::steady_clock::now() - startTimepoint);
+        return result;
+    } catch (...) {
+        return false;
+    }
+}
+
+bool SerializerService::deserializeSimulationFromFiles(DeserializedSimulation& data, std::string const& filename)
+{
+    try {
+        log(Priority::Important, "load simulation from " + filename);
+        auto startTimepoint = std::chrono::steady_clock::now();
+        if (!deserializeDataDescription(data.mainData, filename)) {
+            return false;
         }
-        {
-            std::ofstream stream(statisticsFilename.string(), std::ios::binary);
-            if (!stream) {
-                return false;
-            }
-            serializeStatistics(data.statistics, stream);
+        auto result = deserializeSettingsAndStatisticsFromFiles(data.auxiliaryData, data.statistics, filename);
+        logPerformanceEvent(PerformanceEvent::LoadSimulation, std::chrono::steady_clock::now() - startTimepoint);
+        return result;
+    } catch (...) {
+        return false;
+    }
+}
+
+bool SerializerService::serializeSimulationToFiles(std::string const& filename, DeserializedColumnarSimulation const& data)
+{
+    try {
+        log(Priority::Important, "save simulation to " + filename);
+        auto startTimepoint = std::chrono::steady_clock::now();
+        std::ostringstream stream;
+        ColumnarSerializerService::serialize(data.mainData, stream);
+        if (!writeFile(filename, ChunkedCompressionService::compress(std::move(stream).str()))) {
+            return false;
         }
-        return true;
+        auto result = serializeSettingsAndStatisticsToFiles(filename, data.auxiliaryData, data.statistics);
+        logPerformanceEvent(PerformanceEvent::SaveSimulation, std::chrono::steady_clock::now() - startTimepoint);
+        return result;
     } catch (...) {
         return false;
     }
 }
 
-bool SerializerService::deserializeSimulationFromFiles(DeserializedSimulation& data, std::string const& filename)
+bool SerializerService::deserializeSimulationFromFiles(DeserializedColumnarSimulation& data, std::string const& filename)
 {
     try {
         log(Priority::Important, "load simulation from " + filename);
-        std::filesystem::path settingsFilename(filename);
-        settingsFilename.replace_extension(std::filesystem::path(".settings.json"));
-        std::filesystem::path statisticsFilename(filename);
-        statisticsFilename.replace_extension(std::filesystem::path(".statistics.csv"));
+        auto startTimepoint = std::chrono::steady_clock::now();
+        std::string content;
+        if (!readFile(content, filename)) {
+            return false;
+        }
+        decompressColumnarData(data.mainData, content, filename);
+        auto result = deserializeSettingsAndStatisticsFromFiles(data.auxiliaryData, data.statistics, filename);
+        logPerformanceEvent(PerformanceEvent::LoadSimulation, std::chrono::steady_clock::now() - startTimepoint);
+        return result;
+    } catch (...) {
+        return false;
+    }
+}
 
-        if (!deserializeDataDescription(data.mainData, filename)) {
+bool SerializerService::serializeSimulationDeltaToFiles(
+    std::string const& filename,
+    std::string const& baseFilename,
+    ClusteredDataDescription const& base,
+    DeserializedSimulation const& data)
+{
+    try {
+        log(Priority::Important, "save simulation delta to " + filename);
+        if (std::filesystem::weakly_canonical(filename) == std::filesystem::weakly_canonical(baseFilename)) {
             return false;
         }
-        {
-            std::ifstream stream(settingsFilename.string(), std::ios::binary);
-            if (!stream) {
-                return false;
-            }
-            deserializeAuxiliaryData(data.auxiliaryData, stream);
+
+        //the base is referred relative to the location of the delta checkpoint
+        auto relativeBaseFilename = std::filesystem::proximate(baseFilename, std::filesystem::absolute(filename).parent_path());
+        std::ostringstream stream;
+        DeltaCheckpointService::serialize(relativeBaseFilename.generic_string(), base, data.mainData, stream);
+        if (!writeFile(filename, ChunkedCompressionService::compress(std::move(stream).str()))) {
+            return false;
         }
-        {
-            std::ifstream stream(statisticsFilename.string(), std::ios::binary);
-            if (!stream) {
-                return true;
-            }
-            deserializeStatistics(data.statistics, stream);
+        return serializeSettingsAndStatisticsToFiles(filename, data.auxiliaryData, data.statistics);
+    } catch (...) {
+        return false;
+    }
+}
+
+std::optional<std::string> SerializerService::getDeltaCheckpointBaseFilename(std::string const& filename)
+{
+    try {
+        std::string content;
+        if (!readFile(content, filename) || !ChunkedCompressionService::isChunkedFormat(content)) {
+            return std::nullopt;
         }
-        return true;
+        std::istringstream stream(ChunkedCompressionService::decompress(content));
+        if (!DeltaCheckpointService::isDeltaFormat(stream)) {
+            return std::nullopt;
+        }
+        return (std::filesystem::path(filename).parent_path() / DeltaCheckpointService::deserializeBaseFilename(stream)).string();
     } catch (...) {
+        return std::nullopt;
+    }
+}
+
+bool SerializerService::compactSimulationFiles(std::string const& outputFilename, std::string const& filename)
+{
+    DeserializedSimulation data;
+    if (!deserializeSimulationFromFiles(data, filename)) {
         return false;
     }
+    return serializeSimulationToFiles(outputFilename, data);
 }
 
 bool SerializerService::serializeSimulationToStrings(SerializedSimulation& output, DeserializedSimulation const& input)
 {
     try {
-        {
-            std::stringstream stdStream;
-            zstr::ostream stream(stdStream, std::ios::binary);
-            if (!stream) {
-                return false;
-            }
-            serializeDataDescription(input.mainData, stream);
-            stream.flush();
-            output.mainData = stdStream.str();
-        }
+        output.mainData = compressDataDescription(input.mainData);
         {
             std::stringstream stream;
             serializeAuxiliaryData(input.auxiliaryData, stream);
@@ -833,14 +951,7 @@ bool SerializerService::serializeSimulationToStrings(SerializedSimulation& outpu
 bool SerializerService::deserializeSimulationFromStrings(DeserializedSimulation& output, SerializedSimulation const& input)
 {
     try {
-        {
-            std::stringstream stdStream(input.mainData);
-            zstr::istream stream(stdStream, std::ios::binary);
-            if (!stream) {
-                return false;
-            }
-            deserializeDataDescription(output.mainData, stream);
-        }
+        decompressDataDescription(output.mainData, input.mainData);
         {
             std::stringstream stream(input.auxiliaryData);
             deserializeAuxiliaryData(output.auxiliaryData, stream);
@@ -865,13 +976,7 @@ bool SerializerService::serializeGenomeToFile(std::string const& filename, std::
             return false;
         }
 
-        zstr::ofstream stream(filename, std::ios::binary);
-        if (!stream) {
-            return false;
-        }
-        serializeDataDescription(data, stream);
-
-        return true;
+        return writeFile(filename, compressDataDescription(data));
     } catch (...) {
         return false;
     }
@@ -897,20 +1002,12 @@ bool SerializerService::deserializeGenomeFromFile(std::vector<uint8_t>& genome,
 bool SerializerService::serializeGenomeToString(std::string& output, std::vector<uint8_t> const& input)
 {
     try {
-        std::stringstream stdStream;
-        zstr::ostream stream(stdStream, std::ios::binary);
-        if (!stream) {
-            return false;
-        }
-
         ClusteredDataDescription data;
         if (!wrapGenome(data, input)) {
             return false;
         }
 
-        serializeDataDescription(data, stream);
-        stream.flush();
-        output = stdStream.str();
+        output = compressDataDescription(data);
         return true;
     } catch (...) {
         return false;
@@ -920,14 +1017,8 @@ bool SerializerService::serializeGenomeToString(std::string& output, std::vector
 bool SerializerService::deserializeGenomeFromString(std::vector<uint8_t>& output, std::string const& input)
 {
     try {
-        std::stringstream stdStream(input);
-        zstr::istream stream(stdStream, std::ios::binary);
-        if (!stream) {
-            return false;
-        }
-
         ClusteredDataDescription data;
-        deserializeDataDescription(data, stream);
+        decompressDataDescription(data, input);
 
         if (!unwrapGenome(output, data)) {
             return false;
@@ -938,6 +1029,27 @@ bool SerializerService::deserializeGenomeFromString(std::vector<uint8_t>& output
     }
 }
 
+bool SerializerService::convertToUncompressedData(std::string& output, std::string const& input)
+{
+    try {
+        std::string uncompressedData;
+        if (ChunkedCompressionService::isChunkedFormat(input)) {
+            uncompressedData = ChunkedCompressionService::decompress(input);
+        } else {
+            std::istringstream stdStream(input);
+            zstr::istream stream(stdStream, std::ios::binary);
+            std::stringstream uncompressedStream;
+            uncompressedStream << stream.rdbuf();
+            uncompressedData = std::move(uncompressedStream).str();
+        }
+        output = ChunkedCompressionService::compress(
+            uncompressedData, ChunkedCompressionService::DefaultBlockSize, ChunkedCompressionService::NoCompression);
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
 bool SerializerService::serializeSimulationParametersToFile(std::string const& filename, SimulationParameters const& parameters)
 {
     try {
@@ -989,13 +1101,7 @@ bool SerializerService::serializeStatisticsToFile(std::string const& filename, S
 bool SerializerService::serializeContentToFile(std::string const& filename, ClusteredDataDescription const& content)
 {
     try {
-        zstr::ofstream fileStream(filename, std::ios::binary);
-        if (!fileStream) {
-            return false;
-        }
-        serializeDataDescription(content, fileStream);
-
-        return true;
+        return writeFile(filename, compressDataDescription(content));
     } catch (...) {
         return false;
     }
@@ -1013,25 +1119,41 @@ bool SerializerService::deserializeContentFromFile(ClusteredDataDescription& con
     }
 }
 
-void SerializerService::serializeDataDescription(ClusteredDataDescription const& data, std::ostream& stream)
+void SerializerService::serializeNeuron(NeuronDescription const& neuron, std::ostream& stream)
 {
     cereal::PortableBinaryOutputArchive archive(stream);
-    archive(Const::ProgramVersion);
-    archive(data);
+    archive(neuron);
+}
+
+void SerializerService::deserializeNeuron(NeuronDescription& neuron, std::istream& stream)
+{
+    cereal::PortableBinaryInputArchive archive(stream);
+    archive(neuron);
+}
+
+void SerializerService::serializeDataDescription(ClusteredDataDescription const& data, std::ostream& stream)
+{
+    ColumnarSerializerService::serialize(data, stream);
 }
 
 bool SerializerService::deserializeDataDescription(ClusteredDataDescription& data, std::string const& filename)
 {
-    zstr::ifstream stream(filename, std::ios::binary);
-    if (!stream) {
+    std::string content;
+    if (!readFile(content, filename)) {
         return false;
     }
-    deserializeDataDescription(data, stream);
+    decompressDataDescription(data, content, filename);
     return true;
 }
 
 void SerializerService::deserializeDataDescription(ClusteredDataDescription& data, std::istream& stream)
 {
+    if (ColumnarSerializerService::isColumnarFormat(stream)) {
+        ColumnarSerializerService::deserialize(data, stream);
+        return;
+    }
+
+    //files from older versions
     cereal::PortableBinaryInputArchive archive(stream);
     std::string version;
     archive(version);
@@ -1045,28 +1167,125 @@ void SerializerService::deserializeDataDescription(ClusteredDataDescription& dat
     archive(data);
 }
 
+std::string SerializerService::compressDataDescription(ClusteredDataDescription const& data)
+{
+    std::ostringstream stream;
+    serializeDataDescription(data, stream);
+    return ChunkedCompressionService::compress(std::move(stream).str());
+}
+
+void SerializerService::decompressDataDescription(ClusteredDataDescription& data, std::string const& input, std::string const& filename)
+{
+    if (ChunkedCompressionService::isChunkedFormat(input)) {
+        std::istringstream stream(ChunkedCompressionService::decompress(input));
+        if (DeltaCheckpointService::isDeltaFormat(stream)) {
+            if (filename.empty()) {
+                throw std::runtime_error("Delta checkpoints can only be loaded from files.");
+            }
+            auto baseFilename = std::filesystem::path(filename).parent_path() / DeltaCheckpointService::deserializeBaseFilename(stream);
+            if (!deserializeDataDescription(data, baseFilename.string())) {
+                throw std::runtime_error("Base of delta checkpoint not found.");
+            }
+            DeltaCheckpointService::applyDelta(data, stream);
+            return;
+        }
+        deserializeDataDescription(data, stream);
+        return;
+    }
+
+    //files from older versions are compressed as a single gzip stream
+    std::istringstream stdStream(input);
+    zstr::istream stream(stdStream, std::ios::binary);
+    deserializeDataDescription(data, stream);
+}
+
+void SerializerService::decompressColumnarData(ColumnarData& data, std::string const& input, std::string const& filename)
+{
+    if (ChunkedCompressionService::isChunkedFormat(input)) {
+        std::istringstream stream(ChunkedCompressionService::decompress(input));
+        if (ColumnarSerializerService::isColumnarFormat(stream)) {
+            ColumnarSerializerService::deserialize(data, stream);
+            return;
+        }
+    }
+
+    //delta checkpoints and files from older versions
+    ClusteredDataDescription description;
+    decompressDataDescription(description, input, filename);
+    data = ColumnarSerializerService::convertDescriptionToColumnarData(description);
+}
+
+bool SerializerService::serializeSettingsAndStatisticsToFiles(
+    std::string const& filename,
+    AuxiliaryData const& auxiliaryData,
+    StatisticsHistoryData const& statistics)
+{
+    std::filesystem::path settingsFilename(filename);
+    settingsFilename.replace_extension(std::filesystem::path(".settings.json"));
+    std::filesystem::path statisticsFilename(filename);
+    statisticsFilename.replace_extension(std::filesystem::path(".statistics.csv"));
+
+    {
+        std::ofstream stream(settingsFilename.string(), std::ios::binary);
+        if (!stream) {
+            return false;
+        }
+        serializeAuxiliaryData(auxiliaryData, stream);
+    }
+    {
+        std::ofstream stream(statisticsFilename.string(), std::ios::binary);
+        if (!stream) {
+            return false;
+        }
+        serializeStatistics(statistics, stream);
+    }
+    return true;
+}
+
+bool SerializerService::deserializeSettingsAndStatisticsFromFiles(AuxiliaryData& auxiliaryData, StatisticsHistoryData& statistics, std::string const& filename)
+{
+    std::filesystem::path settingsFilename(filename);
+    settingsFilename.replace_extension(std::filesystem::path(".settings.json"));
+    std::filesystem::path statisticsFilename(filename);
+    statisticsFilename.replace_extension(std::filesystem::path(".statistics.csv"));
+
+    {
+        std::ifstream stream(settingsFilename.string(), std::ios::binary);
+        if (!stream) {
+            return false;
+        }
+        deserializeAuxiliaryData(auxiliaryData, stream);
+    }
+    {
+        std::ifstream stream(statisticsFilename.string(), std::ios::binary);
+        if (!stream) {
+            return true;
+        }
+        deserializeStatistics(statistics, stream);
+    }
+    return true;
+}
+
 void SerializerService::serializeAuxiliaryData(AuxiliaryData const& auxiliaryData, std::ostream& stream)
 {
-    boost::property_tree::json_parser::write_json(stream, AuxiliaryDataParserService::encodeAuxiliaryData(auxiliaryData));
+    stream << AuxiliaryDataParserService::encodeAuxiliaryDataToJson(auxiliaryData);
 }
 
 void SerializerService::deserializeAuxiliaryData(AuxiliaryData& auxiliaryData, std::istream& stream)
 {
-    boost::property_tree::ptree tree;
-    boost::property_tree::read_json(stream, tree);
-    auxiliaryData = AuxiliaryDataParserService::decodeAuxiliaryData(tree);
+    std::string json(std::istreambuf_iterator<char>(stream), {});
+    auxiliaryData = AuxiliaryDataParserService::decodeAuxiliaryDataFromJson(json);
 }
 
 void SerializerService::serializeSimulationParameters(SimulationParameters const& parameters, std::ostream& stream)
 {
-    boost::property_tree::json_parser::write_json(stream, AuxiliaryDataParserService::encodeSimulationParameters(parameters));
+    stream << AuxiliaryDataParserService::encodeSimulationParametersToJson(parameters);
 }
 
 void SerializerService::deserializeSimulationParameters(SimulationParameters& parameters, std::istream& stream)
 {
-    boost::property_tree::ptree tree;
-    boost::property_tree::read_json(stream, tree);
-    parameters = AuxiliaryDataParserService::decodeSimulationParameters(tree);
+    std::string json(std::istreambuf_iterator<char>(stream), {});
+    parameters = AuxiliaryDataParserService::decodeSimulationParametersFromJson(json);
 }
 
 namespace
@@ -1,9 +1,12 @@
 #pragma once
 
+#include <optional>
+
 #include "Base/Definitions.h"
 
 #include "Definitions.h"
 #include "AuxiliaryData.h"
+#include "ColumnarData.h"
 #include "Descriptions.h"
 #include "StatisticsHistory.h"
 
@@ -14,6 +17,14 @@ struct DeserializedSimulation
     StatisticsHistoryData statistics;
 };
 
+//for saving and loading without building the cluster tree, see _SimulationController::getColumnarSimulationData
+struct DeserializedColumnarSimulation
+{
+    ColumnarData mainData;
+    AuxiliaryData auxiliaryData;
+    StatisticsHistoryData statistics;
+};
+
 struct SerializedSimulation
 {
     std::string mainData;  //binary
@@ -26,6 +37,19 @@ class SerializerService
 public:
     static bool serializeSimulationToFiles(std::string const& filename, DeserializedSimulation const& data);
     static bool deserializeSimulationFromFiles(DeserializedSimulation& data, std::string const& filename);
+    static bool serializeSimulationToFiles(std::string const& filename, DeserializedColumnarSimulation const& data);
+    static bool deserializeSimulationFromFiles(DeserializedColumnarSimulation& data, std::string const& filename);
+
+    //saves the main data as difference to the main data of baseFilename; delta checkpoints are loaded by deserializeSimulationFromFiles
+    static bool serializeSimulationDeltaToFiles(
+        std::string const& filename,
+        std::string const& baseFilename,
+        ClusteredDataDescription const& base,
+        DeserializedSimulation const& data);
+    //returns the base file referred by a delta checkpoint or nullopt if filename is not a (readable) delta checkpoint
+    static std::optional<std::string> getDeltaCheckpointBaseFilename(std::string const& filename);
+    //folds delta checkpoints and their bases into a full simulation file
+    static bool compactSimulationFiles(std::string const& outputFilename, std::string const& filename);
 
     static bool serializeSimulationToStrings(SerializedSimulation& output, DeserializedSimulation const& input);
     static bool deserializeSimulationFromStrings(DeserializedSimulation& output, SerializedSimulation const& input);
@@ -36,6 +60,10 @@ public:
     static bool serializeGenomeToString(std::string& output, std::vector<uint8_t> const& input);
     static bool deserializeGenomeFromString(std::vector<uint8_t>& output, std::string const& input);
 
+    //converts compressed main data of simulations or genomes (also from older versions) into a representation with uncompressed blocks
+    //which is still accepted by deserializeSimulationFromStrings and deserializeGenomeFromString but loads faster
+    static bool convertToUncompressedData(std::string& output, std::string const& input);
+
     static bool serializeSimulationParametersToFile(std::string const& filename, SimulationParameters const& parameters);
     static bool deserializeSimulationParametersFromFile(SimulationParameters& parameters, std::string const& filename);
 
@@ -44,10 +72,23 @@ public:
     static bool serializeContentToFile(std::string const& filename, ClusteredDataDescription const& content);
     static bool deserializeContentFromFile(ClusteredDataDescription& content, std::string const& filename);
 
+    //for tests: neuron encoding of files from older versions
+    static void serializeNeuron(NeuronDescription const& neuron, std::ostream& stream);
+    static void deserializeNeuron(NeuronDescription& neuron, std::istream& stream);
+
 private:
     static void serializeDataDescription(ClusteredDataDescription const& data, std::ostream& stream);
     static bool deserializeDataDescription(ClusteredDataDescription& data, std::string const& filename);
     static void deserializeDataDescription(ClusteredDataDescription& data, std::istream& stream);
+    static std::string compressDataDescription(ClusteredDataDescription const& data);
+    static void decompressDataDescription(ClusteredDataDescription& data, std::string const& input, std::string const& filename = std::string());
+    static void decompressColumnarData(ColumnarData& data, std::string const& input, std::string const& filename);
+
+    static bool serializeSettingsAndStatisticsToFiles(
+        std::string const& filename,
+        AuxiliaryData const& auxiliaryData,
+        StatisticsHistoryData const& statistics);
+    static bool deserializeSettingsAndStatisticsFromFiles(AuxiliaryData& auxiliaryData, StatisticsHistoryData& statistics, std::string const& filename);
 
     static void serializeAuxiliaryData(AuxiliaryData const& auxiliaryData, std::ostream& stream);
     static void deserializeAuxiliaryData(AuxiliaryData& auxiliaryData, std::istream& stream);
@@ -8,12 +8,14 @@
 #include "MutationType.h"
 #include "DataPointCollection.h"
 #include "StatisticsHistory.h"
+#include "TimestepProfile.h"
 
 class _SimulationController
 {
 public:
     virtual void newSimulation(uint64_t timestep, GeneralSettings const& generalSettings, SimulationParameters const& simulationParameters) = 0;
     virtual void clear() = 0;
+    virtual uint64_t getSimulationId() const = 0;  //changes with each newSimulation call, e.g. for detecting that another simulation has been loaded
 
     virtual void setImageResource(void* image) = 0;
     virtual std::string getGpuName() const = 0;
@@ -26,6 +28,17 @@ public:
     virtual std::optional<OverlayDescription>
     tryDrawVectorGraphicsAndReturnOverlay(RealVector2D const& rectUpperLeft, RealVector2D const& rectLowerRight, IntVector2D const& imageSize, double zoom) = 0;
 
+    /**
+     * Draws a section of simulation to host memory without using OpenGL.
+     * The pixels have the same layout as the texture: 64 bit in bbbbggggrrrr format (3 x 16 bit + 16 bit unused).
+     */
+    virtual void drawVectorGraphicsToHost(
+        RealVector2D const& rectUpperLeft,
+        RealVector2D const& rectLowerRight,
+        IntVector2D const& imageSize,
+        double zoom,
+        std::vector<uint64_t>& image) = 0;
+
     virtual bool isSyncSimulationWithRendering() const = 0;
     virtual void setSyncSimulationWithRendering(bool value) = 0;
     virtual int getSyncSimulationWithRenderingRatio() const = 0;
@@ -37,6 +50,10 @@ public:
     virtual DataDescription getSelectedSimulationData(bool includeClusters) = 0;
     virtual DataDescription getInspectedSimulationData(std::vector<uint64_t> objectsIds) = 0;
 
+    //bulk access for saving and loading, bypasses the construction of descriptions
+    virtual ColumnarData getColumnarSimulationData() = 0;
+    virtual void setColumnarSimulationData(ColumnarData const& data) = 0;
+
     virtual void addAndSelectSimulationData(DataDescription const& dataToAdd) = 0;
     virtual void setClusteredSimulationData(ClusteredDataDescription const& dataToUpdate) = 0;
     virtual void setSimulationData(DataDescription const& dataToUpdate) = 0;
@@ -60,6 +77,7 @@ public:
     virtual bool isSimulationRunning() const = 0;
 
     virtual void closeSimulation() = 0;
+    virtual void setDeviceResetOnClose(bool value) = 0;  //if disabled, the CUDA context is kept and the next newSimulation call starts faster
 
     virtual uint64_t getCurrentTimestep() const = 0;
     virtual void setCurrentTimestep(uint64_t value) = 0;
@@ -94,6 +112,11 @@ public:
 
     virtual float getTps() const = 0;
 
+    //profiling records the stage durations and entity counts of the last time steps (see _TimestepProfiler)
+    virtual bool isProfilingEnabled() const = 0;
+    virtual void setProfilingEnabled(bool value) = 0;
+    virtual std::vector<TimestepProfile> getTimestepProfiles() const = 0;
+
     //for tests
     virtual void testOnly_mutate(uint64_t cellId, MutationType mutationType) = 0;
 };
@@ -0,0 +1,110 @@
+#include "SimulationParametersDiffService.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
+#include "SimulationParametersFields.h"
+
+namespace
+{
+    template <typename Object, size_t N>
+    void addFieldRanges(std::vector<ParameterByteRange>& ranges, ParameterField<Object> const (&fields)[N], Object& object, SimulationParameters& parameters)
+    {
+        auto baseAddress = reinterpret_cast<char*>(&parameters);
+        for (auto const& field : fields) {
+            auto offset = static_cast<size_t>(static_cast<char*>(field.getValueRef(object)) - baseAddress);
+            auto size = static_cast<size_t>(getNumParameterFieldElements(field.type) * getParameterFieldElementSize(field.type));
+            ranges.push_back({offset, size});
+        }
+    }
+
+    //disjoint ranges covering SimulationParameters completely
+    std::vector<ParameterByteRange> const& getSegments()
+    {
+        static auto const result = [] {
+            auto parameters = std::make_unique<SimulationParameters>();
+            std::vector<ParameterByteRange> fieldRanges;
+            addFieldRanges(fieldRanges, SimulationParametersFields, *parameters, *parameters);
+            for (int i = 0; i < MAX_PARTICLE_SOURCES; ++i) {
+                addFieldRanges(fieldRanges, RadiationSourceFields, parameters->particleSources[i], *parameters);
+            }
+            for (int i = 0; i < MAX_SPOTS; ++i) {
+                addFieldRanges(fieldRanges, SimulationParametersSpotFields, parameters->spots[i], *parameters);
+            }
+            std::sort(fieldRanges.begin(), fieldRanges.end(), [](auto const& left, auto const& right) { return left.offset < right.offset; });
+
+            std::vector<ParameterByteRange> result;
+            size_t end = 0;
+            for (auto const& range : fieldRanges) {
+                if (range.offset < end) {
+                    auto& lastRange = result.back();
+                    lastRange.size = std::max(lastRange.offset + lastRange.size, range.offset + range.size) - lastRange.offset;
+                } else {
+                    if (range.offset > end) {
+                        result.push_back({end, range.offset - end});
+                    }
+                    result.emplace_back(range);
+                }
+                end = result.back().offset + result.back().size;
+            }
+            if (end < sizeof(SimulationParameters)) {
+                result.push_back({end, sizeof(SimulationParameters) - end});
+            }
+            return result;
+        }();
+        return result;
+    }
+
+    template <typename Object, size_t N>
+    void addChangedFields(
+        std::vector<std::string>& result,
+        std::string const& prefix,
+        ParameterField<Object> const (&fields)[N],
+        Object const& reference,
+        Object const& object)
+    {
+        for (auto const& field : fields) {
+            auto size = getNumParameterFieldElements(field.type) * getParameterFieldElementSize(field.type);
+            if (std::memcmp(field.getValueRef(const_cast<Object&>(reference)), field.getValueRef(const_cast<Object&>(object)), size) != 0) {
+                result.emplace_back(prefix + field.name);
+            }
+        }
+    }
+}
+
+void SimulationParametersDiffService::calcChangedByteRanges(
+    std::vector<ParameterByteRange>& result,
+    SimulationParameters const& reference,
+    SimulationParameters const& parameters,
+    size_t maxGap)
+{
+    result.clear();
+    auto referenceBytes = reinterpret_cast<char const*>(&reference);
+    auto bytes = reinterpret_cast<char const*>(&parameters);
+    for (auto const& segment : getSegments()) {
+        if (std::memcmp(referenceBytes + segment.offset, bytes + segment.offset, segment.size) == 0) {
+            continue;
+        }
+        if (!result.empty() && segment.offset - (result.back().offset + result.back().size) < maxGap) {
+            result.back().size = segment.offset + segment.size - result.back().offset;
+        } else {
+            result.emplace_back(segment);
+        }
+    }
+}
+
+std::vector<std::string> SimulationParametersDiffService::calcChangedFields(SimulationParameters const& reference, SimulationParameters const& parameters)
+{
+    std::vector<std::string> result;
+    addChangedFields(result, "", SimulationParametersFields, reference, parameters);
+    auto numParticleSources = std::min(std::max(reference.numParticleSources, parameters.numParticleSources), MAX_PARTICLE_SOURCES);
+    for (int i = 0; i < numParticleSources; ++i) {
+        addChangedFields(result, "particle sources." + std::to_string(i) + ".", RadiationSourceFields, reference.particleSources[i], parameters.particleSources[i]);
+    }
+    auto numSpots = std::min(std::max(reference.numSpots, parameters.numSpots), MAX_SPOTS);
+    for (int i = 0; i < numSpots; ++i) {
+        addChangedFields(result, "spots." + std::to_string(i) + ".", SimulationParametersSpotFields, reference.spots[i], parameters.spots[i]);
+    }
+    return result;
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "SimulationParameters.h"
+
+struct ParameterByteRange
+{
+    size_t offset = 0;
+    size_t size = 0;
+
+    bool operator==(ParameterByteRange const&) const = default;
+};
+
+/**
+ * Change tracking for SimulationParameters based on the field tables in SimulationParametersFields.h.
+ * SimulationParameters is partitioned once into the byte ranges of the registered fields (overlapping union members are joined)
+ * and the gaps between them, so that members which are not registered are tracked as well.
+ */
+class SimulationParametersDiffService
+{
+public:
+    static size_t constexpr MaxRangeGap = 256;
+
+    //changed byte ranges in ascending order, ranges which are less than maxGap bytes apart are merged to reduce the number of copies
+    static void calcChangedByteRanges(
+        std::vector<ParameterByteRange>& result,
+        SimulationParameters const& reference,
+        SimulationParameters const& parameters,
+        size_t maxGap = MaxRangeGap);
+
+    //node paths of the changed fields relative to "simulation parameters", e.g. "spots.1.pos.x"
+    static std::vector<std::string> calcChangedFields(SimulationParameters const& reference, SimulationParameters const& parameters);
+};
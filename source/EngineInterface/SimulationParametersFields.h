@@ -0,0 +1,662 @@
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "AuxiliaryData.h"
+#include "SimulationParameters.h"
+
+/**
+ * Compile-time tables of the persistent fields of the settings. They drive the JSON and binary encoding in
+ * AuxiliaryDataParserService, hence a new parameter only has to be registered here in order to be saved.
+ *
+ * Field names are node paths relative to the owning object (parts separated by '.'):
+ * - AuxiliaryDataFields:            relative to "general"
+ * - SimulationParametersFields:     relative to "simulation parameters"
+ * - RadiationSourceFields:          relative to "simulation parameters.particle sources.<index>"
+ * - SimulationParametersSpotFields: relative to "simulation parameters.spots.<index>"
+ * Elements of color vectors and matrices are stored in "<name>[i]" and "<name>[i, j]".
+ * MAX_MOTION_KEYFRAMES keyframes are registered per spot and particle source.
+ */
+
+enum class ParameterFieldType
+{
+    Bool,
+    Int,
+    UInt32,
+    UInt64,
+    Float,
+    ColorVectorInt,
+    ColorVectorFloat,
+    ColorMatrixBool,
+    ColorMatrixInt,
+    ColorMatrixFloat
+};
+
+template <typename Object>
+struct ParameterField
+{
+    char const* name = nullptr;
+    ParameterFieldType type = ParameterFieldType::Bool;
+    void* (*getValueRef)(Object& object) = nullptr;
+    bool (*isRelevant)(Object const& object) = nullptr;  //nullptr means always relevant, used for fields in unions
+};
+
+template <typename T>
+constexpr ParameterFieldType getParameterFieldType()
+{
+    if constexpr (std::is_same_v<T, bool>) {
+        return ParameterFieldType::Bool;
+    } else if constexpr (std::is_same_v<T, int>) {
+        return ParameterFieldType::Int;
+    } else if constexpr (std::is_same_v<T, uint32_t>) {
+        return ParameterFieldType::UInt32;
+    } else if constexpr (std::is_same_v<T, uint64_t>) {
+        return ParameterFieldType::UInt64;
+    } else if constexpr (std::is_same_v<T, float>) {
+        return ParameterFieldType::Float;
+    } else if constexpr (std::is_same_v<T, ColorVector<int>>) {
+        return ParameterFieldType::ColorVectorInt;
+    } else if constexpr (std::is_same_v<T, ColorVector<float>>) {
+        return ParameterFieldType::ColorVectorFloat;
+    } else if constexpr (std::is_same_v<T, ColorMatrix<bool>>) {
+        return ParameterFieldType::ColorMatrixBool;
+    } else if constexpr (std::is_same_v<T, ColorMatrix<int>>) {
+        return ParameterFieldType::ColorMatrixInt;
+    } else if constexpr (std::is_same_v<T, ColorMatrix<float>>) {
+        return ParameterFieldType::ColorMatrixFloat;
+    } else {
+        static_assert(sizeof(T) == 0, "unsupported parameter type");
+    }
+}
+
+constexpr int getNumParameterFieldElements(ParameterFieldType type)
+{
+    switch (type) {
+    case ParameterFieldType::ColorVectorInt:
+    case ParameterFieldType::ColorVectorFloat:
+        return MAX_COLORS;
+    case ParameterFieldType::ColorMatrixBool:
+    case ParameterFieldType::ColorMatrixInt:
+    case ParameterFieldType::ColorMatrixFloat:
+        return MAX_COLORS * MAX_COLORS;
+    default:
+        return 1;
+    }
+}
+
+constexpr int getParameterFieldElementSize(ParameterFieldType type)
+{
+    switch (type) {
+    case ParameterFieldType::Bool:
+    case ParameterFieldType::ColorMatrixBool:
+        return sizeof(bool);
+    case ParameterFieldType::UInt64:
+        return sizeof(uint64_t);
+    default:
+        return 4;
+    }
+}
+
+//the field type is deduced from the member returned by the accessor
+template <typename Object, typename Accessor>
+constexpr ParameterField<Object> createParameterField(char const* name, Accessor, bool (*isRelevant)(Object const&) = nullptr)
+{
+    using T = std::remove_cvref_t<decltype(*Accessor()(std::declval<Object&>()))>;
+    return {name, getParameterFieldType<T>(), [](Object& object) -> void* { return Accessor()(object); }, isRelevant};
+}
+
+template <typename MovingObject>
+constexpr bool isOscillationMotion(MovingObject const& object)
+{
+    return object.motion.type == ParameterMotionType_Oscillation;
+}
+
+template <typename MovingObject>
+constexpr bool isKeyframeMotion(MovingObject const& object)
+{
+    return object.motion.type == ParameterMotionType_Keyframes;
+}
+
+inline constexpr ParameterField<AuxiliaryData> AuxiliaryDataFields[] = {
+    createParameterField<AuxiliaryData>("time step", [](auto& data) { return &data.timestep; }),
+    createParameterField<AuxiliaryData>("zoom", [](auto& data) { return &data.zoom; }),
+    createParameterField<AuxiliaryData>("center.x", [](auto& data) { return &data.center.x; }),
+    createParameterField<AuxiliaryData>("center.y", [](auto& data) { return &data.center.y; }),
+    createParameterField<AuxiliaryData>("world size.x", [](auto& data) { return &data.generalSettings.worldSizeX; }),
+    createParameterField<AuxiliaryData>("world size.y", [](auto& data) { return &data.generalSettings.worldSizeY; }),
+};
+
+inline constexpr ParameterField<SimulationParameters> SimulationParametersFields[] = {
+    createParameterField<SimulationParameters>("background color", [](auto& p) { return &p.backgroundColor; }),
+    createParameterField<SimulationParameters>("cell colorization", [](auto& p) { return &p.cellColorization; }),
+    createParameterField<SimulationParameters>("zoom level.neural activity", [](auto& p) { return &p.zoomLevelNeuronalActivity; }),
+    createParameterField<SimulationParameters>("show detonations", [](auto& p) { return &p.showDetonations; }),
+    createParameterField<SimulationParameters>("time step size", [](auto& p) { return &p.timestepSize; }),
+
+    createParameterField<SimulationParameters>("motion.type", [](auto& p) { return &p.motionType; }),
+    createParameterField<SimulationParameters>(
+        "fluid.smoothing length",
+        [](auto& p) { return &p.motionData.fluidMotion.smoothingLength; },
+        [](SimulationParameters const& p) { return p.motionType == MotionType_Fluid; }),
+    createParameterField<SimulationParameters>(
+        "fluid.pressure strength",
+        [](auto& p) { return &p.motionData.fluidMotion.pressureStrength; },
+        [](SimulationParameters const& p) { return p.motionType == MotionType_Fluid; }),
+    createParameterField<SimulationParameters>(
+        "fluid.viscosity strength",
+        [](auto& p) { return &p.motionData.fluidMotion.viscosityStrength; },
+        [](SimulationParameters const& p) { return p.motionType == MotionType_Fluid; }),
+    createParameterField<SimulationParameters>(
+        "motion.collision.max distance",
+        [](auto& p) { return &p.motionData.collisionMotion.cellMaxCollisionDistance; },
+        [](SimulationParameters const& p) { return p.motionType != MotionType_Fluid; }),
+    createParameterField<SimulationParameters>(
+        "motion.collision.repulsion strength",
+        [](auto& p) { return &p.motionData.collisionMotion.cellRepulsionStrength; },
+        [](SimulationParameters const& p) { return p.motionType != MotionType_Fluid; }),
+
+    createParameterField<SimulationParameters>("friction", [](auto& p) { return &p.baseValues.friction; }),
+    createParameterField<SimulationParameters>("rigidity", [](auto& p) { return &p.baseValues.rigidity; }),
+    createParameterField<SimulationParameters>("cell.max velocity", [](auto& p) { return &p.cellMaxVelocity; }),
+    createParameterField<SimulationParameters>("cell.max binding distance", [](auto& p) { return &p.cellMaxBindingDistance; }),
+    createParameterField<SimulationParameters>("cell.normal energy", [](auto& p) { return &p.cellNormalEnergy; }),
+    createParameterField<SimulationParameters>("cell.min distance", [](auto& p) { return &p.cellMinDistance; }),
+    createParameterField<SimulationParameters>("cell.max force", [](auto& p) { return &p.baseValues.cellMaxForce; }),
+    createParameterField<SimulationParameters>("cell.max force decay probability", [](auto& p) { return &p.cellMaxForceDecayProb; }),
+    createParameterField<SimulationParameters>("cell.max execution order number", [](auto& p) { return &p.cellNumExecutionOrderNumbers; }),
+    createParameterField<SimulationParameters>("cell.min energy", [](auto& p) { return &p.baseValues.cellMinEnergy; }),
+    createParameterField<SimulationParameters>("cell.fusion velocity", [](auto& p) { return &p.baseValues.cellFusionVelocity; }),
+    createParameterField<SimulationParameters>("cell.max binding energy", [](auto& p) { return &p.baseValues.cellMaxBindingEnergy; }),
+    createParameterField<SimulationParameters>("cell.max age", [](auto& p) { return &p.cellMaxAge; }),
+    createParameterField<SimulationParameters>("cell.max age.balance.enabled", [](auto& p) { return &p.cellMaxAgeBalancer; }),
+    createParameterField<SimulationParameters>("cell.max age.balance.interval", [](auto& p) { return &p.cellMaxAgeBalancerInterval; }),
+    createParameterField<SimulationParameters>("cell.color transition rules.duration", [](auto& p) { return &p.baseValues.cellColorTransitionDuration; }),
+    createParameterField<SimulationParameters>(
+        "cell.color transition rules.target color", [](auto& p) { return &p.baseValues.cellColorTransitionTargetColor; }),
+    createParameterField<SimulationParameters>("radiation.factor", [](auto& p) { return &p.baseValues.radiationCellAgeStrength; }),
+    createParameterField<SimulationParameters>("radiation.probability", [](auto& p) { return &p.radiationProb; }),
+    createParameterField<SimulationParameters>("radiation.velocity multiplier", [](auto& p) { return &p.radiationVelocityMultiplier; }),
+    createParameterField<SimulationParameters>("radiation.velocity perturbation", [](auto& p) { return &p.radiationVelocityPerturbation; }),
+    createParameterField<SimulationParameters>("radiation.absorption", [](auto& p) { return &p.baseValues.radiationAbsorption; }),
+    createParameterField<SimulationParameters>("radiation.absorption velocity penalty", [](auto& p) { return &p.radiationAbsorptionVelocityPenalty; }),
+    createParameterField<SimulationParameters>("high radiation.min cell energy", [](auto& p) { return &p.highRadiationMinCellEnergy; }),
+    createParameterField<SimulationParameters>("high radiation.factor", [](auto& p) { return &p.highRadiationFactor; }),
+    createParameterField<SimulationParameters>("radiation.min cell age", [](auto& p) { return &p.radiationMinCellAge; }),
+
+    createParameterField<SimulationParameters>("cluster.decay", [](auto& p) { return &p.clusterDecay; }),
+    createParameterField<SimulationParameters>("cluster.decay probability", [](auto& p) { return &p.clusterDecayProb; }),
+
+    createParameterField<SimulationParameters>(
+        "cell.function.constructor.pump energy factor", [](auto& p) { return &p.cellFunctionConstructorPumpEnergyFactor; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.constructor.offspring distance", [](auto& p) { return &p.cellFunctionConstructorOffspringDistance; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.constructor.connecting cell max distance", [](auto& p) { return &p.cellFunctionConstructorConnectingCellMaxDistance; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.constructor.activity threshold", [](auto& p) { return &p.cellFunctionConstructorActivityThreshold; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.constructor.mutation probability.neuron data",
+        [](auto& p) { return &p.baseValues.cellFunctionConstructorMutationNeuronDataProbability; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.constructor.mutation probability.data", [](auto& p) { return &p.baseValues.cellFunctionConstructorMutationPropertiesProbability; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.constructor.mutation probability.geometry",
+        [](auto& p) { return &p.baseValues.cellFunctionConstructorMutationGeometryProbability; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.constructor.mutation probability.custom geometry",
+        [](auto& p) { return &p.baseValues.cellFunctionConstructorMutationCustomGeometryProbability; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.constructor.mutation probability.cell function",
+        [](auto& p) { return &p.baseValues.cellFunctionConstructorMutationCellFunctionProbability; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.constructor.mutation probability.insertion",
+        [](auto& p) { return &p.baseValues.cellFunctionConstructorMutationInsertionProbability; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.constructor.mutation probability.deletion",
+        [](auto& p) { return &p.baseValues.cellFunctionConstructorMutationDeletionProbability; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.constructor.mutation probability.translation",
+        [](auto& p) { return &p.baseValues.cellFunctionConstructorMutationTranslationProbability; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.constructor.mutation probability.duplication",
+        [](auto& p) { return &p.baseValues.cellFunctionConstructorMutationDuplicationProbability; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.constructor.mutation probability.color", [](auto& p) { return &p.baseValues.cellFunctionConstructorMutationColorProbability; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.constructor.mutation probability.uniform color",
+        [](auto& p) { return &p.baseValues.cellFunctionConstructorMutationUniformColorProbability; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.constructor.mutation color transition", [](auto& p) { return &p.cellFunctionConstructorMutationColorTransitions; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.constructor.mutation self replication", [](auto& p) { return &p.cellFunctionConstructorMutationSelfReplication; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.constructor.mutation prevent depth increase", [](auto& p) { return &p.cellFunctionConstructorMutationPreventDepthIncrease; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.constructor.completeness check for self-replication",
+        [](auto& p) { return &p.cellFunctionConstructorCheckCompletenessForSelfReplication; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.constructor.external energy", [](auto& p) { return &p.cellFunctionConstructorExternalEnergy; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.constructor.external energy supply rate", [](auto& p) { return &p.cellFunctionConstructorExternalEnergySupplyRate; }),
+
+    createParameterField<SimulationParameters>("cell.function.injector.radius", [](auto& p) { return &p.cellFunctionInjectorRadius; }),
+    createParameterField<SimulationParameters>("cell.function.injector.duration", [](auto& p) { return &p.cellFunctionInjectorDurationColorMatrix; }),
+
+    createParameterField<SimulationParameters>("cell.function.attacker.radius", [](auto& p) { return &p.cellFunctionAttackerRadius; }),
+    createParameterField<SimulationParameters>("cell.function.attacker.strength", [](auto& p) { return &p.cellFunctionAttackerStrength; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.attacker.energy distribution radius", [](auto& p) { return &p.cellFunctionAttackerEnergyDistributionRadius; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.attacker.energy distribution value", [](auto& p) { return &p.cellFunctionAttackerEnergyDistributionValue; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.attacker.color inhomogeneity factor", [](auto& p) { return &p.cellFunctionAttackerColorInhomogeneityFactor; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.attacker.activity threshold", [](auto& p) { return &p.cellFunctionAttackerActivityThreshold; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.attacker.energy cost", [](auto& p) { return &p.baseValues.cellFunctionAttackerEnergyCost; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.attacker.geometry deviation exponent", [](auto& p) { return &p.baseValues.cellFunctionAttackerGeometryDeviationExponent; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.attacker.food chain color matrix", [](auto& p) { return &p.baseValues.cellFunctionAttackerFoodChainColorMatrix; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.attacker.connections mismatch penalty", [](auto& p) { return &p.baseValues.cellFunctionAttackerConnectionsMismatchPenalty; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.attacker.genome size bonus", [](auto& p) { return &p.cellFunctionAttackerGenomeSizeBonus; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.attacker.same mutant penalty", [](auto& p) { return &p.cellFunctionAttackerSameMutantPenalty; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.attacker.sensor detection factor", [](auto& p) { return &p.cellFunctionAttackerSensorDetectionFactor; }),
+    createParameterField<SimulationParameters>("cell.function.attacker.destroy cells", [](auto& p) { return &p.cellFunctionAttackerDestroyCells; }),
+
+    createParameterField<SimulationParameters>(
+        "cell.function.defender.against attacker strength", [](auto& p) { return &p.cellFunctionDefenderAgainstAttackerStrength; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.defender.against injector strength", [](auto& p) { return &p.cellFunctionDefenderAgainstInjectorStrength; }),
+
+    createParameterField<SimulationParameters>(
+        "cell.function.transmitter.energy distribution same creature", [](auto& p) { return &p.cellFunctionTransmitterEnergyDistributionSameCreature; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.transmitter.energy distribution radius", [](auto& p) { return &p.cellFunctionTransmitterEnergyDistributionRadius; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.transmitter.energy distribution value", [](auto& p) { return &p.cellFunctionTransmitterEnergyDistributionValue; }),
+
+    createParameterField<SimulationParameters>(
+        "cell.function.muscle.contraction expansion delta", [](auto& p) { return &p.cellFunctionMuscleContractionExpansionDelta; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.muscle.movement acceleration", [](auto& p) { return &p.cellFunctionMuscleMovementAcceleration; }),
+    createParameterField<SimulationParameters>("cell.function.muscle.bending angle", [](auto& p) { return &p.cellFunctionMuscleBendingAngle; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.muscle.bending acceleration", [](auto& p) { return &p.cellFunctionMuscleBendingAcceleration; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.muscle.bending acceleration threshold", [](auto& p) { return &p.cellFunctionMuscleBendingAccelerationThreshold; }),
+
+    createParameterField<SimulationParameters>("particle.transformation allowed", [](auto& p) { return &p.particleTransformationAllowed; }),
+    createParameterField<SimulationParameters>(
+        "particle.transformation.random cell function", [](auto& p) { return &p.particleTransformationRandomCellFunction; }),
+    createParameterField<SimulationParameters>("particle.transformation.max genome size", [](auto& p) { return &p.particleTransformationMaxGenomeSize; }),
+
+    createParameterField<SimulationParameters>("cell.function.sensor.range", [](auto& p) { return &p.cellFunctionSensorRange; }),
+    createParameterField<SimulationParameters>("cell.function.sensor.activity threshold", [](auto& p) { return &p.cellFunctionSensorActivityThreshold; }),
+
+    createParameterField<SimulationParameters>("cell.function.reconnector.radius", [](auto& p) { return &p.cellFunctionReconnectorRadius; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.reconnector.activity threshold", [](auto& p) { return &p.cellFunctionReconnectorActivityThreshold; }),
+
+    createParameterField<SimulationParameters>("cell.function.detonator.radius", [](auto& p) { return &p.cellFunctionDetonatorRadius; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.detonator.chain explosion probability", [](auto& p) { return &p.cellFunctionDetonatorChainExplosionProbability; }),
+    createParameterField<SimulationParameters>(
+        "cell.function.detonator.activity threshold", [](auto& p) { return &p.cellFunctionDetonatorActivityThreshold; }),
+
+    createParameterField<SimulationParameters>("particle sources.num sources", [](auto& p) { return &p.numParticleSources; }),
+    createParameterField<SimulationParameters>("spots.num spots", [](auto& p) { return &p.numSpots; }),
+};
+
+inline constexpr ParameterField<RadiationSource> RadiationSourceFields[] = {
+    createParameterField<RadiationSource>("pos.x", [](auto& source) { return &source.posX; }),
+    createParameterField<RadiationSource>("pos.y", [](auto& source) { return &source.posY; }),
+    createParameterField<RadiationSource>("vel.x", [](auto& source) { return &source.velX; }),
+    createParameterField<RadiationSource>("vel.y", [](auto& source) { return &source.velY; }),
+    createParameterField<RadiationSource>("motion.type", [](auto& source) { return &source.motion.type; }),
+    createParameterField<RadiationSource>(
+        "motion.oscillation.amplitude.x",
+        [](auto& source) { return &source.motion.oscillation.amplitudeX; },
+        isOscillationMotion<RadiationSource>),
+    createParameterField<RadiationSource>(
+        "motion.oscillation.amplitude.y",
+        [](auto& source) { return &source.motion.oscillation.amplitudeY; },
+        isOscillationMotion<RadiationSource>),
+    createParameterField<RadiationSource>(
+        "motion.oscillation.period",
+        [](auto& source) { return &source.motion.oscillation.period; },
+        isOscillationMotion<RadiationSource>),
+    createParameterField<RadiationSource>(
+        "motion.oscillation.phase",
+        [](auto& source) { return &source.motion.oscillation.phase; },
+        isOscillationMotion<RadiationSource>),
+    createParameterField<RadiationSource>(
+        "motion.keyframes.num keyframes",
+        [](auto& source) { return &source.motion.keyframes.numKeyframes; },
+        isKeyframeMotion<RadiationSource>),
+    createParameterField<RadiationSource>(
+        "motion.keyframes.repeat",
+        [](auto& source) { return &source.motion.keyframes.repeat; },
+        isKeyframeMotion<RadiationSource>),
+    createParameterField<RadiationSource>(
+        "motion.keyframes.0.time step",
+        [](auto& source) { return &source.motion.keyframes.timesteps[0]; },
+        isKeyframeMotion<RadiationSource>),
+    createParameterField<RadiationSource>(
+        "motion.keyframes.0.pos.x",
+        [](auto& source) { return &source.motion.keyframes.posX[0]; },
+        isKeyframeMotion<RadiationSource>),
+    createParameterField<RadiationSource>(
+        "motion.keyframes.0.pos.y",
+        [](auto& source) { return &source.motion.keyframes.posY[0]; },
+        isKeyframeMotion<RadiationSource>),
+    createParameterField<RadiationSource>(
+        "motion.keyframes.1.time step",
+        [](auto& source) { return &source.motion.keyframes.timesteps[1]; },
+        isKeyframeMotion<RadiationSource>),
+    createParameterField<RadiationSource>(
+        "motion.keyframes.1.pos.x",
+        [](auto& source) { return &source.motion.keyframes.posX[1]; },
+        isKeyframeMotion<RadiationSource>),
+    createParameterField<RadiationSource>(
+        "motion.keyframes.1.pos.y",
+        [](auto& source) { return &source.motion.keyframes.posY[1]; },
+        isKeyframeMotion<RadiationSource>),
+    createParameterField<RadiationSource>(
+        "motion.keyframes.2.time step",
+        [](auto& source) { return &source.motion.keyframes.timesteps[2]; },
+        isKeyframeMotion<RadiationSource>),
+    createParameterField<RadiationSource>(
+        "motion.keyframes.2.pos.x",
+        [](auto& source) { return &source.motion.keyframes.posX[2]; },
+        isKeyframeMotion<RadiationSource>),
+    createParameterField<RadiationSource>(
+        "motion.keyframes.2.pos.y",
+        [](auto& source) { return &source.motion.keyframes.posY[2]; },
+        isKeyframeMotion<RadiationSource>),
+    createParameterField<RadiationSource>(
+        "motion.keyframes.3.time step",
+        [](auto& source) { return &source.motion.keyframes.timesteps[3]; },
+        isKeyframeMotion<RadiationSource>),
+    createParameterField<RadiationSource>(
+        "motion.keyframes.3.pos.x",
+        [](auto& source) { return &source.motion.keyframes.posX[3]; },
+        isKeyframeMotion<RadiationSource>),
+    createParameterField<RadiationSource>(
+        "motion.keyframes.3.pos.y",
+        [](auto& source) { return &source.motion.keyframes.posY[3]; },
+        isKeyframeMotion<RadiationSource>),
+    createParameterField<RadiationSource>("use angle", [](auto& source) { return &source.useAngle; }),
+    createParameterField<RadiationSource>("angle", [](auto& source) { return &source.angle; }),
+    createParameterField<RadiationSource>("shape.type", [](auto& source) { return &source.shapeType; }),
+    createParameterField<RadiationSource>(
+        "shape.circular.radius",
+        [](auto& source) { return &source.shapeData.circularRadiationSource.radius; },
+        [](RadiationSource const& source) { return source.shapeType == RadiationSourceShapeType_Circular; }),
+    createParameterField<RadiationSource>(
+        "shape.rectangular.width",
+        [](auto& source) { return &source.shapeData.rectangularRadiationSource.width; },
+        [](RadiationSource const& source) { return source.shapeType == RadiationSourceShapeType_Rectangular; }),
+    createParameterField<RadiationSource>(
+        "shape.rectangular.height",
+        [](auto& source) { return &source.shapeData.rectangularRadiationSource.height; },
+        [](RadiationSource const& source) { return source.shapeType == RadiationSourceShapeType_Rectangular; }),
+};
+
+inline constexpr ParameterField<SimulationParametersSpot> SimulationParametersSpotFields[] = {
+    createParameterField<SimulationParametersSpot>("color", [](auto& spot) { return &spot.color; }),
+    createParameterField<SimulationParametersSpot>("pos.x", [](auto& spot) { return &spot.posX; }),
+    createParameterField<SimulationParametersSpot>("pos.y", [](auto& spot) { return &spot.posY; }),
+    createParameterField<SimulationParametersSpot>("vel.x", [](auto& spot) { return &spot.velX; }),
+    createParameterField<SimulationParametersSpot>("vel.y", [](auto& spot) { return &spot.velY; }),
+    createParameterField<SimulationParametersSpot>("motion.type", [](auto& spot) { return &spot.motion.type; }),
+    createParameterField<SimulationParametersSpot>(
+        "motion.oscillation.amplitude.x",
+        [](auto& spot) { return &spot.motion.oscillation.amplitudeX; },
+        isOscillationMotion<SimulationParametersSpot>),
+    createParameterField<SimulationParametersSpot>(
+        "motion.oscillation.amplitude.y",
+        [](auto& spot) { return &spot.motion.oscillation.amplitudeY; },
+        isOscillationMotion<SimulationParametersSpot>),
+    createParameterField<SimulationParametersSpot>(
+        "motion.oscillation.period",
+        [](auto& spot) { return &spot.motion.oscillation.period; },
+        isOscillationMotion<SimulationParametersSpot>),
+    createParameterField<SimulationParametersSpot>(
+        "motion.oscillation.phase",
+        [](auto& spot) { return &spot.motion.oscillation.phase; },
+        isOscillationMotion<SimulationParametersSpot>),
+    createParameterField<SimulationParametersSpot>(
+        "motion.keyframes.num keyframes",
+        [](auto& spot) { return &spot.motion.keyframes.numKeyframes; },
+        isKeyframeMotion<SimulationParametersSpot>),
+    createParameterField<SimulationParametersSpot>(
+        "motion.keyframes.repeat",
+        [](auto& spot) { return &spot.motion.keyframes.repeat; },
+        isKeyframeMotion<SimulationParametersSpot>),
+    createParameterField<SimulationParametersSpot>(
+        "motion.keyframes.0.time step",
+        [](auto& spot) { return &spot.motion.keyframes.timesteps[0]; },
+        isKeyframeMotion<SimulationParametersSpot>),
+    createParameterField<SimulationParametersSpot>(
+        "motion.keyframes.0.pos.x",
+        [](auto& spot) { return &spot.motion.keyframes.posX[0]; },
+        isKeyframeMotion<SimulationParametersSpot>),
+    createParameterField<SimulationParametersSpot>(
+        "motion.keyframes.0.pos.y",
+        [](auto& spot) { return &spot.motion.keyframes.posY[0]; },
+        isKeyframeMotion<SimulationParametersSpot>),
+    createParameterField<SimulationParametersSpot>(
+        "motion.keyframes.1.time step",
+        [](auto& spot) { return &spot.motion.keyframes.timesteps[1]; },
+        isKeyframeMotion<SimulationParametersSpot>),
+    createParameterField<SimulationParametersSpot>(
+        "motion.keyframes.1.pos.x",
+        [](auto& spot) { return &spot.motion.keyframes.posX[1]; },
+        isKeyframeMotion<SimulationParametersSpot>),
+    createParameterField<SimulationParametersSpot>(
+        "motion.keyframes.1.pos.y",
+        [](auto& spot) { return &spot.motion.keyframes.posY[1]; },
+        isKeyframeMotion<SimulationParametersSpot>),
+    createParameterField<SimulationParametersSpot>(
+        "motion.keyframes.2.time step",
+        [](auto& spot) { return &spot.motion.keyframes.timesteps[2]; },
+        isKeyframeMotion<SimulationParametersSpot>),
+    createParameterField<SimulationParametersSpot>(
+        "motion.keyframes.2.pos.x",
+        [](auto& spot) { return &spot.motion.keyframes.posX[2]; },
+        isKeyframeMotion<SimulationParametersSpot>),
+    createParameterField<SimulationParametersSpot>(
+        "motion.keyframes.2.pos.y",
+        [](auto& spot) { return &spot.motion.keyframes.posY[2]; },
+        isKeyframeMotion<SimulationParametersSpot>),
+    createParameterField<SimulationParametersSpot>(
+        "motion.keyframes.3.time step",
+        [](auto& spot) { return &spot.motion.keyframes.timesteps[3]; },
+        isKeyframeMotion<SimulationParametersSpot>),
+    createParameterField<SimulationParametersSpot>(
+        "motion.keyframes.3.pos.x",
+        [](auto& spot) { return &spot.motion.keyframes.posX[3]; },
+        isKeyframeMotion<SimulationParametersSpot>),
+    createParameterField<SimulationParametersSpot>(
+        "motion.keyframes.3.pos.y",
+        [](auto& spot) { return &spot.motion.keyframes.posY[3]; },
+        isKeyframeMotion<SimulationParametersSpot>),
+
+    createParameterField<SimulationParametersSpot>("shape.type", [](auto& spot) { return &spot.shapeType; }),
+    createParameterField<SimulationParametersSpot>(
+        "shape.circular.core radius",
+        [](auto& spot) { return &spot.shapeData.circularSpot.coreRadius; },
+        [](SimulationParametersSpot const& spot) { return spot.shapeType == SpotShapeType_Circular; }),
+    createParameterField<SimulationParametersSpot>(
+        "shape.rectangular.core width",
+        [](auto& spot) { return &spot.shapeData.rectangularSpot.width; },
+        [](SimulationParametersSpot const& spot) { return spot.shapeType == SpotShapeType_Rectangular; }),
+    createParameterField<SimulationParametersSpot>(
+        "shape.rectangular.core height",
+        [](auto& spot) { return &spot.shapeData.rectangularSpot.height; },
+        [](SimulationParametersSpot const& spot) { return spot.shapeType == SpotShapeType_Rectangular; }),
+
+    createParameterField<SimulationParametersSpot>("flow.type", [](auto& spot) { return &spot.flowType; }),
+    createParameterField<SimulationParametersSpot>(
+        "flow.radial.orientation",
+        [](auto& spot) { return &spot.flowData.radialFlow.orientation; },
+        [](SimulationParametersSpot const& spot) { return spot.flowType == FlowType_Radial; }),
+    createParameterField<SimulationParametersSpot>(
+        "flow.radial.strength",
+        [](auto& spot) { return &spot.flowData.radialFlow.strength; },
+        [](SimulationParametersSpot const& spot) { return spot.flowType == FlowType_Radial; }),
+    createParameterField<SimulationParametersSpot>(
+        "flow.radial.drift angle",
+        [](auto& spot) { return &spot.flowData.radialFlow.driftAngle; },
+        [](SimulationParametersSpot const& spot) { return spot.flowType == FlowType_Radial; }),
+    createParameterField<SimulationParametersSpot>(
+        "flow.central.strength",
+        [](auto& spot) { return &spot.flowData.centralFlow.strength; },
+        [](SimulationParametersSpot const& spot) { return spot.flowType == FlowType_Central; }),
+    createParameterField<SimulationParametersSpot>(
+        "flow.linear.angle",
+        [](auto& spot) { return &spot.flowData.linearFlow.angle; },
+        [](SimulationParametersSpot const& spot) { return spot.flowType == FlowType_Linear; }),
+    createParameterField<SimulationParametersSpot>(
+        "flow.linear.strength",
+        [](auto& spot) { return &spot.flowData.linearFlow.strength; },
+        [](SimulationParametersSpot const& spot) { return spot.flowType == FlowType_Linear; }),
+    createParameterField<SimulationParametersSpot>("fadeout radius", [](auto& spot) { return &spot.fadeoutRadius; }),
+
+    createParameterField<SimulationParametersSpot>("friction.activated", [](auto& spot) { return &spot.activatedValues.friction; }),
+    createParameterField<SimulationParametersSpot>("friction.value", [](auto& spot) { return &spot.values.friction; }),
+    createParameterField<SimulationParametersSpot>("rigidity.activated", [](auto& spot) { return &spot.activatedValues.rigidity; }),
+    createParameterField<SimulationParametersSpot>("rigidity.value", [](auto& spot) { return &spot.values.rigidity; }),
+    createParameterField<SimulationParametersSpot>("radiation.absorption.activated", [](auto& spot) { return &spot.activatedValues.radiationAbsorption; }),
+    createParameterField<SimulationParametersSpot>("radiation.absorption", [](auto& spot) { return &spot.values.radiationAbsorption; }),
+    createParameterField<SimulationParametersSpot>("radiation.factor.activated", [](auto& spot) { return &spot.activatedValues.radiationCellAgeStrength; }),
+    createParameterField<SimulationParametersSpot>("radiation.factor", [](auto& spot) { return &spot.values.radiationCellAgeStrength; }),
+    createParameterField<SimulationParametersSpot>("cell.max force.activated", [](auto& spot) { return &spot.activatedValues.cellMaxForce; }),
+    createParameterField<SimulationParametersSpot>("cell.max force.value", [](auto& spot) { return &spot.values.cellMaxForce; }),
+    createParameterField<SimulationParametersSpot>("cell.min energy.activated", [](auto& spot) { return &spot.activatedValues.cellMinEnergy; }),
+    createParameterField<SimulationParametersSpot>("cell.min energy", [](auto& spot) { return &spot.values.cellMinEnergy; }),
+    createParameterField<SimulationParametersSpot>("cell.fusion velocity.activated", [](auto& spot) { return &spot.activatedValues.cellFusionVelocity; }),
+    createParameterField<SimulationParametersSpot>("cell.fusion velocity.value", [](auto& spot) { return &spot.values.cellFusionVelocity; }),
+    createParameterField<SimulationParametersSpot>(
+        "cell.max binding energy.activated", [](auto& spot) { return &spot.activatedValues.cellMaxBindingEnergy; }),
+    createParameterField<SimulationParametersSpot>("cell.max binding energy.value", [](auto& spot) { return &spot.values.cellMaxBindingEnergy; }),
+    createParameterField<SimulationParametersSpot>(
+        "cell.color transition rules.activated", [](auto& spot) { return &spot.activatedValues.cellColorTransition; }),
+    createParameterField<SimulationParametersSpot>(
+        "cell.color transition rules.duration", [](auto& spot) { return &spot.values.cellColorTransitionDuration; }),
+    createParameterField<SimulationParametersSpot>(
+        "cell.color transition rules.target color", [](auto& spot) { return &spot.values.cellColorTransitionTargetColor; }),
+
+    createParameterField<SimulationParametersSpot>(
+        "cell.function.attacker.energy cost.activated", [](auto& spot) { return &spot.activatedValues.cellFunctionAttackerEnergyCost; }),
+    createParameterField<SimulationParametersSpot>(
+        "cell.function.attacker.energy cost", [](auto& spot) { return &spot.values.cellFunctionAttackerEnergyCost; }),
+    createParameterField<SimulationParametersSpot>(
+        "cell.function.attacker.food chain color matrix.activated",
+        [](auto& spot) { return &spot.activatedValues.cellFunctionAttackerFoodChainColorMatrix; }),
+    createParameterField<SimulationParametersSpot>(
+        "cell.function.attacker.food chain color matrix", [](auto& spot) { return &spot.values.cellFunctionAttackerFoodChainColorMatrix; }),
+    createParameterField<SimulationParametersSpot>(
+        "cell.function.attacker.geometry deviation exponent.activated",
+        [](auto& spot) { return &spot.activatedValues.cellFunctionAttackerGeometryDeviationExponent; }),
+    createParameterField<SimulationParametersSpot>(
+        "cell.function.attacker.geometry deviation exponent", [](auto& spot) { return &spot.values.cellFunctionAttackerGeometryDeviationExponent; }),
+    createParameterField<SimulationParametersSpot>(
+        "cell.function.attacker.connections mismatch penalty.activated",
+        [](auto& spot) { return &spot.activatedValues.cellFunctionAttackerConnectionsMismatchPenalty; }),
+    createParameterField<SimulationParametersSpot>(
+        "cell.function.attacker.connections mismatch penalty", [](auto& spot) { return &spot.values.cellFunctionAttackerConnectionsMismatchPenalty; }),
+
+    createParameterField<SimulationParametersSpot>(
+        "cell.function.constructor.mutation probability.neuron data.activated",
+        [](auto& spot) { return &spot.activatedValues.cellFunctionConstructorMutationNeuronDataProbability; }),
+    createParameterField<SimulationParametersSpot>(
+        "cell.function.constructor.mutation probability.neuron data",
+        [](auto& spot) { return &spot.values.cellFunctionConstructorMutationNeuronDataProbability; }),
+    //the trailing space in "data " is part of the file format
+    createParameterField<SimulationParametersSpot>(
+        "cell.function.constructor.mutation probability.data .activated",
+        [](auto& spot) { return &spot.activatedValues.cellFunctionConstructorMutationPropertiesProbability; }),
+    createParameterField<SimulationParametersSpot>(
+        "cell.function.constructor.mutation probability.data ",
+        [](auto& spot) { return &spot.values.cellFunctionConstructorMutationPropertiesProbability; }),
+    createParameterField<SimulationParametersSpot>(
+        "cell.function.constructor.mutation probability.geometry.activated",
+        [](auto& spot) { return &spot.activatedValues.cellFunctionConstructorMutationGeometryProbability; }),
+    createParameterField<SimulationParametersSpot>(
+        "cell.function.constructor.mutation probability.geometry",
+        [](auto& spot) { return &spot.values.cellFunctionConstructorMutationGeometryProbability; }),
+    createParameterField<SimulationParametersSpot>(
+        "cell.function.constructor.mutation probability.custom geometry.activated",
+        [](auto& spot) { return &spot.activatedValues.cellFunctionConstructorMutationCustomGeometryProbability; }),
+    createParameterField<SimulationParametersSpot>(
+        "cell.function.constructor.mutation probability.custom geometry",
+        [](auto& spot) { return &spot.values.cellFunctionConstructorMutationCustomGeometryProbability; }),
+    createParameterField<SimulationParametersSpot>(
+        "cell.function.constructor.mutation probability.cell function.activated",
+        [](auto& spot) { return &spot.activatedValues.cellFunctionConstructorMutationCellFunctionProbability; }),
+    createParameterField<SimulationParametersSpot>(
+        "cell.function.constructor.mutation probability.cell function",
+        [](auto& spot) { return &spot.values.cellFunctionConstructorMutationCellFunctionProbability; }),
+    createParameterField<SimulationParametersSpot>(
+        "cell.function.constructor.mutation probability.insertion.activated",
+        [](auto& spot) { return &spot.activatedValues.cellFunctionConstructorMutationInsertionProbability; }),
+    createParameterField<SimulationParametersSpot>(
+        "cell.function.constructor.mutation probability.insertion",
+        [](auto& spot) { return &spot.values.cellFunctionConstructorMutationInsertionProbability; }),
+    createParameterField<SimulationParametersSpot>(
+        "cell.function.constructor.mutation probability.deletion.activated",
+        [](auto& spot) { return &spot.activatedValues.cellFunctionConstructorMutationDeletionProbability; }),
+    createParameterField<SimulationParametersSpot>(
+        "cell.function.constructor.mutation probability.deletion",
+        [](auto& spot) { return &spot.values.cellFunctionConstructorMutationDeletionProbability; }),
+    createParameterField<SimulationParametersSpot>(
+        "cell.function.constructor.mutation probability.translation.activated",
+        [](auto& spot) { return &spot.activatedValues.cellFunctionConstructorMutationTranslationProbability; }),
+    createParameterField<SimulationParametersSpot>(
+        "cell.function.constructor.mutation probability.translation",
+        [](auto& spot) { return &spot.values.cellFunctionConstructorMutationTranslationProbability; }),
+    createParameterField<SimulationParametersSpot>(
+        "cell.function.constructor.mutation probability.duplication.activated",
+        [](auto& spot) { return &spot.activatedValues.cellFunctionConstructorMutationDuplicationProbability; }),
+    createParameterField<SimulationParametersSpot>(
+        "cell.function.constructor.mutation probability.duplication",
+        [](auto& spot) { return &spot.values.cellFunctionConstructorMutationDuplicationProbability; }),
+    createParameterField<SimulationParametersSpot>(
+        "cell.function.constructor.mutation probability.color.activated",
+        [](auto& spot) { return &spot.activatedValues.cellFunctionConstructorMutationColorProbability; }),
+    createParameterField<SimulationParametersSpot>(
+        "cell.function.constructor.mutation probability.color", [](auto& spot) { return &spot.values.cellFunctionConstructorMutationColorProbability; }),
+    createParameterField<SimulationParametersSpot>(
+        "cell.function.constructor.mutation probability.uniform color.activated",
+        [](auto& spot) { return &spot.activatedValues.cellFunctionConstructorMutationUniformColorProbability; }),
+    createParameterField<SimulationParametersSpot>(
+        "cell.function.constructor.mutation probability.uniform color",
+        [](auto& spot) { return &spot.values.cellFunctionConstructorMutationUniformColorProbability; }),
+};
+
+//changes whenever names, types or order of the fields change, used to validate binary encoded parameters
+constexpr uint64_t calcParameterFieldsLayoutHash()
+{
+    auto hashFields = [](uint64_t hash, auto const& fields) {
+        for (auto const& field : fields) {
+            for (auto c = field.name; *c != '\0'; ++c) {
+                hash = (hash ^ static_cast<uint8_t>(*c)) * 1099511628211ull;
+            }
+            hash = (hash ^ static_cast<uint8_t>(field.type)) * 1099511628211ull;
+        }
+        return hash;
+    };
+    uint64_t result = 14695981039346656037ull;  //FNV-1a
+    result = hashFields(result, SimulationParametersFields);
+    result = hashFields(result, RadiationSourceFields);
+    result = hashFields(result, SimulationParametersSpotFields);
+    return result;
+}
@@ -2,6 +2,7 @@
 
 #include <cstdint>
 
+#include "ParameterMotion.h"
 #include "SimulationParametersSpotActivatedValues.h"
 #include "SimulationParametersSpotValues.h"
 
@@ -93,6 +94,7 @@ struct SimulationParametersSpot
     float posY = 0;
     float velX= 0;
     float velY = 0;
+    ParameterMotion motion;
 
     float fadeoutRadius = 100.0f;
 
@@ -140,7 +142,7 @@ struct SimulationParametersSpot
         }
 
         return color == other.color && posX == other.posX && posY == other.posY && velX == other.velX && velY == other.velY
-            && fadeoutRadius == other.fadeoutRadius && values == other.values && activatedValues == other.activatedValues && shapeType == other.shapeType;
+            && motion == other.motion && fadeoutRadius == other.fadeoutRadius && values == other.values && activatedValues == other.activatedValues && shapeType == other.shapeType;
     }
     bool operator!=(SimulationParametersSpot const& other) const { return !operator==(other); }
 };
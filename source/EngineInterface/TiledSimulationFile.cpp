@@ -0,0 +1,339 @@
+#include "TiledSimulationFile.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+
+#include "ChunkedCompressionService.h"
+#include "ColumnarSerializerService.h"
+
+namespace
+{
+    char constexpr Magic[] = {'A', 'L', 'I', 'E', 'N', 'T', 'I', 'L'};
+    uint32_t constexpr FormatVersion = 1;
+
+    struct FileHeader
+    {
+        char magic[sizeof(Magic)];
+        uint32_t version;
+        float tileSize;
+        int32_t worldSizeX;  //0 if unknown, i.e. no wrap-around
+        int32_t worldSizeY;
+        uint64_t numTiles;
+        uint64_t numClusters;
+        uint64_t numCellIds;
+    };
+
+    void checkData(bool condition)
+    {
+        if (!condition) {
+            throw std::runtime_error("Simulation data is corrupt.");
+        }
+    }
+
+    template <typename T>
+    void writeValue(std::ostream& stream, T const& value)
+    {
+        stream.write(reinterpret_cast<char const*>(&value), sizeof(T));
+    }
+
+    std::pair<int32_t, int32_t> getTile(RealVector2D const& pos, float tileSize)
+    {
+        return {static_cast<int32_t>(std::floor(pos.x / tileSize)), static_cast<int32_t>(std::floor(pos.y / tileSize))};
+    }
+
+    RealVector2D getClusterPos(ClusterDescription const& cluster)
+    {
+        return cluster.cells.empty() ? RealVector2D() : cluster.getClusterPosFromCells();
+    }
+
+    bool isInside(RealVector2D const& pos, RealVector2D const& topLeft, RealVector2D const& bottomRight)
+    {
+        return pos.x >= topLeft.x && pos.x < bottomRight.x && pos.y >= topLeft.y && pos.y < bottomRight.y;
+    }
+
+    float getValueInWorld(float value, int worldSize)
+    {
+        if (worldSize <= 0) {
+            return value;
+        }
+        auto size = toFloat(worldSize);
+        auto result = std::fmod(value, size);
+        if (result < 0) {
+            result += size;
+        }
+        return result < size ? result : 0.0f;
+    }
+
+    //splits [start, end) into intervals inside [0, worldSize)
+    std::vector<std::pair<float, float>> getIntervalsInWorld(float start, float end, int worldSize)
+    {
+        if (worldSize <= 0) {
+            return {{start, end}};
+        }
+        auto size = toFloat(worldSize);
+        auto length = end - start;
+        if (length < 0) {
+            length += size;
+        }
+        if (length >= size) {
+            return {{0.0f, size}};
+        }
+        auto startInWorld = getValueInWorld(start, worldSize);
+        auto endInWorld = startInWorld + length;
+        if (endInWorld <= size) {
+            return {{startInWorld, endInWorld}};
+        }
+        return {{startInWorld, size}, {0.0f, endInWorld - size}};
+    }
+}
+
+void TiledSimulationFile::write(std::string const& filename, ClusteredDataDescription const& data, IntVector2D const& worldSize, float tileSize)
+{
+    if (!(tileSize > 0)) {
+        throw std::runtime_error("Invalid tile size.");
+    }
+
+    std::map<std::pair<int32_t, int32_t>, ClusteredDataDescription> tiles;
+    std::vector<std::pair<int32_t, int32_t>> tileByCluster;
+    std::vector<uint32_t> indexInTileByCluster;
+    tileByCluster.reserve(data.clusters.size());
+    indexInTileByCluster.reserve(data.clusters.size());
+    auto getPosInWorld = [&](RealVector2D const& pos) {
+        return RealVector2D{getValueInWorld(pos.x, worldSize.x), getValueInWorld(pos.y, worldSize.y)};
+    };
+    for (auto const& cluster : data.clusters) {
+        auto tile = getTile(getPosInWorld(getClusterPos(cluster)), tileSize);
+        auto& tileData = tiles[tile];
+        tileByCluster.emplace_back(tile);
+        indexInTileByCluster.emplace_back(static_cast<uint32_t>(tileData.clusters.size()));
+        tileData.clusters.emplace_back(cluster);
+    }
+    for (auto const& particle : data.particles) {
+        tiles[getTile(getPosInWorld(particle.pos), tileSize)].particles.emplace_back(particle);
+    }
+
+    std::vector<CellIdEntry> cellIdTable;
+    for (uint64_t clusterIndex = 0; clusterIndex < data.clusters.size(); ++clusterIndex) {
+        for (auto const& cell : data.clusters[clusterIndex].cells) {
+            cellIdTable.emplace_back(CellIdEntry{cell.id, clusterIndex});
+        }
+    }
+    std::sort(cellIdTable.begin(), cellIdTable.end(), [](auto const& left, auto const& right) { return left.cellId < right.cellId; });
+
+    std::vector<std::string> compressedTiles;
+    std::map<std::pair<int32_t, int32_t>, uint32_t> tileIndices;
+    compressedTiles.reserve(tiles.size());
+    for (auto const& [tile, tileData] : tiles) {
+        std::ostringstream stream;
+        ColumnarSerializerService::serialize(tileData, stream);
+        tileIndices.emplace(tile, static_cast<uint32_t>(compressedTiles.size()));
+        compressedTiles.emplace_back(ChunkedCompressionService::compress(std::move(stream).str()));
+    }
+
+    FileHeader header;
+    std::memcpy(header.magic, Magic, sizeof(Magic));
+    header.version = FormatVersion;
+    header.tileSize = tileSize;
+    header.worldSizeX = std::max(0, worldSize.x);
+    header.worldSizeY = std::max(0, worldSize.y);
+    header.numTiles = tiles.size();
+    header.numClusters = data.clusters.size();
+    header.numCellIds = cellIdTable.size();
+
+    std::ofstream stream(filename, std::ios::binary);
+    if (!stream) {
+        throw std::runtime_error("Could not open " + filename + ".");
+    }
+    writeValue(stream, header);
+
+    auto offset = sizeof(FileHeader) + sizeof(TileEntry) * tiles.size() + sizeof(ClusterEntry) * data.clusters.size()
+        + sizeof(CellIdEntry) * cellIdTable.size();
+    auto tileIter = tiles.begin();
+    for (auto const& compressedTile : compressedTiles) {
+        writeValue(stream, TileEntry{tileIter->first.first, tileIter->first.second, offset, compressedTile.size()});
+        offset += compressedTile.size();
+        ++tileIter;
+    }
+    for (size_t clusterIndex = 0; clusterIndex < data.clusters.size(); ++clusterIndex) {
+        writeValue(stream, ClusterEntry{tileIndices.at(tileByCluster[clusterIndex]), indexInTileByCluster[clusterIndex]});
+    }
+    for (auto const& entry : cellIdTable) {
+        writeValue(stream, entry);
+    }
+    for (auto const& compressedTile : compressedTiles) {
+        stream.write(compressedTile.data(), compressedTile.size());
+    }
+    if (!stream) {
+        throw std::runtime_error("Could not write " + filename + ".");
+    }
+}
+
+bool TiledSimulationFile::isTiledFile(std::string const& filename)
+{
+    std::ifstream stream(filename, std::ios::binary);
+    char magic[sizeof(Magic)];
+    stream.read(magic, sizeof(magic));
+    return stream && std::equal(std::begin(Magic), std::end(Magic), magic);
+}
+
+TiledSimulationFile::TiledSimulationFile(std::string const& filename)
+    : _file(filename)
+{
+    checkData(_file.getSize() >= sizeof(FileHeader));
+    FileHeader header;
+    std::memcpy(&header, _file.getData(), sizeof(FileHeader));
+    checkData(std::equal(std::begin(Magic), std::end(Magic), header.magic));
+    if (header.version > FormatVersion) {
+        throw std::runtime_error("Format version not supported.");
+    }
+    checkData(header.tileSize > 0);
+
+    auto remainingSize = _file.getSize() - sizeof(FileHeader);
+    checkData(header.numTiles <= remainingSize / sizeof(TileEntry));
+    remainingSize -= header.numTiles * sizeof(TileEntry);
+    checkData(header.numClusters <= remainingSize / sizeof(ClusterEntry));
+    remainingSize -= header.numClusters * sizeof(ClusterEntry);
+    checkData(header.numCellIds <= remainingSize / sizeof(CellIdEntry));
+
+    _tileSize = header.tileSize;
+    _worldSize = {std::max(0, header.worldSizeX), std::max(0, header.worldSizeY)};
+    _numTiles = header.numTiles;
+    _numClusters = header.numClusters;
+    _numCellIds = header.numCellIds;
+    _tileTableOffset = sizeof(FileHeader);
+    _clusterTableOffset = _tileTableOffset + sizeof(TileEntry) * _numTiles;
+    _cellIdTableOffset = _clusterTableOffset + sizeof(ClusterEntry) * _numClusters;
+}
+
+uint64_t TiledSimulationFile::getNumClusters() const
+{
+    return _numClusters;
+}
+
+IntVector2D TiledSimulationFile::getWorldSize() const
+{
+    return _worldSize;
+}
+
+ClusteredDataDescription TiledSimulationFile::getRegion(RealVector2D const& topLeft, RealVector2D const& bottomRight) const
+{
+    ClusteredDataDescription result;
+    for (auto const& [startX, endX] : getIntervalsInWorld(topLeft.x, bottomRight.x, _worldSize.x)) {
+        for (auto const& [startY, endY] : getIntervalsInWorld(topLeft.y, bottomRight.y, _worldSize.y)) {
+            addRegionInWorld(result, {startX, startY}, {endX, endY});
+        }
+    }
+    return result;
+}
+
+std::optional<ClusterDescription> TiledSimulationFile::getCluster(uint64_t clusterIndex) const
+{
+    if (clusterIndex >= _numClusters) {
+        return std::nullopt;
+    }
+    auto entry = readEntry<ClusterEntry>(_clusterTableOffset, clusterIndex);
+    checkData(entry.tileIndex < _numTiles);
+    auto tileData = decodeTile(entry.tileIndex);
+    checkData(entry.indexInTile < tileData.clusters.size());
+    return std::move(tileData.clusters[entry.indexInTile]);
+}
+
+std::optional<ClusterDescription> TiledSimulationFile::getClusterByCellId(uint64_t cellId) const
+{
+    //binary search in the sorted cell id table
+    uint64_t lower = 0;
+    uint64_t upper = _numCellIds;
+    while (lower < upper) {
+        auto middle = lower + (upper - lower) / 2;
+        if (readEntry<CellIdEntry>(_cellIdTableOffset, middle).cellId < cellId) {
+            lower = middle + 1;
+        } else {
+            upper = middle;
+        }
+    }
+    if (lower == _numCellIds) {
+        return std::nullopt;
+    }
+    auto entry = readEntry<CellIdEntry>(_cellIdTableOffset, lower);
+    if (entry.cellId != cellId) {
+        return std::nullopt;
+    }
+    return getCluster(entry.clusterIndex);
+}
+
+uint64_t TiledSimulationFile::findTile(int32_t tileX, int32_t tileY) const
+{
+    //the tile table is sorted by tile coordinates
+    uint64_t lower = 0;
+    uint64_t upper = _numTiles;
+    while (lower < upper) {
+        auto middle = lower + (upper - lower) / 2;
+        auto tile = readEntry<TileEntry>(_tileTableOffset, middle);
+        if (std::make_pair(tile.tileX, tile.tileY) < std::make_pair(tileX, tileY)) {
+            lower = middle + 1;
+        } else {
+            upper = middle;
+        }
+    }
+    return lower;
+}
+
+void TiledSimulationFile::addRegionInWorld(ClusteredDataDescription& result, RealVector2D const& topLeft, RealVector2D const& bottomRight) const
+{
+    if (_numTiles == 0) {
+        return;
+    }
+    auto [minTileX, minTileY] = getTile(topLeft, _tileSize);
+    auto [maxTileX, maxTileY] = getTile(bottomRight, _tileSize);
+    minTileX = std::max(minTileX, readEntry<TileEntry>(_tileTableOffset, 0).tileX);
+    maxTileX = std::min(maxTileX, readEntry<TileEntry>(_tileTableOffset, _numTiles - 1).tileX);
+
+    for (auto tileX = minTileX; tileX <= maxTileX; ++tileX) {
+        for (auto tileIndex = findTile(tileX, minTileY); tileIndex < _numTiles; ++tileIndex) {
+            auto tile = readEntry<TileEntry>(_tileTableOffset, tileIndex);
+            if (tile.tileX != tileX || tile.tileY > maxTileY) {
+                break;
+            }
+            auto tileData = decodeTile(tileIndex);
+            for (auto& cluster : tileData.clusters) {
+                if (isInside(getPosInWorld(getClusterPos(cluster)), topLeft, bottomRight)) {
+                    result.clusters.emplace_back(std::move(cluster));
+                }
+            }
+            for (auto const& particle : tileData.particles) {
+                if (isInside(getPosInWorld(particle.pos), topLeft, bottomRight)) {
+                    result.particles.emplace_back(particle);
+                }
+            }
+        }
+    }
+}
+
+RealVector2D TiledSimulationFile::getPosInWorld(RealVector2D const& pos) const
+{
+    return {getValueInWorld(pos.x, _worldSize.x), getValueInWorld(pos.y, _worldSize.y)};
+}
+
+template <typename T>
+T TiledSimulationFile::readEntry(uint64_t tableOffset, uint64_t index) const
+{
+    T result;
+    std::memcpy(&result, _file.getData() + tableOffset + sizeof(T) * index, sizeof(T));
+    return result;
+}
+
+ClusteredDataDescription TiledSimulationFile::decodeTile(uint64_t tileIndex) const
+{
+    auto tile = readEntry<TileEntry>(_tileTableOffset, tileIndex);
+    checkData(tile.offset <= _file.getSize() && tile.size <= _file.getSize() - tile.offset);
+
+    std::istringstream stream(ChunkedCompressionService::decompress(std::string_view(_file.getData() + tile.offset, tile.size)));
+    ClusteredDataDescription result;
+    ColumnarSerializerService::deserialize(result, stream);
+    return result;
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <optional>
+#include <string>
+
+#include "Base/MemoryMappedFile.h"
+#include "Base/Vector2D.h"
+
+#include "Definitions.h"
+#include "Descriptions.h"
+
+/**
+ * Spatially indexed variant of the simulation main data.
+ * Clusters and particles are grouped into square tiles of the world according to their positions. Each tile is compressed
+ * separately and an index at the beginning of the file refers to the tiles, the clusters and the cell ids.
+ * The file is memory-mapped for reading so that queries only decode the tiles they need.
+ */
+class TiledSimulationFile
+{
+public:
+    static float constexpr DefaultTileSize = 256.0f;
+
+    //positions are assigned to tiles modulo the world size
+    static void write(std::string const& filename, ClusteredDataDescription const& data, IntVector2D const& worldSize, float tileSize = DefaultTileSize);
+    static bool isTiledFile(std::string const& filename);
+
+    //throws std::runtime_error if the file is not valid
+    TiledSimulationFile(std::string const& filename);
+
+    uint64_t getNumClusters() const;
+
+    IntVector2D getWorldSize() const;
+
+    //returns clusters whose center lies in the rectangle and particles located in the rectangle
+    //rectangles crossing the world edge (e.g. negative coordinates or topLeft.x > bottomRight.x) are continued on the opposite side
+    ClusteredDataDescription getRegion(RealVector2D const& topLeft, RealVector2D const& bottomRight) const;
+
+    //clusters are numbered in the order of the data passed to write()
+    std::optional<ClusterDescription> getCluster(uint64_t clusterIndex) const;
+    std::optional<ClusterDescription> getClusterByCellId(uint64_t cellId) const;
+
+private:
+    struct TileEntry
+    {
+        int32_t tileX;
+        int32_t tileY;
+        uint64_t offset;
+        uint64_t size;
+    };
+    struct ClusterEntry
+    {
+        uint32_t tileIndex;
+        uint32_t indexInTile;
+    };
+    struct CellIdEntry
+    {
+        uint64_t cellId;
+        uint64_t clusterIndex;
+    };
+
+    template <typename T>
+    T readEntry(uint64_t tableOffset, uint64_t index) const;
+
+    uint64_t findTile(int32_t tileX, int32_t tileY) const;  //index of the first tile not less than (tileX, tileY)
+    void addRegionInWorld(ClusteredDataDescription& result, RealVector2D const& topLeft, RealVector2D const& bottomRight) const;
+    RealVector2D getPosInWorld(RealVector2D const& pos) const;
+
+    ClusteredDataDescription decodeTile(uint64_t tileIndex) const;
+
+    MemoryMappedFile _file;
+    float _tileSize = DefaultTileSize;
+    IntVector2D _worldSize;
+    uint64_t _numTiles = 0;
+    uint64_t _numClusters = 0;
+    uint64_t _numCellIds = 0;
+    uint64_t _tileTableOffset = 0;
+    uint64_t _clusterTableOffset = 0;
+    uint64_t _cellIdTableOffset = 0;
+};
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+using ProfilingStage = int;
+enum ProfilingStage_
+{
+    ProfilingStage_Physics,
+    ProfilingStage_CellFunctionPreparation,
+    ProfilingStage_Nerve,
+    ProfilingStage_Neuron,
+    ProfilingStage_Constructor,
+    ProfilingStage_Injector,
+    ProfilingStage_Attacker,
+    ProfilingStage_Transmitter,
+    ProfilingStage_Muscle,
+    ProfilingStage_Sensor,
+    ProfilingStage_Reconnector,
+    ProfilingStage_Detonator,
+    ProfilingStage_Clusters,
+    ProfilingStage_StructuralOperations,
+    ProfilingStage_GarbageCollection,
+    ProfilingStage_Statistics,
+    ProfilingStage_ResizeArrays,
+    ProfilingStage_Count
+};
+
+using StageDurations = std::array<float, ProfilingStage_Count>;  //in milliseconds
+
+struct TimestepProfile
+{
+    uint64_t timestep = 0;
+    float duration = 0;  //wall time of the whole time step in milliseconds
+    StageDurations stageDurations = {};
+
+    uint64_t numCells = 0;
+    uint64_t numParticles = 0;
+};
@@ -0,0 +1,123 @@
+#include "TimestepProfileService.h"
+
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+
+std::string TimestepProfileService::getStageName(ProfilingStage stage)
+{
+    switch (stage) {
+    case ProfilingStage_Physics:
+        return "Physics";
+    case ProfilingStage_CellFunctionPreparation:
+        return "Cell function preparation";
+    case ProfilingStage_Nerve:
+        return "Nerve";
+    case ProfilingStage_Neuron:
+        return "Neuron";
+    case ProfilingStage_Constructor:
+        return "Constructor";
+    case ProfilingStage_Injector:
+        return "Injector";
+    case ProfilingStage_Attacker:
+        return "Attacker";
+    case ProfilingStage_Transmitter:
+        return "Transmitter";
+    case ProfilingStage_Muscle:
+        return "Muscle";
+    case ProfilingStage_Sensor:
+        return "Sensor";
+    case ProfilingStage_Reconnector:
+        return "Reconnector";
+    case ProfilingStage_Detonator:
+        return "Detonator";
+    case ProfilingStage_Clusters:
+        return "Clusters";
+    case ProfilingStage_StructuralOperations:
+        return "Structural operations";
+    case ProfilingStage_GarbageCollection:
+        return "Garbage collection";
+    case ProfilingStage_Statistics:
+        return "Statistics";
+    case ProfilingStage_ResizeArrays:
+        return "Resize arrays";
+    }
+    return "";
+}
+
+TimestepProfile TimestepProfileService::calcAverage(std::vector<TimestepProfile> const& profiles)
+{
+    TimestepProfile result;
+    if (profiles.empty()) {
+        return result;
+    }
+    double duration = 0;
+    std::array<double, ProfilingStage_Count> stageDurations = {};
+    uint64_t numCells = 0;
+    uint64_t numParticles = 0;
+    for (auto const& profile : profiles) {
+        duration += profile.duration;
+        for (int i = 0; i < ProfilingStage_Count; ++i) {
+            stageDurations[i] += profile.stageDurations[i];
+        }
+        numCells += profile.numCells;
+        numParticles += profile.numParticles;
+    }
+    auto numProfiles = profiles.size();
+    result.timestep = profiles.back().timestep;
+    result.duration = static_cast<float>(duration / numProfiles);
+    for (int i = 0; i < ProfilingStage_Count; ++i) {
+        result.stageDurations[i] = static_cast<float>(stageDurations[i] / numProfiles);
+    }
+    result.numCells = numCells / numProfiles;
+    result.numParticles = numParticles / numProfiles;
+    return result;
+}
+
+void TimestepProfileService::serializeToCsv(std::vector<TimestepProfile> const& profiles, std::ostream& stream)
+{
+    stream << "Time step, Duration";
+    for (int i = 0; i < ProfilingStage_Count; ++i) {
+        stream << ", " << getStageName(i);
+    }
+    stream << ", Cells, Particles" << std::endl;
+
+    stream << std::fixed << std::setprecision(4);
+    for (auto const& profile : profiles) {
+        stream << profile.timestep << "," << profile.duration;
+        for (auto const& stageDuration : profile.stageDurations) {
+            stream << "," << stageDuration;
+        }
+        stream << "," << profile.numCells << "," << profile.numParticles << std::endl;
+    }
+}
+
+void TimestepProfileService::serializeToJson(std::vector<TimestepProfile> const& profiles, std::ostream& stream)
+{
+    stream << std::fixed << std::setprecision(4);
+    stream << "[";
+    for (size_t i = 0; i < profiles.size(); ++i) {
+        auto const& profile = profiles.at(i);
+        stream << (i > 0 ? ",\n" : "\n");
+        stream << "  {\"timestep\": " << profile.timestep << ", \"duration\": " << profile.duration << ", \"stages\": {";
+        for (int j = 0; j < ProfilingStage_Count; ++j) {
+            stream << (j > 0 ? ", " : "") << "\"" << getStageName(j) << "\": " << profile.stageDurations[j];
+        }
+        stream << "}, \"cells\": " << profile.numCells << ", \"particles\": " << profile.numParticles << "}";
+    }
+    stream << "\n]" << std::endl;
+}
+
+bool TimestepProfileService::serializeToFile(std::string const& filename, std::vector<TimestepProfile> const& profiles)
+{
+    std::ofstream stream(filename, std::ios::binary);
+    if (!stream) {
+        return false;
+    }
+    if (std::filesystem::path(filename).extension() == ".json") {
+        serializeToJson(profiles, stream);
+    } else {
+        serializeToCsv(profiles, stream);
+    }
+    return static_cast<bool>(stream);
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "TimestepProfile.h"
+
+class TimestepProfileService
+{
+public:
+    static std::string getStageName(ProfilingStage stage);
+
+    static TimestepProfile calcAverage(std::vector<TimestepProfile> const& profiles);  //timestep of the result is the last one
+
+    //one row per time step with the stage durations in milliseconds
+    static void serializeToCsv(std::vector<TimestepProfile> const& profiles, std::ostream& stream);
+    static void serializeToJson(std::vector<TimestepProfile> const& profiles, std::ostream& stream);
+
+    //format is chosen by extension (*.json or CSV otherwise)
+    static bool serializeToFile(std::string const& filename, std::vector<TimestepProfile> const& profiles);
+};
@@ -0,0 +1,121 @@
+#include "TimestepProfiler.h"
+
+#include <algorithm>
+
+namespace
+{
+    float toMilliseconds(std::chrono::steady_clock::duration duration)
+    {
+        return std::chrono::duration<float, std::milli>(duration).count();
+    }
+}
+
+void _HostProfilingTimer::startStage(ProfilingStage stage)
+{
+    _startTimepoints.at(stage) = std::chrono::steady_clock::now();
+}
+
+void _HostProfilingTimer::stopStage(ProfilingStage stage)
+{
+    _durations.at(stage) += toMilliseconds(std::chrono::steady_clock::now() - _startTimepoints.at(stage));
+}
+
+void _HostProfilingTimer::collectDurations(StageDurations& durations)
+{
+    for (int i = 0; i < ProfilingStage_Count; ++i) {
+        durations[i] += _durations[i];
+    }
+    _durations = {};
+}
+
+_TimestepProfiler::_TimestepProfiler(ProfilingTimer const& timer, int capacity)
+    : _timer(timer)
+    , _capacity(std::max(1, capacity))
+{
+    _profiles.reserve(_capacity);
+}
+
+bool _TimestepProfiler::isEnabled() const
+{
+    return _enabled.load();
+}
+
+void _TimestepProfiler::setEnabled(bool value)
+{
+    _enabled.store(value);
+}
+
+void _TimestepProfiler::beginTimestep(uint64_t timestep)
+{
+    _recording = _enabled.load();
+    if (!_recording) {
+        return;
+    }
+    _currentProfile = TimestepProfile();
+    _currentProfile.timestep = timestep;
+    _timestepStartTimepoint = std::chrono::steady_clock::now();
+}
+
+bool _TimestepProfiler::isRecording() const
+{
+    return _recording;
+}
+
+void _TimestepProfiler::startStage(ProfilingStage stage)
+{
+    if (_recording) {
+        _timer->startStage(stage);
+    }
+}
+
+void _TimestepProfiler::stopStage(ProfilingStage stage)
+{
+    if (_recording) {
+        _timer->stopStage(stage);
+    }
+}
+
+void _TimestepProfiler::addStageDuration(ProfilingStage stage, std::chrono::steady_clock::duration duration)
+{
+    if (_recording) {
+        _currentProfile.stageDurations.at(stage) += toMilliseconds(duration);
+    }
+}
+
+void _TimestepProfiler::endTimestep(uint64_t numCells, uint64_t numParticles)
+{
+    if (!_recording) {
+        return;
+    }
+    _recording = false;
+
+    _timer->collectDurations(_currentProfile.stageDurations);
+    _currentProfile.duration = toMilliseconds(std::chrono::steady_clock::now() - _timestepStartTimepoint);
+    _currentProfile.numCells = numCells;
+    _currentProfile.numParticles = numParticles;
+
+    std::lock_guard lock(_mutex);
+    if (static_cast<int>(_profiles.size()) < _capacity) {
+        _profiles.emplace_back(_currentProfile);
+    } else {
+        _profiles.at(_nextIndex) = _currentProfile;
+        _nextIndex = (_nextIndex + 1) % _capacity;
+    }
+}
+
+std::vector<TimestepProfile> _TimestepProfiler::getProfiles() const
+{
+    std::lock_guard lock(_mutex);
+    std::vector<TimestepProfile> result;
+    result.reserve(_profiles.size());
+    result.insert(result.end(), _profiles.begin() + _nextIndex, _profiles.end());
+    result.insert(result.end(), _profiles.begin(), _profiles.begin() + _nextIndex);
+    return result;
+}
+
+void _TimestepProfiler::clear()
+{
+    std::lock_guard lock(_mutex);
+    _profiles.clear();
+    _nextIndex = 0;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+#include "Definitions.h"
+#include "TimestepProfile.h"
+
+//measures the durations of the stages of a time step, backends can measure asynchronous work (e.g. with device events)
+class _ProfilingTimer
+{
+public:
+    virtual ~_ProfilingTimer() = default;
+
+    virtual void startStage(ProfilingStage stage) = 0;
+    virtual void stopStage(ProfilingStage stage) = 0;
+
+    //adds the durations measured since the last call (a stage can be started several times per time step)
+    virtual void collectDurations(StageDurations& durations) = 0;
+};
+
+//fallback which measures the wall time on the calling thread, asynchronous work is only included if it has been waited for
+class _HostProfilingTimer : public _ProfilingTimer
+{
+public:
+    void startStage(ProfilingStage stage) override;
+    void stopStage(ProfilingStage stage) override;
+    void collectDurations(StageDurations& durations) override;
+
+private:
+    std::array<std::chrono::steady_clock::time_point, ProfilingStage_Count> _startTimepoints;
+    StageDurations _durations = {};
+};
+
+//records stage durations and entity counts of the last time steps in a ring buffer
+//the recording methods are called from the simulation thread and return immediately if profiling is disabled
+class _TimestepProfiler
+{
+public:
+    static auto constexpr DefaultCapacity = 1000;
+
+    _TimestepProfiler(ProfilingTimer const& timer = std::make_shared<_HostProfilingTimer>(), int capacity = DefaultCapacity);
+
+    bool isEnabled() const;
+    void setEnabled(bool value);  //takes effect at the next time step
+
+    void beginTimestep(uint64_t timestep);
+    bool isRecording() const;  //true between beginTimestep and endTimestep if profiling is enabled
+    void startStage(ProfilingStage stage);
+    void stopStage(ProfilingStage stage);
+    void addStageDuration(ProfilingStage stage, std::chrono::steady_clock::duration duration);  //for stages measured by the caller
+    void endTimestep(uint64_t numCells, uint64_t numParticles);
+
+    std::vector<TimestepProfile> getProfiles() const;  //ordered from oldest to newest
+    void clear();
+
+private:
+    ProfilingTimer _timer;
+    std::atomic<bool> _enabled = false;
+
+    bool _recording = false;
+    std::chrono::steady_clock::time_point _timestepStartTimepoint;
+    TimestepProfile _currentProfile;
+
+    mutable std::mutex _mutex;
+    std::vector<TimestepProfile> _profiles;
+    int _capacity = DefaultCapacity;
+    int _nextIndex = 0;  //index of the oldest profile once the ring buffer is full
+};
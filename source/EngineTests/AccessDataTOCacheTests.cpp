@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#include "EngineImpl/AccessDataTOCache.h"
+
+class AccessDataTOCacheTests : public ::testing::Test
+{
+public:
+    AccessDataTOCacheTests()
+        : _cache(createAllocator())
+    {}
+
+    ~AccessDataTOCacheTests() = default;
+
+protected:
+    HostMemoryAllocator createAllocator()
+    {
+        return HostMemoryAllocator{
+            [this](uint64_t size) -> void* {
+                if (_allocationsFail) {
+                    return nullptr;
+                }
+                ++_numAllocations;
+                return ::operator new(size);
+            },
+            [this](void* memory) {
+                ++_numFrees;
+                ::operator delete(memory);
+            }};
+    }
+
+    bool _allocationsFail = false;
+    int _numAllocations = 0;
+    int _numFrees = 0;
+    _AccessDataTOCache _cache;
+};
+
+TEST_F(AccessDataTOCacheTests, buffersAreReusedIfCapacitiesSuffice)
+{
+    auto dataTO = _cache.getDataTO({100, 100, 1000});
+    *dataTO.numCells = 10;
+    EXPECT_EQ(1, _numAllocations);
+
+    for (uint64_t i = 0; i < 10; ++i) {
+        auto reusedDataTO = _cache.getDataTO({50 + i * 5, 100, 1000});
+        EXPECT_TRUE(reusedDataTO == dataTO);
+        EXPECT_EQ(0, *reusedDataTO.numCells);
+        *reusedDataTO.numCells = 50;
+    }
+    EXPECT_EQ(1, _numAllocations);
+}
+
+TEST_F(AccessDataTOCacheTests, capacitiesGrowGeometrically)
+{
+    for (uint64_t size = 100; size <= 10000; size += 100) {
+        _cache.getDataTO({size, size, size * 10});
+    }
+    EXPECT_TRUE(_numAllocations <= 8);
+}
+
+TEST_F(AccessDataTOCacheTests, doubleBuffering)
+{
+    _AccessDataTOCache cache(createAllocator(), 2);
+    EXPECT_FALSE(cache.getPreviousDataTO().has_value());
+
+    auto dataTO1 = cache.getDataTO({10, 10, 10});
+    *dataTO1.numCells = 1;
+    dataTO1.cells[0].id = 1;
+    EXPECT_FALSE(cache.getPreviousDataTO().has_value());
+
+    auto dataTO2 = cache.getDataTO({10, 10, 10});
+    EXPECT_TRUE(dataTO2.cells != dataTO1.cells);
+    *dataTO2.numCells = 1;
+    dataTO2.cells[0].id = 2;
+
+    auto previousDataTO = cache.getPreviousDataTO();
+    ASSERT_TRUE(previousDataTO.has_value());
+    EXPECT_TRUE(*previousDataTO == dataTO1);
+    EXPECT_EQ(1, *previousDataTO->numCells);
+    EXPECT_EQ(1, previousDataTO->cells[0].id);
+
+    auto dataTO3 = cache.getDataTO({10, 10, 10});
+    EXPECT_TRUE(dataTO3 == dataTO1);
+    EXPECT_TRUE(*cache.getPreviousDataTO() == dataTO2);
+    EXPECT_EQ(2, cache.getPreviousDataTO()->cells[0].id);
+    EXPECT_EQ(2, _numAllocations);
+}
+
+TEST_F(AccessDataTOCacheTests, singleBufferHasNoPreviousDataTO)
+{
+    _cache.getDataTO({10, 10, 10});
+    _cache.getDataTO({10, 10, 10});
+    EXPECT_FALSE(_cache.getPreviousDataTO().has_value());
+}
+
+TEST_F(AccessDataTOCacheTests, fallbackIfAllocationFails)
+{
+    {
+        _AccessDataTOCache cache(createAllocator());
+        _allocationsFail = true;
+        auto dataTO = cache.getDataTO({100, 100, 1000});
+        *dataTO.numCells = 100;
+        dataTO.cells[99].id = 1;
+        EXPECT_EQ(0, _numAllocations);
+
+        //fallback memory is not passed to the allocator
+        _allocationsFail = false;
+        cache.getDataTO({1000, 100, 1000});
+        EXPECT_EQ(1, _numAllocations);
+        EXPECT_EQ(0, _numFrees);
+    }
+    EXPECT_EQ(1, _numFrees);
+}
@@ -0,0 +1,142 @@
+#include <sstream>
+
+#include <boost/property_tree/json_parser.hpp>
+#include <gtest/gtest.h>
+
+#include "EngineInterface/AuxiliaryDataParserService.h"
+#include "EngineInterface/SimulationParametersFields.h"
+
+class AuxiliaryDataParserTests : public ::testing::Test
+{
+public:
+    AuxiliaryDataParserTests() = default;
+    ~AuxiliaryDataParserTests() = default;
+
+protected:
+    //assigns deterministic values to all fields which are exactly representable with 8 decimal places
+    template <typename Object, size_t N>
+    void fillFields(Object& object, ParameterField<Object> const (&fields)[N], int seed) const
+    {
+        for (auto const& field : fields) {
+            auto value = field.getValueRef(object);
+            for (int i = 0; i < getNumParameterFieldElements(field.type); ++i) {
+                auto number = (seed++ * 7919) % 1000;
+                switch (field.type) {
+                case ParameterFieldType::Bool:
+                case ParameterFieldType::ColorMatrixBool:
+                    static_cast<bool*>(value)[i] = number % 2 == 0;
+                    break;
+                case ParameterFieldType::Int:
+                case ParameterFieldType::ColorVectorInt:
+                case ParameterFieldType::ColorMatrixInt:
+                    static_cast<int*>(value)[i] = number - 500;
+                    break;
+                case ParameterFieldType::UInt32:
+                    *static_cast<uint32_t*>(value) = number;
+                    break;
+                case ParameterFieldType::UInt64:
+                    *static_cast<uint64_t*>(value) = number + 0x100000000ull;
+                    break;
+                case ParameterFieldType::Float:
+                case ParameterFieldType::ColorVectorFloat:
+                case ParameterFieldType::ColorMatrixFloat:
+                    static_cast<float*>(value)[i] = toFloat(number) / 8 - 50.0f;
+                    break;
+                }
+            }
+        }
+    }
+
+    SimulationParameters createParameters() const
+    {
+        SimulationParameters result;
+        fillFields(result, SimulationParametersFields, 1);
+        result.numParticleSources = 2;
+        result.numSpots = 3;
+        for (int i = 0; i < result.numParticleSources; ++i) {
+            fillFields(result.particleSources[i], RadiationSourceFields, 1000 + i * 100);
+            result.particleSources[i].shapeType = i == 0 ? RadiationSourceShapeType_Circular : RadiationSourceShapeType_Rectangular;
+        }
+        for (int i = 0; i < result.numSpots; ++i) {
+            fillFields(result.spots[i], SimulationParametersSpotFields, 2000 + i * 1000);
+            result.spots[i].shapeType = i == 0 ? SpotShapeType_Circular : SpotShapeType_Rectangular;
+            result.spots[i].flowType = i == 0 ? FlowType_Radial : (i == 1 ? FlowType_Central : FlowType_Linear);
+        }
+        return result;
+    }
+
+    boost::property_tree::ptree readPropertyTree(std::string const& json) const
+    {
+        std::stringstream stream(json);
+        boost::property_tree::ptree result;
+        boost::property_tree::read_json(stream, result);
+        return result;
+    }
+};
+
+TEST_F(AuxiliaryDataParserTests, jsonRoundTrip)
+{
+    AuxiliaryData data;
+    data.timestep = 123456789012;
+    data.zoom = 2.5f;
+    data.center = {10.25f, 20.5f};
+    data.generalSettings.worldSizeX = 1000;
+    data.generalSettings.worldSizeY = 500;
+    data.simulationParameters = createParameters();
+
+    auto json = AuxiliaryDataParserService::encodeAuxiliaryDataToJson(data);
+    auto decodedData = AuxiliaryDataParserService::decodeAuxiliaryDataFromJson(json);
+
+    EXPECT_EQ(data.timestep, decodedData.timestep);
+    EXPECT_EQ(data.zoom, decodedData.zoom);
+    EXPECT_EQ(data.center, decodedData.center);
+    EXPECT_EQ(data.generalSettings.worldSizeX, decodedData.generalSettings.worldSizeX);
+    EXPECT_EQ(data.generalSettings.worldSizeY, decodedData.generalSettings.worldSizeY);
+    EXPECT_TRUE(data.simulationParameters == decodedData.simulationParameters);
+}
+
+TEST_F(AuxiliaryDataParserTests, jsonCompatibleWithPropertyTree)
+{
+    auto parameters = createParameters();
+    auto json = AuxiliaryDataParserService::encodeSimulationParametersToJson(parameters);
+
+    //the files remain readable by generic JSON parsers and vice versa
+    auto tree = readPropertyTree(json);
+    EXPECT_EQ("3", tree.get<std::string>("simulation parameters.spots.num spots"));
+    EXPECT_EQ(
+        parameters.spots[2].flowData.linearFlow.strength, tree.get<float>("simulation parameters.spots.2.flow.linear.strength"));
+    EXPECT_FALSE(tree.get_optional<std::string>("simulation parameters.spots.2.flow.radial.strength"));
+    EXPECT_FALSE(tree.get_optional<std::string>("simulation parameters.spots.3"));
+
+    std::stringstream stream;
+    boost::property_tree::write_json(stream, tree);
+    EXPECT_TRUE(parameters == AuxiliaryDataParserService::decodeSimulationParametersFromJson(stream.str()));
+    EXPECT_TRUE(parameters == AuxiliaryDataParserService::decodeSimulationParameters(tree));
+}
+
+TEST_F(AuxiliaryDataParserTests, jsonMissingAndInvalidValues)
+{
+    auto parameters = AuxiliaryDataParserService::decodeSimulationParametersFromJson(
+        R"({"simulation parameters": {"time step size": "0.5", "friction": "abc", "spots": {"num spots": "100"}}})");
+
+    SimulationParameters expectedParameters;
+    expectedParameters.timestepSize = 0.5f;
+    expectedParameters.numSpots = MAX_SPOTS;
+    EXPECT_TRUE(expectedParameters == parameters);
+
+    EXPECT_THROW(AuxiliaryDataParserService::decodeSimulationParametersFromJson(R"({"simulation parameters": )"), std::runtime_error);
+}
+
+TEST_F(AuxiliaryDataParserTests, binaryRoundTrip)
+{
+    auto parameters = createParameters();
+    auto data = AuxiliaryDataParserService::encodeSimulationParametersToBinary(parameters);
+
+    SimulationParameters decodedParameters;
+    ASSERT_TRUE(AuxiliaryDataParserService::decodeSimulationParametersFromBinary(decodedParameters, data));
+    EXPECT_TRUE(parameters == decodedParameters);
+
+    EXPECT_FALSE(AuxiliaryDataParserService::decodeSimulationParametersFromBinary(decodedParameters, data.substr(0, data.size() - 1)));
+    data[4] ^= 1;  //layout hash
+    EXPECT_FALSE(AuxiliaryDataParserService::decodeSimulationParametersFromBinary(decodedParameters, data));
+}
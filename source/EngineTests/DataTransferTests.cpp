@@ -1,8 +1,10 @@
 #include <gtest/gtest.h>
 
 #include "Base/NumberGenerator.h"
+#include "EngineInterface/ColumnarData.h"
 #include "EngineInterface/DescriptionEditService.h"
 #include "EngineInterface/Descriptions.h"
+#include "EngineInterface/GenomeDescriptionService.h"
 #include "EngineInterface/SimulationController.h"
 #include "IntegrationTestFramework.h"
 
@@ -102,6 +104,43 @@ TEST_F(DataTransferTests, cellCluster)
     EXPECT_TRUE(compare(data, actualData));
 }
 
+TEST_F(DataTransferTests, columnarData)
+{
+    NeuronDescription neuron;
+    neuron.weights[2][1] = 1.0f;
+    neuron.biases[3] = -0.5f;
+    auto genome = GenomeDescriptionService::convertDescriptionToBytes(GenomeDescription().setCells({CellGenomeDescription()}));
+
+    DataDescription data;
+    data.addCells({
+        CellDescription()
+            .setId(1)
+            .setPos({2.0f, 4.0f})
+            .setVel({0.5f, 1.0f})
+            .setMaxConnections(2)
+            .setExecutionOrderNumber(3)
+            .setInputExecutionOrderNumber(4)
+            .setCellFunction(neuron)
+            .setMetadata(CellMetadataDescription().setName("name").setDescription("description")),
+        CellDescription().setId(2).setPos({3.0f, 4.0f}).setMaxConnections(2).setCellFunction(ConstructorDescription().setGenome(genome)),
+        CellDescription().setId(3).setPos({10.0f, 4.0f}).setCellFunction(SensorDescription().setFixedAngle(30.0f)),
+    });
+    data.addConnection(1, 2);
+    data.addParticle(ParticleDescription().setId(4).setPos({20.0f, 4.0f}).setEnergy(50.0f));
+
+    _simController->setSimulationData(data);
+    auto columnarData = _simController->getColumnarSimulationData();
+    EXPECT_TRUE(columnarData.clusters.numCells.empty());
+    EXPECT_EQ(3, columnarData.cells.id.size());
+    EXPECT_EQ(1, columnarData.particles.id.size());
+
+    _simController->clear();
+    _simController->setColumnarSimulationData(columnarData);
+    auto actualData = _simController->getSimulationData();
+
+    EXPECT_TRUE(compare(data, actualData));
+}
+
 TEST_F(DataTransferTests, largeData)
 {
     auto& numberGen = NumberGenerator::getInstance();
@@ -146,3 +185,38 @@ TEST_F(DataTransferTests, largeData)
         EXPECT_EQ(data.particles.size() + newData.particles.size(), actualData.particles.size());
     }
 }
+
+TEST_F(DataTransferTests, largeClusteredData)
+{
+    auto constexpr NumClusters = 50000;
+    auto constexpr ClusterSize = 10;
+
+    DataDescription data;
+    std::unordered_map<uint64_t, int> cache;
+    for (int i = 0; i < NumClusters; ++i) {
+        for (int j = 0; j < ClusterSize; ++j) {
+            uint64_t id = i * ClusterSize + j + 1;
+            data.addCell(CellDescription()
+                             .setId(id)
+                             .setPos({toFloat((i % 100) * ClusterSize + j), toFloat((i / 100) * 2)})
+                             .setMaxConnections(2));
+            if (j > 0) {
+                data.addConnection(id - 1, id, &cache);
+            }
+        }
+    }
+    _simController->setSimulationData(data);
+
+    auto actualData = _simController->getSimulationData();
+    auto actualClusteredData = _simController->getClusteredSimulationData();
+
+    EXPECT_EQ(NumClusters * ClusterSize, actualData.cells.size());
+    ASSERT_EQ(NumClusters, actualClusteredData.clusters.size());
+    for (auto const& cluster : actualClusteredData.clusters) {
+        ASSERT_EQ(ClusterSize, cluster.cells.size());
+        auto clusterIndex = (cluster.cells.front().id - 1) / ClusterSize;
+        for (auto const& cell : cluster.cells) {
+            EXPECT_EQ(clusterIndex, (cell.id - 1) / ClusterSize);
+        }
+    }
+}
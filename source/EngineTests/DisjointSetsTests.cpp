@@ -0,0 +1,195 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <unordered_set>
+
+#include <gtest/gtest.h>
+
+#include "Base/DisjointSets.h"
+
+class DisjointSetsTests : public ::testing::Test
+{
+public:
+    DisjointSetsTests() = default;
+    ~DisjointSetsTests() = default;
+
+protected:
+    using Connections = std::vector<std::vector<uint64_t>>;
+
+    //clusters of random sizes whose cells are connected in a chain with additional random bonds, cell indices are shuffled as in a DataTO
+    Connections createWorld(uint64_t numCells, uint64_t maxClusterSize, unsigned int seed) const
+    {
+        std::mt19937 generator(seed);
+        std::vector<uint64_t> permutation(numCells);
+        std::iota(permutation.begin(), permutation.end(), 0);
+        std::shuffle(permutation.begin(), permutation.end(), generator);
+
+        Connections result(numCells);
+        auto connect = [&](uint64_t index1, uint64_t index2) {
+            result[permutation[index1]].emplace_back(permutation[index2]);
+            result[permutation[index2]].emplace_back(permutation[index1]);
+        };
+        for (uint64_t clusterStart = 0; clusterStart < numCells;) {
+            auto clusterSize = std::min(std::uniform_int_distribution<uint64_t>(1, maxClusterSize)(generator), numCells - clusterStart);
+            for (uint64_t i = 1; i < clusterSize; ++i) {
+                connect(clusterStart + i - 1, clusterStart + i);
+                if (i % 3 == 0) {
+                    connect(clusterStart + i, clusterStart + std::uniform_int_distribution<uint64_t>(0, i - 1)(generator));
+                }
+            }
+            clusterStart += clusterSize;
+        }
+        return result;
+    }
+
+    DisjointSets::Sets calcSetsByUnionFind(Connections const& connections) const
+    {
+        DisjointSets sets(connections.size());
+        for (uint64_t i = 0; i < connections.size(); ++i) {
+            for (auto const& connectedIndex : connections[i]) {
+                sets.unite(i, connectedIndex);
+            }
+        }
+        return sets.getSets();
+    }
+
+    //breadth-first search as in the former cluster scan of DescriptionConverter
+    std::vector<std::vector<uint64_t>> calcSetsByBreadthFirstSearch(Connections const& connections) const
+    {
+        std::vector<std::vector<uint64_t>> result;
+        std::unordered_set<uint64_t> freeIndices;
+        for (uint64_t i = 0; i < connections.size(); ++i) {
+            freeIndices.insert(i);
+        }
+        while (!freeIndices.empty()) {
+            std::vector<uint64_t> set;
+            std::unordered_set<uint64_t> currentIndices{*freeIndices.begin()};
+            std::unordered_set<uint64_t> scannedIndices = currentIndices;
+            std::unordered_set<uint64_t> nextIndices;
+            do {
+                for (auto const& currentIndex : currentIndices) {
+                    set.emplace_back(currentIndex);
+                    for (auto const& connectedIndex : connections[currentIndex]) {
+                        if (scannedIndices.insert(connectedIndex).second) {
+                            nextIndices.insert(connectedIndex);
+                        }
+                    }
+                }
+                currentIndices = nextIndices;
+                nextIndices.clear();
+            } while (!currentIndices.empty());
+
+            for (auto const& index : scannedIndices) {
+                freeIndices.erase(index);
+            }
+            result.emplace_back(set);
+        }
+        return result;
+    }
+
+    //sets with ascending elements ordered by their smallest element
+    std::vector<std::vector<uint64_t>> normalize(std::vector<std::vector<uint64_t>> sets) const
+    {
+        for (auto& set : sets) {
+            std::sort(set.begin(), set.end());
+        }
+        std::sort(sets.begin(), sets.end());
+        return sets;
+    }
+
+    std::vector<std::vector<uint64_t>> toVectors(DisjointSets::Sets const& sets) const
+    {
+        std::vector<std::vector<uint64_t>> result;
+        for (size_t i = 0; i + 1 < sets.offsets.size(); ++i) {
+            result.emplace_back(sets.elements.begin() + sets.offsets[i], sets.elements.begin() + sets.offsets[i + 1]);
+        }
+        return result;
+    }
+};
+
+TEST_F(DisjointSetsTests, singletons)
+{
+    DisjointSets sets(4);
+    for (uint64_t i = 0; i < 4; ++i) {
+        EXPECT_EQ(i, sets.find(i));
+    }
+    auto result = sets.getSets();
+    EXPECT_EQ((std::vector<uint64_t>{0, 1, 2, 3, 4}), result.offsets);
+    EXPECT_EQ((std::vector<uint64_t>{0, 1, 2, 3}), result.elements);
+}
+
+TEST_F(DisjointSetsTests, unite)
+{
+    DisjointSets sets(8);
+    sets.unite(6, 3);
+    sets.unite(3, 1);
+    sets.unite(7, 4);
+    sets.unite(4, 7);
+    sets.unite(5, 5);
+
+    //roots are the smallest elements of their sets
+    EXPECT_EQ(1, sets.find(6));
+    EXPECT_EQ(1, sets.find(3));
+    EXPECT_EQ(4, sets.find(7));
+    EXPECT_EQ(5, sets.find(5));
+
+    auto result = sets.getSets();
+    EXPECT_EQ((std::vector<uint64_t>{0, 1, 4, 5, 7, 8}), result.offsets);
+    EXPECT_EQ((std::vector<uint64_t>{0, 1, 3, 6, 2, 4, 7, 5}), result.elements);
+}
+
+TEST_F(DisjointSetsTests, empty)
+{
+    DisjointSets sets(0);
+    auto result = sets.getSets();
+    EXPECT_EQ((std::vector<uint64_t>{0}), result.offsets);
+    EXPECT_TRUE(result.elements.empty());
+}
+
+TEST_F(DisjointSetsTests, longChain)
+{
+    uint64_t constexpr NumElements = 100000;
+    DisjointSets sets(NumElements);
+    for (uint64_t i = NumElements - 1; i > 0; --i) {
+        sets.unite(i, i - 1);
+    }
+    EXPECT_EQ(0, sets.find(NumElements - 1));
+
+    auto result = sets.getSets();
+    ASSERT_EQ(2, result.offsets.size());
+    EXPECT_EQ(NumElements, result.offsets.back());
+    EXPECT_TRUE(std::is_sorted(result.elements.begin(), result.elements.end()));
+}
+
+TEST_F(DisjointSetsTests, equalsBreadthFirstSearch)
+{
+    for (unsigned int seed = 0; seed < 5; ++seed) {
+        auto connections = createWorld(5000, 50, seed);
+        auto result = calcSetsByUnionFind(connections);
+
+        EXPECT_EQ(normalize(calcSetsByBreadthFirstSearch(connections)), toVectors(result));
+    }
+}
+
+//run with --gtest_also_run_disabled_tests --gtest_filter=DisjointSetsTests.*
+TEST_F(DisjointSetsTests, DISABLED_benchmarkAgainstBreadthFirstSearch)
+{
+    for (auto const& maxClusterSize : {10ull, 1000ull, 100000ull}) {
+        auto connections = createWorld(1000000, maxClusterSize, 0);
+
+        auto startTimepoint = std::chrono::steady_clock::now();
+        auto unionFindResult = calcSetsByUnionFind(connections);
+        auto unionFindDuration = std::chrono::steady_clock::now() - startTimepoint;
+
+        startTimepoint = std::chrono::steady_clock::now();
+        auto breadthFirstSearchResult = calcSetsByBreadthFirstSearch(connections);
+        auto breadthFirstSearchDuration = std::chrono::steady_clock::now() - startTimepoint;
+
+        std::cout << "1M cells, max cluster size " << maxClusterSize << ": union-find "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(unionFindDuration).count() << " ms, breadth-first search "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(breadthFirstSearchDuration).count() << " ms" << std::endl;
+        EXPECT_EQ(breadthFirstSearchResult.size(), unionFindResult.offsets.size() - 1);
+    }
+}
@@ -0,0 +1,170 @@
+#include <filesystem>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include "Network/DownloadCache.h"
+
+class DownloadCacheTests : public ::testing::Test
+{
+public:
+    DownloadCacheTests()
+    {
+        std::filesystem::remove_all(_directory);
+    }
+    ~DownloadCacheTests()
+    {
+        std::error_code errorCode;
+        std::filesystem::remove_all(_directory, errorCode);
+    }
+
+protected:
+    //each entry occupies 3 size fields of 8 bytes and its parts
+    static uint64_t constexpr EntrySize = 24 + 100 + 10 + 6;
+
+    SerializedSimulation createData(char content) const
+    {
+        SerializedSimulation result;
+        result.mainData = std::string(100, content);
+        result.auxiliaryData = std::string(10, content);
+        result.statistics = std::string(6, content);
+        return result;
+    }
+
+    void expectData(std::optional<SerializedSimulation> const& data, char content) const
+    {
+        ASSERT_TRUE(data.has_value());
+        EXPECT_EQ(createData(content).mainData, data->mainData);
+        EXPECT_EQ(createData(content).auxiliaryData, data->auxiliaryData);
+        EXPECT_EQ(createData(content).statistics, data->statistics);
+    }
+
+    std::vector<std::filesystem::path> getCacheFiles() const
+    {
+        std::vector<std::filesystem::path> result;
+        for (auto const& directoryEntry : std::filesystem::directory_iterator(_directory)) {
+            if (directoryEntry.path().extension() == ".cache") {
+                result.emplace_back(directoryEntry.path());
+            }
+        }
+        return result;
+    }
+
+    std::filesystem::path _directory = std::filesystem::temp_directory_path() / "downloadCacheTests";
+};
+
+TEST_F(DownloadCacheTests, insertAndFind)
+{
+    _DownloadCache cache(_directory.string(), 10 * EntrySize);
+    EXPECT_FALSE(cache.find("1", "key").has_value());
+
+    cache.insert("1", "key", createData('a'));
+    cache.insert("2", "key", createData('b'));
+    expectData(cache.find("1", "key"), 'a');
+    expectData(cache.find("2", "key"), 'b');
+    EXPECT_EQ(2, getCacheFiles().size());
+}
+
+TEST_F(DownloadCacheTests, leastRecentlyUsedEviction)
+{
+    _DownloadCache cache(_directory.string(), 2 * EntrySize);
+    cache.insert("1", "key", createData('a'));
+    cache.insert("2", "key", createData('b'));
+    cache.find("1", "key");
+
+    cache.insert("3", "key", createData('c'));
+    EXPECT_FALSE(cache.find("2", "key").has_value());
+    expectData(cache.find("1", "key"), 'a');
+    expectData(cache.find("3", "key"), 'c');
+    EXPECT_EQ(2, getCacheFiles().size());
+
+    cache.setMaxSize(EntrySize);
+    EXPECT_FALSE(cache.find("1", "key").has_value());
+    expectData(cache.find("3", "key"), 'c');
+    EXPECT_EQ(1, getCacheFiles().size());
+}
+
+TEST_F(DownloadCacheTests, entryLargerThanMaxSize)
+{
+    _DownloadCache cache(_directory.string(), EntrySize - 1);
+    cache.insert("1", "key", createData('a'));
+    EXPECT_FALSE(cache.find("1", "key").has_value());
+    EXPECT_TRUE(getCacheFiles().empty());
+}
+
+TEST_F(DownloadCacheTests, contentKeyInvalidation)
+{
+    _DownloadCache cache(_directory.string(), 10 * EntrySize);
+    cache.insert("1", "timestamp1", createData('a'));
+
+    //the outdated entry is removed
+    EXPECT_FALSE(cache.find("1", "timestamp2").has_value());
+    EXPECT_FALSE(cache.find("1", "timestamp1").has_value());
+    EXPECT_TRUE(getCacheFiles().empty());
+
+    cache.insert("1", "timestamp2", createData('b'));
+    expectData(cache.find("1", "timestamp2"), 'b');
+}
+
+TEST_F(DownloadCacheTests, corruptFile)
+{
+    _DownloadCache cache(_directory.string(), 10 * EntrySize);
+    cache.insert("1", "key", createData('a'));
+    cache.insert("2", "key", createData('b'));
+
+    for (auto const& cacheFile : getCacheFiles()) {
+        std::filesystem::resize_file(cacheFile, EntrySize - 1);
+    }
+    EXPECT_FALSE(cache.find("1", "key").has_value());
+    EXPECT_EQ(1, getCacheFiles().size());
+
+    //a cache file with wrong part sizes but the expected file size
+    {
+        std::ofstream stream(getCacheFiles().front(), std::ios::binary);
+        stream << std::string(EntrySize, '\xff');
+    }
+    EXPECT_FALSE(cache.find("2", "key").has_value());
+    EXPECT_TRUE(getCacheFiles().empty());
+}
+
+TEST_F(DownloadCacheTests, indexRoundTrip)
+{
+    {
+        _DownloadCache cache(_directory.string(), 10 * EntrySize);
+        cache.insert("1", "key1", createData('a'));
+        cache.insert("2", "key2", createData('b'));
+        cache.insert("3", "key3", createData('c'));
+        cache.find("1", "key1");
+    }
+    {
+        _DownloadCache cache(_directory.string(), 10 * EntrySize);
+        expectData(cache.find("2", "key2"), 'b');
+        expectData(cache.find("1", "key1"), 'a');
+        expectData(cache.find("3", "key3"), 'c');
+        EXPECT_FALSE(cache.find("2", "key1").has_value());
+    }
+
+    //the access order is restored, hence the least recently used entries are evicted on construction
+    _DownloadCache cache(_directory.string(), 2 * EntrySize);
+    EXPECT_FALSE(cache.find("2", "key2").has_value());
+    expectData(cache.find("1", "key1"), 'a');
+    expectData(cache.find("3", "key3"), 'c');
+    EXPECT_EQ(2, getCacheFiles().size());
+}
+
+TEST_F(DownloadCacheTests, corruptIndex)
+{
+    {
+        _DownloadCache cache(_directory.string(), 10 * EntrySize);
+        cache.insert("1", "key", createData('a'));
+    }
+    {
+        std::ofstream stream(_directory / "index.json");
+        stream << "{\"entries\": [";
+    }
+
+    _DownloadCache cache(_directory.string(), 10 * EntrySize);
+    EXPECT_FALSE(cache.find("1", "key").has_value());
+    cache.insert("1", "key", createData('b'));
+    expectData(cache.find("1", "key"), 'b');
+}
@@ -0,0 +1,208 @@
+#include <chrono>
+#include <iostream>
+
+#include <gtest/gtest.h>
+
+#include "EngineInterface/DescriptionEditService.h"
+#include "EngineInterface/Descriptions.h"
+#include "EngineInterface/GenomeDescriptionService.h"
+#include "EngineInterface/GenomeView.h"
+
+class GenomeViewTests : public ::testing::Test
+{
+public:
+    GenomeViewTests() = default;
+    ~GenomeViewTests() = default;
+
+protected:
+    //genome with constructor and injector sub-genomes nested two levels deep
+    std::vector<uint8_t> createGenome() const
+    {
+        auto subSubGenome = GenomeDescriptionService::convertDescriptionToBytes(GenomeDescription()
+                                                                                     .setHeader(GenomeHeaderDescription().setNumRepetitions(2))
+                                                                                     .setCells({CellGenomeDescription(), CellGenomeDescription()}));
+        auto subGenome = GenomeDescriptionService::convertDescriptionToBytes(
+            GenomeDescription()
+                .setHeader(GenomeHeaderDescription().setNumRepetitions(3))
+                .setCells({
+                    CellGenomeDescription().setCellFunction(NeuronGenomeDescription()),
+                    CellGenomeDescription().setCellFunction(InjectorGenomeDescription().setGenome(subSubGenome)),
+                }));
+        return GenomeDescriptionService::convertDescriptionToBytes(
+            GenomeDescription()
+                .setHeader(GenomeHeaderDescription().setInfiniteRepetitions().setSeparateConstruction(false))
+                .setCells({
+                    CellGenomeDescription().setColor(2).setCellFunction(SensorGenomeDescription().setColor(3)),
+                    CellGenomeDescription().setReferenceAngle(90.0f).setCellFunction(ConstructorGenomeDescription().setGenome(subGenome)),
+                    CellGenomeDescription().setCellFunction(ConstructorGenomeDescription().setMakeSelfCopy()),
+                    CellGenomeDescription().setCellFunction(DetonatorGenomeDescription().setCountDown(300)),
+                    CellGenomeDescription().setOutputBlocked(true),
+                }));
+    }
+};
+
+TEST_F(GenomeViewTests, header)
+{
+    auto genome = createGenome();
+    auto description = GenomeDescriptionService::convertBytesToDescription(genome);
+
+    GenomeView view(genome);
+    EXPECT_EQ(Const::GenomeHeaderSize, view.getHeaderSize());
+    EXPECT_EQ(description.header.shape, view.getShape());
+    EXPECT_EQ(description.header.singleConstruction, view.isSingleConstruction());
+    EXPECT_EQ(description.header.separateConstruction, view.isSeparateConstruction());
+    EXPECT_EQ(description.header.angleAlignment, view.getAngleAlignment());
+    EXPECT_EQ(description.header.stiffness, view.getStiffness());
+    EXPECT_EQ(description.header.connectionDistance, view.getConnectionDistance());
+    EXPECT_EQ(std::numeric_limits<int>::max(), view.getNumRepetitions());
+    EXPECT_EQ(1, view.getNumRepetitions(true));
+}
+
+TEST_F(GenomeViewTests, nodes)
+{
+    auto genome = createGenome();
+    auto description = GenomeDescriptionService::convertBytesToDescription(genome);
+
+    GenomeView view(genome);
+    ASSERT_EQ(description.cells.size(), view.getNumNodes());
+
+    int index = 0;
+    for (auto const& node : view) {
+        auto const& cell = description.cells.at(index);
+        EXPECT_EQ(GenomeDescriptionService::convertNodeIndexToNodeAddress(genome, index), node.getAddress());
+        EXPECT_EQ(cell.getCellFunctionType(), node.getCellFunctionType());
+        EXPECT_EQ(cell.referenceAngle, node.getReferenceAngle());
+        EXPECT_EQ(cell.energy, node.getEnergy());
+        EXPECT_EQ(cell.color, node.getColor());
+        EXPECT_EQ(cell.outputBlocked, node.isOutputBlocked());
+        EXPECT_EQ(cell.getGenome().has_value(), node.hasGenome() && !node.isMakeGenomeCopy());
+        if (auto subGenome = cell.getGenome()) {
+            auto bytes = node.getSubGenome().getBytes();
+            EXPECT_TRUE(*subGenome == std::vector<uint8_t>(bytes.begin(), bytes.end()));
+        }
+        EXPECT_EQ(index, view.getNodeIndex(node.getAddress()));
+        ++index;
+    }
+    EXPECT_EQ(toInt(genome.size()), view.getNodeAddress(index));
+}
+
+TEST_F(GenomeViewTests, recursiveNodes)
+{
+    auto genome = createGenome();
+
+    std::vector<int> depths;
+    std::vector<int> repetitions;
+    GenomeView(genome).executeForEachNodeRecursively([&](int depth, GenomeNodeView const& node, int numRepetitions) {
+        depths.emplace_back(depth);
+        repetitions.emplace_back(numRepetitions);
+    });
+    EXPECT_TRUE((std::vector<int>{0, 0, 1, 1, 2, 2, 0, 0, 0} == depths));
+    EXPECT_TRUE((std::vector<int>{1, 1, 3, 3, 6, 6, 1, 1, 1} == repetitions));
+
+    EXPECT_EQ(9, GenomeDescriptionService::getNumNodesRecursively(genome, false));
+    EXPECT_EQ(5 + 2 * 3 + 2 * 6, GenomeDescriptionService::getNumNodesRecursively(genome, true));
+}
+
+TEST_F(GenomeViewTests, truncatedGenome)
+{
+    auto genome = createGenome();
+
+    for (auto size : {0, Const::GenomeHeaderSize - 1, Const::GenomeHeaderSize, Const::GenomeHeaderSize + 3, toInt(genome.size()) / 2, toInt(genome.size()) - 1}) {
+        std::vector<uint8_t> truncatedGenome(genome.begin(), genome.begin() + size);
+        auto description = GenomeDescriptionService::convertBytesToDescription(truncatedGenome);
+
+        GenomeView view(truncatedGenome);
+        EXPECT_EQ(description.cells.size(), view.getNumNodes());
+        auto lastAddress = -1;
+        for (auto const& node : view) {
+            EXPECT_LT(lastAddress, node.getAddress());
+            EXPECT_LT(node.getAddress(), size);
+            lastAddress = node.getAddress();
+        }
+        EXPECT_EQ(size, view.getNodeAddress(view.getNumNodes()));
+        GenomeDescriptionService::getNumNodesRecursively(truncatedGenome, true);
+    }
+}
+
+TEST_F(GenomeViewTests, sameNodeCountsAsDescription)
+{
+    auto genome = createGenome();
+
+    auto description = GenomeDescriptionService::convertBytesToDescription(genome);
+    auto numNodesFromDescription = toInt(description.cells.size());
+    for (auto const& cell : description.cells) {
+        if (auto subGenome = cell.getGenome()) {
+            numNodesFromDescription += toInt(GenomeDescriptionService::convertBytesToDescription(*subGenome).cells.size());
+        }
+    }
+
+    GenomeView view(genome);
+    auto numNodesFromView = view.getNumNodes();
+    for (auto const& node : view) {
+        if (node.hasGenome() && !node.isMakeGenomeCopy()) {
+            numNodesFromView += node.getSubGenome().getNumNodes();
+        }
+    }
+
+    EXPECT_EQ(numNodesFromDescription, numNodesFromView);
+}
+
+TEST_F(GenomeViewTests, randomizeGenomeColors)
+{
+    ClusteredDataDescription data;
+    data.addCluster(ClusterDescription().addCell(CellDescription().setCellFunction(ConstructorDescription().setGenome(createGenome()))));
+
+    DescriptionEditService::randomizeGenomeColors(data, {4});
+
+    auto description = GenomeDescriptionService::convertBytesToDescription(data.clusters.front().cells.front().getGenomeRef());
+    ASSERT_EQ(5, description.cells.size());
+    EXPECT_EQ(3, std::get<SensorGenomeDescription>(*description.cells.at(0).cellFunction).color);
+    for (auto const& cell : description.cells) {
+        EXPECT_EQ(4, cell.color);
+    }
+    auto subGenome = GenomeDescriptionService::convertBytesToDescription(description.cells.at(1).getGenomeRef());
+    auto subSubGenome = GenomeDescriptionService::convertBytesToDescription(subGenome.cells.at(1).getGenomeRef());
+    for (auto const& cell : subGenome.cells) {
+        EXPECT_EQ(4, cell.color);
+    }
+    for (auto const& cell : subSubGenome.cells) {
+        EXPECT_EQ(4, cell.color);
+    }
+}
+
+//run with --gtest_also_run_disabled_tests --gtest_filter=GenomeViewTests.*
+TEST_F(GenomeViewTests, DISABLED_benchmarkAgainstDescription)
+{
+    auto genome = createGenome();
+    auto constexpr NumIterations = 10000;
+
+    auto startTimepoint = std::chrono::steady_clock::now();
+    auto numNodesFromDescription = 0;
+    for (int i = 0; i < NumIterations; ++i) {
+        auto description = GenomeDescriptionService::convertBytesToDescription(genome);
+        numNodesFromDescription += toInt(description.cells.size());
+        for (auto const& cell : description.cells) {
+            if (auto subGenome = cell.getGenome()) {
+                numNodesFromDescription += toInt(GenomeDescriptionService::convertBytesToDescription(*subGenome).cells.size());
+            }
+        }
+    }
+    auto descriptionDuration = std::chrono::steady_clock::now() - startTimepoint;
+
+    startTimepoint = std::chrono::steady_clock::now();
+    auto numNodesFromView = 0;
+    for (int i = 0; i < NumIterations; ++i) {
+        GenomeView view(genome);
+        numNodesFromView += view.getNumNodes();
+        for (auto const& node : view) {
+            if (node.hasGenome() && !node.isMakeGenomeCopy()) {
+                numNodesFromView += node.getSubGenome().getNumNodes();
+            }
+        }
+    }
+    auto viewDuration = std::chrono::steady_clock::now() - startTimepoint;
+
+    std::cout << NumIterations << " walks: description " << std::chrono::duration_cast<std::chrono::microseconds>(descriptionDuration).count()
+              << " us, view " << std::chrono::duration_cast<std::chrono::microseconds>(viewDuration).count() << " us" << std::endl;
+    EXPECT_EQ(numNodesFromDescription, numNodesFromView);
+}
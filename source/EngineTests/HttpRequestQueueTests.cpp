@@ -0,0 +1,176 @@
+#include <atomic>
+#include <future>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#define CPPHTTPLIB_OPENSSL_SUPPORT
+#include <cpp-httplib/httplib.h>
+
+#include "Network/HttpRequestQueue.h"
+
+class HttpRequestQueueTests : public ::testing::Test
+{
+public:
+    HttpRequestQueueTests()
+    {
+        _server.Get("/value", [this](httplib::Request const& request, httplib::Response& response) {
+            ++_numValueCalls;
+            response.set_content("value " + request.get_param_value("id"), "text/plain");
+        });
+
+        //the first calls are aborted without response
+        _server.Get("/unreliable", [this](httplib::Request const&, httplib::Response& response) {
+            if (++_numUnreliableCalls <= _numFailures) {
+                response.set_content_provider(10, "text/plain", [](size_t, size_t, httplib::DataSink&) { return false; });
+                return;
+            }
+            response.set_content("ok", "text/plain");
+        });
+
+        //blocks until the gate is opened
+        _server.Get("/blocking", [this](httplib::Request const&, httplib::Response& response) {
+            _blockingCallReceived.set_value();
+            _gate.wait();
+            response.set_content("unblocked", "text/plain");
+        });
+
+        auto port = _server.bind_to_any_port("127.0.0.1");
+        _serverThread = std::thread([this] { _server.listen_after_bind(); });
+        _serverAddress = "http://127.0.0.1:" + std::to_string(port);
+    }
+
+    ~HttpRequestQueueTests()
+    {
+        openGate();
+        _server.stop();
+        _serverThread.join();
+    }
+
+protected:
+    HttpRequest createRequest(std::string const& path, std::string const& id = "", bool deduplicate = false) const
+    {
+        HttpRequest result;
+        result.method = HttpMethod::Get;
+        result.path = path;
+        if (!id.empty()) {
+            result.params = {{"id", id}};
+        }
+        result.deduplicate = deduplicate;
+        return result;
+    }
+
+    //occupies the only worker of the queue so that subsequent requests remain queued
+    HttpRequestHandle blockWorker(_HttpRequestQueue& queue)
+    {
+        auto result = queue.execute(createRequest("/blocking"));
+        _blockingCallReceived.get_future().wait();
+        return result;
+    }
+
+    void openGate()
+    {
+        if (!_isGateOpen) {
+            _isGateOpen = true;
+            _openGate.set_value();
+        }
+    }
+
+    httplib::Server _server;
+    std::thread _serverThread;
+    std::string _serverAddress;
+
+    std::atomic<int> _numValueCalls = 0;
+    std::atomic<int> _numUnreliableCalls = 0;
+    int _numFailures = 0;
+
+    std::promise<void> _blockingCallReceived;
+    std::promise<void> _openGate;
+    std::shared_future<void> _gate = _openGate.get_future().share();
+    bool _isGateOpen = false;
+};
+
+TEST_F(HttpRequestQueueTests, retry)
+{
+    _numFailures = 2;
+    _HttpRequestQueue queue(_serverAddress);
+
+    auto response = queue.execute(createRequest("/unreliable")).response.get();
+    ASSERT_TRUE(response.has_value());
+    EXPECT_EQ("ok", *response);
+    EXPECT_EQ(3, _numUnreliableCalls.load());
+}
+
+TEST_F(HttpRequestQueueTests, withoutRetry)
+{
+    _numFailures = 1;
+    _HttpRequestQueue queue(_serverAddress);
+
+    auto request = createRequest("/unreliable");
+    request.withRetry = false;
+    EXPECT_FALSE(queue.execute(request).response.get().has_value());
+    EXPECT_EQ(1, _numUnreliableCalls.load());
+}
+
+TEST_F(HttpRequestQueueTests, deduplication)
+{
+    _HttpRequestQueue queue(_serverAddress, 1);
+    blockWorker(queue);
+
+    auto handle1 = queue.execute(createRequest("/value", "1", true));
+    auto handle2 = queue.execute(createRequest("/value", "1", true));
+    auto handle3 = queue.execute(createRequest("/value", "2", true));
+    auto handle4 = queue.execute(createRequest("/value", "2"));
+    EXPECT_NE(handle1.id, handle2.id);
+    openGate();
+
+    EXPECT_EQ("value 1", *handle1.response.get());
+    EXPECT_EQ("value 1", *handle2.response.get());
+    EXPECT_EQ("value 2", *handle3.response.get());
+    EXPECT_EQ("value 2", *handle4.response.get());
+    EXPECT_EQ(3, _numValueCalls.load());
+}
+
+TEST_F(HttpRequestQueueTests, cancel)
+{
+    _HttpRequestQueue queue(_serverAddress, 1);
+    auto blockingHandle = blockWorker(queue);
+
+    auto handle1 = queue.execute(createRequest("/value", "1"));
+    auto handle2 = queue.execute(createRequest("/value", "2"));
+    queue.cancel(handle1.id);
+    EXPECT_FALSE(handle1.response.get().has_value());
+    openGate();
+
+    EXPECT_EQ("unblocked", *blockingHandle.response.get());
+    EXPECT_EQ("value 2", *handle2.response.get());
+    EXPECT_EQ(1, _numValueCalls.load());
+}
+
+TEST_F(HttpRequestQueueTests, cancelDeduplicatedRequest)
+{
+    _HttpRequestQueue queue(_serverAddress, 1);
+    blockWorker(queue);
+
+    //the request is still executed for the remaining caller
+    auto handle1 = queue.execute(createRequest("/value", "1", true));
+    auto handle2 = queue.execute(createRequest("/value", "1", true));
+    queue.cancel(handle1.id);
+
+    //the request is cancelled after all callers have cancelled it
+    auto handle3 = queue.execute(createRequest("/value", "2", true));
+    auto handle4 = queue.execute(createRequest("/value", "2", true));
+    queue.cancel(handle3.id);
+    queue.cancel(handle4.id);
+    EXPECT_FALSE(handle3.response.get().has_value());
+    EXPECT_FALSE(handle4.response.get().has_value());
+
+    //a cancelled request is not reused
+    auto handle5 = queue.execute(createRequest("/value", "2", true));
+    openGate();
+
+    EXPECT_EQ("value 1", *handle2.response.get());
+    EXPECT_EQ("value 1", *handle1.response.get());
+    EXPECT_EQ("value 2", *handle5.response.get());
+    EXPECT_EQ(2, _numValueCalls.load());
+}
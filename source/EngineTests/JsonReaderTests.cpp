@@ -0,0 +1,78 @@
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Base/JsonReader.h"
+
+class JsonReaderTests : public ::testing::Test
+{
+public:
+    JsonReaderTests() = default;
+    ~JsonReaderTests() = default;
+};
+
+TEST_F(JsonReaderTests, readNestedValues)
+{
+    JsonReader reader(R"( {"a": [1, -2.5e3, true, null], "b": {"c": "x"}, "d": []} )");
+    std::string key;
+
+    reader.beginObject();
+    ASSERT_TRUE(reader.nextMember(key));
+    EXPECT_EQ("a", key);
+    ASSERT_TRUE(reader.isArray());
+    reader.beginArray();
+    std::vector<std::string> values;
+    while (reader.nextElement()) {
+        values.emplace_back(reader.readScalar());
+    }
+    EXPECT_EQ((std::vector<std::string>{"1", "-2.5e3", "true", "null"}), values);
+
+    ASSERT_TRUE(reader.nextMember(key));
+    EXPECT_EQ("b", key);
+    reader.skipValue();
+
+    ASSERT_TRUE(reader.nextMember(key));
+    EXPECT_EQ("d", key);
+    reader.beginArray();
+    EXPECT_FALSE(reader.nextElement());
+    EXPECT_FALSE(reader.nextMember(key));
+}
+
+TEST_F(JsonReaderTests, readEscapedStrings)
+{
+    JsonReader reader(R"(["a\"b\\c\/d\n", "\u00e4\u20ac\ud83d\ude00"])");
+    reader.beginArray();
+    ASSERT_TRUE(reader.nextElement());
+    EXPECT_EQ("a\"b\\c/d\n", reader.readScalar());
+    ASSERT_TRUE(reader.nextElement());
+    EXPECT_EQ("\xc3\xa4\xe2\x82\xac\xf0\x9f\x98\x80", reader.readScalar());
+    EXPECT_FALSE(reader.nextElement());
+}
+
+TEST_F(JsonReaderTests, invalidSyntax)
+{
+    for (auto const& json : {R"({"a" 1})", R"([1 2])", R"(["a)", R"({"a": })"}) {
+        EXPECT_THROW(
+            {
+                JsonReader reader(json);
+                reader.skipValue();
+            },
+            std::runtime_error);
+    }
+}
+
+TEST_F(JsonReaderTests, invalidUnicodeEscapes)
+{
+    for (auto const& json :
+         {R"(["\u00g1"])", R"(["\u+123"])", R"(["\u 123"])", R"(["\u12"])", R"(["\ud83d"])", R"(["\ud83dx"])", R"(["\ud83d\u0041"])", R"(["\ude00"])"}) {
+        EXPECT_THROW(
+            {
+                JsonReader reader(json);
+                reader.beginArray();
+                reader.nextElement();
+                reader.readScalar();
+            },
+            std::runtime_error);
+    }
+}
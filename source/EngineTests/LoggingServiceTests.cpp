@@ -0,0 +1,108 @@
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "Base/LoggingService.h"
+#include "Base/MpscRingBuffer.h"
+
+class LoggingServiceTests : public ::testing::Test
+{
+public:
+    LoggingServiceTests() = default;
+    ~LoggingServiceTests() = default;
+
+protected:
+    class TestLogger : public LoggingCallBack
+    {
+    public:
+        TestLogger() { LoggingService::getInstance().registerCallBack(this); }
+        ~TestLogger() { LoggingService::getInstance().unregisterCallBack(this); }
+
+        void newLogMessage(Priority priority, std::string const& message) override { messages.emplace_back(message); }
+        void newPerformanceEvent(PerformanceEventRecord const& record) override { performanceEvents.emplace_back(record); }
+        void flush() override { ++numFlushes; }
+
+        std::vector<std::string> messages;
+        std::vector<PerformanceEventRecord> performanceEvents;
+        int numFlushes = 0;
+    };
+};
+
+TEST_F(LoggingServiceTests, ringBuffer)
+{
+    MpscRingBuffer<int, 4> ringBuffer;
+    int value = 0;
+    EXPECT_FALSE(ringBuffer.tryPop(value));
+
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < 4; ++i) {
+            EXPECT_TRUE(ringBuffer.tryPush(round * 10 + i));
+        }
+        EXPECT_FALSE(ringBuffer.tryPush(99));
+        for (int i = 0; i < 4; ++i) {
+            EXPECT_TRUE(ringBuffer.tryPop(value));
+            EXPECT_EQ(round * 10 + i, value);
+        }
+        EXPECT_FALSE(ringBuffer.tryPop(value));
+    }
+}
+
+TEST_F(LoggingServiceTests, messagesFromMultipleThreads)
+{
+    auto constexpr NumThreads = 4;
+    auto constexpr NumMessagesPerThread = 5000;
+
+    TestLogger logger;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < NumThreads; ++i) {
+        threads.emplace_back([i] {
+            for (int j = 0; j < NumMessagesPerThread; ++j) {
+                log(Priority::Unimportant, std::to_string(i) + " " + std::to_string(j));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    LoggingService::getInstance().flush();
+
+    ASSERT_EQ(NumThreads * NumMessagesPerThread, logger.messages.size());
+    EXPECT_LT(0, logger.numFlushes);
+
+    //messages of each thread arrive in order and with timestamp
+    std::vector<int> nextMessage(NumThreads, 0);
+    for (auto const& message : logger.messages) {
+        auto separatorPos = message.find(": ");
+        ASSERT_TRUE(separatorPos != std::string::npos);
+        auto content = message.substr(separatorPos + 2);
+        auto threadIndex = std::stoi(content.substr(0, content.find(' ')));
+        auto messageIndex = std::stoi(content.substr(content.find(' ') + 1));
+        EXPECT_EQ(nextMessage.at(threadIndex), messageIndex);
+        nextMessage.at(threadIndex) = messageIndex + 1;
+    }
+}
+
+TEST_F(LoggingServiceTests, flushDeliversPendingMessages)
+{
+    TestLogger logger;
+    log(Priority::Unimportant, "message 1");
+    log(Priority::Important, "message 2");
+    LoggingService::getInstance().flush();
+
+    ASSERT_EQ(2, logger.messages.size());
+    EXPECT_TRUE(logger.messages.back().ends_with("message 2"));
+}
+
+TEST_F(LoggingServiceTests, performanceEvents)
+{
+    TestLogger logger;
+    logPerformanceEvent(PerformanceEvent::ResizeArrays, std::chrono::milliseconds(12));
+    LoggingService::getInstance().flush();
+
+    ASSERT_EQ(1, logger.performanceEvents.size());
+    EXPECT_TRUE(PerformanceEvent::ResizeArrays == logger.performanceEvents.front().event);
+    EXPECT_EQ(12.0, logger.performanceEvents.front().durationMs);
+    ASSERT_EQ(1, logger.messages.size());
+    EXPECT_TRUE(logger.messages.front().ends_with("resize arrays took 12.0 ms"));
+}
@@ -0,0 +1,200 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <sstream>
+
+#include <boost/property_tree/json_parser.hpp>
+#include <gtest/gtest.h>
+
+#include "Network/ListUpdater.h"
+#include "Network/NetworkDataParser.h"
+
+class NetworkDataParserTests : public ::testing::Test
+{
+public:
+    NetworkDataParserTests() = default;
+    ~NetworkDataParserTests() = default;
+
+protected:
+    //similar to the simulation list from the server, numbers are sent as strings
+    std::string createSimulationList(int numEntries, int version = 0) const
+    {
+        std::stringstream stream;
+        stream << "[";
+        for (int i = 0; i < numEntries; ++i) {
+            stream << (i > 0 ? "," : "") << R"({"id":")" << i << R"(","userName":"user )" << i % 100 << R"(","simulationName":"sim \/ )" << i
+                   << R"(","description":"a\nb ä","width":")" << i % 1000 << R"(","height":")" << i % 500 << R"(","particles":")" << i % 3
+                   << R"(","version":"4.5.1","timestamp":"2024-01-)" << 10 + i % 20 << R"(","contentSize":")" << 1024 * i
+                   << R"(","likesByType":{"0":")" << i % 7 + version << R"(","3":"1"},"numDownloads":")" << i % 50 << R"(","fromRelease":")"
+                   << i % 2 << R"(","type":")" << i % 2 << R"(","unknownField":{"a":[1,2]}})";
+        }
+        stream << "]";
+        return stream.str();
+    }
+
+    std::string createUserList(int numEntries) const
+    {
+        std::stringstream stream;
+        stream << "[";
+        for (int i = 0; i < numEntries; ++i) {
+            stream << (i > 0 ? "," : "") << R"({"userName":"user )" << i << R"(","starsReceived":")" << i % 13 << R"(","starsGiven":")" << i % 5
+                   << R"(","timestamp":"2024-02-01","online":")" << (i % 3 == 0 ? "true" : "false") << R"(","lastDayOnline":")"
+                   << (i % 2 == 0 ? "true" : "false") << R"(","timeSpent":")" << i << R"(","gpu":"GPU )" << i % 4 << R"("})";
+        }
+        stream << "]";
+        return stream.str();
+    }
+
+    //decoding via boost::property_tree as done previously for the browser lists
+    std::vector<RemoteSimulationData> decodeSimulationListWithPropertyTree(std::string const& json) const
+    {
+        std::stringstream stream(json);
+        boost::property_tree::ptree tree;
+        boost::property_tree::read_json(stream, tree);
+
+        std::vector<RemoteSimulationData> result;
+        for (auto const& [key, subTree] : tree) {
+            RemoteSimulationData entry;
+            entry.id = subTree.get<std::string>("id");
+            entry.userName = subTree.get<std::string>("userName");
+            entry.simName = subTree.get<std::string>("simulationName");
+            entry.description = subTree.get<std::string>("description");
+            entry.width = subTree.get<int>("width");
+            entry.height = subTree.get<int>("height");
+            entry.particles = subTree.get<int>("particles");
+            entry.version = subTree.get<std::string>("version");
+            entry.timestamp = subTree.get<std::string>("timestamp");
+            entry.contentSize = std::stoll(subTree.get<std::string>("contentSize"));
+            for (auto const& [likeTypeString, numLikesString] : subTree.get_child("likesByType")) {
+                entry.numLikesByEmojiType[std::stoi(likeTypeString)] = std::stoi(numLikesString.data());
+            }
+            entry.numDownloads = subTree.get<int>("numDownloads");
+            entry.fromRelease = subTree.get<int>("fromRelease") == 1;
+            entry.type = subTree.get<RemoteDataType>("type");
+            result.emplace_back(std::move(entry));
+        }
+        return result;
+    }
+
+    std::vector<UserData> decodeUserListWithPropertyTree(std::string const& json) const
+    {
+        std::stringstream stream(json);
+        boost::property_tree::ptree tree;
+        boost::property_tree::read_json(stream, tree);
+
+        std::vector<UserData> result;
+        for (auto const& [key, subTree] : tree) {
+            UserData entry;
+            entry.userName = subTree.get<std::string>("userName");
+            entry.starsReceived = subTree.get<int>("starsReceived");
+            entry.starsGiven = subTree.get<int>("starsGiven");
+            entry.timestamp = subTree.get<std::string>("timestamp");
+            entry.online = subTree.get<bool>("online");
+            entry.lastDayOnline = subTree.get<bool>("lastDayOnline");
+            entry.timeSpent = subTree.get<int>("timeSpent");
+            entry.gpu = subTree.get<std::string>("gpu");
+            result.emplace_back(std::move(entry));
+        }
+        return result;
+    }
+
+    static std::string getId(RemoteSimulationData const& entry) { return entry.id; }
+};
+
+TEST_F(NetworkDataParserTests, decodeSimulationList)
+{
+    auto json = createSimulationList(30000);
+
+    auto result = NetworkDataParser::decodeRemoteSimulationData(json);
+    ASSERT_EQ(30000, result.size());
+    EXPECT_EQ(decodeSimulationListWithPropertyTree(json), result);
+
+    auto const& entry = result.at(1005);
+    EXPECT_EQ("1005", entry.id);
+    EXPECT_EQ("user 5", entry.userName);
+    EXPECT_EQ("sim / 1005", entry.simName);
+    EXPECT_EQ("a\nb \xc3\xa4", entry.description);
+    EXPECT_EQ(5, entry.width);
+    EXPECT_EQ(5, entry.height);
+    EXPECT_EQ(0, entry.particles);
+    EXPECT_EQ(1024 * 1005, entry.contentSize);
+    EXPECT_EQ((std::map<int, int>{{0, 4}, {3, 1}}), entry.numLikesByEmojiType);
+    EXPECT_EQ(5, entry.numDownloads);
+    EXPECT_TRUE(entry.fromRelease);
+    EXPECT_EQ(RemoteDataType_Genome, entry.type);
+}
+
+TEST_F(NetworkDataParserTests, decodeLikesGivenAsArray)
+{
+    auto result = NetworkDataParser::decodeRemoteSimulationData(R"({"0": {"id": "7", "likesByType": ["2", "0", "5"]}})");
+    ASSERT_EQ(1, result.size());
+    EXPECT_EQ("7", result.front().id);
+    EXPECT_EQ((std::map<int, int>{{0, 2}, {1, 0}, {2, 5}}), result.front().numLikesByEmojiType);
+}
+
+TEST_F(NetworkDataParserTests, decodeUserList)
+{
+    auto json = createUserList(1000);
+
+    auto result = NetworkDataParser::decodeUserData(json);
+    ASSERT_EQ(1000, result.size());
+    EXPECT_EQ(decodeUserListWithPropertyTree(json), result);
+    EXPECT_TRUE(result.at(3).online);
+    EXPECT_FALSE(result.at(3).lastDayOnline);
+}
+
+TEST_F(NetworkDataParserTests, invalidJson)
+{
+    EXPECT_THROW(NetworkDataParser::decodeRemoteSimulationData(R"([{"id": "1"})"), std::runtime_error);
+    EXPECT_THROW(NetworkDataParser::decodeUserData(R"([{"online": "maybe"}])"), std::runtime_error);
+}
+
+TEST_F(NetworkDataParserTests, updateListWithoutChanges)
+{
+    auto list = NetworkDataParser::decodeRemoteSimulationData(createSimulationList(1000));
+    auto origList = list;
+
+    EXPECT_FALSE(ListUpdater::update(list, NetworkDataParser::decodeRemoteSimulationData(createSimulationList(1000)), getId));
+    EXPECT_EQ(origList, list);
+}
+
+TEST_F(NetworkDataParserTests, updateListWithChanges)
+{
+    auto list = NetworkDataParser::decodeRemoteSimulationData(createSimulationList(1000));
+
+    //the likes of all entries change, entry 10 is removed and a new entry is added
+    auto newList = NetworkDataParser::decodeRemoteSimulationData(createSimulationList(1001, 1));
+    newList.erase(newList.begin() + 10);
+    std::swap(newList.front(), newList.back());
+    auto expectedList = newList;
+
+    EXPECT_TRUE(ListUpdater::update(list, std::move(newList), getId));
+    ASSERT_EQ(1000, list.size());
+
+    //remaining entries keep their order, new entries are appended
+    EXPECT_EQ("9", list.at(9).id);
+    EXPECT_EQ("11", list.at(10).id);
+    EXPECT_EQ("1000", list.back().id);
+    std::sort(list.begin(), list.end(), [](auto const& left, auto const& right) { return std::stoi(left.id) < std::stoi(right.id); });
+    std::sort(expectedList.begin(), expectedList.end(), [](auto const& left, auto const& right) { return std::stoi(left.id) < std::stoi(right.id); });
+    EXPECT_EQ(expectedList, list);
+}
+
+//run with --gtest_also_run_disabled_tests --gtest_filter=NetworkDataParserTests.*
+TEST_F(NetworkDataParserTests, DISABLED_benchmarkAgainstPropertyTree)
+{
+    auto json = createSimulationList(30000);
+
+    auto startTimepoint = std::chrono::steady_clock::now();
+    auto result = NetworkDataParser::decodeRemoteSimulationData(json);
+    auto parserDuration = std::chrono::steady_clock::now() - startTimepoint;
+
+    startTimepoint = std::chrono::steady_clock::now();
+    auto propertyTreeResult = decodeSimulationListWithPropertyTree(json);
+    auto propertyTreeDuration = std::chrono::steady_clock::now() - startTimepoint;
+
+    std::cout << "30000 entries: NetworkDataParser " << std::chrono::duration_cast<std::chrono::milliseconds>(parserDuration).count()
+              << " ms, property tree " << std::chrono::duration_cast<std::chrono::milliseconds>(propertyTreeDuration).count() << " ms" << std::endl;
+    EXPECT_EQ(propertyTreeResult, result);
+}
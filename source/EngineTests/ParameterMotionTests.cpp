@@ -0,0 +1,168 @@
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include "EngineInterface/SimulationParameters.h"
+
+class ParameterMotionTests : public ::testing::Test
+{
+public:
+    ParameterMotionTests() = default;
+    ~ParameterMotionTests() = default;
+
+protected:
+    float const WorldSizeX = 1000.0f;
+    float const WorldSizeY = 500.0f;
+    float const TimestepSize = 0.5f;
+
+    //reference implementation: movement per time step as previously done on the host
+    void moveStepwise(SimulationParametersSpot& spot, uint64_t timesteps) const
+    {
+        for (uint64_t t = 0; t < timesteps; ++t) {
+            spot.posX = std::fmod(spot.posX + spot.velX * TimestepSize + WorldSizeX, WorldSizeX);
+            spot.posY = std::fmod(spot.posY + spot.velY * TimestepSize + WorldSizeY, WorldSizeY);
+        }
+    }
+};
+
+TEST_F(ParameterMotionTests, linear)
+{
+    SimulationParametersSpot spot;
+    spot.posX = 100.0f;
+    spot.posY = 200.0f;
+    spot.velX = 1.0f;
+    spot.velY = -2.0f;
+    spot.motion.referenceTimestep = 1000;
+
+    float x, y;
+    calcMotionPosition(x, y, spot, 1000, TimestepSize, WorldSizeX, WorldSizeY);
+    EXPECT_FLOAT_EQ(100.0f, x);
+    EXPECT_FLOAT_EQ(200.0f, y);
+
+    calcMotionPosition(x, y, spot, 1010, TimestepSize, WorldSizeX, WorldSizeY);
+    EXPECT_FLOAT_EQ(105.0f, x);
+    EXPECT_FLOAT_EQ(190.0f, y);
+
+    calcMotionPosition(x, y, spot, 990, TimestepSize, WorldSizeX, WorldSizeY);
+    EXPECT_FLOAT_EQ(95.0f, x);
+    EXPECT_FLOAT_EQ(210.0f, y);
+
+    auto steppedSpot = spot;
+    moveStepwise(steppedSpot, 1000);
+    calcMotionPosition(x, y, spot, 2000, TimestepSize, WorldSizeX, WorldSizeY);
+    EXPECT_NEAR(steppedSpot.posX, x, 0.01f);
+    EXPECT_NEAR(steppedSpot.posY, y, 0.01f);
+}
+
+TEST_F(ParameterMotionTests, linear_worldWrap)
+{
+    RadiationSource source;
+    source.posX = 990.0f;
+    source.posY = 5.0f;
+    source.velX = 4.0f;
+    source.velY = -4.0f;
+
+    float x, y;
+    calcMotionPosition(x, y, source, 10, TimestepSize, WorldSizeX, WorldSizeY);
+    EXPECT_FLOAT_EQ(10.0f, x);
+    EXPECT_FLOAT_EQ(485.0f, y);
+
+    //large time steps do not accumulate rounding errors
+    calcMotionPosition(x, y, source, 1000000000ull, TimestepSize, WorldSizeX, WorldSizeY);
+    EXPECT_GE(x, 0.0f);
+    EXPECT_LT(x, WorldSizeX);
+    EXPECT_NEAR(990.0f, x, 0.01f);
+    EXPECT_NEAR(5.0f, y, 0.01f);
+}
+
+TEST_F(ParameterMotionTests, oscillation)
+{
+    SimulationParametersSpot spot;
+    spot.posX = 500.0f;
+    spot.posY = 250.0f;
+    spot.motion.type = ParameterMotionType_Oscillation;
+    spot.motion.oscillation.amplitudeX = 100.0f;
+    spot.motion.oscillation.amplitudeY = 50.0f;
+    spot.motion.oscillation.period = 400.0f;
+
+    float x, y;
+    calcMotionPosition(x, y, spot, 0, TimestepSize, WorldSizeX, WorldSizeY);
+    EXPECT_NEAR(500.0f, x, 0.01f);
+    EXPECT_NEAR(250.0f, y, 0.01f);
+
+    calcMotionPosition(x, y, spot, 100, TimestepSize, WorldSizeX, WorldSizeY);
+    EXPECT_NEAR(600.0f, x, 0.01f);
+    EXPECT_NEAR(300.0f, y, 0.01f);
+
+    calcMotionPosition(x, y, spot, 300, TimestepSize, WorldSizeX, WorldSizeY);
+    EXPECT_NEAR(400.0f, x, 0.01f);
+    EXPECT_NEAR(200.0f, y, 0.01f);
+
+    calcMotionPosition(x, y, spot, 400 * 1000 + 100, TimestepSize, WorldSizeX, WorldSizeY);
+    EXPECT_NEAR(600.0f, x, 0.01f);
+    EXPECT_NEAR(300.0f, y, 0.01f);
+}
+
+TEST_F(ParameterMotionTests, keyframes)
+{
+    RadiationSource source;
+    source.motion.type = ParameterMotionType_Keyframes;
+    auto& keyframes = source.motion.keyframes;
+    keyframes.numKeyframes = 3;
+    keyframes.timesteps[0] = 100;
+    keyframes.timesteps[1] = 200;
+    keyframes.timesteps[2] = 400;
+    keyframes.posX[0] = 100.0f;
+    keyframes.posX[1] = 300.0f;
+    keyframes.posX[2] = 100.0f;
+    keyframes.posY[0] = 50.0f;
+    keyframes.posY[1] = 50.0f;
+    keyframes.posY[2] = 250.0f;
+
+    float x, y;
+    calcMotionPosition(x, y, source, 0, TimestepSize, WorldSizeX, WorldSizeY);
+    EXPECT_FLOAT_EQ(100.0f, x);
+    EXPECT_FLOAT_EQ(50.0f, y);
+
+    calcMotionPosition(x, y, source, 150, TimestepSize, WorldSizeX, WorldSizeY);
+    EXPECT_FLOAT_EQ(200.0f, x);
+    EXPECT_FLOAT_EQ(50.0f, y);
+
+    calcMotionPosition(x, y, source, 300, TimestepSize, WorldSizeX, WorldSizeY);
+    EXPECT_FLOAT_EQ(200.0f, x);
+    EXPECT_FLOAT_EQ(150.0f, y);
+
+    calcMotionPosition(x, y, source, 1000, TimestepSize, WorldSizeX, WorldSizeY);
+    EXPECT_FLOAT_EQ(100.0f, x);
+    EXPECT_FLOAT_EQ(250.0f, y);
+
+    keyframes.repeat = true;
+    calcMotionPosition(x, y, source, 450, TimestepSize, WorldSizeX, WorldSizeY);
+    EXPECT_FLOAT_EQ(200.0f, x);
+    EXPECT_FLOAT_EQ(50.0f, y);
+}
+
+TEST_F(ParameterMotionTests, rebase)
+{
+    SimulationParametersSpot spot;
+    spot.posX = 900.0f;
+    spot.posY = 100.0f;
+    spot.velX = 3.0f;
+    spot.velY = 1.0f;
+    spot.motion.type = ParameterMotionType_Oscillation;
+    spot.motion.oscillation.amplitudeX = 20.0f;
+    spot.motion.oscillation.period = 333.0f;
+    spot.motion.oscillation.phase = 45.0f;
+
+    auto rebasedSpot = spot;
+    rebaseMotion(rebasedSpot, 1234, TimestepSize, WorldSizeX, WorldSizeY);
+    EXPECT_EQ(1234, rebasedSpot.motion.referenceTimestep);
+
+    for (uint64_t timestep : {1234ull, 1500ull, 100000ull}) {
+        float x, y, rebasedX, rebasedY;
+        calcMotionPosition(x, y, spot, timestep, TimestepSize, WorldSizeX, WorldSizeY);
+        calcMotionPosition(rebasedX, rebasedY, rebasedSpot, timestep, TimestepSize, WorldSizeX, WorldSizeY);
+        EXPECT_NEAR(x, rebasedX, 0.05f);
+        EXPECT_NEAR(y, rebasedY, 0.05f);
+    }
+}
@@ -0,0 +1,150 @@
+#include <algorithm>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "Network/RemoteSimulationDataIndex.h"
+
+class RemoteSimulationDataIndexTests : public ::testing::Test
+{
+public:
+    RemoteSimulationDataIndexTests()
+    {
+        //small value ranges such that there are many equal values per column
+        std::mt19937 generator(42);
+        auto randomInt = [&](int max) { return std::uniform_int_distribution<int>(0, max)(generator); };
+        auto randomText = [&](int length) {
+            std::string result;
+            for (int i = 0; i < length; ++i) {
+                result += static_cast<char>('a' + randomInt(3));
+            }
+            return result;
+        };
+        for (int i = 0; i < 500; ++i) {
+            RemoteSimulationData entry;
+            entry.id = std::to_string(i);
+            entry.timestamp = "2024-0" + std::to_string(1 + randomInt(8));
+            entry.userName = randomText(2);
+            entry.simName = randomText(1 + randomInt(6));
+            entry.description = randomText(randomInt(12));
+            entry.numLikesByEmojiType = {{0, randomInt(3)}, {randomInt(4), randomInt(2)}};
+            entry.numDownloads = randomInt(20);
+            entry.width = 100 * randomInt(5);
+            entry.height = 100 * randomInt(5);
+            entry.particles = randomInt(3);
+            entry.contentSize = 1024 * randomInt(10);
+            entry.version = "4." + std::to_string(randomInt(2));
+            _entries.emplace_back(entry);
+        }
+        _index.rebuild(_entries);
+    }
+    ~RemoteSimulationDataIndexTests() = default;
+
+protected:
+    std::vector<int> filterWithoutIndex(std::string const& filter) const
+    {
+        std::vector<int> result;
+        for (int i = 0; i < toInt(_entries.size()); ++i) {
+            if (_entries[i].matchWithFilter(filter)) {
+                result.emplace_back(i);
+            }
+        }
+        return result;
+    }
+
+    int compare(int left, int right, std::vector<RemoteSimulationDataIndex::SortSpec> const& sortSpecs) const
+    {
+        for (auto const& sortSpec : sortSpecs) {
+            if (auto delta = RemoteSimulationData::compareByColumn(_entries[left], _entries[right], sortSpec.columnId)) {
+                return sortSpec.ascending ? delta : -delta;
+            }
+        }
+        return 0;
+    }
+
+    //entries which are equal in all sort columns may appear in any order
+    void checkSort(std::vector<int> const& entryIndices, std::vector<RemoteSimulationDataIndex::SortSpec> const& sortSpecs) const
+    {
+        auto expected = entryIndices;
+        std::stable_sort(expected.begin(), expected.end(), [&](int left, int right) { return compare(left, right, sortSpecs) < 0; });
+
+        auto actual = entryIndices;
+        _index.sort(actual, sortSpecs);
+        ASSERT_EQ(expected.size(), actual.size());
+        for (size_t i = 0; i < expected.size(); ++i) {
+            EXPECT_EQ(0, compare(expected[i], actual[i], sortSpecs));
+        }
+        std::sort(actual.begin(), actual.end());
+        auto sortedEntryIndices = entryIndices;
+        std::sort(sortedEntryIndices.begin(), sortedEntryIndices.end());
+        EXPECT_EQ(sortedEntryIndices, actual);
+    }
+
+    static int toInt(size_t value) { return static_cast<int>(value); }
+
+    std::vector<RemoteSimulationData> _entries;
+    RemoteSimulationDataIndex _index;
+};
+
+TEST_F(RemoteSimulationDataIndexTests, filterShortText)
+{
+    for (auto const& filter : {"a", "d", "ab", "2024", "4.1", "ccd", "00", "-0"}) {
+        EXPECT_EQ(filterWithoutIndex(filter), _index.filter(filter));
+    }
+}
+
+TEST_F(RemoteSimulationDataIndexTests, filterLongText)
+{
+    for (auto const& filter : {"abca", "dcba", "2024-03", "abcdab", "4.0", "1024"}) {
+        EXPECT_EQ(filterWithoutIndex(filter), _index.filter(filter));
+    }
+}
+
+TEST_F(RemoteSimulationDataIndexTests, filterWithoutMatch)
+{
+    for (auto const& filter : {"x", "xy", "xyz", "abcx", "2025-01"}) {
+        EXPECT_TRUE(_index.filter(filter).empty());
+        EXPECT_TRUE(filterWithoutIndex(filter).empty());
+    }
+}
+
+TEST_F(RemoteSimulationDataIndexTests, filterEmptyText)
+{
+    EXPECT_EQ(filterWithoutIndex(""), _index.filter(""));
+    EXPECT_EQ(_entries.size(), _index.filter("").size());
+}
+
+TEST_F(RemoteSimulationDataIndexTests, sortSingleColumn)
+{
+    auto entryIndices = _index.filter("");
+    for (int columnId = 0; columnId < RemoteSimulationDataColumnId_Actions; ++columnId) {
+        checkSort(entryIndices, {{columnId, true}});
+        checkSort(entryIndices, {{columnId, false}});
+    }
+}
+
+TEST_F(RemoteSimulationDataIndexTests, sortMultipleColumns)
+{
+    auto entryIndices = _index.filter("");
+    checkSort(entryIndices, {{RemoteSimulationDataColumnId_Width, true}, {RemoteSimulationDataColumnId_Height, false}});
+    checkSort(entryIndices, {{RemoteSimulationDataColumnId_Likes, false}, {RemoteSimulationDataColumnId_UserName, true}});
+    checkSort(
+        entryIndices,
+        {{RemoteSimulationDataColumnId_Version, false},
+         {RemoteSimulationDataColumnId_Particles, true},
+         {RemoteSimulationDataColumnId_FileSize, false}});
+    checkSort(
+        entryIndices,
+        {{RemoteSimulationDataColumnId_Timestamp, true},
+         {RemoteSimulationDataColumnId_NumDownloads, true},
+         {RemoteSimulationDataColumnId_SimulationName, false}});
+}
+
+TEST_F(RemoteSimulationDataIndexTests, sortFilteredEntries)
+{
+    auto entryIndices = _index.filter("ab");
+    ASSERT_FALSE(entryIndices.empty());
+    ASSERT_TRUE(entryIndices.size() < _entries.size());
+    checkSort(entryIndices, {{RemoteSimulationDataColumnId_Description, true}});
+    checkSort(entryIndices, {{RemoteSimulationDataColumnId_Likes, true}, {RemoteSimulationDataColumnId_Width, false}});
+}
@@ -0,0 +1,268 @@
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "Base/Definitions.h"
+#include "EngineGpuKernels/RenderingTiles.cuh"
+
+class RenderingTilesTests : public ::testing::Test
+{
+public:
+    RenderingTilesTests() = default;
+    ~RenderingTilesTests() = default;
+
+protected:
+    struct Bins
+    {
+        std::vector<int> offsets;  //numBins + 1 entries
+        std::vector<int> entityIndices;
+    };
+
+    //prefix sum as in cudaCalcOffsets with one chunk per thread
+    void calcOffsets(std::vector<int>& counts, std::vector<int>& offsets, int numChunks) const
+    {
+        auto numCounts = toInt(counts.size());
+        std::vector<int> chunkOffsets(numChunks);
+        for (int chunk = 0; chunk < numChunks; ++chunk) {
+            int startIndex, endIndex;
+            RenderingTiles::calcChunk(numCounts, chunk, numChunks, startIndex, endIndex);
+            chunkOffsets[chunk] = RenderingTiles::sumChunk(counts.data(), startIndex, endIndex);
+        }
+        offsets[numCounts] = RenderingTiles::scanChunkSums(chunkOffsets.data(), numChunks);
+        for (int chunk = 0; chunk < numChunks; ++chunk) {
+            int startIndex, endIndex;
+            RenderingTiles::calcChunk(numCounts, chunk, numChunks, startIndex, endIndex);
+            RenderingTiles::writeChunkOffsets(counts.data(), offsets.data(), startIndex, endIndex, chunkOffsets[chunk]);
+        }
+    }
+
+    //executes the binning routines in the same order as the kernels, the prefix sum is split into several chunks like on the device
+    Bins bin(std::vector<int> const& entityIndices, std::vector<int> const& binIndices, int numBins, int numChunks) const
+    {
+        Bins result;
+        result.offsets.resize(numBins + 1);
+        std::vector<int> counts(numBins, 0);
+        for (size_t i = 0; i < entityIndices.size(); ++i) {
+            RenderingTiles::binEntity(entityIndices[i], binIndices[i], counts.data(), result.offsets.data(), nullptr);
+        }
+
+        calcOffsets(counts, result.offsets, numChunks);
+
+        result.entityIndices.resize(result.offsets[numBins]);
+        for (size_t i = 0; i < entityIndices.size(); ++i) {
+            RenderingTiles::binEntity(entityIndices[i], binIndices[i], counts.data(), result.offsets.data(), result.entityIndices.data());
+        }
+        return result;
+    }
+
+    Bins buildGrid(std::vector<float2> const& positions, int2 const& worldSize, int numChunks) const
+    {
+        auto gridSize = RenderingTiles::calcGridSize(worldSize);
+        std::vector<int> entityIndices;
+        std::vector<int> gridCellIndices;
+        for (int i = 0; i < static_cast<int>(positions.size()); ++i) {
+            entityIndices.emplace_back(i);
+            gridCellIndices.emplace_back(RenderingTiles::calcGridCellIndex(positions[i], gridSize));
+        }
+        return bin(entityIndices, gridCellIndices, gridSize.x * gridSize.y, numChunks);
+    }
+
+    int calcTileIndex(float2 const& pos, float2 const& rectUpperLeft, float2 const& rectLowerRight, int2 const& imageSize, float zoom) const
+    {
+        if (pos.x < rectUpperLeft.x || pos.x > rectLowerRight.x || pos.y < rectUpperLeft.y || pos.y > rectLowerRight.y) {
+            return -1;
+        }
+        auto imagePos = RenderingTiles::mapWorldPosToImagePos(rectUpperLeft, pos, zoom);
+        return RenderingTiles::calcTileIndex(imagePos, RenderingTiles::calcNumTiles(imageSize));
+    }
+
+    //only the entities of the visible grid cells are binned by tiles (as in cudaBinCellsByTiles)
+    Bins binByTilesUsingGrid(
+        std::vector<float2> const& positions,
+        int2 const& worldSize,
+        float2 const& rectUpperLeft,
+        int2 const& imageSize,
+        float zoom,
+        int& numConsideredEntities) const
+    {
+        float2 rectLowerRight{rectUpperLeft.x + imageSize.x / zoom, rectUpperLeft.y + imageSize.y / zoom};
+        auto grid = buildGrid(positions, worldSize, 7);
+        auto gridSize = RenderingTiles::calcGridSize(worldSize);
+
+        std::vector<int> entityIndices;
+        std::vector<int> tileIndices;
+        int2 firstGridCell, lastGridCell;
+        if (RenderingTiles::calcVisibleGridCells(rectUpperLeft, rectLowerRight, gridSize, firstGridCell, lastGridCell)) {
+            for (int row = firstGridCell.y; row <= lastGridCell.y; ++row) {
+                int startIndex, endIndex;
+                RenderingTiles::calcEntityRangeOfGridRow(grid.offsets.data(), gridSize, firstGridCell, lastGridCell, row, startIndex, endIndex);
+                for (int index = startIndex; index < endIndex; ++index) {
+                    auto entityIndex = grid.entityIndices[index];
+                    entityIndices.emplace_back(entityIndex);
+                    tileIndices.emplace_back(calcTileIndex(positions[entityIndex], rectUpperLeft, rectLowerRight, imageSize, zoom));
+                }
+            }
+        }
+        numConsideredEntities = static_cast<int>(entityIndices.size());
+        auto numTiles = RenderingTiles::calcNumTiles(imageSize);
+        return bin(entityIndices, tileIndices, numTiles.x * numTiles.y, 5);
+    }
+
+    //reference: all entities are checked
+    std::vector<std::vector<int>> binByTilesWithoutGrid(
+        std::vector<float2> const& positions,
+        float2 const& rectUpperLeft,
+        int2 const& imageSize,
+        float zoom) const
+    {
+        float2 rectLowerRight{rectUpperLeft.x + imageSize.x / zoom, rectUpperLeft.y + imageSize.y / zoom};
+        auto numTiles = RenderingTiles::calcNumTiles(imageSize);
+        std::vector<std::vector<int>> result(numTiles.x * numTiles.y);
+        for (int i = 0; i < static_cast<int>(positions.size()); ++i) {
+            auto tileIndex = calcTileIndex(positions[i], rectUpperLeft, rectLowerRight, imageSize, zoom);
+            if (tileIndex != -1) {
+                result[tileIndex].emplace_back(i);
+            }
+        }
+        return result;
+    }
+
+    std::vector<std::vector<int>> toSortedBinContents(Bins const& bins) const
+    {
+        std::vector<std::vector<int>> result;
+        for (size_t i = 0; i + 1 < bins.offsets.size(); ++i) {
+            std::vector<int> content(bins.entityIndices.begin() + bins.offsets[i], bins.entityIndices.begin() + bins.offsets[i + 1]);
+            std::sort(content.begin(), content.end());
+            result.emplace_back(content);
+        }
+        return result;
+    }
+};
+
+TEST_F(RenderingTilesTests, tileIndices)
+{
+    auto numTiles = RenderingTiles::calcNumTiles({100, 70});
+    EXPECT_EQ(4, numTiles.x);
+    EXPECT_EQ(3, numTiles.y);
+
+    EXPECT_EQ(0, RenderingTiles::calcTileIndex({0, 0}, numTiles));
+    EXPECT_EQ(1, RenderingTiles::calcTileIndex({RenderingTiles::TileSize + 0.5f, 3.0f}, numTiles));
+    EXPECT_EQ(3 + 2 * 4, RenderingTiles::calcTileIndex({100.0f, 70.0f}, numTiles));
+}
+
+TEST_F(RenderingTilesTests, prefixSumInChunks)
+{
+    std::vector<int> counts{3, 0, 2, 5, 0, 0, 1, 4, 2, 0, 7};
+    for (int numChunks : {1, 2, 3, 11, 16}) {
+        auto countsCopy = counts;
+        std::vector<int> offsets(counts.size() + 1);
+        calcOffsets(countsCopy, offsets, numChunks);
+        EXPECT_EQ((std::vector<int>{0, 3, 3, 5, 10, 10, 10, 11, 15, 17, 17, 24}), offsets);
+        EXPECT_EQ(std::vector<int>(counts.size(), 0), countsCopy);
+    }
+}
+
+TEST_F(RenderingTilesTests, workListsContainVisibleEntitiesGroupedByTiles)
+{
+    int2 imageSize{100, 70};
+    std::vector<float2> positions{{10, 10}, {-1, 5}, {90, 60}, {11, 12}, {50, 80}, {40, 10}, {5, 5}};
+    std::vector<int> entityIndices;
+    std::vector<int> tileIndices;
+    for (int i = 0; i < toInt(positions.size()); ++i) {
+        entityIndices.emplace_back(i);
+        tileIndices.emplace_back(calcTileIndex(positions[i], {0, 0}, {100, 70}, imageSize, 1.0f));
+    }
+    auto numTiles = RenderingTiles::calcNumTiles(imageSize);
+    auto workLists = bin(entityIndices, tileIndices, numTiles.x * numTiles.y, 4);
+
+    EXPECT_EQ(13, workLists.offsets.size());
+    EXPECT_EQ((std::vector<int>{0, 3, 6, 5, 2}), workLists.entityIndices);
+    EXPECT_EQ((std::vector<int>{0, 3, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5}), workLists.offsets);
+}
+
+TEST_F(RenderingTilesTests, gridSortsEntitiesByGridCells)
+{
+    int2 worldSize{40, 20};
+    auto gridSize = RenderingTiles::calcGridSize(worldSize);
+    EXPECT_EQ(3, gridSize.x);
+    EXPECT_EQ(2, gridSize.y);
+
+    std::vector<float2> positions{{35, 19}, {1, 1}, {17, 3}, {40, 20}, {2, 15}, {15.9f, 16}};
+    auto grid = buildGrid(positions, worldSize, 4);
+    EXPECT_EQ((std::vector<int>{0, 2, 3, 3, 4, 4, 6}), grid.offsets);
+    EXPECT_EQ((std::vector<int>{1, 4, 2, 5, 0, 3}), grid.entityIndices);
+}
+
+TEST_F(RenderingTilesTests, visibleGridCells)
+{
+    int2 gridSize{10, 8};
+    int2 firstGridCell, lastGridCell;
+    ASSERT_TRUE(RenderingTiles::calcVisibleGridCells({20, 33}, {50, 40}, gridSize, firstGridCell, lastGridCell));
+    EXPECT_EQ(1, firstGridCell.x);
+    EXPECT_EQ(2, firstGridCell.y);
+    EXPECT_EQ(3, lastGridCell.x);
+    EXPECT_EQ(2, lastGridCell.y);
+
+    ASSERT_TRUE(RenderingTiles::calcVisibleGridCells({-100, -5}, {1000, 1000}, gridSize, firstGridCell, lastGridCell));
+    EXPECT_EQ(0, firstGridCell.x);
+    EXPECT_EQ(0, firstGridCell.y);
+    EXPECT_EQ(9, lastGridCell.x);
+    EXPECT_EQ(7, lastGridCell.y);
+
+    EXPECT_FALSE(RenderingTiles::calcVisibleGridCells({200, 0}, {300, 10}, gridSize, firstGridCell, lastGridCell));
+    EXPECT_FALSE(RenderingTiles::calcVisibleGridCells({-50, 0}, {-10, 10}, gridSize, firstGridCell, lastGridCell));
+}
+
+TEST_F(RenderingTilesTests, dotWeights)
+{
+    unsigned int index;
+    float weights[4];
+    ASSERT_TRUE(RenderingTiles::calcDotPixels({100, 70}, {10.25f, 20.5f}, index, weights));
+    EXPECT_EQ(10 + 20 * 100, index);
+    EXPECT_TRUE(std::abs(weights[0] + weights[1] + weights[2] + weights[3] - 1.0f) < 1e-6f);
+    EXPECT_TRUE(std::abs(weights[1] - 0.125f) < 1e-6f);
+
+    EXPECT_FALSE(RenderingTiles::calcDotPixels({100, 70}, {0.5f, 20.5f}, index, weights));
+    EXPECT_FALSE(RenderingTiles::calcDotPixels({100, 70}, {50.0f, 69.5f}, index, weights));
+}
+
+TEST_F(RenderingTilesTests, binningUsingGridEqualsBinningOfAllEntities)
+{
+    int2 worldSize{2000, 1000};
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<float> distributionX(0.0f, toFloat(worldSize.x));
+    std::uniform_real_distribution<float> distributionY(0.0f, toFloat(worldSize.y));
+    std::vector<float2> positions(100000);
+    for (auto& pos : positions) {
+        pos = {distributionX(generator), distributionY(generator)};
+    }
+
+    struct View
+    {
+        float2 rectUpperLeft;
+        float zoom;
+    };
+    for (auto const& view : {View{{500.0f, 300.0f}, 8.0f}, View{{-100.0f, -50.0f}, 0.5f}, View{{1900.0f, 950.0f}, 4.0f}, View{{3000.0f, 0}, 2.0f}}) {
+        int2 imageSize{640, 480};
+        int numConsideredEntities = 0;
+        auto workLists = binByTilesUsingGrid(positions, worldSize, view.rectUpperLeft, imageSize, view.zoom, numConsideredEntities);
+        auto expectedWorkLists = binByTilesWithoutGrid(positions, view.rectUpperLeft, imageSize, view.zoom);
+        EXPECT_EQ(expectedWorkLists, toSortedBinContents(workLists));
+
+        //only the entities of the grid cells overlapping the visible rect are considered
+        auto gridSize = RenderingTiles::calcGridSize(worldSize);
+        float2 rectLowerRight{view.rectUpperLeft.x + imageSize.x / view.zoom, view.rectUpperLeft.y + imageSize.y / view.zoom};
+        int2 firstGridCell{0, 0}, lastGridCell{-1, -1};
+        RenderingTiles::calcVisibleGridCells(view.rectUpperLeft, rectLowerRight, gridSize, firstGridCell, lastGridCell);
+        auto expectedNumConsideredEntities = std::count_if(positions.begin(), positions.end(), [&](float2 const& pos) {
+            auto gridCellIndex = RenderingTiles::calcGridCellIndex(pos, gridSize);
+            auto x = gridCellIndex % gridSize.x;
+            auto y = gridCellIndex / gridSize.x;
+            return x >= firstGridCell.x && x <= lastGridCell.x && y >= firstGridCell.y && y <= lastGridCell.y;
+        });
+        EXPECT_EQ(expectedNumConsideredEntities, numConsideredEntities);
+        EXPECT_LT(numConsideredEntities, toInt(positions.size()));
+    }
+}
@@ -0,0 +1,460 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <sstream>
+
+#include <cereal/archives/portable_binary.hpp>
+#include <cereal/types/optional.hpp>
+#include <cereal/types/unordered_map.hpp>
+#include <cereal/types/variant.hpp>
+#include <cereal/types/vector.hpp>
+#include <zstr.hpp>
+
+#include "EngineInterface/ChunkedCompressionService.h"
+#include "EngineInterface/ColumnarSerializerService.h"
+#include "EngineInterface/DeltaCheckpointService.h"
+#include "EngineInterface/Descriptions.h"
+#include "EngineInterface/GenomeDescriptionService.h"
+#include "EngineInterface/SerializerService.h"
+#include "EngineInterface/TiledSimulationFile.h"
+
+class SerializerTests : public ::testing::Test
+{
+public:
+    SerializerTests() = default;
+    ~SerializerTests() = default;
+
+protected:
+    //same types as in the auxiliary maps of older file versions
+    using VariantData = std::variant<int, float, uint64_t, bool, std::optional<float>, std::optional<int>, std::vector<int>>;
+
+    //neuron encoding of older versions where weights and biases were stored as std::vector
+    void writeOldNeuron(
+        std::ostream& stream,
+        std::vector<std::vector<float>> const& weights,
+        std::vector<float> const& biases,
+        std::vector<int> const& activationFunctions) const
+    {
+        cereal::PortableBinaryOutputArchive archive(stream);
+        std::unordered_map<int, VariantData> auxiliaries;
+        auxiliaries.emplace(0, activationFunctions);
+        archive(auxiliaries);
+        archive(weights, biases);
+    }
+
+    void readOldNeuron(std::istream& stream, std::vector<std::vector<float>>& weights, std::vector<float>& biases, std::vector<int>& activationFunctions) const
+    {
+        cereal::PortableBinaryInputArchive archive(stream);
+        std::unordered_map<int, VariantData> auxiliaries;
+        archive(auxiliaries);
+        activationFunctions = std::get<std::vector<int>>(auxiliaries.at(0));
+        archive(weights, biases);
+    }
+
+    ClusteredDataDescription createData() const
+    {
+        auto genome = GenomeDescriptionService::convertDescriptionToBytes(
+            GenomeDescription().setCells({CellGenomeDescription(), CellGenomeDescription().setCellFunction(NeuronGenomeDescription())}));
+
+        NeuronDescription neuron;
+        neuron.weights[2][1] = 1.0f;
+        neuron.biases[3] = -0.5f;
+        neuron.activationFunctions[4] = NeuronActivationFunction_Gaussian;
+
+        ClusteredDataDescription result;
+        result.addCluster(ClusterDescription().addCells({
+            CellDescription()
+                .setId(1)
+                .setPos({2.0f, 4.0f})
+                .setVel({0.5f, 1.0f})
+                .setMaxConnections(2)
+                .setExecutionOrderNumber(3)
+                .setInputExecutionOrderNumber(4)
+                .setCellFunction(neuron)
+                .setActivity({1, 0, -1, 0, 0, 0, 0, 0})
+                .setMetadata(CellMetadataDescription().setName("name").setDescription("description"))
+                .setConnectingCells({ConnectionDescription().setCellId(2).setDistance(1.0f).setAngleFromPrevious(360.0f)}),
+            CellDescription()
+                .setId(2)
+                .setPos({3.0f, 4.0f})
+                .setMaxConnections(2)
+                .setCellFunction(ConstructorDescription().setGenome(genome).setGenomeCurrentNodeIndex(1))
+                .setConnectingCells({ConnectionDescription().setCellId(1).setDistance(1.0f).setAngleFromPrevious(360.0f)}),
+        }));
+        result.addCluster(ClusterDescription().addCell(CellDescription().setId(3).setCellFunction(SensorDescription().setFixedAngle(30.0f))));
+        result.addCluster(ClusterDescription().addCell(CellDescription().setId(4).setCellFunction(InjectorDescription().setGenome(genome))));
+        result.addCluster(ClusterDescription().addCell(CellDescription().setId(5).setCellFunction(DetonatorDescription().setCountDown(5))));
+        result.addParticle(ParticleDescription().setId(6).setPos({10.0f, 20.0f}).setEnergy(50.0f).setColor(3));
+        return result;
+    }
+};
+
+TEST_F(SerializerTests, simulationRoundTrip)
+{
+    DeserializedSimulation input;
+    input.mainData = createData();
+
+    SerializedSimulation serializedData;
+    ASSERT_TRUE(SerializerService::serializeSimulationToStrings(serializedData, input));
+
+    DeserializedSimulation output;
+    ASSERT_TRUE(SerializerService::deserializeSimulationFromStrings(output, serializedData));
+
+    EXPECT_EQ(input.mainData, output.mainData);
+}
+
+TEST_F(SerializerTests, emptySimulationRoundTrip)
+{
+    DeserializedSimulation input;
+
+    SerializedSimulation serializedData;
+    ASSERT_TRUE(SerializerService::serializeSimulationToStrings(serializedData, input));
+
+    DeserializedSimulation output;
+    ASSERT_TRUE(SerializerService::deserializeSimulationFromStrings(output, serializedData));
+
+    EXPECT_TRUE(output.mainData.isEmpty());
+}
+
+TEST_F(SerializerTests, corruptDataIsRejected)
+{
+    DeserializedSimulation input;
+    input.mainData = createData();
+
+    SerializedSimulation serializedData;
+    ASSERT_TRUE(SerializerService::serializeSimulationToStrings(serializedData, input));
+    serializedData.mainData.resize(serializedData.mainData.size() / 2);
+
+    DeserializedSimulation output;
+    EXPECT_FALSE(SerializerService::deserializeSimulationFromStrings(output, serializedData));
+}
+
+TEST_F(SerializerTests, identicalGenomesAreStoredOnce)
+{
+    auto genome = GenomeDescriptionService::convertDescriptionToBytes(GenomeDescription().setCells(std::vector<CellGenomeDescription>(1000)));
+    auto otherGenome = GenomeDescriptionService::convertDescriptionToBytes(GenomeDescription().setCells(std::vector<CellGenomeDescription>(100)));
+
+    auto createReplicators = [&](int numReplicators) {
+        ClusteredDataDescription result;
+        for (int i = 0; i < numReplicators; ++i) {
+            result.addCluster(ClusterDescription().addCell(
+                CellDescription().setId(i + 1).setCellFunction(ConstructorDescription().setGenome(i % 2 == 0 ? genome : otherGenome))));
+        }
+        return result;
+    };
+    auto input = createReplicators(10);
+
+    std::stringstream stream;
+    ColumnarSerializerService::serialize(input, stream);
+    std::stringstream referenceStream;
+    ColumnarSerializerService::serialize(createReplicators(2), referenceStream);
+    EXPECT_LT(stream.str().size() - referenceStream.str().size(), genome.size());
+
+    ClusteredDataDescription output;
+    ColumnarSerializerService::deserialize(output, stream);
+    EXPECT_EQ(input, output);
+}
+
+TEST_F(SerializerTests, identicalGenomesAreStoredOnceAfterDeserialization)
+{
+    auto genome = GenomeDescriptionService::convertDescriptionToBytes(GenomeDescription().setCells(std::vector<CellGenomeDescription>(10)));
+    auto otherGenome = GenomeDescriptionService::convertDescriptionToBytes(GenomeDescription().setCells(std::vector<CellGenomeDescription>(20)));
+
+    ColumnarData input;
+    input.genomePool.addGenome(genome.data(), genome.size());
+    input.genomePool.addGenome(otherGenome.data(), otherGenome.size());
+    std::stringstream stream;
+    ColumnarSerializerService::serialize(input, stream);
+
+    ColumnarData output;
+    ColumnarSerializerService::deserialize(output, stream);
+    EXPECT_EQ(1, output.genomePool.addGenome(otherGenome.data(), otherGenome.size()));
+    EXPECT_EQ(0, output.genomePool.addGenome(genome.data(), genome.size()));
+    EXPECT_EQ(2, output.genomePool.genomeSize.size());
+    EXPECT_EQ(genome.size() + otherGenome.size(), output.genomePool.bytes.size());
+}
+
+TEST_F(SerializerTests, unclusteredColumnarDataIsGroupedByConnections)
+{
+    auto input = createData();
+    auto columnarData = ColumnarSerializerService::convertDescriptionToColumnarData(input);
+    columnarData.clusters.numCells.clear();
+
+    std::stringstream stream;
+    ColumnarSerializerService::serialize(columnarData, stream);
+    ColumnarData output;
+    ColumnarSerializerService::deserialize(output, stream);
+
+    EXPECT_TRUE(output.clusters.numCells.empty());
+    EXPECT_EQ(input, ColumnarSerializerService::convertColumnarDataToDescription(output));
+}
+
+TEST_F(SerializerTests, chunkedCompressionRoundTrip)
+{
+    std::string input;
+    for (int i = 0; i < 100000; ++i) {
+        input += std::to_string(i);
+    }
+
+    auto compressed = ChunkedCompressionService::compress(input, 1000);
+    EXPECT_TRUE(ChunkedCompressionService::isChunkedFormat(compressed));
+    EXPECT_EQ(input, ChunkedCompressionService::decompress(compressed));
+    EXPECT_EQ(std::string(), ChunkedCompressionService::decompress(ChunkedCompressionService::compress(std::string())));
+}
+
+TEST_F(SerializerTests, gzipCompressedDataIsLoaded)
+{
+    DeserializedSimulation input;
+    input.mainData = createData();
+
+    SerializedSimulation serializedData;
+    {
+        std::stringstream stdStream;
+        zstr::ostream stream(stdStream, std::ios::binary);
+        ColumnarSerializerService::serialize(input.mainData, stream);
+        stream.flush();
+        serializedData.mainData = stdStream.str();
+    }
+    ASSERT_FALSE(ChunkedCompressionService::isChunkedFormat(serializedData.mainData));
+
+    DeserializedSimulation output;
+    ASSERT_TRUE(SerializerService::deserializeSimulationFromStrings(output, serializedData));
+
+    EXPECT_EQ(input.mainData, output.mainData);
+}
+
+TEST_F(SerializerTests, uncompressedDataIsLoaded)
+{
+    DeserializedSimulation input;
+    input.mainData = createData();
+
+    SerializedSimulation serializedData;
+    ASSERT_TRUE(SerializerService::serializeSimulationToStrings(serializedData, input));
+
+    SerializedSimulation uncompressedData = serializedData;
+    ASSERT_TRUE(SerializerService::convertToUncompressedData(uncompressedData.mainData, serializedData.mainData));
+    EXPECT_TRUE(ChunkedCompressionService::isChunkedFormat(uncompressedData.mainData));
+
+    DeserializedSimulation output;
+    ASSERT_TRUE(SerializerService::deserializeSimulationFromStrings(output, uncompressedData));
+    EXPECT_EQ(input.mainData, output.mainData);
+}
+
+TEST_F(SerializerTests, tiledFileQueries)
+{
+    ClusteredDataDescription data;
+    for (int i = 0; i < 10; ++i) {
+        data.addCluster(ClusterDescription().addCells(
+            {CellDescription().setId(i * 2 + 1).setPos({i * 100.0f + 10.0f, 50.0f}),
+             CellDescription().setId(i * 2 + 2).setPos({i * 100.0f + 11.0f, 50.0f})}));
+        data.addParticle(ParticleDescription().setId(100 + i).setPos({i * 100.0f + 20.0f, 60.0f}));
+    }
+    auto filename = (std::filesystem::temp_directory_path() / "tiledFileQueries.sim").string();
+    TiledSimulationFile::write(filename, data, {1000, 100}, 64.0f);
+    ASSERT_TRUE(TiledSimulationFile::isTiledFile(filename));
+
+    {
+        TiledSimulationFile file(filename);
+        EXPECT_EQ(10, file.getNumClusters());
+
+        auto region = file.getRegion({200.0f, 0.0f}, {400.0f, 100.0f});
+        ASSERT_EQ(2, region.clusters.size());
+        EXPECT_EQ(data.clusters.at(2), region.clusters.at(0));
+        EXPECT_EQ(data.clusters.at(3), region.clusters.at(1));
+        EXPECT_EQ(2, region.particles.size());
+
+        //rectangles crossing the world edge
+        for (auto const& [topLeft, bottomRight] : std::vector<std::pair<RealVector2D, RealVector2D>>{
+                 {{-100.0f, 0.0f}, {50.0f, 100.0f}}, {{900.0f, 0.0f}, {1050.0f, 100.0f}}, {{900.0f, -50.0f}, {50.0f, 50.0f}}}) {
+            auto region = file.getRegion(topLeft, bottomRight);
+            ASSERT_EQ(2, region.clusters.size());
+            EXPECT_EQ(data.clusters.at(9), region.clusters.at(0));
+            EXPECT_EQ(data.clusters.at(0), region.clusters.at(1));
+            EXPECT_EQ(2, region.particles.size());
+        }
+        EXPECT_EQ(10, file.getRegion({0.0f, 0.0f}, {5000.0f, 100.0f}).clusters.size());
+        EXPECT_TRUE(file.getRegion({0.0f, 60.0f}, {1000.0f, 100.0f}).clusters.empty());
+
+        EXPECT_EQ(data.clusters.at(4), file.getCluster(4));
+        EXPECT_EQ(data.clusters.at(7), file.getClusterByCellId(16));
+        EXPECT_FALSE(file.getClusterByCellId(1000).has_value());
+        EXPECT_FALSE(file.getCluster(10).has_value());
+    }
+    std::filesystem::remove(filename);
+}
+
+TEST_F(SerializerTests, neuronFromOlderVersion)
+{
+    std::vector<std::vector<float>> weights(MAX_CHANNELS, std::vector<float>(MAX_CHANNELS));
+    std::vector<float> biases(MAX_CHANNELS);
+    std::vector<int> activationFunctions(MAX_CHANNELS);
+    for (int i = 0; i < MAX_CHANNELS; ++i) {
+        for (int j = 0; j < MAX_CHANNELS; ++j) {
+            weights[i][j] = toFloat(i * MAX_CHANNELS + j);
+        }
+        biases[i] = -toFloat(i);
+        activationFunctions[i] = i % NeuronActivationFunction_Count;
+    }
+    std::stringstream stream;
+    writeOldNeuron(stream, weights, biases, activationFunctions);
+
+    NeuronDescription neuron;
+    SerializerService::deserializeNeuron(neuron, stream);
+    for (int i = 0; i < MAX_CHANNELS; ++i) {
+        for (int j = 0; j < MAX_CHANNELS; ++j) {
+            EXPECT_EQ(weights[i][j], neuron.weights[i][j]);
+        }
+        EXPECT_EQ(biases[i], neuron.biases[i]);
+        EXPECT_EQ(activationFunctions[i], neuron.activationFunctions[i]);
+    }
+}
+
+TEST_F(SerializerTests, neuronFromOlderVersionWithDifferentSizes)
+{
+    //short rows and missing rows are padded with zeros, long rows and additional rows are truncated
+    std::vector<std::vector<float>> weights(MAX_CHANNELS + 2);
+    for (int i = 0; i < MAX_CHANNELS + 2; ++i) {
+        weights[i] = std::vector<float>(i % 2 == 0 ? MAX_CHANNELS - 3 : MAX_CHANNELS + 3, toFloat(i + 1));
+    }
+    std::vector<float> biases(MAX_CHANNELS - 1, 2.0f);
+    std::vector<int> activationFunctions(MAX_CHANNELS + 1, NeuronActivationFunction_Gaussian);
+    {
+        std::stringstream stream;
+        writeOldNeuron(stream, weights, biases, activationFunctions);
+
+        NeuronDescription neuron;
+        SerializerService::deserializeNeuron(neuron, stream);
+        for (int i = 0; i < MAX_CHANNELS; ++i) {
+            for (int j = 0; j < MAX_CHANNELS; ++j) {
+                auto expectedWeight = i % 2 == 0 && j >= MAX_CHANNELS - 3 ? 0.0f : toFloat(i + 1);
+                EXPECT_EQ(expectedWeight, neuron.weights[i][j]);
+            }
+            EXPECT_EQ(i < MAX_CHANNELS - 1 ? 2.0f : 0.0f, neuron.biases[i]);
+            EXPECT_EQ(NeuronActivationFunction_Gaussian, neuron.activationFunctions[i]);
+        }
+    }
+    {
+        weights.resize(2);
+        std::stringstream stream;
+        writeOldNeuron(stream, weights, biases, activationFunctions);
+        {
+            //data following the neuron should still be read correctly
+            cereal::PortableBinaryOutputArchive archive(stream);
+            archive(42);
+        }
+
+        NeuronDescription neuron;
+        neuron.weights[5][5] = 1.0f;
+        SerializerService::deserializeNeuron(neuron, stream);
+        EXPECT_EQ(1.0f, neuron.weights[0][0]);
+        EXPECT_EQ(2.0f, neuron.weights[1][MAX_CHANNELS - 1]);
+        EXPECT_EQ(0.0f, neuron.weights[5][5]);
+
+        cereal::PortableBinaryInputArchive archive(stream);
+        int value = 0;
+        archive(value);
+        EXPECT_EQ(42, value);
+    }
+}
+
+TEST_F(SerializerTests, neuronForOlderVersion)
+{
+    NeuronDescription neuron;
+    for (int i = 0; i < MAX_CHANNELS; ++i) {
+        for (int j = 0; j < MAX_CHANNELS; ++j) {
+            neuron.weights[i][j] = toFloat(i * MAX_CHANNELS + j);
+        }
+        neuron.biases[i] = -toFloat(i);
+        neuron.activationFunctions[i] = i % NeuronActivationFunction_Count;
+    }
+    std::stringstream stream;
+    SerializerService::serializeNeuron(neuron, stream);
+
+    std::vector<std::vector<float>> weights;
+    std::vector<float> biases;
+    std::vector<int> activationFunctions;
+    readOldNeuron(stream, weights, biases, activationFunctions);
+    ASSERT_EQ(MAX_CHANNELS, weights.size());
+    ASSERT_EQ(MAX_CHANNELS, biases.size());
+    ASSERT_EQ(MAX_CHANNELS, activationFunctions.size());
+    for (int i = 0; i < MAX_CHANNELS; ++i) {
+        ASSERT_EQ(MAX_CHANNELS, weights[i].size());
+        for (int j = 0; j < MAX_CHANNELS; ++j) {
+            EXPECT_EQ(neuron.weights[i][j], weights[i][j]);
+        }
+        EXPECT_EQ(neuron.biases[i], biases[i]);
+        EXPECT_EQ(neuron.activationFunctions[i], activationFunctions[i]);
+    }
+}
+
+TEST_F(SerializerTests, deltaCheckpointWithMotion)
+{
+    auto base = createData();
+    auto data = base;
+    data.clusters.at(0).cells.at(0).setPos({5.0f, 6.0f}).setVel({0.1f, 0.2f}).setEnergy(20.0f);
+    data.clusters.at(1).cells.at(0).setAge(10);
+    data.particles.at(0).setPos({11.0f, 21.0f});
+
+    std::stringstream stream;
+    DeltaCheckpointService::serialize("base.sim", base, data, stream);
+    ASSERT_TRUE(DeltaCheckpointService::isDeltaFormat(stream));
+    EXPECT_EQ(std::string("base.sim"), DeltaCheckpointService::deserializeBaseFilename(stream));
+
+    auto output = base;
+    DeltaCheckpointService::applyDelta(output, stream);
+    EXPECT_EQ(data, output);
+}
+
+TEST_F(SerializerTests, deltaCheckpointWithStructuralChanges)
+{
+    auto base = createData();
+    auto data = base;
+    data.clusters.at(0).cells.at(1).setCellFunction(ConstructorDescription().setGenomeCurrentNodeIndex(0));
+    data.clusters.erase(data.clusters.begin() + 2);
+    data.clusters.at(2).cells.at(0).setPos({1.0f, 1.0f});
+    data.addCluster(ClusterDescription().addCell(CellDescription().setId(10).setCellFunction(MuscleDescription())));
+    data.particles.clear();
+    data.addParticle(ParticleDescription().setId(11).setEnergy(3.0f));
+
+    std::stringstream stream;
+    DeltaCheckpointService::serialize("base.sim", base, data, stream);
+    DeltaCheckpointService::deserializeBaseFilename(stream);
+
+    auto output = base;
+    DeltaCheckpointService::applyDelta(output, stream);
+    EXPECT_EQ(data, output);
+}
+
+TEST_F(SerializerTests, deltaCheckpointFiles)
+{
+    DeserializedSimulation base;
+    base.mainData = createData();
+    DeserializedSimulation input = base;
+    input.mainData.clusters.at(0).cells.at(0).setPos({5.0f, 6.0f});
+    input.auxiliaryData.timestep = 100;
+
+    auto directory = std::filesystem::temp_directory_path();
+    auto baseFilename = (directory / "deltaCheckpointFilesBase.sim").string();
+    auto filename = (directory / "deltaCheckpointFiles.sim").string();
+    auto compactedFilename = (directory / "deltaCheckpointFilesCompacted.sim").string();
+    ASSERT_TRUE(SerializerService::serializeSimulationToFiles(baseFilename, base));
+    ASSERT_TRUE(SerializerService::serializeSimulationDeltaToFiles(filename, baseFilename, base.mainData, input));
+    ASSERT_TRUE(SerializerService::compactSimulationFiles(compactedFilename, filename));
+
+    DeserializedSimulation output;
+    ASSERT_TRUE(SerializerService::deserializeSimulationFromFiles(output, filename));
+    EXPECT_EQ(input.mainData, output.mainData);
+    EXPECT_EQ(100, output.auxiliaryData.timestep);
+
+    std::filesystem::remove(baseFilename);
+    DeserializedSimulation compactedOutput;
+    ASSERT_TRUE(SerializerService::deserializeSimulationFromFiles(compactedOutput, compactedFilename));
+    EXPECT_EQ(input.mainData, compactedOutput.mainData);
+    EXPECT_FALSE(SerializerService::deserializeSimulationFromFiles(output, filename));
+
+    for (auto const& name : {"deltaCheckpointFiles", "deltaCheckpointFilesCompacted", "deltaCheckpointFilesBase"}) {
+        for (auto const& extension : {".sim", ".settings.json", ".statistics.csv"}) {
+            std::filesystem::remove(directory / (std::string(name) + extension));
+        }
+    }
+}
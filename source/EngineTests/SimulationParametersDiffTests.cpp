@@ -0,0 +1,125 @@
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "Base/Definitions.h"
+#include "EngineInterface/SimulationParametersDiffService.h"
+
+class SimulationParametersDiffTests : public ::testing::Test
+{
+public:
+    SimulationParametersDiffTests() = default;
+    ~SimulationParametersDiffTests() = default;
+
+protected:
+    void applyRanges(SimulationParameters& target, SimulationParameters const& source, std::vector<ParameterByteRange> const& ranges) const
+    {
+        for (auto const& range : ranges) {
+            std::memcpy(reinterpret_cast<char*>(&target) + range.offset, reinterpret_cast<char const*>(&source) + range.offset, range.size);
+        }
+    }
+
+    bool isCovered(std::vector<ParameterByteRange> const& ranges, void const* member, SimulationParameters const& parameters) const
+    {
+        auto offset = static_cast<size_t>(static_cast<char const*>(member) - reinterpret_cast<char const*>(&parameters));
+        for (auto const& range : ranges) {
+            if (offset >= range.offset && offset < range.offset + range.size) {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+TEST_F(SimulationParametersDiffTests, noChanges)
+{
+    SimulationParameters parameters;
+    std::vector<ParameterByteRange> ranges;
+    SimulationParametersDiffService::calcChangedByteRanges(ranges, parameters, parameters);
+    EXPECT_TRUE(ranges.empty());
+    EXPECT_TRUE(SimulationParametersDiffService::calcChangedFields(parameters, parameters).empty());
+}
+
+TEST_F(SimulationParametersDiffTests, changedFields)
+{
+    SimulationParameters reference;
+    reference.numSpots = 2;
+    auto parameters = reference;
+    parameters.baseValues.friction += 0.1f;
+    parameters.spots[1].posX += 1.0f;
+    parameters.spots[1].posY += 1.0f;
+    parameters.baseValues.radiationCellAgeStrength[3] += 0.5f;
+
+    auto changedFields = SimulationParametersDiffService::calcChangedFields(reference, parameters);
+    EXPECT_EQ(4, changedFields.size());
+    EXPECT_NE(changedFields.end(), std::find(changedFields.begin(), changedFields.end(), "friction"));
+    EXPECT_NE(changedFields.end(), std::find(changedFields.begin(), changedFields.end(), "spots.1.pos.x"));
+    EXPECT_NE(changedFields.end(), std::find(changedFields.begin(), changedFields.end(), "spots.1.pos.y"));
+}
+
+TEST_F(SimulationParametersDiffTests, changedByteRanges)
+{
+    SimulationParameters reference;
+    reference.numSpots = 3;
+    auto parameters = reference;
+    parameters.spots[0].posX += 1.0f;
+    parameters.spots[2].posY += 1.0f;
+    parameters.cellFunctionConstructorExternalEnergy[2] = 100.0f;
+
+    std::vector<ParameterByteRange> exactRanges;
+    SimulationParametersDiffService::calcChangedByteRanges(exactRanges, reference, parameters, 0);
+    EXPECT_EQ(3, exactRanges.size());  //x, y and the whole color vector
+    EXPECT_TRUE(isCovered(exactRanges, &parameters.spots[0].posX, parameters));
+    EXPECT_FALSE(isCovered(exactRanges, &parameters.spots[0].posY, parameters));
+    EXPECT_TRUE(isCovered(exactRanges, &parameters.spots[2].posY, parameters));
+    EXPECT_TRUE(isCovered(exactRanges, &parameters.cellFunctionConstructorExternalEnergy[0], parameters));
+
+    std::vector<ParameterByteRange> ranges;
+    SimulationParametersDiffService::calcChangedByteRanges(ranges, reference, parameters);
+    EXPECT_LE(ranges.size(), exactRanges.size());
+    size_t uploadSize = 0;
+    for (auto const& range : ranges) {
+        uploadSize += range.size;
+    }
+    EXPECT_LT(uploadSize, sizeof(SimulationParameters) / 10);
+
+    for (auto const& appliedRanges : {exactRanges, ranges}) {
+        auto target = reference;
+        applyRanges(target, parameters, appliedRanges);
+        EXPECT_TRUE(target == parameters);
+    }
+}
+
+TEST_F(SimulationParametersDiffTests, unregisteredBytesAreTracked)
+{
+    auto reference = std::make_unique<SimulationParameters>();
+    auto parameters = std::make_unique<SimulationParameters>();
+    std::vector<ParameterByteRange> ranges;
+    for (size_t offset = 0; offset < sizeof(SimulationParameters); offset += 97) {
+        std::memcpy(parameters.get(), reference.get(), sizeof(SimulationParameters));
+        reinterpret_cast<char*>(parameters.get())[offset] ^= 1;
+        SimulationParametersDiffService::calcChangedByteRanges(ranges, *reference, *parameters);
+        ASSERT_EQ(1, ranges.size());
+        EXPECT_TRUE(offset >= ranges.front().offset && offset < ranges.front().offset + ranges.front().size);
+    }
+}
+
+TEST_F(SimulationParametersDiffTests, repeatedlyMovedSpots)
+{
+    SimulationParameters reference;
+    reference.numSpots = 5;
+    auto parameters = reference;
+    auto constexpr NumRepetitions = 100;
+
+    std::vector<ParameterByteRange> ranges;
+    for (int i = 0; i < NumRepetitions; ++i) {
+        parameters.spots[i % 5].posX += 1.0f;
+        SimulationParametersDiffService::calcChangedByteRanges(ranges, reference, parameters);
+        applyRanges(reference, parameters, ranges);
+    }
+    ASSERT_FALSE(ranges.empty());
+    EXPECT_LT(ranges.front().size, sizeof(SimulationParameters));
+    EXPECT_TRUE(reference == parameters);
+}
@@ -92,3 +92,34 @@ TEST_F(StatisticsTests, nonSelfReplicatorWithRepetitionsInGenome)
     EXPECT_EQ(0, statistics.timeline.timestep.numSelfReplicators[0]);
     EXPECT_EQ(00, statistics.timeline.timestep.numGenomeCells[0]);
 }
+
+TEST_F(StatisticsTests, historyAfterCalcTimesteps)
+{
+    DataDescription data;
+    data.addCells({CellDescription().setId(1)});
+    _simController->setSimulationData(data);
+
+    _simController->calcTimesteps(100);
+
+    auto history = _simController->getStatisticsHistory().getCopiedData();
+    ASSERT_FALSE(history.empty());
+    EXPECT_EQ(100.0, history.back().time);
+    EXPECT_EQ(1.0, history.back().numCells.values[0]);
+}
+
+TEST_F(StatisticsTests, rewriteHistory)
+{
+    _simController->setCurrentTimestep(1000);
+
+    StatisticsHistoryData historyData(3);
+    for (int i = 0; i < 3; ++i) {
+        historyData.at(i).time = toDouble(i * 100);
+        historyData.at(i).numCells.values[0] = toDouble(i);
+    }
+    _simController->setStatisticsHistory(historyData);
+
+    auto history = _simController->getStatisticsHistory().getCopiedData();
+    ASSERT_EQ(3, history.size());
+    EXPECT_EQ(200.0, history.back().time);
+    EXPECT_EQ(2.0, history.back().numCells.values[0]);
+}
@@ -0,0 +1,188 @@
+#include <sstream>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "EngineInterface/Descriptions.h"
+#include "EngineInterface/SimulationController.h"
+#include "EngineInterface/TimestepProfileService.h"
+#include "EngineInterface/TimestepProfiler.h"
+
+#include "IntegrationTestFramework.h"
+
+class TimestepProfilerTests : public ::testing::Test
+{
+public:
+    TimestepProfilerTests() = default;
+    ~TimestepProfilerTests() = default;
+
+protected:
+    //reports 1 ms for each measurement
+    class FixedProfilingTimer : public _ProfilingTimer
+    {
+    public:
+        void startStage(ProfilingStage stage) override {}
+        void stopStage(ProfilingStage stage) override { _durations.at(stage) += 1.0f; }
+        void collectDurations(StageDurations& durations) override
+        {
+            for (int i = 0; i < ProfilingStage_Count; ++i) {
+                durations[i] += _durations[i];
+            }
+            _durations = {};
+        }
+
+    private:
+        StageDurations _durations = {};
+    };
+
+    void recordTimestep(_TimestepProfiler& profiler, uint64_t timestep)
+    {
+        profiler.beginTimestep(timestep);
+        profiler.startStage(ProfilingStage_Physics);
+        profiler.stopStage(ProfilingStage_Physics);
+        profiler.endTimestep(timestep * 10, timestep * 100);
+    }
+};
+
+class TimestepProfilerSimulationTests : public IntegrationTestFramework
+{
+public:
+    TimestepProfilerSimulationTests()
+        : IntegrationTestFramework()
+    {}
+
+    ~TimestepProfilerSimulationTests() = default;
+};
+
+TEST_F(TimestepProfilerTests, disabled)
+{
+    _TimestepProfiler profiler;
+    profiler.beginTimestep(0);
+    EXPECT_FALSE(profiler.isRecording());
+    profiler.startStage(ProfilingStage_Physics);
+    profiler.stopStage(ProfilingStage_Physics);
+    profiler.endTimestep(1, 1);
+
+    EXPECT_TRUE(profiler.getProfiles().empty());
+}
+
+TEST_F(TimestepProfilerTests, ringBuffer)
+{
+    _TimestepProfiler profiler(std::make_shared<FixedProfilingTimer>(), 3);
+    profiler.setEnabled(true);
+    for (uint64_t timestep = 0; timestep < 5; ++timestep) {
+        recordTimestep(profiler, timestep);
+    }
+
+    auto profiles = profiler.getProfiles();
+    ASSERT_EQ(3, profiles.size());
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(i + 2, profiles.at(i).timestep);
+        EXPECT_EQ((i + 2) * 10, profiles.at(i).numCells);
+        EXPECT_EQ((i + 2) * 100, profiles.at(i).numParticles);
+        EXPECT_EQ(1.0f, profiles.at(i).stageDurations[ProfilingStage_Physics]);
+    }
+
+    profiler.clear();
+    EXPECT_TRUE(profiler.getProfiles().empty());
+}
+
+TEST_F(TimestepProfilerTests, hostTimer)
+{
+    _TimestepProfiler profiler;
+    profiler.setEnabled(true);
+    profiler.beginTimestep(7);
+    EXPECT_TRUE(profiler.isRecording());
+
+    //stages can be measured several times per time step
+    for (int i = 0; i < 2; ++i) {
+        profiler.startStage(ProfilingStage_Physics);
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        profiler.stopStage(ProfilingStage_Physics);
+    }
+    profiler.addStageDuration(ProfilingStage_ResizeArrays, std::chrono::milliseconds(3));
+    profiler.endTimestep(1, 2);
+    EXPECT_FALSE(profiler.isRecording());
+
+    auto profiles = profiler.getProfiles();
+    ASSERT_EQ(1, profiles.size());
+    auto const& profile = profiles.front();
+    EXPECT_EQ(7, profile.timestep);
+    EXPECT_LE(10.0f, profile.stageDurations[ProfilingStage_Physics]);
+    EXPECT_EQ(3.0f, profile.stageDurations[ProfilingStage_ResizeArrays]);
+    EXPECT_EQ(0.0f, profile.stageDurations[ProfilingStage_Neuron]);
+    EXPECT_LE(profile.stageDurations[ProfilingStage_Physics], profile.duration);
+}
+
+TEST_F(TimestepProfilerTests, stageDurationsOutsideOfTimestep)
+{
+    _TimestepProfiler profiler(std::make_shared<FixedProfilingTimer>());
+    profiler.setEnabled(true);
+    profiler.addStageDuration(ProfilingStage_ResizeArrays, std::chrono::milliseconds(3));
+    recordTimestep(profiler, 0);
+
+    auto profiles = profiler.getProfiles();
+    ASSERT_EQ(1, profiles.size());
+    EXPECT_EQ(0.0f, profiles.front().stageDurations[ProfilingStage_ResizeArrays]);
+}
+
+TEST_F(TimestepProfilerTests, serialization)
+{
+    _TimestepProfiler profiler(std::make_shared<FixedProfilingTimer>());
+    profiler.setEnabled(true);
+    for (uint64_t timestep = 0; timestep < 4; ++timestep) {
+        recordTimestep(profiler, timestep);
+    }
+    auto profiles = profiler.getProfiles();
+
+    auto average = TimestepProfileService::calcAverage(profiles);
+    EXPECT_EQ(3, average.timestep);
+    EXPECT_EQ(15, average.numCells);
+    EXPECT_EQ(1.0f, average.stageDurations[ProfilingStage_Physics]);
+
+    std::stringstream csv;
+    TimestepProfileService::serializeToCsv(profiles, csv);
+    std::vector<std::string> lines;
+    for (std::string line; std::getline(csv, line);) {
+        lines.emplace_back(line);
+    }
+    ASSERT_EQ(5, lines.size());
+    EXPECT_EQ(0, lines.front().find("Time step, Duration, Physics"));
+    EXPECT_EQ(0, lines.at(4).find("3,"));
+    EXPECT_TRUE(lines.at(4).ends_with(",30,300"));
+
+    std::stringstream json;
+    TimestepProfileService::serializeToJson(profiles, json);
+    auto jsonString = json.str();
+    EXPECT_EQ(0, jsonString.find('['));
+    EXPECT_NE(std::string::npos, jsonString.find("\"timestep\": 3"));
+    EXPECT_NE(std::string::npos, jsonString.find("\"Physics\": 1.0000"));
+    EXPECT_NE(std::string::npos, jsonString.find("\"cells\": 30"));
+}
+
+TEST_F(TimestepProfilerSimulationTests, recordTimesteps)
+{
+    DataDescription data;
+    data.addCells({CellDescription().setId(1).setPos({100.0f, 100.0f}), CellDescription().setId(2).setPos({101.0f, 100.0f})});
+    data.addConnection(1, 2);
+    _simController->setSimulationData(data);
+
+    _simController->calcTimesteps(5);
+    EXPECT_TRUE(_simController->getTimestepProfiles().empty());
+
+    _simController->setProfilingEnabled(true);
+    _simController->calcTimesteps(10);
+    _simController->setProfilingEnabled(false);
+    _simController->calcTimesteps(5);
+
+    auto profiles = _simController->getTimestepProfiles();
+    ASSERT_EQ(10, profiles.size());
+    for (int i = 0; i < 10; ++i) {
+        auto const& profile = profiles.at(i);
+        EXPECT_EQ(5 + i, profile.timestep);
+        EXPECT_EQ(2, profile.numCells);
+        EXPECT_EQ(0, profile.numParticles);
+        EXPECT_LT(0.0f, profile.stageDurations[ProfilingStage_Physics]);
+        EXPECT_LT(0.0f, profile.duration);
+    }
+}
@@ -1243,9 +1243,9 @@ namespace
 
 void AlienImGui::NeuronSelection(
     NeuronSelectionParameters const& parameters,
-    std::vector<std::vector<float>>& weights,
-    std::vector<float>& biases,
-    std::vector<NeuronActivationFunction>& activationFunctions)
+    std::array<std::array<float, MAX_CHANNELS>, MAX_CHANNELS>& weights,
+    std::array<float, MAX_CHANNELS>& biases,
+    std::array<NeuronActivationFunction, MAX_CHANNELS>& activationFunctions)
 {
     auto& selectedInput = getIdBasedValue(_neuronSelectedInput);
     auto& selectedOutput = getIdBasedValue(_neuronSelectedOutput);
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <functional>
 
 #include <imgui.h>
@@ -296,9 +297,9 @@ public:
     };
     static void NeuronSelection(
         NeuronSelectionParameters const& parameters,
-        std::vector<std::vector<float>>& weights,
-        std::vector<float>& biases,
-        std::vector<NeuronActivationFunction>& activationFunctions);
+        std::array<std::array<float, MAX_CHANNELS>, MAX_CHANNELS>& weights,
+        std::array<float, MAX_CHANNELS>& biases,
+        std::array<NeuronActivationFunction, MAX_CHANNELS>& activationFunctions);
 
     static void OnlineSymbol();
     static void LastDayOnlineSymbol();
@@ -1,5 +1,7 @@
 #include "AutosaveController.h"
 
+#include <filesystem>
+
 #include <imgui.h>
 
 #include "Base/Resources.h"
@@ -11,17 +13,31 @@
 #include "DelayedExecutionController.h"
 #include "OverlayMessageController.h"
 
+namespace
+{
+    auto constexpr MaxDeltaCheckpointsPerBase = 10;
+
+    void removeFile(std::string const& filename)
+    {
+        std::error_code error;
+        std::filesystem::remove(filename, error);
+    }
+}
+
 _AutosaveController::_AutosaveController(SimulationController const& simController, Viewport const& viewport)
     : _simController(simController)
     , _viewport(viewport)
 {
     _startTimePoint = std::chrono::steady_clock::now();
     _on = GlobalSettings::getInstance().getBoolState("controllers.auto save.active", true);
+    _deltaCheckpointsOn = GlobalSettings::getInstance().getBoolState("controllers.auto save.delta checkpoints", false);
+    adoptDeltaCheckpointBase();
 }
 
 _AutosaveController::~_AutosaveController()
 {
     GlobalSettings::getInstance().setBoolState("controllers.auto save.active", _on);
+    GlobalSettings::getInstance().setBoolState("controllers.auto save.delta checkpoints", _deltaCheckpointsOn);
 }
 
 void _AutosaveController::shutdown()
@@ -42,6 +58,17 @@ void _AutosaveController::setOn(bool value)
     _on = value;
 }
 
+bool _AutosaveController::isDeltaCheckpointsOn() const
+{
+    return _deltaCheckpointsOn;
+}
+
+void _AutosaveController::setDeltaCheckpointsOn(bool value)
+{
+    _deltaCheckpointsOn = value;
+    _deltaCheckpointBase.reset();
+}
+
 void _AutosaveController::process()
 {
     if (!_on) {
@@ -59,6 +86,32 @@ void _AutosaveController::process()
     }
 }
 
+void _AutosaveController::adoptDeltaCheckpointBase()
+{
+    //the autosave file of the last session may refer to a base snapshot which is removed as soon as it is no longer referred
+    if (auto baseFilename = SerializerService::getDeltaCheckpointBaseFilename(Const::AutosaveFile)) {
+        _deltaCheckpointBaseFilename = *baseFilename;
+    }
+
+    //base snapshots of interrupted sessions are not referred by any file
+    auto prefix = std::filesystem::path(Const::AutosaveBaseFilePrefix);
+    auto directory = prefix.has_parent_path() ? prefix.parent_path() : std::filesystem::path(".");
+    std::vector<std::string> unreferredFilenames;
+    std::error_code error;
+    for (auto const& entry : std::filesystem::directory_iterator(directory, error)) {
+        if (!entry.is_regular_file(error) || !entry.path().filename().string().starts_with(prefix.filename().string())) {
+            continue;
+        }
+        if (!_deltaCheckpointBaseFilename.empty() && std::filesystem::equivalent(entry.path(), _deltaCheckpointBaseFilename, error)) {
+            continue;
+        }
+        unreferredFilenames.emplace_back(entry.path().string());
+    }
+    for (auto const& filename : unreferredFilenames) {
+        removeFile(filename);
+    }
+}
+
 void _AutosaveController::onSave()
 {
     DeserializedSimulation sim;
@@ -69,5 +122,59 @@ void _AutosaveController::onSave()
     sim.auxiliaryData.simulationParameters = _simController->getSimulationParameters();
     sim.mainData = _simController->getClusteredSimulationData();
     sim.statistics = _simController->getStatisticsHistory().getCopiedData();
-    SerializerService::serializeSimulationToFiles(Const::AutosaveFile, sim);
+
+    if (!_deltaCheckpointsOn) {
+        saveWithoutDelta(sim);
+        return;
+    }
+
+    //the base snapshot refers to a simulation which is no longer loaded
+    if (_deltaCheckpointBase && _deltaCheckpointBaseSimulationId != _simController->getSimulationId()) {
+        _deltaCheckpointBase.reset();
+    }
+
+    //the autosave file only contains the changes since the last base snapshot
+    //each base snapshot is written to a new file such that the previous autosave file remains loadable until it is replaced
+    auto baseFilename = _deltaCheckpointBaseFilename;
+    if (!_deltaCheckpointBase || _numDeltaCheckpoints >= MaxDeltaCheckpointsPerBase) {
+        auto generation = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+        baseFilename = Const::AutosaveBaseFilePrefix + std::to_string(generation) + ".sim";
+        if (!SerializerService::serializeContentToFile(baseFilename, sim.mainData)) {
+            removeFile(baseFilename);
+            _deltaCheckpointBase.reset();
+            saveWithoutDelta(sim);
+            return;
+        }
+        _deltaCheckpointBase = sim.mainData;
+        _deltaCheckpointBaseSimulationId = _simController->getSimulationId();
+        _numDeltaCheckpoints = 0;
+    }
+    if (!SerializerService::serializeSimulationDeltaToFiles(Const::AutosaveFile, baseFilename, *_deltaCheckpointBase, sim)) {
+        if (baseFilename != _deltaCheckpointBaseFilename) {
+            removeFile(baseFilename);
+        }
+        _deltaCheckpointBase.reset();
+        saveWithoutDelta(sim);
+        return;
+    }
+    ++_numDeltaCheckpoints;
+
+    //the autosave file refers to the new base snapshot from now on
+    if (baseFilename != _deltaCheckpointBaseFilename) {
+        if (!_deltaCheckpointBaseFilename.empty()) {
+            removeFile(_deltaCheckpointBaseFilename);
+        }
+        _deltaCheckpointBaseFilename = baseFilename;
+    }
+}
+
+void _AutosaveController::saveWithoutDelta(DeserializedSimulation const& sim)
+{
+    if (!SerializerService::serializeSimulationToFiles(Const::AutosaveFile, sim)) {
+        return;
+    }
+    if (!_deltaCheckpointBaseFilename.empty()) {
+        removeFile(_deltaCheckpointBaseFilename);
+        _deltaCheckpointBaseFilename.clear();
+    }
 }
@@ -3,6 +3,7 @@
 #include <chrono>
 
 #include "EngineInterface/Definitions.h"
+#include "EngineInterface/Descriptions.h"
 #include "Definitions.h"
 
 class _AutosaveController
@@ -16,10 +17,15 @@ public:
     bool isOn() const;
     void setOn(bool value);
 
+    bool isDeltaCheckpointsOn() const;
+    void setDeltaCheckpointsOn(bool value);
+
     void process();
 
 private:
+    void adoptDeltaCheckpointBase();
     void onSave();
+    void saveWithoutDelta(DeserializedSimulation const& sim);
 
     SimulationController _simController;
     Viewport _viewport;
@@ -27,4 +33,10 @@ private:
     bool _on = true;
     std::optional<std::chrono::steady_clock::time_point> _startTimePoint;
     bool _alreadySaved = false;
+
+    bool _deltaCheckpointsOn = false;
+    std::optional<ClusteredDataDescription> _deltaCheckpointBase;
+    std::string _deltaCheckpointBaseFilename;  //base snapshot which is referred by the autosave file on disk
+    uint64_t _deltaCheckpointBaseSimulationId = 0;
+    int _numDeltaCheckpoints = 0;
 };
\ No newline at end of file
@@ -21,10 +21,11 @@
 #include "EngineInterface/GenomeDescriptionService.h"
 #include "EngineInterface/SerializerService.h"
 #include "EngineInterface/SimulationController.h"
+#include "Network/ListUpdater.h"
+#include "Network/NetworkDataParser.h"
 
 #include "AlienImGui.h"
 #include "StyleRepository.h"
-#include "NetworkDataParser.h"
 #include "NetworkController.h"
 #include "StatisticsWindow.h"
 #include "Viewport.h"
@@ -101,15 +102,51 @@ void _BrowserWindow::onRefresh()
 
 void _BrowserWindow::refreshIntern(bool withRetry)
 {
-    try {
-        bool success = _networkController->getRemoteSimulationList(_rawRemoteDataList, withRetry);
-        success &= _networkController->getUserList(_userList, withRetry);
+    _refreshWithRetry = withRetry;
+    _pendingRemoteDataList = _networkController->getRemoteSimulationList(withRetry);
+    _pendingUserList = _networkController->getUserList(withRetry);
+    if (_networkController->getLoggedInUserName()) {
+        _pendingOwnEmojiTypeBySimId = _networkController->getEmojiTypeBySimId();
+    } else {
+        _pendingOwnEmojiTypeBySimId = {};
+        _ownEmojiTypeBySimId.clear();
+    }
+}
 
-        if (!success) {
-            if (withRetry) {
-                MessageDialog::getInstance().information("Error", "Failed to retrieve browser data. Please try again.");
-            }
+void _BrowserWindow::processPendingRequests()
+{
+    if (_pendingRemoteDataList.isValid() && _pendingRemoteDataList.isReady() && _pendingUserList.isReady()
+        && _pendingOwnEmojiTypeBySimId.isReady()) {
+        onRefreshFinished();
+    }
+
+    for (auto it = _pendingUserNamesByEmojiTypeBySimId.begin(); it != _pendingUserNamesByEmojiTypeBySimId.end();) {
+        if (it->second.isReady()) {
+            _userNamesByEmojiTypeBySimIdCache.insert_or_assign(it->first, boost::algorithm::join(it->second.get().value_or(std::set<std::string>()), ", "));
+            it = _pendingUserNamesByEmojiTypeBySimId.erase(it);
         } else {
+            ++it;
+        }
+    }
+
+    if (_pendingDownload && _pendingDownload->result.isReady()) {
+        auto pendingDownload = std::move(*_pendingDownload);
+        _pendingDownload.reset();
+        onDownloadFinished(pendingDownload.sim, pendingDownload.dataType, pendingDownload.result.get());
+    }
+}
+
+void _BrowserWindow::onRefreshFinished()
+{
+    auto remoteDataList = _pendingRemoteDataList.get();
+    auto userList = _pendingUserList.get();
+    if (!remoteDataList || !userList) {
+        if (_refreshWithRetry) {
+            MessageDialog::getInstance().information("Error", "Failed to retrieve browser data. Please try again.");
+        }
+    } else {
+        //only changed entries are updated such that the filtered lists need not be rebuilt on periodic refreshes without changes
+        if (ListUpdater::update(_rawRemoteDataList, std::move(*remoteDataList), [](RemoteSimulationData const& entry) { return entry.id; })) {
             _numSimulations = 0;
             _numGenomes = 0;
             for (auto const& entry : _rawRemoteDataList) {
@@ -119,22 +156,19 @@ void _BrowserWindow::refreshIntern(bool withRetry)
                     ++_numGenomes;
                 }
             }
+            _remoteDataIndex.rebuild(_rawRemoteDataList);
+            calcFilteredSimulationAndGenomeLists();
         }
-        calcFilteredSimulationAndGenomeLists();
-
-        if (_networkController->getLoggedInUserName()) {
-            if (!_networkController->getEmojiTypeBySimId(_ownEmojiTypeBySimId)) {
-                MessageDialog::getInstance().information("Error", "Failed to retrieve browser data. Please try again.");
-            }
-        } else {
-            _ownEmojiTypeBySimId.clear();
+        if (ListUpdater::update(_userList, std::move(*userList), [](UserData const& entry) { return entry.userName; })) {
+            sortUserList();
         }
+    }
 
-        sortSimulationList();
-        sortUserList();
-    } catch (std::exception const& e) {
-        if (withRetry) {
-            MessageDialog::getInstance().information("Error", e.what());
+    if (_pendingOwnEmojiTypeBySimId.isValid()) {
+        if (auto ownEmojiTypeBySimId = _pendingOwnEmojiTypeBySimId.get()) {
+            _ownEmojiTypeBySimId = std::move(*ownEmojiTypeBySimId);
+        } else {
+            MessageDialog::getInstance().information("Error", "Failed to retrieve browser data. Please try again.");
         }
     }
 }
@@ -204,6 +238,7 @@ void _BrowserWindow::processBackground()
         onRefresh();
         _scheduleRefresh = false;
     }
+    processPendingRequests();
 }
 
 void _BrowserWindow::processToolbar()
@@ -309,13 +344,10 @@ void _BrowserWindow::processSimulationList()
 
         //sort our data if sort specs have been changed!
         if (ImGuiTableSortSpecs* sortSpecs = ImGui::TableGetSortSpecs()) {
-            if (sortSpecs->SpecsDirty || _scheduleSort) {
-                if (_filteredRemoteSimulationList.size() > 1) {
-                    std::sort(_filteredRemoteSimulationList.begin(), _filteredRemoteSimulationList.end(), [&](auto const& left, auto const& right) {
-                        return RemoteSimulationData::compare(&left, &right, sortSpecs) < 0;
-                    });
-                }
+            if (sortSpecs->SpecsDirty || _scheduleSimulationSort) {
+                sortSimulationList(_filteredRemoteSimulationList, sortSpecs);
                 sortSpecs->SpecsDirty = false;
+                _scheduleSimulationSort = false;
             }
         }
         ImGuiListClipper clipper;
@@ -323,7 +355,7 @@ void _BrowserWindow::processSimulationList()
         while (clipper.Step())
             for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++) {
 
-                RemoteSimulationData* item = &_filteredRemoteSimulationList[row];
+                RemoteSimulationData* item = &_rawRemoteDataList[_filteredRemoteSimulationList[row]];
 
                 ImGui::PushID(row);
                 ImGui::TableNextRow(0, scale(RowHeight));
@@ -410,13 +442,10 @@ void _BrowserWindow::processGenomeList()
 
         //sort our data if sort specs have been changed!
         if (ImGuiTableSortSpecs* sortSpecs = ImGui::TableGetSortSpecs()) {
-            if (sortSpecs->SpecsDirty || _scheduleSort) {
-                if (_filteredRemoteGenomeList.size() > 1) {
-                    std::sort(_filteredRemoteGenomeList.begin(), _filteredRemoteGenomeList.end(), [&](auto const& left, auto const& right) {
-                        return RemoteSimulationData::compare(&left, &right, sortSpecs) < 0;
-                    });
-                }
+            if (sortSpecs->SpecsDirty || _scheduleGenomeSort) {
+                sortSimulationList(_filteredRemoteGenomeList, sortSpecs);
                 sortSpecs->SpecsDirty = false;
+                _scheduleGenomeSort = false;
             }
         }
         ImGuiListClipper clipper;
@@ -424,7 +453,7 @@ void _BrowserWindow::processGenomeList()
         while (clipper.Step())
             for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++) {
 
-                RemoteSimulationData* item = &_filteredRemoteGenomeList[row];
+                RemoteSimulationData* item = &_rawRemoteDataList[_filteredRemoteGenomeList[row]];
 
                 ImGui::PushID(row);
                 ImGui::TableNextRow(0, scale(RowHeight));
@@ -828,7 +857,18 @@ void _BrowserWindow::processActivated()
 
 void _BrowserWindow::sortSimulationList()
 {
-    _scheduleSort = true;
+    _scheduleSimulationSort = true;
+    _scheduleGenomeSort = true;
+}
+
+void _BrowserWindow::sortSimulationList(std::vector<int>& entryIndices, ImGuiTableSortSpecs const* sortSpecs) const
+{
+    std::vector<RemoteSimulationDataIndex::SortSpec> indexSortSpecs;
+    for (int n = 0; n < sortSpecs->SpecsCount; ++n) {
+        auto const& sortSpec = sortSpecs->Specs[n];
+        indexSortSpecs.push_back({sortSpec.ColumnUserID, sortSpec.SortDirection == ImGuiSortDirection_Ascending});
+    }
+    _remoteDataIndex.sort(entryIndices, indexSortSpecs);
 }
 
 void _BrowserWindow::sortUserList()
@@ -840,63 +880,68 @@ void _BrowserWindow::onDownloadItem(RemoteSimulationData* sim)
 {
     printOverlayMessage("Downloading ...");
 
-    delayedExecution([=, this] {
-        std::string dataTypeString = _selectedDataType == DataType_Simulation ? "simulation" : "genome";
-        SerializedSimulation serializedSim;
-        if (!_networkController->downloadSimulation(serializedSim.mainData, serializedSim.auxiliaryData, serializedSim.statistics, sim->id)) {
-            MessageDialog::getInstance().information("Error", "Failed to download " + dataTypeString + ".");
+    if (_pendingDownload) {
+        _pendingDownload->result.cancel();
+    }
+    _pendingDownload = PendingDownload{*sim, _selectedDataType, _networkController->downloadSimulation(*sim)};
+}
+
+void _BrowserWindow::onDownloadFinished(RemoteSimulationData const& sim, DataType dataType, std::optional<SerializedSimulation> const& serializedSim)
+{
+    std::string dataTypeString = dataType == DataType_Simulation ? "simulation" : "genome";
+    if (!serializedSim) {
+        MessageDialog::getInstance().information("Error", "Failed to download " + dataTypeString + ".");
+        return;
+    }
+
+    if (dataType == DataType_Simulation) {
+        DeserializedSimulation deserializedSim;
+        if (!SerializerService::deserializeSimulationFromStrings(deserializedSim, *serializedSim)) {
+            MessageDialog::getInstance().information("Error", "Failed to load simulation. Your program version may not match.");
             return;
         }
 
-        if (_selectedDataType == DataType_Simulation) {
-            DeserializedSimulation deserializedSim;
-            if (!SerializerService::deserializeSimulationFromStrings(deserializedSim, serializedSim)) {
-                MessageDialog::getInstance().information("Error", "Failed to load simulation. Your program version may not match.");
-                return;
-            }
+        _simController->closeSimulation();
+
+        std::optional<std::string> errorMessage;
+        try {
+            _simController->newSimulation(
+                deserializedSim.auxiliaryData.timestep, deserializedSim.auxiliaryData.generalSettings, deserializedSim.auxiliaryData.simulationParameters);
+            _simController->setClusteredSimulationData(deserializedSim.mainData);
+            _simController->setStatisticsHistory(deserializedSim.statistics);
+        } catch (CudaMemoryAllocationException const& exception) {
+            errorMessage = exception.what();
+        } catch (...) {
+            errorMessage = "Failed to load simulation.";
+        }
 
+        if (errorMessage) {
+            showMessage("Error", *errorMessage);
             _simController->closeSimulation();
+            _simController->newSimulation(
+                deserializedSim.auxiliaryData.timestep, deserializedSim.auxiliaryData.generalSettings, deserializedSim.auxiliaryData.simulationParameters);
+        }
 
-            std::optional<std::string> errorMessage;
-            try {
-                _simController->newSimulation(
-                    deserializedSim.auxiliaryData.timestep, deserializedSim.auxiliaryData.generalSettings, deserializedSim.auxiliaryData.simulationParameters);
-                _simController->setClusteredSimulationData(deserializedSim.mainData);
-                _simController->setStatisticsHistory(deserializedSim.statistics);
-            } catch (CudaMemoryAllocationException const& exception) {
-                errorMessage = exception.what();
-            } catch (...) {
-                errorMessage = "Failed to load simulation.";
-            }
-
-            if (errorMessage) {
-                showMessage("Error", *errorMessage);
-                _simController->closeSimulation();
-                _simController->newSimulation(
-                    deserializedSim.auxiliaryData.timestep, deserializedSim.auxiliaryData.generalSettings, deserializedSim.auxiliaryData.simulationParameters);
-            }
-
-            _viewport->setCenterInWorldPos(deserializedSim.auxiliaryData.center);
-            _viewport->setZoomFactor(deserializedSim.auxiliaryData.zoom);
-            _temporalControlWindow->onSnapshot();
+        _viewport->setCenterInWorldPos(deserializedSim.auxiliaryData.center);
+        _viewport->setZoomFactor(deserializedSim.auxiliaryData.zoom);
+        _temporalControlWindow->onSnapshot();
 
-        } else {
-            std::vector<uint8_t> genome;
-            if (!SerializerService::deserializeGenomeFromString(genome, serializedSim.mainData)) {
-                MessageDialog::getInstance().information("Error", "Failed to load genome. Your program version may not match.");
-                return;
-            }
-            _editorController->setOn(true);
-            _editorController->getGenomeEditorWindow()->openTab(GenomeDescriptionService::convertBytesToDescription(genome));
-        }
-        if (VersionChecker::isVersionNewer(sim->version)) {
-            MessageDialog::getInstance().information(
-                "Warning",
-                "The download was successful but the " + dataTypeString +" was generated using a more recent\n"
-                "version of ALIEN. Consequently, the " + dataTypeString + "might not function as expected.\n"
-                "Please visit\n\nhttps://github.com/chrxh/alien\n\nto obtain the latest version.");
+    } else {
+        std::vector<uint8_t> genome;
+        if (!SerializerService::deserializeGenomeFromString(genome, serializedSim->mainData)) {
+            MessageDialog::getInstance().information("Error", "Failed to load genome. Your program version may not match.");
+            return;
         }
-    });
+        _editorController->setOn(true);
+        _editorController->getGenomeEditorWindow()->openTab(GenomeDescriptionService::convertBytesToDescription(genome));
+    }
+    if (VersionChecker::isVersionNewer(sim.version)) {
+        MessageDialog::getInstance().information(
+            "Warning",
+            "The download was successful but the " + dataTypeString +" was generated using a more recent\n"
+            "version of ALIEN. Consequently, the " + dataTypeString + "might not function as expected.\n"
+            "Please visit\n\nhttps://github.com/chrxh/alien\n\nto obtain the latest version.");
+    }
 }
 
 void _BrowserWindow::onDeleteItem(RemoteSimulationData* sim)
@@ -942,7 +987,9 @@ void _BrowserWindow::onToggleLike(RemoteSimulationData* sim, int emojiType)
         }
 
         _userNamesByEmojiTypeBySimIdCache.erase(std::make_pair(sim->id, emojiType));  //invalidate cache entry
+        _pendingUserNamesByEmojiTypeBySimId.erase(std::make_pair(sim->id, emojiType));
         _networkController->toggleLikeSimulation(sim->id, emojiType);
+        _remoteDataIndex.rebuildSortOrder(_rawRemoteDataList, RemoteSimulationDataColumnId_Likes);
         sortSimulationList();
     } else {
         _loginDialog.lock()->open();
@@ -963,17 +1010,17 @@ bool _BrowserWindow::isLiked(std::string const& simId)
 
 std::string _BrowserWindow::getUserNamesToEmojiType(std::string const& simId, int emojiType)
 {
-    std::set<std::string> userNames;
-
-    auto findResult = _userNamesByEmojiTypeBySimIdCache.find(std::make_pair(simId, emojiType));
+    auto key = std::make_pair(simId, emojiType);
+    auto findResult = _userNamesByEmojiTypeBySimIdCache.find(key);
     if (findResult != _userNamesByEmojiTypeBySimIdCache.end()) {
-        userNames = findResult->second;
-    } else {
-        _networkController->getUserNamesForSimulationAndEmojiType(userNames, simId, emojiType);
-        _userNamesByEmojiTypeBySimIdCache.emplace(std::make_pair(simId, emojiType), userNames);
+        return findResult->second;
     }
 
-    return boost::algorithm::join(userNames, ", ");
+    //the tooltip is updated as soon as the response has been processed
+    if (!_pendingUserNamesByEmojiTypeBySimId.contains(key)) {
+        _pendingUserNamesByEmojiTypeBySimId.emplace(key, _networkController->getUserNamesForSimulationAndEmojiType(simId, emojiType));
+    }
+    return "...";
 }
 
 void _BrowserWindow::pushTextColor(RemoteSimulationData const& entry)
@@ -990,16 +1037,16 @@ void _BrowserWindow::pushTextColor(RemoteSimulationData const& entry)
 void _BrowserWindow::calcFilteredSimulationAndGenomeLists()
 {
     _filteredRemoteSimulationList.clear();
-    _filteredRemoteSimulationList.reserve(_rawRemoteDataList.size());
     _filteredRemoteGenomeList.clear();
-    _filteredRemoteGenomeList.reserve(_filteredRemoteGenomeList.size());
-    for (auto const& simData : _rawRemoteDataList) {
-        if (simData.matchWithFilter(_filter) &&_showCommunityCreations != simData.fromRelease) {
+    for (auto const& entryIndex : _remoteDataIndex.filter(_filter)) {
+        auto const& simData = _rawRemoteDataList[entryIndex];
+        if (_showCommunityCreations != simData.fromRelease) {
             if (simData.type == RemoteDataType_Simulation) {
-                _filteredRemoteSimulationList.emplace_back(simData);
+                _filteredRemoteSimulationList.emplace_back(entryIndex);
             } else {
-                _filteredRemoteGenomeList.emplace_back(simData);
+                _filteredRemoteGenomeList.emplace_back(entryIndex);
             }
         }
     }
+    sortSimulationList();
 }
@@ -4,12 +4,16 @@
 
 #include "Base/Hashes.h"
 #include "EngineInterface/Definitions.h"
+#include "Network/RemoteSimulationData.h"
+#include "Network/RemoteSimulationDataIndex.h"
+#include "Network/UserData.h"
 
 #include "AlienWindow.h"
-#include "RemoteSimulationData.h"
-#include "UserData.h"
+#include "NetworkController.h"
 #include "Definitions.h"
 
+struct ImGuiTableSortSpecs;
+
 class _BrowserWindow : public _AlienWindow
 {
 public:
@@ -28,6 +32,8 @@ public:
 
 private:
     void refreshIntern(bool withRetry);
+    void processPendingRequests();
+    void onRefreshFinished();
 
     void processIntern() override;
     void processBackground() override;
@@ -53,9 +59,11 @@ private:
     void processActivated() override;
 
     void sortSimulationList();
+    void sortSimulationList(std::vector<int>& entryIndices, ImGuiTableSortSpecs const* sortSpecs) const;
     void sortUserList();
 
     void onDownloadItem(RemoteSimulationData* sim);
+    void onDownloadFinished(RemoteSimulationData const& sim, DataType dataType, std::optional<SerializedSimulation> const& serializedSim);
     void onDeleteItem(RemoteSimulationData* sim);
     void onToggleLike(RemoteSimulationData* sim, int emojiType);
     void openWeblink(std::string const& link);
@@ -68,19 +76,21 @@ private:
 
     DataType _selectedDataType = DataType_Simulation; 
     bool _scheduleRefresh = false;
-    bool _scheduleSort = false;
+    bool _scheduleSimulationSort = false;
+    bool _scheduleGenomeSort = false;
     std::string _filter;
     bool _showCommunityCreations = false;
     float _userTableWidth = 0;
     std::unordered_set<std::string> _selectionIds;
     std::unordered_map<std::string, int> _ownEmojiTypeBySimId;
-    std::unordered_map<std::pair<std::string, int>, std::set<std::string>> _userNamesByEmojiTypeBySimIdCache;
+    std::unordered_map<std::pair<std::string, int>, std::string> _userNamesByEmojiTypeBySimIdCache;
 
     int _numSimulations = 0;
     int _numGenomes = 0;
     std::vector<RemoteSimulationData> _rawRemoteDataList;
-    std::vector<RemoteSimulationData> _filteredRemoteSimulationList;
-    std::vector<RemoteSimulationData> _filteredRemoteGenomeList;
+    RemoteSimulationDataIndex _remoteDataIndex;
+    std::vector<int> _filteredRemoteSimulationList;  //indices in _rawRemoteDataList
+    std::vector<int> _filteredRemoteGenomeList;
 
     std::vector<UserData> _userList;
 
@@ -92,6 +102,20 @@ private:
 
     std::optional<std::chrono::steady_clock::time_point> _lastRefreshTime;
 
+    //results of asynchronous requests are applied in processBackground
+    bool _refreshWithRetry = false;
+    NetworkResult<std::vector<RemoteSimulationData>> _pendingRemoteDataList;
+    NetworkResult<std::vector<UserData>> _pendingUserList;
+    NetworkResult<std::unordered_map<std::string, int>> _pendingOwnEmojiTypeBySimId;
+    std::unordered_map<std::pair<std::string, int>, NetworkResult<std::set<std::string>>> _pendingUserNamesByEmojiTypeBySimId;
+    struct PendingDownload
+    {
+        RemoteSimulationData sim;
+        DataType dataType;
+        NetworkResult<SerializedSimulation> result;
+    };
+    std::optional<PendingDownload> _pendingDownload;
+
     SimulationController _simController;
     NetworkController _networkController;
     StatisticsWindow _statisticsWindow;
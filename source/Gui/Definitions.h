@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Base/Definitions.h"
+#include "Network/Definitions.h"
 
 class _MainWindow;
 using MainWindow = std::shared_ptr<_MainWindow>;
@@ -58,6 +59,9 @@ using MassOperationsDialog = std::shared_ptr<_MassOperationsDialog>;
 class _LogWindow;
 using LogWindow = std::shared_ptr<_LogWindow>;
 
+class _ProfilingWindow;
+using ProfilingWindow = std::shared_ptr<_ProfilingWindow>;
+
 class _GuiLogger;
 using GuiLogger = std::shared_ptr<_GuiLogger>;
 
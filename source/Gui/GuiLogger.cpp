@@ -12,8 +12,19 @@ _GuiLogger::~_GuiLogger()
     LoggingService::getInstance().unregisterCallBack(this);
 }
 
-std::vector<std::string> const& _GuiLogger::getMessages(Priority minPriority) const
+std::vector<std::string> const& _GuiLogger::getMessages(Priority minPriority)
 {
+    {
+        std::lock_guard lock(_pendingMessagesMutex);
+        for (auto& [priority, message] : _pendingMessages) {
+            if (Priority::Important == priority) {
+                _importantLogMessages.emplace_back(message);
+            }
+            _allLogMessages.emplace_back(std::move(message));
+        }
+        _pendingMessages.clear();
+    }
+
     if (Priority::Important == minPriority) {
         return _importantLogMessages;
     }
@@ -22,8 +33,6 @@ std::vector<std::string> const& _GuiLogger::getMessages(Priority minPriority) co
 
 void _GuiLogger::newLogMessage(Priority priority, std::string const& message)
 {
-    _allLogMessages.emplace_back(message);
-    if (Priority::Important == priority) {
-        _importantLogMessages.emplace_back(message);
-    }
+    std::lock_guard lock(_pendingMessagesMutex);
+    _pendingMessages.emplace_back(priority, message);
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <mutex>
+
 #include "Base/LoggingService.h"
 #include "Definitions.h"
 
@@ -9,7 +11,7 @@ public:
     _GuiLogger();
     virtual ~_GuiLogger();
 
-    std::vector<std::string> const& getMessages(Priority minPriority) const;
+    std::vector<std::string> const& getMessages(Priority minPriority);  //must be called from the GUI thread
 
 private:
 
@@ -17,4 +19,8 @@ private:
 
     std::vector<std::string> _allLogMessages;
     std::vector<std::string> _importantLogMessages;
+
+    //messages delivered by the writer thread of the LoggingService which are not yet taken over by the GUI thread
+    std::mutex _pendingMessagesMutex;
+    std::vector<std::pair<Priority, std::string>> _pendingMessages;
 };
@@ -424,8 +424,8 @@ void _InspectorWindow::processCellGenomeTab(Description& desc)
 
             if (ImGui::TreeNodeEx("Properties (principal genome part)", TreeNodeFlags)) {
 
-                auto genomeDesc = GenomeDescriptionService::convertBytesToDescription(desc.genome);
-                auto numRepetitions = genomeDesc.header.numRepetitions;
+                GenomeView genome(desc.genome);
+                auto numRepetitions = genome.getNumRepetitions();
                 AlienImGui::InputInt(
                     AlienImGui::InputIntParameters()
                         .name("Number of repetitions")
@@ -435,7 +435,7 @@ void _InspectorWindow::processCellGenomeTab(Description& desc)
                         .tooltip(Const::GenomeRepetitionsPerConstructionTooltip),
                     numRepetitions);
 
-                auto numNodes = toInt(genomeDesc.cells.size());
+                auto numNodes = genome.getNumNodes();
                 AlienImGui::InputInt(
                     AlienImGui::InputIntParameters()
                         .name("Number of cells")
@@ -39,6 +39,7 @@
 #include "AboutDialog.h"
 #include "MassOperationsDialog.h"
 #include "LogWindow.h"
+#include "ProfilingWindow.h"
 #include "GuiLogger.h"
 #include "UiController.h"
 #include "AutosaveController.h"
@@ -135,6 +136,7 @@ _MainWindow::_MainWindow(SimulationController const& simController, GuiLogger co
     _aboutDialog = std::make_shared<_AboutDialog>();
     _massOperationsDialog = std::make_shared<_MassOperationsDialog>(_simController);
     _logWindow = std::make_shared<_LogWindow>(_logger);
+    _profilingWindow = std::make_shared<_ProfilingWindow>(_simController);
     _gettingStartedWindow = std::make_shared<_GettingStartedWindow>();
     _newSimulationDialog = std::make_shared<_NewSimulationDialog>(_simController, _temporalControlWindow, _viewport, _statisticsWindow);
     _displaySettingsDialog = std::make_shared<_DisplaySettingsDialog>();
@@ -448,6 +450,9 @@ void _MainWindow::processMenubar()
             if (ImGui::MenuItem("Log", "ALT+7", _logWindow->isOn())) {
                 _logWindow->setOn(!_logWindow->isOn());
             }
+            if (ImGui::MenuItem("Profiling", "ALT+8", _profilingWindow->isOn())) {
+                _profilingWindow->setOn(!_profilingWindow->isOn());
+            }
             AlienImGui::EndMenuButton();
         }
 
@@ -538,6 +543,9 @@ void _MainWindow::processMenubar()
             if (ImGui::MenuItem("Auto save", "", _autosaveController->isOn())) {
                 _autosaveController->setOn(!_autosaveController->isOn());
             }
+            if (ImGui::MenuItem("Auto save as delta checkpoint", "", _autosaveController->isDeltaCheckpointsOn())) {
+                _autosaveController->setDeltaCheckpointsOn(!_autosaveController->isDeltaCheckpointsOn());
+            }
             if (ImGui::MenuItem("CUDA settings", "ALT+C")) {
                 _gpuSettingsDialog->open();
             }
@@ -627,6 +635,9 @@ void _MainWindow::processMenubar()
         if (io.KeyAlt && ImGui::IsKeyPressed(GLFW_KEY_7)) {
             _logWindow->setOn(!_logWindow->isOn());
         }
+        if (io.KeyAlt && ImGui::IsKeyPressed(GLFW_KEY_8)) {
+            _profilingWindow->setOn(!_profilingWindow->isOn());
+        }
 
         if (io.KeyAlt && ImGui::IsKeyPressed(GLFW_KEY_E)) {
             _modeController->setMode(
@@ -736,6 +747,7 @@ void _MainWindow::processWindows()
     _statisticsWindow->process();
     _simulationParametersWindow->process();
     _logWindow->process();
+    _profilingWindow->process();
     _browserWindow->process();
     _gettingStartedWindow->process();
     _shaderWindow->process();
@@ -42,6 +42,7 @@ private:
     SimulationParametersWindow _simulationParametersWindow;
     StatisticsWindow _statisticsWindow;
     LogWindow _logWindow;
+    ProfilingWindow _profilingWindow;
     GettingStartedWindow _gettingStartedWindow;
     BrowserWindow _browserWindow;
     ShaderWindow _shaderWindow;
@@ -2,42 +2,43 @@
 
 #include <boost/property_tree/json_parser.hpp>
 
-#define CPPHTTPLIB_OPENSSL_SUPPORT
-#include <cpp-httplib/httplib.h>
-
 #include "Base/GlobalSettings.h"
 #include "Base/LoggingService.h"
 #include "Base/Resources.h"
+#include "Network/DownloadCache.h"
+#include "Network/NetworkDataParser.h"
 
 #include "MessageDialog.h"
-#include "NetworkDataParser.h"
 
 namespace
 {
     auto RefreshInterval = 20;  //in minutes
-
-    void configureClient(httplib::SSLClient& client)
+    auto constexpr DefaultDownloadCacheSize = 1024;  //in MB
+
+    HttpRequest createRequest(
+        std::string const& path,
+        std::vector<std::pair<std::string, std::string>> const& params,
+        HttpMethod method = HttpMethod::Post,
+        bool withRetry = true,
+        bool deduplicate = false)
     {
-        client.set_ca_cert_path("./resources/ca-bundle.crt");
-        client.enable_server_certificate_verification(true);
-        if (auto result = client.get_openssl_verify_result()) {
-            throw std::runtime_error("OpenSSL verify error: " + std::string(X509_verify_cert_error_string(result)));
-        }
+        HttpRequest result;
+        result.method = method;
+        result.path = path;
+        result.params = params;
+        result.withRetry = withRetry;
+        result.deduplicate = deduplicate;
+        return result;
     }
 
-    httplib::Result executeRequest(std::function<httplib::Result()> const& func, bool withRetry = true)
+    //blocks until the response is available
+    std::string getResponseBody(HttpRequestHandle const& handle)
     {
-        auto attempt = 0;
-        while (true) {
-            auto result = func();
-            if (result) {
-                return result;
-            }
-            if (++attempt == 5 || !withRetry) {
-                throw std::runtime_error("Error connecting to the server.");
-            }
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        auto response = handle.response.get();
+        if (!response) {
+            throw std::runtime_error("Error connecting to the server.");
         }
+        return *response;
     }
 
     void logNetworkError()
@@ -45,12 +46,17 @@ namespace
         log(Priority::Important, "network: an error occurred");
     }
 
-    bool parseBoolResult(std::string const& serverResponse)
+    boost::property_tree::ptree parseJson(std::string const& serverResponse)
     {
         std::stringstream stream(serverResponse);
         boost::property_tree::ptree tree;
         boost::property_tree::read_json(stream, tree);
-        auto result = tree.get<bool>("result");
+        return tree;
+    }
+
+    bool parseBoolResult(std::string const& serverResponse)
+    {
+        auto result = parseJson(serverResponse).get<bool>("result");
         if (!result) {
             log(Priority::Important, "network: negative response received from server");
         }
@@ -61,11 +67,16 @@ namespace
 _NetworkController::_NetworkController()
 {
     _serverAddress = GlobalSettings::getInstance().getStringState("settings.server", "alien-project.org");
+    _requestQueue = std::make_shared<_HttpRequestQueue>(_serverAddress);
+
+    auto downloadCacheSize = GlobalSettings::getInstance().getIntState("settings.download cache size", DefaultDownloadCacheSize);
+    _downloadCache = std::make_shared<_DownloadCache>(Const::DownloadCacheDirectory, uint64_t(downloadCacheSize) << 20);
 }
 
 _NetworkController::~_NetworkController()
 {
     GlobalSettings::getInstance().setStringState("settings.server", _serverAddress);
+    GlobalSettings::getInstance().setIntState("settings.download cache size", static_cast<int>(_downloadCache->getMaxSize() >> 20));
     logout();
 }
 
@@ -89,6 +100,7 @@ std::string _NetworkController::getServerAddress() const
 void _NetworkController::setServerAddress(std::string const& value)
 {
     _serverAddress = value;
+    _requestQueue->setServerAddress(value);
     logout();
 }
 
@@ -106,17 +118,10 @@ bool _NetworkController::createUser(std::string const& userName, std::string con
 {
     log(Priority::Important, "network: create user '" + userName + "'");
 
-    httplib::SSLClient client(_serverAddress);
-    configureClient(client);
-
-    httplib::Params params;
-    params.emplace("userName", userName);
-    params.emplace("password", password);
-    params.emplace("email", email);
+    auto request = createRequest("/alien-server/createuser.php", {{"userName", userName}, {"password", password}, {"email", email}});
 
     try {
-        auto result = executeRequest([&] { return client.Post("/alien-server/createuser.php", params); });
-        return parseBoolResult(result->body);
+        return parseBoolResult(getResponseBody(_requestQueue->execute(request)));
     } catch (...) {
         logNetworkError();
         return false;
@@ -127,20 +132,14 @@ bool _NetworkController::activateUser(std::string const& userName, std::string c
 {
     log(Priority::Important, "network: activate user '" + userName + "'");
 
-    httplib::SSLClient client(_serverAddress);
-    configureClient(client);
-
-    httplib::Params params;
-    params.emplace("userName", userName);
-    params.emplace("password", password);
-    params.emplace("activationCode", confirmationCode);
+    auto request =
+        createRequest("/alien-server/activateuser.php", {{"userName", userName}, {"password", password}, {"activationCode", confirmationCode}});
     if (userInfo.gpu) {
-        params.emplace("gpu", *userInfo.gpu);
+        request.params.emplace_back("gpu", *userInfo.gpu);
     }
 
     try {
-        auto result = executeRequest([&] { return client.Post("/alien-server/activateuser.php", params); });
-        return parseBoolResult(result->body);
+        return parseBoolResult(getResponseBody(_requestQueue->execute(request)));
     } catch (...) {
         logNetworkError();
         return false;
@@ -151,30 +150,22 @@ bool _NetworkController::login(LoginErrorCode& errorCode, std::string const& use
 {
     log(Priority::Important, "network: login user '" + userName + "'");
 
-    httplib::SSLClient client(_serverAddress);
-    configureClient(client);
-
-    httplib::Params params;
-    params.emplace("userName", userName);
-    params.emplace("password", password);
+    auto request = createRequest("/alien-server/login.php", {{"userName", userName}, {"password", password}});
     if (userInfo.gpu) {
-        params.emplace("gpu", *userInfo.gpu);
+        request.params.emplace_back("gpu", *userInfo.gpu);
     }
 
     try {
-        auto result = executeRequest([&] { return client.Post("/alien-server/login.php", params); });
+        auto responseBody = getResponseBody(_requestQueue->execute(request));
 
-        auto boolResult = parseBoolResult(result->body);
+        auto boolResult = parseBoolResult(responseBody);
         if (boolResult) {
             _loggedInUserName = userName;
             _password = password;
         }
 
         errorCode = false;
-        std::stringstream stream(result->body);
-        boost::property_tree::ptree tree;
-        boost::property_tree::read_json(stream, tree);
-        errorCode = tree.get<LoginErrorCode>("errorCode");
+        errorCode = parseJson(responseBody).get<LoginErrorCode>("errorCode");
 
         return boolResult;
     } catch (...) {
@@ -189,15 +180,10 @@ bool _NetworkController::logout()
     bool result = true;
 
     if (_loggedInUserName && _password) {
-        httplib::SSLClient client(_serverAddress);
-        configureClient(client);
-
-        httplib::Params params;
-        params.emplace("userName", *_loggedInUserName);
-        params.emplace("password", *_password);
+        auto request = createRequest("/alien-server/logout.php", {{"userName", *_loggedInUserName}, {"password", *_password}});
 
         try {
-            result = executeRequest([&] { return client.Post("/alien-server/logout.php", params); });
+            getResponseBody(_requestQueue->execute(request));
         } catch (...) {
             logNetworkError();
             result = false;
@@ -213,17 +199,10 @@ bool _NetworkController::deleteUser()
 {
     log(Priority::Important, "network: delete user '" + *_loggedInUserName + "'");
 
-    httplib::SSLClient client(_serverAddress);
-    configureClient(client);
-
-    httplib::Params params;
-    params.emplace("userName", *_loggedInUserName);
-    params.emplace("password", *_password);
+    auto request = createRequest("/alien-server/deleteuser.php", {{"userName", *_loggedInUserName}, {"password", *_password}});
 
     try {
-        auto postResult = executeRequest([&] { return client.Post("/alien-server/deleteuser.php", params); });
-
-        auto result = parseBoolResult(postResult->body);
+        auto result = parseBoolResult(getResponseBody(_requestQueue->execute(request)));
         if (result) {
             return logout();
         }
@@ -238,16 +217,10 @@ bool _NetworkController::resetPassword(std::string const& userName, std::string
 {
     log(Priority::Important, "network: reset password of user '" + userName + "'");
 
-    httplib::SSLClient client(_serverAddress);
-    configureClient(client);
-
-    httplib::Params params;
-    params.emplace("userName", userName);
-    params.emplace("email", email);
+    auto request = createRequest("/alien-server/resetpw.php", {{"userName", userName}, {"email", email}});
 
     try {
-        auto result = executeRequest([&] { return client.Post("/alien-server/resetpw.php", params); });
-        return parseBoolResult(result->body);
+        return parseBoolResult(getResponseBody(_requestQueue->execute(request)));
     } catch (...) {
         logNetworkError();
         return false;
@@ -258,152 +231,86 @@ bool _NetworkController::setNewPassword(std::string const& userName, std::string
 {
     log(Priority::Important, "network: set new password for user '" + userName + "'");
 
-    httplib::SSLClient client(_serverAddress);
-    configureClient(client);
-
-    httplib::Params params;
-    params.emplace("userName", userName);
-    params.emplace("newPassword", newPassword);
-    params.emplace("activationCode", confirmationCode);
+    auto request = createRequest(
+        "/alien-server/setnewpw.php", {{"userName", userName}, {"newPassword", newPassword}, {"activationCode", confirmationCode}});
 
     try {
-        auto result = executeRequest([&] { return client.Post("/alien-server/setnewpw.php", params); });
-        return parseBoolResult(result->body);
+        return parseBoolResult(getResponseBody(_requestQueue->execute(request)));
     } catch (...) {
         logNetworkError();
         return false;
     }
 }
 
-bool _NetworkController::getRemoteSimulationList(std::vector<RemoteSimulationData>& result, bool withRetry) const
+NetworkResult<std::vector<RemoteSimulationData>> _NetworkController::getRemoteSimulationList(bool withRetry) const
 {
     log(Priority::Important, "network: get simulation list");
 
-    httplib::SSLClient client(_serverAddress);
-    configureClient(client);
-
-    httplib::Params params;
-    params.emplace("version", Const::ProgramVersion);
+    auto request =
+        createRequest("/alien-server/getversionedsimulationlist.php", {{"version", Const::ProgramVersion}}, HttpMethod::Post, withRetry, true);
 
-    try {
-        auto postResult = executeRequest([&] { return client.Post("/alien-server/getversionedsimulationlist.php", params); }, withRetry);
-
-        std::stringstream stream(postResult->body);
-        boost::property_tree::ptree tree;
-        boost::property_tree::read_json(stream, tree);
-        result = NetworkDataParser::decodeRemoteSimulationData(tree);
-        return true;
-    } catch (...) {
-        logNetworkError();
-        return false;
-    }
+    return NetworkResult<std::vector<RemoteSimulationData>>(_requestQueue, {_requestQueue->execute(request)}, [](std::vector<std::string> const& responseBodies) {
+        return NetworkDataParser::decodeRemoteSimulationData(responseBodies.front());
+    });
 }
 
-bool _NetworkController::getUserList(std::vector<UserData>& result, bool withRetry) const
+NetworkResult<std::vector<UserData>> _NetworkController::getUserList(bool withRetry) const
 {
     log(Priority::Important, "network: get user list");
 
-    httplib::SSLClient client(_serverAddress);
-    configureClient(client);
-
-    try {
-        httplib::Params params;
-        auto postResult = executeRequest([&] { return client.Post("/alien-server/getuserlist.php", params); }, withRetry);
+    auto request = createRequest("/alien-server/getuserlist.php", {}, HttpMethod::Post, withRetry, true);
 
-        std::stringstream stream(postResult->body);
-        boost::property_tree::ptree tree;
-        boost::property_tree::read_json(stream, tree);
-        result.clear();
-        result = NetworkDataParser::decodeUserData(tree);
+    return NetworkResult<std::vector<UserData>>(_requestQueue, {_requestQueue->execute(request)}, [](std::vector<std::string> const& responseBodies) {
+        auto result = NetworkDataParser::decodeUserData(responseBodies.front());
         for (UserData& userData : result) {
             userData.timeSpent = userData.timeSpent * RefreshInterval / 60;
         }
-        return true;
-    } catch (...) {
-        logNetworkError();
-        return false;
-    }
+        return result;
+    });
 }
 
-bool _NetworkController::getEmojiTypeBySimId(std::unordered_map<std::string, int>& result) const
+NetworkResult<std::unordered_map<std::string, int>> _NetworkController::getEmojiTypeBySimId() const
 {
     log(Priority::Important, "network: get liked simulations");
 
-    httplib::SSLClient client(_serverAddress);
-    configureClient(client);
-
-    httplib::Params params;
-    params.emplace("userName", *_loggedInUserName);
-    params.emplace("password", *_password);
-
-    try {
-        auto postResult = executeRequest([&] { return client.Post("/alien-server/getlikedsimulations.php", params); });
-
-        std::stringstream stream(postResult->body);
-        boost::property_tree::ptree tree;
-        boost::property_tree::read_json(stream, tree);
+    auto request = createRequest(
+        "/alien-server/getlikedsimulations.php", {{"userName", *_loggedInUserName}, {"password", *_password}}, HttpMethod::Post, true, true);
 
-        result.clear();
-        for (auto const& [key, subTree] : tree) {
+    return NetworkResult<std::unordered_map<std::string, int>>(_requestQueue, {_requestQueue->execute(request)}, [](std::vector<std::string> const& responseBodies) {
+        std::unordered_map<std::string, int> result;
+        for (auto const& [key, subTree] : parseJson(responseBodies.front())) {
             result.emplace(subTree.get<std::string>("id"), subTree.get<int>("likeType"));
         }
-        return true;
-    } catch (...) {
-        logNetworkError();
-        return false;
-    }
+        return result;
+    });
 }
 
-bool _NetworkController::getUserNamesForSimulationAndEmojiType(std::set<std::string>& result, std::string const& simId, int likeType)
+NetworkResult<std::set<std::string>> _NetworkController::getUserNamesForSimulationAndEmojiType(std::string const& simId, int likeType) const
 {
     log(Priority::Important, "network: get user likes for simulation with id=" + simId + " and likeType=" + std::to_string(likeType));
 
-    httplib::SSLClient client(_serverAddress);
-    configureClient(client);
-
-    httplib::Params params;
-    params.emplace("simId", simId);
-    params.emplace("likeType", std::to_string(likeType));
+    auto request =
+        createRequest("/alien-server/getuserlikes.php", {{"simId", simId}, {"likeType", std::to_string(likeType)}}, HttpMethod::Post, true, true);
 
-    try {
-        auto postResult = executeRequest([&] { return client.Post("/alien-server/getuserlikes.php", params); });
-
-        std::stringstream stream(postResult->body);
-        boost::property_tree::ptree tree;
-        boost::property_tree::read_json(stream, tree);
-
-        result.clear();
-        for (auto const& [key, subTree] : tree) {
+    return NetworkResult<std::set<std::string>>(_requestQueue, {_requestQueue->execute(request)}, [](std::vector<std::string> const& responseBodies) {
+        std::set<std::string> result;
+        for (auto const& [key, subTree] : parseJson(responseBodies.front())) {
             result.insert(subTree.get<std::string>("userName"));
         }
-        return true;
-    } catch (...) {
-        logNetworkError();
-        return false;
-    }
+        return result;
+    });
 }
 
-bool _NetworkController::toggleLikeSimulation(std::string const& simId, int likeType)
+NetworkResult<bool> _NetworkController::toggleLikeSimulation(std::string const& simId, int likeType)
 {
     log(Priority::Important, "network: toggle like for simulation with id=" + simId);
 
-    httplib::SSLClient client(_serverAddress);
-    configureClient(client);
-
-    httplib::Params params;
-    params.emplace("userName", *_loggedInUserName);
-    params.emplace("password", *_password);
-    params.emplace("simId", simId);
-    params.emplace("likeType", std::to_string(likeType));
-
+    auto request = createRequest(
+        "/alien-server/togglelikesimulation.php",
+        {{"userName", *_loggedInUserName}, {"password", *_password}, {"simId", simId}, {"likeType", std::to_string(likeType)}});
 
-    try {
-        auto result = executeRequest([&] { return client.Post("/alien-server/togglelikesimulation.php", params); });
-        return parseBoolResult(result->body);
-    } catch (...) {
-        logNetworkError();
-        return false;
-    }
+    return NetworkResult<bool>(
+        _requestQueue, {_requestQueue->execute(request)}, [](std::vector<std::string> const& responseBodies) { return parseBoolResult(responseBodies.front()); });
 }
 
 bool _NetworkController::uploadSimulation(
@@ -418,79 +325,83 @@ bool _NetworkController::uploadSimulation(
 {
     log(Priority::Important, "network: upload simulation with name='" + simulationName + "'");
 
-    httplib::SSLClient client(_serverAddress);
-    configureClient(client);
-
-    httplib::MultipartFormDataItems items = {
-        {"userName", *_loggedInUserName, "", ""},
-        {"password", *_password, "", ""},
-        {"simName", simulationName, "", ""},
-        {"simDesc", description, "", ""},
-        {"width", std::to_string(size.x), "", ""},
-        {"height", std::to_string(size.y), "", ""},
-        {"particles", std::to_string(particles), "", ""},
-        {"version", Const::ProgramVersion, "", ""},
-        {"content", mainData, "", "application/octet-stream"},
-        {"settings", settings, "", ""},
-        {"symbolMap", "", "", ""},
-        {"type", std::to_string(type), "", ""},
-        {"statistics", statistics, "", ""},
+    HttpRequest request;
+    request.path = "/alien-server/uploadsimulation.php";
+    request.formDataItems = {
+        {"userName", *_loggedInUserName, ""},
+        {"password", *_password, ""},
+        {"simName", simulationName, ""},
+        {"simDesc", description, ""},
+        {"width", std::to_string(size.x), ""},
+        {"height", std::to_string(size.y), ""},
+        {"particles", std::to_string(particles), ""},
+        {"version", Const::ProgramVersion, ""},
+        {"content", mainData, "application/octet-stream"},
+        {"settings", settings, ""},
+        {"symbolMap", "", ""},
+        {"type", std::to_string(type), ""},
+        {"statistics", statistics, ""},
     };
 
     try {
-        auto result = executeRequest([&] { return client.Post("/alien-server/uploadsimulation.php", items); });
-        return parseBoolResult(result->body);
+        auto startTimepoint = std::chrono::steady_clock::now();
+        auto result = parseBoolResult(getResponseBody(_requestQueue->execute(request)));
+        logPerformanceEvent(PerformanceEvent::UploadSimulation, std::chrono::steady_clock::now() - startTimepoint);
+        return result;
     } catch (...) {
         logNetworkError();
         return false;
     }
 }
 
-bool _NetworkController::downloadSimulation(std::string& mainData, std::string& auxiliaryData, std::string& statistics, std::string const& simId)
+NetworkResult<SerializedSimulation> _NetworkController::downloadSimulation(RemoteSimulationData const& remoteData) const
 {
-    log(Priority::Important, "network: download simulation with id=" + simId);
-
-    httplib::SSLClient client(_serverAddress);
-    configureClient(client);
+    //the entry in the browser list changes with the content, i.e. it serves for validating the cache entry
+    auto contentKey = remoteData.timestamp + "/" + std::to_string(remoteData.contentSize) + "/" + remoteData.version;
+    if (auto cachedData = _downloadCache->find(remoteData.id, contentKey)) {
+        log(Priority::Important, "network: simulation with id=" + remoteData.id + " found in download cache");
+        return NetworkResult<SerializedSimulation>(*cachedData);
+    }
 
-    httplib::Params params;
-    params.emplace("id", simId);
+    log(Priority::Important, "network: download simulation with id=" + remoteData.id);
 
-    try {
-        {
-            auto result = executeRequest([&] { return client.Get("/alien-server/downloadcontent.php", params, {}); });
-            mainData = result->body;
-        }
-        {
-            auto result = executeRequest([&] { return client.Get("/alien-server/downloadsettings.php", params, {}); });
-            auxiliaryData = result->body;
-        }
-        {
-            auto result = executeRequest([&] { return client.Get("/alien-server/downloadstatistics.php", params, {}); });
-            statistics = result->body;
-        }
-        return true;
-    } catch (...) {
-        logNetworkError();
-        return false;
+    //the parts are downloaded in parallel
+    std::vector<HttpRequestHandle> handles;
+    for (auto const& path : {"/alien-server/downloadcontent.php", "/alien-server/downloadsettings.php", "/alien-server/downloadstatistics.php"}) {
+        handles.emplace_back(_requestQueue->execute(createRequest(path, {{"id", remoteData.id}}, HttpMethod::Get, true, true)));
     }
+    return NetworkResult<SerializedSimulation>(
+        _requestQueue, handles, [downloadCache = _downloadCache, id = remoteData.id, contentKey](std::vector<std::string> const& responseBodies) {
+            SerializedSimulation result{responseBodies.at(0), responseBodies.at(1), responseBodies.at(2)};
+
+            //the cache contains the main data with uncompressed blocks for fast loading
+            std::string uncompressedMainData;
+            if (SerializerService::convertToUncompressedData(uncompressedMainData, result.mainData)) {
+                result.mainData = std::move(uncompressedMainData);
+                downloadCache->insert(id, contentKey, result);
+            }
+            return result;
+        });
+}
+
+uint64_t _NetworkController::getDownloadCacheSize() const
+{
+    return _downloadCache->getMaxSize();
+}
+
+void _NetworkController::setDownloadCacheSize(uint64_t value)
+{
+    _downloadCache->setMaxSize(value);
 }
 
 bool _NetworkController::deleteSimulation(std::string const& simId)
 {
     log(Priority::Important, "network: delete simulation with id=" + simId);
 
-    httplib::SSLClient client(_serverAddress);
-    configureClient(client);
-
-    httplib::Params params;
-    params.emplace("userName", *_loggedInUserName);
-    params.emplace("password", *_password);
-    params.emplace("simId", simId);
+    auto request = createRequest("/alien-server/deletesimulation.php", {{"userName", *_loggedInUserName}, {"password", *_password}, {"simId", simId}});
 
     try {
-    auto result = executeRequest([&] { return client.Post("/alien-server/deletesimulation.php", params); });
-    return parseBoolResult(result->body);
+        return parseBoolResult(getResponseBody(_requestQueue->execute(request)));
     } catch (...) {
         logNetworkError();
         return false;
@@ -502,16 +413,7 @@ void _NetworkController::refreshLogin()
     if (_loggedInUserName && _password) {
         log(Priority::Important, "network: refresh login");
 
-        httplib::SSLClient client(_serverAddress);
-        configureClient(client);
-
-        httplib::Params params;
-        params.emplace("userName", *_loggedInUserName);
-        params.emplace("password", *_password);
-
-        try {
-            executeRequest([&] { return client.Post("/alien-server/refreshlogin.php", params); });
-        } catch (...) {
-        }
+        //the response is not needed
+        _requestQueue->execute(createRequest("/alien-server/refreshlogin.php", {{"userName", *_loggedInUserName}, {"password", *_password}}));
     }
 }
@@ -1,9 +1,14 @@
 #pragma once
 
 #include <chrono>
+#include <functional>
+
+#include "Base/LoggingService.h"
+#include "EngineInterface/SerializerService.h"
+#include "Network/HttpRequestQueue.h"
+#include "Network/RemoteSimulationData.h"
+#include "Network/UserData.h"
 
-#include "RemoteSimulationData.h"
-#include "UserData.h"
 #include "Definitions.h"
 
 using LoginErrorCode = int;
@@ -18,6 +23,33 @@ struct UserInfo
     std::optional<std::string> gpu;
 };
 
+//result of asynchronous requests, it is evaluated on the calling thread as soon as all responses are available
+template <typename T>
+class NetworkResult
+{
+public:
+    NetworkResult() = default;
+    NetworkResult(T const& value);  //already available result
+    NetworkResult(
+        HttpRequestQueue const& requestQueue,
+        std::vector<HttpRequestHandle> const& handles,
+        std::function<T(std::vector<std::string> const&)> const& evaluateFunc);
+
+    bool isValid() const;  //false if no request is pending or the result has already been fetched
+    bool isReady() const;
+
+    //blocks if not ready, returns std::nullopt if a request has failed
+    std::optional<T> get();
+
+    void cancel();
+
+private:
+    std::optional<T> _value;
+    std::weak_ptr<_HttpRequestQueue> _requestQueue;
+    std::vector<HttpRequestHandle> _handles;
+    std::function<T(std::vector<std::string> const&)> _evaluateFunc;
+};
+
 class _NetworkController
 {
 public:
@@ -40,11 +72,17 @@ public:
     bool resetPassword(std::string const& userName, std::string const& email);
     bool setNewPassword(std::string const& userName, std::string const& newPassword, std::string const& confirmationCode);
 
-    bool getRemoteSimulationList(std::vector<RemoteSimulationData>& result, bool withRetry) const;
-    bool getUserList(std::vector<UserData>& result, bool withRetry) const;
-    bool getEmojiTypeBySimId(std::unordered_map<std::string, int>& result) const;
-    bool getUserNamesForSimulationAndEmojiType(std::set<std::string>& result, std::string const& simId, int likeType);
-    bool toggleLikeSimulation(std::string const& simId, int likeType);
+    //the following requests do not block, identical pending queries are merged
+    NetworkResult<std::vector<RemoteSimulationData>> getRemoteSimulationList(bool withRetry) const;
+    NetworkResult<std::vector<UserData>> getUserList(bool withRetry) const;
+    NetworkResult<std::unordered_map<std::string, int>> getEmojiTypeBySimId() const;
+    NetworkResult<std::set<std::string>> getUserNamesForSimulationAndEmojiType(std::string const& simId, int likeType) const;
+    NetworkResult<bool> toggleLikeSimulation(std::string const& simId, int likeType);
+    //downloads are cached on disk
+    NetworkResult<SerializedSimulation> downloadSimulation(RemoteSimulationData const& remoteData) const;
+
+    uint64_t getDownloadCacheSize() const;
+    void setDownloadCacheSize(uint64_t value);  //in bytes
 
     bool uploadSimulation(
         std::string const& simulationName,
@@ -55,7 +93,6 @@ public:
         std::string const& settings,
         std::string const& statistics,
         RemoteDataType type);
-    bool downloadSimulation(std::string& mainData, std::string& auxiliaryData, std::string& statistics, std::string const& simId);
     bool deleteSimulation(std::string const& simId);
 
 private:
@@ -65,4 +102,83 @@ private:
     std::optional<std::string> _loggedInUserName;
     std::optional<std::string> _password;
     std::optional<std::chrono::steady_clock::time_point> _lastRefreshTime;
+    HttpRequestQueue _requestQueue;
+    DownloadCache _downloadCache;
 };
+
+/**
+ * Implementations
+ */
+
+template <typename T>
+NetworkResult<T>::NetworkResult(T const& value)
+    : _value(value)
+{}
+
+template <typename T>
+NetworkResult<T>::NetworkResult(
+    HttpRequestQueue const& requestQueue,
+    std::vector<HttpRequestHandle> const& handles,
+    std::function<T(std::vector<std::string> const&)> const& evaluateFunc)
+    : _requestQueue(requestQueue)
+    , _handles(handles)
+    , _evaluateFunc(evaluateFunc)
+{}
+
+template <typename T>
+bool NetworkResult<T>::isValid() const
+{
+    return _value.has_value() || !_handles.empty();
+}
+
+template <typename T>
+bool NetworkResult<T>::isReady() const
+{
+    for (auto const& handle : _handles) {
+        if (handle.response.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T>
+std::optional<T> NetworkResult<T>::get()
+{
+    if (_value) {
+        auto result = std::move(_value);
+        _value.reset();
+        return result;
+    }
+
+    auto handles = std::move(_handles);
+    _handles.clear();
+
+    std::vector<std::string> bodies;
+    for (auto const& handle : handles) {
+        auto response = handle.response.get();
+        if (!response) {
+            log(Priority::Important, "network: an error occurred");
+            return std::nullopt;
+        }
+        bodies.emplace_back(*response);
+    }
+    try {
+        return _evaluateFunc(bodies);
+    } catch (...) {
+        log(Priority::Important, "network: an error occurred");
+        return std::nullopt;
+    }
+}
+
+template <typename T>
+void NetworkResult<T>::cancel()
+{
+    if (auto requestQueue = _requestQueue.lock()) {
+        for (auto const& handle : _handles) {
+            requestQueue->cancel(handle.id);
+        }
+    }
+    _value.reset();
+    _handles.clear();
+}
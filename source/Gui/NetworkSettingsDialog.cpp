@@ -1,5 +1,7 @@
 #include "NetworkSettingsDialog.h"
 
+#include <algorithm>
+
 #include <imgui.h>
 
 #include "AlienImGui.h"
@@ -23,6 +25,13 @@ void _NetworkSettingsDialog::processIntern()
 {
     AlienImGui::InputText(
         AlienImGui::InputTextParameters().name("Blocks").defaultValue(_origServerAddress).name("Server address").textWidth(RightColumnWidth), _serverAddress);
+    AlienImGui::InputInt(
+        AlienImGui::InputIntParameters()
+            .name("Download cache (MB)")
+            .defaultValue(_origDownloadCacheSize)
+            .textWidth(RightColumnWidth)
+            .tooltip("Downloaded simulations and genomes are kept on disk up to this size so that they can be opened again without downloading."),
+        _downloadCacheSize);
 
     ImGui::Dummy({0, ImGui::GetContentRegionAvail().y - scale(50.0f)});
     AlienImGui::Separator();
@@ -43,10 +52,15 @@ void _NetworkSettingsDialog::openIntern()
 {
     _origServerAddress = _networkController->getServerAddress();
     _serverAddress = _origServerAddress;
+    _origDownloadCacheSize = static_cast<int>(_networkController->getDownloadCacheSize() >> 20);
+    _downloadCacheSize = _origDownloadCacheSize;
 }
 
 void _NetworkSettingsDialog::onChangeSettings()
 {
-    _networkController->setServerAddress(_serverAddress);
-    _browserWindow->onRefresh();
+    _networkController->setDownloadCacheSize(uint64_t(std::max(0, _downloadCacheSize)) << 20);
+    if (_serverAddress != _origServerAddress) {
+        _networkController->setServerAddress(_serverAddress);
+        _browserWindow->onRefresh();
+    }
 }
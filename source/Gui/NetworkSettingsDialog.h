@@ -19,4 +19,6 @@ private:
 
     std::string _serverAddress;
     std::string _origServerAddress;
+    int _downloadCacheSize = 0;
+    int _origDownloadCacheSize = 0;
 };
\ No newline at end of file
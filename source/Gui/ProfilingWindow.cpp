@@ -0,0 +1,112 @@
+#include "ProfilingWindow.h"
+
+#include <algorithm>
+#include <filesystem>
+
+#include <imgui.h>
+#include <ImFileDialog.h>
+
+#include "Base/GlobalSettings.h"
+#include "Base/StringHelper.h"
+#include "EngineInterface/SimulationController.h"
+#include "EngineInterface/TimestepProfileService.h"
+
+#include "AlienImGui.h"
+#include "GenericFileDialogs.h"
+#include "MessageDialog.h"
+#include "StyleRepository.h"
+
+namespace
+{
+    auto constexpr RightColumnWidth = 90.0f;
+}
+
+_ProfilingWindow::_ProfilingWindow(SimulationController const& simController)
+    : _AlienWindow("Profiling", "windows.profiling", false)
+    , _simController(simController)
+{
+    auto path = std::filesystem::current_path();
+    if (path.has_parent_path()) {
+        path = path.parent_path();
+    }
+    _startingPath = GlobalSettings::getInstance().getStringState("windows.profiling.starting path", path.string());
+}
+
+_ProfilingWindow::~_ProfilingWindow()
+{
+    GlobalSettings::getInstance().setStringState("windows.profiling.starting path", _startingPath);
+}
+
+void _ProfilingWindow::processIntern()
+{
+    auto enabled = _simController->isProfilingEnabled();
+    if (AlienImGui::ToggleButton(
+            AlienImGui::ToggleButtonParameters().name("Record time steps").tooltip("Measures the stages of each time step. This slows down the simulation."),
+            enabled)) {
+        _simController->setProfilingEnabled(enabled);
+    }
+    ImGui::SameLine();
+    auto profiles = _simController->getTimestepProfiles();
+    ImGui::BeginDisabled(profiles.empty());
+    if (AlienImGui::Button("Save")) {
+        onSaveProfiles();
+    }
+    ImGui::EndDisabled();
+
+    if (profiles.empty()) {
+        AlienImGui::Separator();
+        AlienImGui::Text("No time steps recorded.");
+        return;
+    }
+    auto average = TimestepProfileService::calcAverage(profiles);
+
+    AlienImGui::Group("Last " + StringHelper::format(profiles.size()) + " time steps");
+    AlienImGui::Text("Average duration: " + StringHelper::format(average.duration, 3) + " ms");
+    AlienImGui::Text("Cells: " + StringHelper::format(profiles.back().numCells));
+    AlienImGui::Text("Energy particles: " + StringHelper::format(profiles.back().numParticles));
+
+    processStageTable(average, profiles.back());
+}
+
+void _ProfilingWindow::processStageTable(TimestepProfile const& average, TimestepProfile const& last)
+{
+    AlienImGui::Group("Stages");
+    if (ImGui::BeginChild("##", ImVec2(0, 0), false, ImGuiWindowFlags_HorizontalScrollbar)) {
+        if (ImGui::BeginTable("##", 4, ImGuiTableFlags_BordersInnerH | ImGuiTableFlags_RowBg, ImVec2(-1, 0))) {
+            ImGui::TableSetupColumn("Stage");
+            ImGui::TableSetupColumn("Average (ms)", ImGuiTableColumnFlags_WidthFixed, scale(RightColumnWidth));
+            ImGui::TableSetupColumn("Last (ms)", ImGuiTableColumnFlags_WidthFixed, scale(RightColumnWidth));
+            ImGui::TableSetupColumn("Share", ImGuiTableColumnFlags_WidthFixed, scale(RightColumnWidth));
+            ImGui::TableHeadersRow();
+
+            for (int stage = 0; stage < ProfilingStage_Count; ++stage) {
+                ImGui::TableNextRow();
+                ImGui::TableSetColumnIndex(0);
+                AlienImGui::Text(TimestepProfileService::getStageName(stage));
+                ImGui::TableSetColumnIndex(1);
+                AlienImGui::Text(StringHelper::format(average.stageDurations[stage], 3));
+                ImGui::TableSetColumnIndex(2);
+                AlienImGui::Text(StringHelper::format(last.stageDurations[stage], 3));
+                ImGui::TableSetColumnIndex(3);
+                auto share = average.duration > 0 ? average.stageDurations[stage] / average.duration : 0.0f;
+                ImGui::ProgressBar(std::min(1.0f, share), ImVec2(-1, 0));
+            }
+            ImGui::EndTable();
+        }
+    }
+    ImGui::EndChild();
+}
+
+void _ProfilingWindow::onSaveProfiles()
+{
+    GenericFileDialogs::getInstance().showSaveFileDialog(
+        "Save profiling data", "Profiling data (*.csv *.json){.csv,.json},.*", _startingPath, [&](std::filesystem::path const& path) {
+            auto firstFilename = ifd::FileDialog::Instance().GetResult();
+            auto firstFilenameCopy = firstFilename;
+            _startingPath = firstFilenameCopy.remove_filename().string();
+
+            if (!TimestepProfileService::serializeToFile(firstFilename.string(), _simController->getTimestepProfiles())) {
+                MessageDialog::getInstance().information("Save profiling data", "The selected file could not be saved.");
+            }
+        });
+}
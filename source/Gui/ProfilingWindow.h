@@ -0,0 +1,23 @@
+#pragma once
+
+#include "EngineInterface/Definitions.h"
+#include "EngineInterface/TimestepProfile.h"
+
+#include "Definitions.h"
+#include "AlienWindow.h"
+
+class _ProfilingWindow : public _AlienWindow
+{
+public:
+    _ProfilingWindow(SimulationController const& simController);
+    ~_ProfilingWindow();
+
+private:
+    void processIntern() override;
+
+    void processStageTable(TimestepProfile const& average, TimestepProfile const& last);
+    void onSaveProfiles();
+
+    SimulationController _simController;
+    std::string _startingPath;
+};
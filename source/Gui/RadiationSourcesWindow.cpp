@@ -103,6 +103,55 @@ void _RadiationSourcesWindow::processIntern()
                         .format("%.2f")
                         .defaultValue(&origSource.velY),
                     &source.velY);
+                AlienImGui::Combo(
+                    AlienImGui::ComboParameters()
+                        .name("Motion")
+                        .values({"Linear", "Oscillation", "Keyframes"})
+                        .textWidth(RightColumnWidth)
+                        .defaultValue(origSource.motion.type)
+                        .tooltip("Linear: The position changes with the given velocity.\nOscillation: The linear motion is superimposed by a periodic "
+                                 "oscillation.\nKeyframes: The position is interpolated between the keyframes which are defined in the settings file."),
+                    source.motion.type);
+                if (source.motion.type == ParameterMotionType_Oscillation) {
+                    AlienImGui::SliderFloat(
+                        AlienImGui::SliderFloatParameters()
+                            .name("Amplitude X")
+                            .textWidth(RightColumnWidth)
+                            .min(0)
+                            .max(toFloat(worldSize.x) / 2)
+                            .format("%.1f")
+                            .defaultValue(&origSource.motion.oscillation.amplitudeX),
+                        &source.motion.oscillation.amplitudeX);
+                    AlienImGui::SliderFloat(
+                        AlienImGui::SliderFloatParameters()
+                            .name("Amplitude Y")
+                            .textWidth(RightColumnWidth)
+                            .min(0)
+                            .max(toFloat(worldSize.y) / 2)
+                            .format("%.1f")
+                            .defaultValue(&origSource.motion.oscillation.amplitudeY),
+                        &source.motion.oscillation.amplitudeY);
+                    AlienImGui::SliderFloat(
+                        AlienImGui::SliderFloatParameters()
+                            .name("Period")
+                            .textWidth(RightColumnWidth)
+                            .min(10.0f)
+                            .max(100000.0f)
+                            .logarithmic(true)
+                            .format("%.0f")
+                            .defaultValue(&origSource.motion.oscillation.period)
+                            .tooltip("Duration of an oscillation in time steps."),
+                        &source.motion.oscillation.period);
+                    AlienImGui::SliderFloat(
+                        AlienImGui::SliderFloatParameters()
+                            .name("Phase")
+                            .textWidth(RightColumnWidth)
+                            .min(0)
+                            .max(360.0f)
+                            .format("%.1f")
+                            .defaultValue(&origSource.motion.oscillation.phase),
+                        &source.motion.oscillation.phase);
+                }
                 AlienImGui::SliderFloat(
                     AlienImGui::SliderFloatParameters()
                         .name("Angle")
@@ -189,4 +238,5 @@ void _RadiationSourcesWindow::validationAndCorrection(RadiationSource& source) c
         source.shapeData.rectangularRadiationSource.width = std::max(1.0f, source.shapeData.rectangularRadiationSource.width);
         source.shapeData.rectangularRadiationSource.height = std::max(1.0f, source.shapeData.rectangularRadiationSource.height);
     }
+    source.motion.oscillation.period = std::max(1.0f, source.motion.oscillation.period);
 }
@@ -1307,6 +1307,55 @@ void _SimulationParametersWindow::processSpot(
                     .defaultValue(&origSpot.velY)
                     .format("%.2f"),
                 &spot.velY);
+            AlienImGui::Combo(
+                AlienImGui::ComboParameters()
+                    .name("Motion")
+                    .values({"Linear", "Oscillation", "Keyframes"})
+                    .textWidth(RightColumnWidth)
+                    .defaultValue(origSpot.motion.type)
+                    .tooltip("Linear: The position changes with the given velocity.\nOscillation: The linear motion is superimposed by a periodic "
+                             "oscillation.\nKeyframes: The position is interpolated between the keyframes which are defined in the settings file."),
+                spot.motion.type);
+            if (spot.motion.type == ParameterMotionType_Oscillation) {
+                AlienImGui::SliderFloat(
+                    AlienImGui::SliderFloatParameters()
+                        .name("Amplitude X")
+                        .textWidth(RightColumnWidth)
+                        .min(0)
+                        .max(toFloat(worldSize.x) / 2)
+                        .format("%.1f")
+                        .defaultValue(&origSpot.motion.oscillation.amplitudeX),
+                    &spot.motion.oscillation.amplitudeX);
+                AlienImGui::SliderFloat(
+                    AlienImGui::SliderFloatParameters()
+                        .name("Amplitude Y")
+                        .textWidth(RightColumnWidth)
+                        .min(0)
+                        .max(toFloat(worldSize.y) / 2)
+                        .format("%.1f")
+                        .defaultValue(&origSpot.motion.oscillation.amplitudeY),
+                    &spot.motion.oscillation.amplitudeY);
+                AlienImGui::SliderFloat(
+                    AlienImGui::SliderFloatParameters()
+                        .name("Period")
+                        .textWidth(RightColumnWidth)
+                        .min(10.0f)
+                        .max(100000.0f)
+                        .logarithmic(true)
+                        .format("%.0f")
+                        .defaultValue(&origSpot.motion.oscillation.period)
+                        .tooltip("Duration of an oscillation in time steps."),
+                    &spot.motion.oscillation.period);
+                AlienImGui::SliderFloat(
+                    AlienImGui::SliderFloatParameters()
+                        .name("Phase")
+                        .textWidth(RightColumnWidth)
+                        .min(0)
+                        .max(360.0f)
+                        .format("%.1f")
+                        .defaultValue(&origSpot.motion.oscillation.phase),
+                    &spot.motion.oscillation.phase);
+            }
             auto maxRadius = toFloat(std::min(worldSize.x, worldSize.y));
             if (spot.shapeType == SpotShapeType_Circular) {
                 AlienImGui::SliderFloat(
@@ -1900,4 +1949,5 @@ void _SimulationParametersWindow::validationAndCorrection(SimulationParametersSp
         spot.values.radiationAbsorption[i] = std::max(0.0f, std::min(1.0f, spot.values.radiationAbsorption[i]));
     }
     spot.values.cellMaxBindingEnergy = std::max(10.0f, spot.values.cellMaxBindingEnergy);
+    spot.motion.oscillation.period = std::max(1.0f, spot.motion.oscillation.period);
 }
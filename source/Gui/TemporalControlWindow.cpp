@@ -221,8 +221,10 @@ void _TemporalControlWindow::restorePosition(MovedObjectType& movedObject, Moved
     auto movedObjectClone = movedObject;
 
     if (std::abs(movedObject.velX) > NEAR_ZERO || std::abs(movedObject.velY) > NEAR_ZERO || std::abs(origMovedObject.velX) > NEAR_ZERO
-        || std::abs(origMovedObject.velY) > NEAR_ZERO) {
+        || std::abs(origMovedObject.velY) > NEAR_ZERO || movedObject.motion.type != ParameterMotionType_Linear
+        || origMovedObject.motion.type != ParameterMotionType_Linear) {
         movedObject.posX = origMovedObject.posX;
         movedObject.posY = origMovedObject.posY;
+        movedObject.motion.oscillation.phase = origMovedObject.motion.oscillation.phase;
     }
 }
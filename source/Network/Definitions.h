@@ -0,0 +1,9 @@
+#pragma once
+
+#include "Base/Definitions.h"
+
+class _HttpRequestQueue;
+using HttpRequestQueue = std::shared_ptr<_HttpRequestQueue>;
+
+class _DownloadCache;
+using DownloadCache = std::shared_ptr<_DownloadCache>;
@@ -0,0 +1,220 @@
+#include "DownloadCache.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include <boost/property_tree/json_parser.hpp>
+
+#include "Base/LoggingService.h"
+
+namespace
+{
+    auto const IndexFilename = "index.json";
+
+    //file names must be stable across program runs, therefore std::hash is not used
+    std::string calcFilename(std::string const& id, std::string const& contentKey)
+    {
+        uint64_t hash = 14695981039346656037ull;  //FNV-1a
+        for (auto const& c : id + '\n' + contentKey) {
+            hash = (hash ^ static_cast<uint8_t>(c)) * 1099511628211ull;
+        }
+        std::stringstream stream;
+        stream << std::hex << std::setw(16) << std::setfill('0') << hash << ".cache";
+        return stream.str();
+    }
+
+    //layout of a cache file: sizes of the three parts followed by the parts
+    bool writeCacheFile(std::filesystem::path const& path, SerializedSimulation const& data)
+    {
+        std::ofstream stream(path, std::ios::binary);
+        for (auto const& part : {&data.mainData, &data.auxiliaryData, &data.statistics}) {
+            uint64_t size = part->size();
+            stream.write(reinterpret_cast<char const*>(&size), sizeof(size));
+        }
+        for (auto const& part : {&data.mainData, &data.auxiliaryData, &data.statistics}) {
+            stream.write(part->data(), part->size());
+        }
+        return static_cast<bool>(stream);
+    }
+
+    std::optional<SerializedSimulation> readCacheFile(std::filesystem::path const& path, uint64_t fileSize)
+    {
+        std::ifstream stream(path, std::ios::binary);
+        uint64_t sizes[3];
+        stream.read(reinterpret_cast<char*>(sizes), sizeof(sizes));
+        if (!stream || sizes[0] + sizes[1] + sizes[2] + sizeof(sizes) != fileSize) {
+            return std::nullopt;
+        }
+        SerializedSimulation result;
+        auto parts = {&result.mainData, &result.auxiliaryData, &result.statistics};
+        auto sizeIndex = 0;
+        for (auto const& part : parts) {
+            part->resize(sizes[sizeIndex++]);
+            stream.read(part->data(), part->size());
+        }
+        if (!stream) {
+            return std::nullopt;
+        }
+        return result;
+    }
+}
+
+_DownloadCache::_DownloadCache(std::string const& directory, uint64_t maxSize)
+    : _directory(directory)
+    , _maxSize(maxSize)
+{
+    try {
+        std::filesystem::create_directories(_directory);
+        readIndex();
+        evict(0);
+    } catch (...) {
+        log(Priority::Important, "download cache: could not read index");
+        _entryById.clear();
+    }
+}
+
+uint64_t _DownloadCache::getMaxSize() const
+{
+    return _maxSize;
+}
+
+void _DownloadCache::setMaxSize(uint64_t value)
+{
+    _maxSize = value;
+    evict(0);
+    writeIndex();
+}
+
+std::optional<SerializedSimulation> _DownloadCache::find(std::string const& id, std::string const& contentKey)
+{
+    auto findResult = _entryById.find(id);
+    if (findResult == _entryById.end()) {
+        return std::nullopt;
+    }
+    auto& entry = findResult->second;
+    if (entry.contentKey != contentKey) {
+        log(Priority::Important, "download cache: entry for id=" + id + " is outdated");
+        removeEntry(id);
+        writeIndex();
+        return std::nullopt;
+    }
+
+    std::optional<SerializedSimulation> result;
+    try {
+        result = readCacheFile(_directory / entry.filename, entry.size);
+    } catch (...) {
+    }
+    if (!result) {
+        log(Priority::Important, "download cache: entry for id=" + id + " is corrupt");
+        removeEntry(id);
+    } else {
+        entry.lastAccess = ++_accessCounter;
+    }
+    writeIndex();
+    return result;
+}
+
+void _DownloadCache::insert(std::string const& id, std::string const& contentKey, SerializedSimulation const& data)
+{
+    removeEntry(id);
+
+    Entry entry;
+    entry.contentKey = contentKey;
+    entry.filename = calcFilename(id, contentKey);
+    entry.size = sizeof(uint64_t) * 3 + data.mainData.size() + data.auxiliaryData.size() + data.statistics.size();
+    entry.lastAccess = ++_accessCounter;
+    if (entry.size > _maxSize) {
+        return;
+    }
+    evict(entry.size);
+
+    try {
+        if (!writeCacheFile(_directory / entry.filename, data)) {
+            std::filesystem::remove(_directory / entry.filename);
+            log(Priority::Important, "download cache: could not write entry for id=" + id);
+            return;
+        }
+    } catch (...) {
+        log(Priority::Important, "download cache: could not write entry for id=" + id);
+        return;
+    }
+    _entryById.emplace(id, entry);
+    writeIndex();
+}
+
+void _DownloadCache::readIndex()
+{
+    _entryById.clear();
+    auto indexPath = _directory / IndexFilename;
+    if (!std::filesystem::exists(indexPath)) {
+        return;
+    }
+    boost::property_tree::ptree tree;
+    boost::property_tree::read_json(indexPath.string(), tree);
+    _accessCounter = tree.get<uint64_t>("access counter");
+    for (auto const& [key, subTree] : tree.get_child("entries")) {
+        Entry entry;
+        entry.contentKey = subTree.get<std::string>("content key");
+        entry.filename = subTree.get<std::string>("file");
+        entry.size = subTree.get<uint64_t>("size");
+        entry.lastAccess = subTree.get<uint64_t>("last access");
+        if (std::filesystem::exists(_directory / entry.filename)) {
+            _entryById.emplace(subTree.get<std::string>("id"), entry);
+        }
+    }
+}
+
+void _DownloadCache::writeIndex() const
+{
+    try {
+        boost::property_tree::ptree tree;
+        tree.put("access counter", _accessCounter);
+        boost::property_tree::ptree entriesTree;
+        for (auto const& [id, entry] : _entryById) {
+            boost::property_tree::ptree entryTree;
+            entryTree.put("id", id);
+            entryTree.put("content key", entry.contentKey);
+            entryTree.put("file", entry.filename);
+            entryTree.put("size", entry.size);
+            entryTree.put("last access", entry.lastAccess);
+            entriesTree.push_back(std::make_pair("", entryTree));
+        }
+        tree.add_child("entries", entriesTree);
+        boost::property_tree::write_json((_directory / IndexFilename).string(), tree);
+    } catch (...) {
+        log(Priority::Important, "download cache: could not write index");
+    }
+}
+
+void _DownloadCache::removeEntry(std::string const& id)
+{
+    auto findResult = _entryById.find(id);
+    if (findResult == _entryById.end()) {
+        return;
+    }
+    std::error_code errorCode;
+    std::filesystem::remove(_directory / findResult->second.filename, errorCode);
+    _entryById.erase(findResult);
+}
+
+void _DownloadCache::evict(uint64_t requiredSize)
+{
+    auto totalSize = getTotalSize();
+    while (!_entryById.empty() && totalSize + requiredSize > _maxSize) {
+        auto leastRecentlyUsed = std::min_element(
+            _entryById.begin(), _entryById.end(), [](auto const& left, auto const& right) { return left.second.lastAccess < right.second.lastAccess; });
+        totalSize -= leastRecentlyUsed->second.size;
+        removeEntry(leastRecentlyUsed->first);
+    }
+}
+
+uint64_t _DownloadCache::getTotalSize() const
+{
+    uint64_t result = 0;
+    for (auto const& [id, entry] : _entryById) {
+        result += entry.size;
+    }
+    return result;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include "EngineInterface/SerializerService.h"
+
+#include "Definitions.h"
+
+/**
+ * On-disk cache for downloaded simulations and genomes with least-recently-used eviction.
+ * Entries are addressed by the id of the remote data and a content key which changes whenever the content changes
+ * (e.g. timestamp and size from the browser list). A lookup with another content key than the stored one
+ * invalidates the entry.
+ * All methods are called from the UI thread.
+ */
+class _DownloadCache
+{
+public:
+    _DownloadCache(std::string const& directory, uint64_t maxSize);
+
+    uint64_t getMaxSize() const;
+    void setMaxSize(uint64_t value);  //in bytes
+
+    std::optional<SerializedSimulation> find(std::string const& id, std::string const& contentKey);
+    void insert(std::string const& id, std::string const& contentKey, SerializedSimulation const& data);
+
+private:
+    struct Entry
+    {
+        std::string contentKey;
+        std::string filename;
+        uint64_t size = 0;
+        uint64_t lastAccess = 0;
+    };
+
+    void readIndex();
+    void writeIndex() const;
+    void removeEntry(std::string const& id);
+    void evict(uint64_t requiredSize);
+    uint64_t getTotalSize() const;
+
+    std::filesystem::path _directory;
+    uint64_t _maxSize = 0;
+    uint64_t _accessCounter = 0;
+    std::unordered_map<std::string, Entry> _entryById;
+};
@@ -0,0 +1,231 @@
+#include "HttpRequestQueue.h"
+
+#include <algorithm>
+
+#define CPPHTTPLIB_OPENSSL_SUPPORT
+#include <cpp-httplib/httplib.h>
+
+namespace
+{
+    auto constexpr MaxAttempts = 5;
+    auto constexpr RetryDelay = 100;  //in milliseconds
+
+    std::unique_ptr<httplib::Client> createClient(std::string const& serverAddress)
+    {
+        auto isSchemeSpecified = serverAddress.find("://") != std::string::npos;
+        auto result = std::make_unique<httplib::Client>(isSchemeSpecified ? serverAddress : "https://" + serverAddress);
+        if (!isSchemeSpecified || serverAddress.starts_with("https://")) {
+            result->set_ca_cert_path("./resources/ca-bundle.crt");
+            result->enable_server_certificate_verification(true);
+        }
+        result->set_keep_alive(true);
+        return result;
+    }
+
+    httplib::Result sendRequest(httplib::Client& client, HttpRequest const& request, std::atomic<bool> const& cancelled)
+    {
+        httplib::Params params(request.params.begin(), request.params.end());
+        if (request.method == HttpMethod::Get) {
+            return client.Get(request.path.c_str(), params, {}, [&](uint64_t, uint64_t) { return !cancelled.load(); });
+        }
+        if (!request.formDataItems.empty()) {
+            httplib::MultipartFormDataItems items;
+            for (auto const& item : request.formDataItems) {
+                items.push_back({item.name, item.content, "", item.contentType});
+            }
+            return client.Post(request.path.c_str(), items);
+        }
+        return client.Post(request.path.c_str(), params);
+    }
+
+    HttpResponse executeRequest(httplib::Client& client, HttpRequest const& request, std::atomic<bool> const& cancelled)
+    {
+        for (int attempt = 1; !cancelled; ++attempt) {
+            auto result = sendRequest(client, request, cancelled);
+            if (result && !cancelled) {
+                return result->body;
+            }
+            if (attempt == MaxAttempts || !request.withRetry) {
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(RetryDelay));
+        }
+        return std::nullopt;
+    }
+}
+
+std::string HttpRequest::getKey() const
+{
+    std::string result = (method == HttpMethod::Get ? "GET " : "POST ") + path;
+    for (auto const& [key, value] : params) {
+        result += "\n" + key + "=" + value;
+    }
+    for (auto const& item : formDataItems) {
+        result += "\n" + item.name + ":" + item.contentType + "=" + item.content;
+    }
+    return result;
+}
+
+_HttpRequestQueue::_HttpRequestQueue(std::string const& serverAddress, int numWorkers)
+    : _serverAddress(serverAddress)
+{
+    for (int i = 0; i < numWorkers; ++i) {
+        _threads.emplace_back(&_HttpRequestQueue::workerThread, this);
+    }
+}
+
+_HttpRequestQueue::~_HttpRequestQueue()
+{
+    cancelAll();
+    {
+        std::unique_lock lock(_mutex);
+        _shutdown = true;
+        _conditionVariable.notify_all();
+    }
+    for (auto& thread : _threads) {
+        thread.join();
+    }
+}
+
+void _HttpRequestQueue::setServerAddress(std::string const& value)
+{
+    cancelAll();
+
+    std::unique_lock lock(_mutex);
+    _serverAddress = value;
+    ++_serverAddressVersion;
+}
+
+HttpRequestHandle _HttpRequestQueue::execute(HttpRequest const& request)
+{
+    std::unique_lock lock(_mutex);
+
+    auto handleId = _nextHandleId++;
+
+    std::string key;
+    if (request.deduplicate) {
+        key = request.getKey();
+        auto findResult = _pendingEntriesByKey.find(key);
+        if (findResult != _pendingEntriesByKey.end()) {
+            auto const& entry = findResult->second;
+            entry->handleIds.emplace_back(handleId);
+            _pendingEntriesByHandleId.emplace(handleId, entry);
+            return HttpRequestHandle{handleId, entry->response};
+        }
+    }
+
+    auto entry = std::make_shared<Entry>();
+    entry->request = request;
+    entry->key = key;
+    entry->response = entry->promise.get_future().share();
+    entry->handleIds.emplace_back(handleId);
+
+    _queue.emplace_back(entry);
+    _pendingEntriesByHandleId.emplace(handleId, entry);
+    if (request.deduplicate) {
+        _pendingEntriesByKey.emplace(key, entry);
+    }
+    _conditionVariable.notify_one();
+    return HttpRequestHandle{handleId, entry->response};
+}
+
+void _HttpRequestQueue::cancel(uint64_t handleId)
+{
+    SharedEntry queuedEntry;
+    {
+        std::unique_lock lock(_mutex);
+        auto findResult = _pendingEntriesByHandleId.find(handleId);
+        if (findResult == _pendingEntriesByHandleId.end()) {
+            return;
+        }
+        auto entry = findResult->second;
+        _pendingEntriesByHandleId.erase(findResult);
+        std::erase(entry->handleIds, handleId);
+
+        //other callers still wait for the response
+        if (!entry->handleIds.empty()) {
+            return;
+        }
+        entry->cancelled = true;
+        removeFromPendingEntriesByKey(entry);
+
+        auto queuePos = std::find(_queue.begin(), _queue.end(), entry);
+        if (queuePos != _queue.end()) {
+            _queue.erase(queuePos);
+            queuedEntry = entry;
+        }
+    }
+
+    //running requests are finished by their worker
+    if (queuedEntry) {
+        finishEntry(queuedEntry, std::nullopt);
+    }
+}
+
+void _HttpRequestQueue::cancelAll()
+{
+    std::vector<uint64_t> handleIds;
+    {
+        std::unique_lock lock(_mutex);
+        for (auto const& [id, entry] : _pendingEntriesByHandleId) {
+            handleIds.emplace_back(id);
+        }
+    }
+    for (auto const& id : handleIds) {
+        cancel(id);
+    }
+}
+
+void _HttpRequestQueue::workerThread()
+{
+    std::unique_ptr<httplib::Client> client;
+    std::optional<uint64_t> clientServerAddressVersion;
+    while (true) {
+        SharedEntry entry;
+        std::string serverAddress;
+        uint64_t serverAddressVersion;
+        {
+            std::unique_lock lock(_mutex);
+            _conditionVariable.wait(lock, [this] { return !_queue.empty() || _shutdown; });
+            if (_shutdown) {
+                return;
+            }
+            entry = _queue.front();
+            _queue.pop_front();
+            serverAddress = _serverAddress;
+            serverAddressVersion = _serverAddressVersion;
+        }
+
+        //the connection is reused as long as the server address does not change
+        if (!client || clientServerAddressVersion != serverAddressVersion) {
+            client = createClient(serverAddress);
+            clientServerAddressVersion = serverAddressVersion;
+        }
+        auto response = executeRequest(*client, entry->request, entry->cancelled);
+        finishEntry(entry, entry->cancelled ? std::nullopt : response);
+    }
+}
+
+void _HttpRequestQueue::finishEntry(SharedEntry const& entry, HttpResponse const& response)
+{
+    {
+        std::unique_lock lock(_mutex);
+        for (auto const& handleId : entry->handleIds) {
+            _pendingEntriesByHandleId.erase(handleId);
+        }
+        entry->handleIds.clear();
+        removeFromPendingEntriesByKey(entry);
+    }
+    entry->promise.set_value(response);
+}
+
+void _HttpRequestQueue::removeFromPendingEntriesByKey(SharedEntry const& entry)
+{
+    if (entry->key.empty()) {
+        return;
+    }
+    auto findResult = _pendingEntriesByKey.find(entry->key);
+    if (findResult != _pendingEntriesByKey.end() && findResult->second == entry) {
+        _pendingEntriesByKey.erase(findResult);
+    }
+}
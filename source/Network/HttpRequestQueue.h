@@ -0,0 +1,97 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "Definitions.h"
+
+enum class HttpMethod
+{
+    Get,
+    Post
+};
+
+struct HttpFormDataItem
+{
+    std::string name;
+    std::string content;
+    std::string contentType;
+};
+
+struct HttpRequest
+{
+    HttpMethod method = HttpMethod::Post;
+    std::string path;
+    std::vector<std::pair<std::string, std::string>> params;
+    std::vector<HttpFormDataItem> formDataItems;  //if not empty, a multipart POST request is sent instead of the params
+    bool withRetry = true;
+    bool deduplicate = false;  //only for requests without side effects: an identical pending request is reused
+
+    std::string getKey() const;
+};
+
+using HttpResponse = std::optional<std::string>;  //body, std::nullopt if the request failed or was cancelled
+
+//each call of _HttpRequestQueue::execute returns its own handle id, also for deduplicated requests
+struct HttpRequestHandle
+{
+    uint64_t id = 0;
+    std::shared_future<HttpResponse> response;
+};
+
+/**
+ * Executes HTTP requests on background workers.
+ * Each worker keeps its connection to the server alive between requests.
+ * The server address may contain a scheme (e.g. "http://localhost:8080" for a local test server), otherwise https is used.
+ */
+class _HttpRequestQueue
+{
+public:
+    _HttpRequestQueue(std::string const& serverAddress, int numWorkers = 2);
+    ~_HttpRequestQueue();
+
+    //cancels all pending requests
+    void setServerAddress(std::string const& value);
+
+    HttpRequestHandle execute(HttpRequest const& request);
+
+    //a cancelled request is answered with std::nullopt, requests which are already sent are not retried
+    //a deduplicated request is only cancelled when the handles of all its callers are cancelled
+    void cancel(uint64_t handleId);
+    void cancelAll();
+
+private:
+    struct Entry
+    {
+        HttpRequest request;
+        std::string key;
+        std::promise<HttpResponse> promise;
+        std::shared_future<HttpResponse> response;
+        std::vector<uint64_t> handleIds;  //handles which are not cancelled
+        std::atomic<bool> cancelled = false;
+    };
+    using SharedEntry = std::shared_ptr<Entry>;
+
+    void workerThread();
+    void finishEntry(SharedEntry const& entry, HttpResponse const& response);
+    void removeFromPendingEntriesByKey(SharedEntry const& entry);  //a cancelled request is not reused for new requests
+
+    std::mutex _mutex;
+    std::condition_variable _conditionVariable;
+    std::string _serverAddress;
+    uint64_t _serverAddressVersion = 0;
+    uint64_t _nextHandleId = 1;
+    std::deque<SharedEntry> _queue;
+    std::unordered_map<uint64_t, SharedEntry> _pendingEntriesByHandleId;  //queued and running requests
+    std::unordered_map<std::string, SharedEntry> _pendingEntriesByKey;  //only requests to be deduplicated
+    bool _shutdown = false;
+    std::vector<std::thread> _threads;
+};
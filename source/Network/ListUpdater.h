@@ -0,0 +1,51 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+//applies a list received from the server to the list already shown such that unchanged entries need not be processed again
+class ListUpdater
+{
+public:
+    //entries are identified by getKey, remaining entries keep their order and new entries are appended
+    //returns true if something has changed
+    template <typename T, typename KeyFunc>
+    static bool update(std::vector<T>& list, std::vector<T>&& newList, KeyFunc const& getKey)
+    {
+        std::unordered_map<std::string, size_t> newIndexByKey;
+        for (size_t i = 0; i < newList.size(); ++i) {
+            newIndexByKey.emplace(getKey(newList[i]), i);
+        }
+
+        auto changed = false;
+        std::vector<bool> isContained(newList.size(), false);
+        size_t numRemaining = 0;
+        for (size_t i = 0; i < list.size(); ++i) {
+            auto findResult = newIndexByKey.find(getKey(list[i]));
+            if (findResult == newIndexByKey.end() || isContained[findResult->second]) {
+                changed = true;
+                continue;
+            }
+            isContained[findResult->second] = true;
+            auto& newEntry = newList[findResult->second];
+            if (numRemaining != i) {
+                list[numRemaining] = std::move(list[i]);
+            }
+            if (!(list[numRemaining] == newEntry)) {
+                list[numRemaining] = std::move(newEntry);
+                changed = true;
+            }
+            ++numRemaining;
+        }
+        list.resize(numRemaining);
+
+        for (size_t i = 0; i < newList.size(); ++i) {
+            if (!isContained[i]) {
+                list.emplace_back(std::move(newList[i]));
+                changed = true;
+            }
+        }
+        return changed;
+    }
+};
@@ -0,0 +1,128 @@
+#include "NetworkDataParser.h"
+
+#include <stdexcept>
+
+#include "Base/JsonReader.h"
+
+namespace
+{
+    bool toBool(std::string const& value)
+    {
+        if (value == "true" || value == "1") {
+            return true;
+        }
+        if (value == "false" || value == "0") {
+            return false;
+        }
+        throw std::runtime_error("Invalid boolean value.");
+    }
+
+    //the entries of the lists may be given as array or as object with arbitrary keys
+    template <typename Func>
+    void forEachEntry(JsonReader& reader, Func const& func)
+    {
+        std::string key;
+        if (reader.isArray()) {
+            reader.beginArray();
+            while (reader.nextElement()) {
+                func(std::string());
+            }
+        } else {
+            reader.beginObject();
+            while (reader.nextMember(key)) {
+                func(key);
+            }
+        }
+    }
+
+    void readLikesByType(JsonReader& reader, RemoteSimulationData& entry)
+    {
+        int counter = 0;
+        forEachEntry(reader, [&](std::string const& likeTypeString) {
+            auto likes = std::stoi(reader.readScalar());
+            auto likeType = likeTypeString.empty() ? counter : std::stoi(likeTypeString);
+            entry.numLikesByEmojiType[likeType] = likes;
+            ++counter;
+        });
+    }
+}
+
+std::vector<RemoteSimulationData> NetworkDataParser::decodeRemoteSimulationData(std::string_view const& json)
+{
+    std::vector<RemoteSimulationData> result;
+    JsonReader reader(json);
+    std::string key;
+    forEachEntry(reader, [&](std::string const&) {
+        RemoteSimulationData entry;
+        reader.beginObject();
+        while (reader.nextMember(key)) {
+            if (key == "id") {
+                entry.id = reader.readScalar();
+            } else if (key == "userName") {
+                entry.userName = reader.readScalar();
+            } else if (key == "simulationName") {
+                entry.simName = reader.readScalar();
+            } else if (key == "description") {
+                entry.description = reader.readScalar();
+            } else if (key == "width") {
+                entry.width = std::stoi(reader.readScalar());
+            } else if (key == "height") {
+                entry.height = std::stoi(reader.readScalar());
+            } else if (key == "particles") {
+                entry.particles = std::stoi(reader.readScalar());
+            } else if (key == "version") {
+                entry.version = reader.readScalar();
+            } else if (key == "timestamp") {
+                entry.timestamp = reader.readScalar();
+            } else if (key == "contentSize") {
+                entry.contentSize = std::stoll(reader.readScalar());
+            } else if (key == "likesByType") {
+                readLikesByType(reader, entry);
+            } else if (key == "numDownloads") {
+                entry.numDownloads = std::stoi(reader.readScalar());
+            } else if (key == "fromRelease") {
+                entry.fromRelease = std::stoi(reader.readScalar()) == 1;
+            } else if (key == "type") {
+                entry.type = std::stoi(reader.readScalar());
+            } else {
+                reader.skipValue();
+            }
+        }
+        result.emplace_back(std::move(entry));
+    });
+    return result;
+}
+
+std::vector<UserData> NetworkDataParser::decodeUserData(std::string_view const& json)
+{
+    std::vector<UserData> result;
+    JsonReader reader(json);
+    std::string key;
+    forEachEntry(reader, [&](std::string const&) {
+        UserData entry;
+        reader.beginObject();
+        while (reader.nextMember(key)) {
+            if (key == "userName") {
+                entry.userName = reader.readScalar();
+            } else if (key == "starsReceived") {
+                entry.starsReceived = std::stoi(reader.readScalar());
+            } else if (key == "starsGiven") {
+                entry.starsGiven = std::stoi(reader.readScalar());
+            } else if (key == "timestamp") {
+                entry.timestamp = reader.readScalar();
+            } else if (key == "online") {
+                entry.online = toBool(reader.readScalar());
+            } else if (key == "lastDayOnline") {
+                entry.lastDayOnline = toBool(reader.readScalar());
+            } else if (key == "timeSpent") {
+                entry.timeSpent = std::stoi(reader.readScalar());
+            } else if (key == "gpu") {
+                entry.gpu = reader.readScalar();
+            } else {
+                reader.skipValue();
+            }
+        }
+        result.emplace_back(std::move(entry));
+    });
+    return result;
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <string_view>
+#include <vector>
+
+#include "RemoteSimulationData.h"
+#include "UserData.h"
+
+//decodes the server responses directly from the JSON text without building a property tree
+class NetworkDataParser
+{
+public:
+    static std::vector<RemoteSimulationData> decodeRemoteSimulationData(std::string_view const& json);
+    static std::vector<UserData> decodeUserData(std::string_view const& json);
+};
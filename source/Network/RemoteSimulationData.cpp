@@ -0,0 +1,67 @@
+#include "RemoteSimulationData.h"
+
+#include <ranges>
+
+int RemoteSimulationData::compareByColumn(RemoteSimulationData const& left, RemoteSimulationData const& right, int columnId)
+{
+    switch (columnId) {
+    case RemoteSimulationDataColumnId_Timestamp:
+        return left.timestamp.compare(right.timestamp);
+    case RemoteSimulationDataColumnId_UserName:
+        return left.userName.compare(right.userName);
+    case RemoteSimulationDataColumnId_SimulationName:
+        return left.simName.compare(right.simName);
+    case RemoteSimulationDataColumnId_Description:
+        return left.description.compare(right.description);
+    case RemoteSimulationDataColumnId_Likes:
+        return left.getTotalLikes() - right.getTotalLikes();
+    case RemoteSimulationDataColumnId_NumDownloads:
+        return left.numDownloads - right.numDownloads;
+    case RemoteSimulationDataColumnId_Width:
+        return left.width - right.width;
+    case RemoteSimulationDataColumnId_Height:
+        return left.height - right.height;
+    case RemoteSimulationDataColumnId_Particles:
+        return left.particles - right.particles;
+    case RemoteSimulationDataColumnId_FileSize:
+        return static_cast<int>(left.contentSize / 1024) - static_cast<int>(right.contentSize / 1024);
+    case RemoteSimulationDataColumnId_Version:
+        return left.version.compare(right.version);
+    }
+    return 0;
+}
+
+bool RemoteSimulationData::matchWithFilter(std::string const& filter) const
+{
+    return getFilterText().find(filter) != std::string::npos;
+}
+
+std::string RemoteSimulationData::getFilterText() const
+{
+    //fields are separated by '\0' such that a filter cannot match across field boundaries
+    std::string result;
+    for (auto const& field :
+         {timestamp,
+          userName,
+          simName,
+          std::to_string(numDownloads),
+          std::to_string(width),
+          std::to_string(height),
+          std::to_string(particles),
+          std::to_string(contentSize),
+          description,
+          version}) {
+        result += field;
+        result += '\0';
+    }
+    return result;
+}
+
+int RemoteSimulationData::getTotalLikes() const
+{
+    int result = 0;
+    for (auto const& numReactions : numLikesByEmojiType | std::views::values) {
+        result += numReactions;
+    }
+    return result;
+}
@@ -3,8 +3,6 @@
 #include <string>
 #include <map>
 
-class ImGuiTableSortSpecs;
-
 enum RemoteSimulationDataColumnId
 {
     RemoteSimulationDataColumnId_Timestamp,
@@ -18,7 +16,8 @@ enum RemoteSimulationDataColumnId
     RemoteSimulationDataColumnId_Particles,
     RemoteSimulationDataColumnId_FileSize,
     RemoteSimulationDataColumnId_Version,
-    RemoteSimulationDataColumnId_Actions
+    RemoteSimulationDataColumnId_Actions,
+    RemoteSimulationDataColumnId_Count
 };
 
 using RemoteDataType = int;
@@ -36,18 +35,21 @@ public:
     std::string userName;
     std::string simName;
     std::map<int, int> numLikesByEmojiType;
-    int numDownloads;
-    int width;
-    int height;
-    int particles;
-    uint64_t contentSize;
+    int numDownloads = 0;
+    int width = 0;
+    int height = 0;
+    int particles = 0;
+    uint64_t contentSize = 0;
     std::string description;
     std::string version;
-    bool fromRelease;
-    RemoteDataType type;
+    bool fromRelease = false;
+    RemoteDataType type = RemoteDataType_Simulation;
+
+    bool operator==(RemoteSimulationData const&) const = default;
 
-    static int compare(void const* left, void const* right, ImGuiTableSortSpecs const* specs);
+    static int compareByColumn(RemoteSimulationData const& left, RemoteSimulationData const& right, int columnId);
     bool matchWithFilter(std::string const& filter) const;
+    std::string getFilterText() const;
 
     int getTotalLikes() const;
 };
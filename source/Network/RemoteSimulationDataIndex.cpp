@@ -0,0 +1,138 @@
+#include "RemoteSimulationDataIndex.h"
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+
+namespace
+{
+    auto constexpr MaxNgramSize = 3;
+
+    //n-grams of different sizes are distinguished by the size in the upper byte
+    uint32_t getNgram(std::string const& text, size_t pos, size_t size)
+    {
+        uint32_t result = static_cast<uint32_t>(size) << 24;
+        for (size_t i = 0; i < size; ++i) {
+            result |= static_cast<uint32_t>(static_cast<uint8_t>(text[pos + i])) << (i * 8);
+        }
+        return result;
+    }
+}
+
+void RemoteSimulationDataIndex::rebuild(std::vector<RemoteSimulationData> const& entries)
+{
+    _filterTexts.clear();
+    _filterTexts.reserve(entries.size());
+    _entryIndicesByNgram.clear();
+    for (auto const& entry : entries) {
+        auto entryIndex = static_cast<int>(_filterTexts.size());
+        auto const& text = _filterTexts.emplace_back(entry.getFilterText());
+        for (size_t size = 1; size <= MaxNgramSize; ++size) {
+            for (size_t pos = 0; pos + size <= text.size(); ++pos) {
+                auto& entryIndices = _entryIndicesByNgram[getNgram(text, pos, size)];
+                if (entryIndices.empty() || entryIndices.back() != entryIndex) {
+                    entryIndices.emplace_back(entryIndex);
+                }
+            }
+        }
+    }
+
+    _sortedEntryIndicesByColumn.resize(RemoteSimulationDataColumnId_Count);
+    _ranksByColumn.resize(RemoteSimulationDataColumnId_Count);
+    for (int columnId = 0; columnId < RemoteSimulationDataColumnId_Count; ++columnId) {
+        rebuildSortOrder(entries, columnId);
+    }
+}
+
+void RemoteSimulationDataIndex::rebuildSortOrder(std::vector<RemoteSimulationData> const& entries, int columnId)
+{
+    auto& sortedEntryIndices = _sortedEntryIndicesByColumn.at(columnId);
+    sortedEntryIndices.resize(entries.size());
+    std::iota(sortedEntryIndices.begin(), sortedEntryIndices.end(), 0);
+    std::sort(sortedEntryIndices.begin(), sortedEntryIndices.end(), [&](int left, int right) {
+        return RemoteSimulationData::compareByColumn(entries[left], entries[right], columnId) < 0;
+    });
+
+    auto& ranks = _ranksByColumn.at(columnId);
+    ranks.resize(entries.size());
+    int rank = 0;
+    for (size_t i = 0; i < sortedEntryIndices.size(); ++i) {
+        if (i > 0 && RemoteSimulationData::compareByColumn(entries[sortedEntryIndices[i - 1]], entries[sortedEntryIndices[i]], columnId) != 0) {
+            ++rank;
+        }
+        ranks[sortedEntryIndices[i]] = rank;
+    }
+}
+
+std::vector<int> RemoteSimulationDataIndex::filter(std::string const& filter) const
+{
+    if (filter.empty()) {
+        std::vector<int> result(_filterTexts.size());
+        std::iota(result.begin(), result.end(), 0);
+        return result;
+    }
+
+    //filters up to MaxNgramSize characters are answered directly by the posting list
+    if (filter.size() <= MaxNgramSize) {
+        auto findResult = _entryIndicesByNgram.find(getNgram(filter, 0, filter.size()));
+        return findResult != _entryIndicesByNgram.end() ? findResult->second : std::vector<int>();
+    }
+
+    std::vector<int> result;
+    std::vector<int> const* candidates = nullptr;
+    for (size_t pos = 0; pos + MaxNgramSize <= filter.size(); ++pos) {
+        auto findResult = _entryIndicesByNgram.find(getNgram(filter, pos, MaxNgramSize));
+        if (findResult == _entryIndicesByNgram.end()) {
+            return result;
+        }
+        if (!candidates || findResult->second.size() < candidates->size()) {
+            candidates = &findResult->second;
+        }
+    }
+    for (auto const& entryIndex : *candidates) {
+        if (_filterTexts[entryIndex].find(filter) != std::string::npos) {
+            result.emplace_back(entryIndex);
+        }
+    }
+    return result;
+}
+
+void RemoteSimulationDataIndex::sort(std::vector<int>& entryIndices, std::vector<SortSpec> const& sortSpecs) const
+{
+    if (sortSpecs.empty() || entryIndices.size() < 2) {
+        return;
+    }
+
+    //least significant column: pick the given entries from the presorted permutation
+    auto const& lastSortSpec = sortSpecs.back();
+    auto const& sortedEntryIndices = _sortedEntryIndicesByColumn.at(lastSortSpec.columnId);
+    std::vector<bool> selected(_filterTexts.size(), false);
+    for (auto const& entryIndex : entryIndices) {
+        selected[entryIndex] = true;
+    }
+    entryIndices.clear();
+    if (lastSortSpec.ascending) {
+        std::copy_if(sortedEntryIndices.begin(), sortedEntryIndices.end(), std::back_inserter(entryIndices), [&](int index) { return selected[index]; });
+    } else {
+        std::copy_if(sortedEntryIndices.rbegin(), sortedEntryIndices.rend(), std::back_inserter(entryIndices), [&](int index) { return selected[index]; });
+    }
+
+    //more significant columns: stable counting sorts by rank
+    std::vector<int> counts;
+    std::vector<int> sortedResult(entryIndices.size());
+    for (auto sortSpec = std::next(sortSpecs.rbegin()); sortSpec != sortSpecs.rend(); ++sortSpec) {
+        auto const& ranks = _ranksByColumn.at(sortSpec->columnId);
+        auto maxRank = ranks.empty() ? 0 : ranks[_sortedEntryIndicesByColumn.at(sortSpec->columnId).back()];
+        auto getKey = [&](int entryIndex) { return sortSpec->ascending ? ranks[entryIndex] : maxRank - ranks[entryIndex]; };
+
+        counts.assign(maxRank + 2, 0);
+        for (auto const& entryIndex : entryIndices) {
+            ++counts[getKey(entryIndex) + 1];
+        }
+        std::partial_sum(counts.begin(), counts.end(), counts.begin());
+        for (auto const& entryIndex : entryIndices) {
+            sortedResult[counts[getKey(entryIndex)]++] = entryIndex;
+        }
+        entryIndices.swap(sortedResult);
+    }
+}
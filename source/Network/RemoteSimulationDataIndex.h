@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "RemoteSimulationData.h"
+
+/**
+ * Index over a list of remote simulations/genomes for filtering and sorting without scanning or sorting the whole list.
+ * - Text filter: index of all 1-, 2- and 3-grams of RemoteSimulationData::getFilterText. Short filters are looked up directly,
+ *   for longer ones the candidates are taken from the shortest posting list of the filter's trigrams and then verified.
+ *   The result equals RemoteSimulationData::matchWithFilter.
+ * - Sorting: presorted permutation and rank arrays per column which are built once per list update.
+ *   Sorting a filtered list takes linear time per sort column.
+ * Entries are referred to by their index in the list passed to rebuild.
+ */
+class RemoteSimulationDataIndex
+{
+public:
+    struct SortSpec
+    {
+        int columnId = 0;
+        bool ascending = true;
+    };
+
+    void rebuild(std::vector<RemoteSimulationData> const& entries);
+    void rebuildSortOrder(std::vector<RemoteSimulationData> const& entries, int columnId);  //e.g. after likes have been changed locally
+
+    std::vector<int> filter(std::string const& filter) const;  //returns the indices of the matching entries in ascending order
+    void sort(std::vector<int>& entryIndices, std::vector<SortSpec> const& sortSpecs) const;
+
+private:
+    std::vector<std::string> _filterTexts;
+    std::unordered_map<uint32_t, std::vector<int>> _entryIndicesByNgram;
+
+    std::vector<std::vector<int>> _sortedEntryIndicesByColumn;
+    std::vector<std::vector<int>> _ranksByColumn;  //equal values have equal ranks
+};
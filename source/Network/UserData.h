@@ -5,14 +5,16 @@ class UserData
 {
 public:
     std::string userName;
-    int starsReceived;
-    int starsGiven;
+    int starsReceived = 0;
+    int starsGiven = 0;
     std::string timestamp;
-    bool online;
-    bool lastDayOnline;
-    int timeSpent;
+    bool online = false;
+    bool lastDayOnline = false;
+    int timeSpent = 0;
     std::string gpu;
 
+    bool operator==(UserData const&) const = default;
+
     static int compareOnlineAndTimestamp(UserData const& left, UserData const& right)
     {
         if (int result = static_cast<int>(left.online) - static_cast<int>(right.online)) {